@@ -0,0 +1,361 @@
+/*
+ * esmini - Environment Simulator Minimalistic
+ * https://github.com/esmini/esmini
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *
+ * Copyright (c) partners of Simulation Scenarios
+ * https://sites.google.com/view/simulationscenarios
+ */
+
+/*
+ * This application runs micro-benchmarks of selected esmini functions, without any viewer.
+ * Each benchmark prints its timings to stdout. Run from the bin folder, since default input
+ * files are referred relative to it.
+ */
+
+#include <clocale>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "CommonMini.hpp"
+#include "ControllerRel2Abs.hpp"
+#include "Entities.hpp"
+#include "RoadManager.hpp"
+#include "ScenarioEngine.hpp"
+
+#ifdef _USE_OSI
+#include "OSIReporter.hpp"
+#include "osi_groundtruth.pb.h"
+#endif
+
+using namespace scenarioengine;
+
+#define DEFAULT_LOOPS 20
+
+typedef struct
+{
+    const char* name;
+    const char* description;
+    int (*func)(const std::vector<std::string>& args, int n_loops);
+} Benchmark;
+
+// Reference free-space distance, as before the cached oriented bounding box:
+// SAT by projecting all corners, then brute force vertex to edge distance
+static double RefFreeSpaceDistance(Object& obj0, Object& obj1)
+{
+    double vertices[2][4][2];
+
+    for (int i = 0; i < 2; i++)
+    {
+        Object& obj     = i == 0 ? obj0 : obj1;
+        double  cx      = static_cast<double>(obj.boundingbox_.center_.x_);
+        double  cy      = static_cast<double>(obj.boundingbox_.center_.y_);
+        double  hl      = static_cast<double>(obj.boundingbox_.dimensions_.length_) / 2.0;
+        double  hw      = static_cast<double>(obj.boundingbox_.dimensions_.width_) / 2.0;
+        double  v[4][2] = {{cx + hl, cy + hw}, {cx - hl, cy + hw}, {cx - hl, cy - hw}, {cx + hl, cy - hw}};
+
+        for (int j = 0; j < 4; j++)
+        {
+            RotateVec2D(v[j][0], v[j][1], obj.pos_.GetH(), vertices[i][j][0], vertices[i][j][1]);
+            vertices[i][j][0] += obj.pos_.GetX();
+            vertices[i][j][1] += obj.pos_.GetY();
+        }
+    }
+
+    bool overlap = true;
+    for (int i = 0; i < 2 && overlap; i++)
+    {
+        for (int j = 0; j < 2 && overlap; j++)
+        {
+            double n[2];
+            RotateVec2D(j == 0 ? 0.0 : 1.0, j == 0 ? 1.0 : 0.0, (i == 0 ? obj0 : obj1).pos_.GetH(), n[0], n[1]);
+            double min[2], max[2];
+            for (int k = 0; k < 2; k++)
+            {
+                int b = (i + k) % 2;
+                for (int l = 0; l < 4; l++)
+                {
+                    double dot_p = GetDotProduct2D(vertices[b][l][0], vertices[b][l][1], n[0], n[1]);
+                    min[k]       = l == 0 ? dot_p : MIN(dot_p, min[k]);
+                    max[k]       = l == 0 ? dot_p : MAX(dot_p, max[k]);
+                }
+            }
+            if ((max[0] < min[1] - SMALL_NUMBER) || (min[0] > max[1] + SMALL_NUMBER))
+            {
+                overlap = false;
+            }
+        }
+    }
+
+    if (overlap)
+    {
+        return 0.0;
+    }
+
+    double minDist = LARGE_NUMBER;
+    for (int i = 0; i < 2; i++)
+    {
+        for (int j = 0; j < 4; j++)
+        {
+            for (int k = 0; k < 4; k++)
+            {
+                double(&e)[4][2] = vertices[(i + 1) % 2];
+                double xProj = 0.0, yProj = 0.0;
+                minDist = MIN(minDist,
+                              DistanceFromPointToEdge2D(vertices[i][j][0], vertices[i][j][1], e[k][0], e[k][1], e[(k + 1) % 4][0], e[(k + 1) % 4][1], &xProj, &yProj));
+            }
+        }
+    }
+
+    return minDist;
+}
+
+// Free-space distance between all pairs of randomly placed objects, reference vs cached bounding box
+static int FreeSpaceDistance(const std::vector<std::string>& args, int n_loops)
+{
+    unsigned int n_objects = args.size() > 0 ? static_cast<unsigned int>(strtoi(args[0])) : 100;
+
+    if (!roadmanager::Position::LoadOpenDrive("../resources/xodr/straight_500m.xodr"))
+    {
+        printf("Failed to load road network\n");
+        return -1;
+    }
+
+    std::mt19937                           gen(12345);
+    std::uniform_real_distribution<double> pos_dist(-15.0, 15.0);
+    std::uniform_real_distribution<double> h_dist(-M_PI, M_PI);
+    std::uniform_real_distribution<double> dim_dist(0.5, 10.0);
+    std::uniform_real_distribution<double> offset_dist(-2.0, 2.0);
+    std::vector<Object>                    objects(n_objects, Object(Object::Type::VEHICLE));
+
+    for (auto& obj : objects)
+    {
+        obj.boundingbox_.center_     = {static_cast<float>(offset_dist(gen)), static_cast<float>(offset_dist(gen)), 0.0f};
+        obj.boundingbox_.dimensions_ = {static_cast<float>(dim_dist(gen)), static_cast<float>(dim_dist(gen)), 1.5f};
+        obj.pos_.SetInertiaPos(pos_dist(gen), pos_dist(gen), h_dist(gen), false);
+    }
+
+    double         sum[2] = {0.0, 0.0};
+    SE_SystemTimer timer;
+
+    timer.Start();
+    for (int k = 0; k < n_loops; k++)
+    {
+        for (unsigned int i = 0; i < n_objects; i++)
+        {
+            for (unsigned int j = 0; j < n_objects; j++)
+            {
+                sum[0] += RefFreeSpaceDistance(objects[i], objects[j]);
+            }
+        }
+    }
+    double t_ref = timer.Elapsed();
+
+    timer.Start();
+    for (int k = 0; k < n_loops; k++)
+    {
+        for (unsigned int i = 0; i < n_objects; i++)
+        {
+            for (unsigned int j = 0; j < n_objects; j++)
+            {
+                double latDist  = 0.0;
+                double longDist = 0.0;
+                sum[1] += objects[i].FreeSpaceDistance(&objects[j], &latDist, &longDist);
+            }
+        }
+    }
+    double t_cached = timer.Elapsed();
+
+    printf("FreeSpaceDistance %u pairs: reference %.3f s, cached OBB %.3f s, sum diff %.2e\n",
+           static_cast<unsigned int>(n_loops) * n_objects * n_objects,
+           t_ref,
+           t_cached,
+           fabs(sum[0] - sum[1]));
+
+    return 0;
+}
+
+// Rel2Abs prediction time vs number of added objects, either close to ego or beyond the interaction radius
+static int Rel2AbsPrediction(const std::vector<std::string>& args, int n_loops)
+{
+    (void)args;
+    const char* filename      = "../EnvironmentSimulator/Unittest/xosc/rel2abs_prediction.xosc";
+    int         n_added[]     = {0, 10, 50, 100, 200, 400};
+    double      radius[2]     = {100.0, 0.0};
+    double      dt            = 0.1;
+    const char* placement[2]  = {"far", "near"};
+    int         n_predictions = 50 * n_loops;
+
+    printf("Rel2Abs %d predictions per case, interaction radius %.0f m vs unlimited\n", n_predictions, radius[0]);
+    printf("  added objects  total  | limited: predicted  time (ms) | unlimited: predicted  time (ms)\n");
+
+    for (int near = 0; near < 2; near++)
+    {
+        for (int n : n_added)
+        {
+            ScenarioEngine* se = new ScenarioEngine(filename);
+            if (se->GetInitStatus() != 0)
+            {
+                printf("Failed to load %s\n", filename);
+                delete se;
+                return -1;
+            }
+            se->step(dt);
+            se->prepareGroundTruth(dt);
+
+            // Ego is at s=20 on the 1000 m road, place objects within 100 m ahead or far beyond
+            for (int i = 0; i < n; i++)
+            {
+                Vehicle* vehicle = new Vehicle();
+                double   s       = near ? 25.0 + 90.0 * (i + 0.5) / n : 300.0 + 690.0 * (i + 0.5) / n;
+                vehicle->pos_.SetLanePos(1, -2 - i % 3, s, 0.0);
+                vehicle->SetSpeed(20.0);
+                vehicle->name_ = "bench_" + std::to_string(i);
+                se->entities_.addObject(vehicle, true);
+            }
+
+            ControllerRel2Abs* ctrl = static_cast<ControllerRel2Abs*>(se->scenarioReader->controller_[0]);
+            double             t_elapsed[2];
+            int                n_pred[2];
+            SE_SystemTimer     timer;
+
+            for (int i = 0; i < 2; i++)
+            {
+                ctrl->interaction_radius = radius[i];
+                timer.Start();
+                for (int k = 0; k < n_predictions; k++)
+                {
+                    ctrl->Predict(se->getSimulationTime());
+                }
+                t_elapsed[i] = timer.Elapsed();
+                n_pred[i]    = ctrl->GetNumberOfPredictedObjects();
+            }
+
+            printf("  %4s %4d      %5d  |          %5d  %9.0f  |            %5d  %9.0f\n",
+                   placement[near],
+                   n,
+                   static_cast<int>(se->entities_.object_.size()),
+                   n_pred[0],
+                   1e3 * t_elapsed[0],
+                   n_pred[1],
+                   1e3 * t_elapsed[1]);
+
+            delete se;
+        }
+    }
+
+    return 0;
+}
+
+#ifdef _USE_OSI
+// Static OSI ground truth (lanes, boundaries, junctions, signals) for the largest bundled road networks
+static int OSIStaticGroundTruth(const std::vector<std::string>& args, int n_loops)
+{
+    std::vector<std::string> filenames = {"../resources/xodr/multi_intersections.xodr",
+                                          "../resources/xodr/fabriksgatan.xodr",
+                                          "../resources/xodr/soderleden.xodr",
+                                          "../resources/xodr/e6mini.xodr"};
+
+    if (args.size() > 0)
+    {
+        filenames = args;
+    }
+
+    for (auto& filename : filenames)
+    {
+        if (!roadmanager::Position::LoadOpenDrive(filename.c_str()))
+        {
+            printf("Failed to load %s\n", filename.c_str());
+            return -1;
+        }
+
+        int            n_lanes = 0;
+        SE_SystemTimer timer;
+
+        // Timer resolution is too coarse for a single update, so time all loops together. A fresh reporter
+        // is needed each loop since static ground truth is accumulated in the reporter, its construction is
+        // negligible in comparison.
+        timer.Start();
+        for (int i = 0; i < n_loops; i++)
+        {
+            OSIReporter* reporter = new OSIReporter();
+            reporter->UpdateOSIStaticGroundTruth(std::vector<std::unique_ptr<ObjectState>>());
+            n_lanes = reinterpret_cast<const osi3::GroundTruth*>(reporter->GetOSIGroundTruthRaw())->lane_size();
+            delete reporter;
+        }
+        double t_elapsed = timer.Elapsed();
+
+        printf("%s: %d lanes, static ground truth %.3f ms\n", filename.c_str(), n_lanes, 1E3 * t_elapsed / n_loops);
+    }
+
+    return 0;
+}
+#endif
+
+static Benchmark benchmarks[] = {
+    {"free_space_distance", "[n_objects=100] Free-space distance between all object pairs, reference vs cached bounding box", FreeSpaceDistance},
+    {"rel2abs_prediction", "Rel2Abs prediction time vs number of objects near ego and far away, range limited vs unlimited", Rel2AbsPrediction},
+#ifdef _USE_OSI
+    {"osi_static_gt", "[xodr files] Static OSI ground truth update time, default the largest bundled road networks", OSIStaticGroundTruth},
+#endif
+};
+
+static void PrintUsage(const char* app_name)
+{
+    printf("Usage: %s <benchmark> [--loops n] [benchmark arguments]\n\nBenchmarks:\n", FileNameOf(app_name).c_str());
+    for (auto& benchmark : benchmarks)
+    {
+        printf("  %s %s\n", benchmark.name, benchmark.description);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    std::setlocale(LC_ALL, "C.UTF-8");
+
+    std::vector<std::string> args;
+    int                      n_loops = DEFAULT_LOOPS;
+
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        if (arg == "--loops" && i < argc - 1)
+        {
+            n_loops = strtoi(argv[++i]);
+            n_loops = MAX(1, n_loops);
+        }
+        else if (arg.substr(0, 2) == "--")
+        {
+            printf("Unknown or incomplete option: %s\n", arg.c_str());
+            PrintUsage(argv[0]);
+            return -1;
+        }
+        else
+        {
+            args.push_back(arg);
+        }
+    }
+
+    if (args.empty())
+    {
+        PrintUsage(argv[0]);
+        return -1;
+    }
+
+    for (auto& benchmark : benchmarks)
+    {
+        if (args[0] == benchmark.name)
+        {
+            return benchmark.func(std::vector<std::string>(args.begin() + 1, args.end()), n_loops);
+        }
+    }
+
+    printf("Unknown benchmark: %s\n", args[0].c_str());
+    PrintUsage(argv[0]);
+
+    return -1;
+}
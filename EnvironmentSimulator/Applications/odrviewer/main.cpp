@@ -28,11 +28,11 @@
 
 #include "viewer.hpp"
 #include "RoadManager.hpp"
+#include "RoadNetworkExerciser.hpp"
 #include "CommonMini.hpp"
 #include "helpText.hpp"
 
 #define ROAD_MIN_LENGTH 30.0
-#define SIGN(X)         ((X < 0) ? -1 : 1)
 
 static bool         run_only_once       = false;
 static const double stepSize            = 0.01;
@@ -44,6 +44,7 @@ static double       global_speed_factor = 1.0;
 static int          first_car_in_focus  = -1;
 static double       fixed_timestep      = -1.0;
 static bool         stop_at_end_of_road = false;
+static double       duration            = 60.0;  // Simulation time for headless runs
 
 static struct
 {
@@ -55,29 +56,9 @@ roadmanager::Road::RoadRule rule = roadmanager::Road::RoadRule::ROAD_RULE_UNDEFI
 
 double deltaSimTime;  // external - used by Viewer::RubberBandCamera
 
-struct Car
-{
-    int                    road_id_init;
-    int                    lane_id_init;
-    double                 heading_init;
-    double                 s_init;
-    roadmanager::Position *pos;
-    double                 speed_factor;  // speed vary bewtween lanes, m/s
-    viewer::EntityModel   *model;
-    int                    id;
-    bool                   stopped = false;
-};
-
-typedef struct
-{
-    int    roadId;
-    int    side;
-    int    nLanes;
-    double s;
-} OpenEnd;
-
-std::vector<Car *>   cars;
-std::vector<OpenEnd> openEnds;
+// Traffic, stored and moved by the exerciser. Models are indexed as the cars.
+roadmanager::RoadNetworkExerciser *traffic = nullptr;
+std::vector<viewer::EntityModel *> models;
 
 // Car models used for populating the road network
 // path should be relative the OpenDRIVE file
@@ -120,120 +101,45 @@ void FetchKeyEvent(viewer::KeyEvent *keyEvent, void *)
     }
 }
 
-int SetupCars(roadmanager::OpenDrive *odrManager, viewer::Viewer *viewer)
+int AddCarModel(viewer::Viewer *viewer, int carModelID)
 {
-    if (density < 1E-10)
+    viewer::EntityModel *model = viewer->CreateEntityModel(carModelsFiles_[carModelID],
+                                                           osg::Vec4(0.5, 0.5, 0.5, 1.0),
+                                                           viewer::EntityModel::EntityType::VEHICLE,
+                                                           false,
+                                                           "",
+                                                           0,
+                                                           EntityScaleMode::BB_TO_MODEL);
+
+    if (model == 0 || viewer->AddEntityModel(model) != 0)
     {
-        // Basically no scenario vehicles
-        return 0;
+        return -1;
     }
+    models.push_back(model);
 
-    for (int r = 0; r < odrManager->GetNumOfRoads(); r++)
-    {
-        roadmanager::Road *road             = odrManager->GetRoadByIdx(r);
-        double             average_distance = 100.0 / density;
+    return 0;
+}
 
-        roadmanager::Road::RoadRule rrule = road->GetRule();
-        if (rule != roadmanager::Road::RoadRule::ROAD_RULE_UNDEFINED)
-        {
-            // Enforce specified rule
-            rrule = rule;
-        }
+int SetupCars(viewer::Viewer *viewer)
+{
+    traffic->Populate(density, rule, ROAD_MIN_LENGTH);
 
-        // Check for open end
-        OpenEnd                openEnd;
-        roadmanager::RoadLink *tmpLink = road->GetLink(roadmanager::LinkType::PREDECESSOR);
-        if (tmpLink == nullptr)
-        {
-            openEnd.roadId = road->GetId();
-            openEnd.s      = 0;
-            openEnd.side   = rrule == roadmanager::Road::RoadRule::LEFT_HAND_TRAFFIC ? 1 : -1;
-            openEnd.nLanes = road->GetNumberOfDrivingLanesSide(openEnd.s, -1);
-            if (openEnd.nLanes > 0)
-            {
-                openEnds.push_back(openEnd);
-            }
-        }
-        tmpLink = road->GetLink(roadmanager::LinkType::SUCCESSOR);
-        if (tmpLink == nullptr)
+    std::vector<roadmanager::RoadNetworkExerciser::Car> &cars = traffic->GetCars();
+    for (size_t i = 0; i < cars.size(); i++)
+    {
+        if (viewer != nullptr)
         {
-            openEnd.roadId = road->GetId();
-            openEnd.s      = road->GetLength();
-            openEnd.side   = rrule == roadmanager::Road::RoadRule::LEFT_HAND_TRAFFIC ? -1 : 1;
-            openEnd.nLanes = road->GetNumberOfDrivingLanesSide(openEnd.s, 1);
-            if (openEnd.nLanes > 0)
+            // randomly choose model
+            int carModelID = SE_Env::Inst().GetRand().GetNumberBetween(0, (sizeof(carModelsFiles_) / sizeof(carModelsFiles_[0])) - 1);
+            if (AddCarModel(viewer, carModelID) != 0)
             {
-                openEnds.push_back(openEnd);
+                return -1;
             }
         }
 
-        if (road->GetLength() > ROAD_MIN_LENGTH)
+        if (first_car_in_focus == -1 && cars[i].lane_id_init < 0)
         {
-            // Populate road lanes with vehicles at some random distances
-            for (double s = 10; s < road->GetLength() - average_distance;
-                 s += average_distance + 0.2 * average_distance * SE_Env::Inst().GetRand().GetReal())
-            {
-                // Pick lane by random
-                int                lane_idx = SE_Env::Inst().GetRand().GetNumberBetween(0, road->GetNumberOfDrivingLanes(s) - 1);
-                roadmanager::Lane *lane     = road->GetDrivingLaneByIdx(s, lane_idx);
-                if (lane == 0)
-                {
-                    LOG("Failed locate driving lane %d at s %d", lane_idx, s);
-                    continue;
-                }
-
-                if (((SIGN(lane->GetId()) < 0) && (road->GetLength() - s < 50) && (road->GetLink(roadmanager::LinkType::SUCCESSOR) == 0)) ||
-                    ((SIGN(lane->GetId()) > 0) && (s < 50) && (road->GetLink(roadmanager::LinkType::PREDECESSOR) == 0)))
-                {
-                    // Skip vehicles too close to road end - and where connecting road is missing
-                    continue;
-                }
-
-                // randomly choose model
-                int carModelID = SE_Env::Inst().GetRand().GetNumberBetween(0, (sizeof(carModelsFiles_) / sizeof(carModelsFiles_[0])) - 1);
-                // LOG("Adding car of model %d to road nr %d (road id %d s %.2f lane id %d), ", carModelID, r, road->GetId(), s, lane->GetId());
-
-                Car *car_ = new Car;
-                // Higher speeds in lanes closer to reference lane
-                car_->speed_factor = 0.5 + 0.5 / abs(lane->GetId());  // Speed vary between 0.5 to 1.0 times default speed
-                car_->road_id_init = odrManager->GetRoadByIdx(r)->GetId();
-                car_->lane_id_init = lane->GetId();
-                car_->s_init       = s;
-                car_->pos          = new roadmanager::Position(odrManager->GetRoadByIdx(r)->GetId(), lane->GetId(), s, 0);
-                if (rrule == roadmanager::Road::RoadRule::LEFT_HAND_TRAFFIC)
-                {
-                    car_->pos->SetHeadingRelative(lane->GetId() < 0 ? M_PI : 0);
-                }
-                else
-                {
-                    car_->pos->SetHeadingRelative(lane->GetId() < 0 ? 0 : M_PI);
-                }
-                car_->heading_init = car_->pos->GetHRelative();
-
-                if ((car_->model = viewer->CreateEntityModel(carModelsFiles_[carModelID],
-                                                             osg::Vec4(0.5, 0.5, 0.5, 1.0),
-                                                             viewer::EntityModel::EntityType::VEHICLE,
-                                                             false,
-                                                             "",
-                                                             0,
-                                                             EntityScaleMode::BB_TO_MODEL)) == 0)
-                {
-                    return -1;
-                }
-                else
-                {
-                    if (viewer->AddEntityModel(car_->model) != 0)
-                    {
-                        return -1;
-                    }
-                }
-                car_->id = static_cast<int>(cars.size());
-                cars.push_back(car_);
-                if (first_car_in_focus == -1 && lane->GetId() < 0)
-                {
-                    first_car_in_focus = car_->id;
-                }
-            }
+            first_car_in_focus = cars[i].id;
         }
     }
 
@@ -245,120 +151,49 @@ int SetupCars(roadmanager::OpenDrive *odrManager, viewer::Viewer *viewer)
     return 0;
 }
 
-int SetupCarsSpecial(roadmanager::OpenDrive *odrManager, viewer::Viewer *viewer)
+int SetupCarsSpecial(viewer::Viewer *viewer)
 {
-    (void)odrManager;
     // Setup one single vehicle in a dedicated pos
-    Car *car_ = new Car;
-
-    car_->speed_factor = 1.0;
-    car_->road_id_init = 1;
-    car_->lane_id_init = -1;
-    car_->s_init       = 40;
-    car_->pos          = new roadmanager::Position(car_->road_id_init, car_->lane_id_init, car_->s_init, 0);
-    car_->pos->SetHeadingRelative(car_->lane_id_init < 0 ? 0 : M_PI);
-    car_->heading_init = car_->pos->GetHRelative();
-
-    if ((car_->model = viewer->CreateEntityModel(carModelsFiles_[0],
-                                                 osg::Vec4(0.5, 0.5, 0.5, 1.0),
-                                                 viewer::EntityModel::EntityType::VEHICLE,
-                                                 false,
-                                                 "",
-                                                 0,
-                                                 EntityScaleMode::BB_TO_MODEL)) == 0)
+    if (traffic->AddCar(1, -1, 40, 1.0) < 0)
     {
         return -1;
     }
-    else
+
+    if (viewer != nullptr && AddCarModel(viewer, 0) != 0)
     {
-        if (viewer->AddEntityModel(car_->model) != 0)
-        {
-            return -1;
-        }
+        return -1;
     }
 
-    car_->id = static_cast<int>(cars.size());
-    cars.push_back(car_);
-
     first_car_in_focus = 0;
 
     return 0;
 }
 
-void updateCar(roadmanager::OpenDrive *odrManager, Car *car, double dt)
+void UpdateCarModels()
 {
-    if (car->stopped)
-    {
-        return;
-    }
-
-    double new_speed = car->pos->GetSpeedLimit() * car->speed_factor * global_speed_factor;
-    double ds        = new_speed * dt;  // right lane is < 0 in road dir;
-
-    roadmanager::Road::RoadRule rrule = odrManager->GetRoadById(car->pos->GetTrackId())->GetRule();
-    if (rule != roadmanager::Road::RoadRule::ROAD_RULE_UNDEFINED)
-    {
-        // Enforce specified rule
-        rrule = rule;
-    }
+    std::vector<roadmanager::RoadNetworkExerciser::Car> &cars = traffic->GetCars();
 
-    if (static_cast<int>(car->pos->MoveAlongS(ds)) < 0)
+    for (size_t i = 0; i < models.size() && i < cars.size(); i++)
     {
-        if (stop_at_end_of_road)
+        if (models[i]->txNode_ != 0)
         {
-            car->stopped = true;
-        }
-        else if (openEnds.size() == 0)
-        {
-            // If no open ends, respawn based on initial position
-            // start from beginning of lane section - not initial s-position
-            roadmanager::LaneSection *ls      = odrManager->GetRoadById(car->road_id_init)->GetLaneSectionByS(car->s_init);
-            double                    start_s = ls->GetS() + 5;
-            if (car->lane_id_init > 0)
-            {
-                start_s = ls->GetS() + ls->GetLength() - 5;
-            }
-            car->pos->SetLanePos(car->road_id_init, car->lane_id_init, start_s, 0);
-            car->pos->SetHeadingRelative(car->heading_init);
-        }
-        else
-        {
-            // Choose random open end
-            int      oeIndex = SE_Env::Inst().GetRand().GetNumberBetween(0, static_cast<int>(openEnds.size()) - 1);
-            OpenEnd *oe      = &openEnds[static_cast<unsigned int>(oeIndex)];
-            // Choose random lane
-            int                laneIndex = SE_Env::Inst().GetRand().GetNumberBetween(0, oe->nLanes - 1);
-            roadmanager::Road *road      = odrManager->GetRoadById(oe->roadId);
-            roadmanager::Lane *lane      = road->GetDrivingLaneSideByIdx(oe->s, oe->side, laneIndex);
-
-            car->pos->SetLanePos(road->GetId(), lane->GetId(), oe->s, 0);
-
-            // Ensure car is oriented along lane driving direction
-            rrule = road->GetRule();
-            if (rule != roadmanager::Road::RoadRule::ROAD_RULE_UNDEFINED)
-            {
-                // Enforce specified rule
-                rrule = rule;
-            }
-            if (rrule == roadmanager::Road::RoadRule::LEFT_HAND_TRAFFIC)
-            {
-                car->pos->SetHeadingRelative(SIGN(lane->GetId()) > 0 ? 0.0 : M_PI);
-            }
-            else
-            {
-                car->pos->SetHeadingRelative(SIGN(lane->GetId()) > 0 ? M_PI : 0.0);
-            }
+            roadmanager::Position &pos = cars[i].pos;
+            double                 h, p, r;
+            R0R12EulerAngles(pos.GetHRoad(), pos.GetPRoad(), pos.GetRRoad(), pos.GetHRelative(), 0.0, 0.0, h, p, r);
+
+            models[i]->SetPosition(pos.GetX(), pos.GetY(), pos.GetZ());
+            models[i]->SetRotation(h, p, r);
         }
     }
+}
 
-    if (car->model->txNode_ != 0)
-    {
-        double h, p, r;
-        R0R12EulerAngles(car->pos->GetHRoad(), car->pos->GetPRoad(), car->pos->GetRRoad(), car->pos->GetHRelative(), 0.0, 0.0, h, p, r);
-
-        car->model->SetPosition(car->pos->GetX(), car->pos->GetY(), car->pos->GetZ());
-        car->model->SetRotation(h, p, r);
-    }
+void LogThroughput()
+{
+    LOG("%llu moves of %d cars in %.3f s: %.0f MoveAlongS/s",
+        traffic->GetNumberOfMoves(),
+        static_cast<int>(traffic->GetCars().size()),
+        traffic->GetStepTime(),
+        traffic->GetMoveThroughput());
 }
 
 int main(int argc, char **argv)
@@ -389,15 +224,20 @@ int main(int argc, char **argv)
     opt.AddOption("disable_log", "Prevent logfile from being created");
     opt.AddOption("disable_off_screen", "Disable esmini off-screen rendering, revert to OSG viewer default handling");
     opt.AddOption("disable_stdout", "Prevent messages to stdout");
+    opt.AddOption("duration", "Simulation time (s) of headless runs", "duration", std::to_string(duration));
     opt.AddOption("fixed_timestep", "Run simulation decoupled from realtime, with specified timesteps", "timestep");
     opt.AddOption("generate_no_road_objects", "Do not generate any OpenDRIVE road objects (e.g. when part of referred 3D model)");
     opt.AddOption("ground_plane", "Add a large flat ground surface");
-    opt.AddOption("headless", "Run without viewer window");
+    opt.AddOption("headless", "Run without viewer window, report RoadManager throughput and quit");
+    opt.AddOption("load_threads", "Number of threads for loading the OpenDRIVE file (default: one per hardware thread)", "number");
     opt.AddOption("logfile_path", "logfile path/filename, e.g. \"../esmini.log\" (default: log.txt)", "path");
     opt.AddOption("model", "3D Model filename", "model_filename");
     opt.AddOption("osi_lines", "Show OSI road lines (toggle during simulation by press 'u') ");
+    opt.AddOption("osi_max_lateral_deviation", "Max lateral deviation (m) of OSI points from road geometry (default: 0.05)", "distance");
+    opt.AddOption("osi_max_longitudinal_distance", "Max longitudinal distance (m) between OSI points (default: 50)", "distance");
     opt.AddOption("osi_points", "Show OSI road points (toggle during simulation by press 'y') ");
     opt.AddOption("path", "Search path prefix for assets, e.g. car and sign model files", "path");
+    opt.AddOption("profile_load", "Report duration of each stage of OpenDRIVE file loading");
     opt.AddOption("road_features", "Show OpenDRIVE road features (toggle during simulation by press 'o') ");
     opt.AddOption("save_generated_model", "Save generated 3D model (n/a when a scenegraph is loaded)");
     opt.AddOption("seed", "Specify seed number for random generator", "number");
@@ -519,6 +359,36 @@ int main(int argc, char **argv)
         SE_Env::Inst().SetOffScreenRendering(false);
     }
 
+    if (opt.GetOptionSet("stop_at_end_of_road"))
+    {
+        stop_at_end_of_road = true;
+    }
+
+    if (opt.GetOptionArg("duration") != "")
+    {
+        duration = strtod(opt.GetOptionArg("duration"));
+    }
+
+    if (opt.GetOptionArg("load_threads") != "")
+    {
+        SE_Env::Inst().SetLoadThreads(strtoi(opt.GetOptionArg("load_threads")));
+    }
+
+    if (opt.GetOptionSet("profile_load"))
+    {
+        SE_Env::Inst().SetProfileLoad(true);
+    }
+
+    if (opt.GetOptionArg("osi_max_lateral_deviation") != "")
+    {
+        SE_Env::Inst().SetOSIMaxLateralDeviation(strtod(opt.GetOptionArg("osi_max_lateral_deviation")));
+    }
+
+    if (opt.GetOptionArg("osi_max_longitudinal_distance") != "")
+    {
+        SE_Env::Inst().SetOSIMaxLongitudinalDistance(strtod(opt.GetOptionArg("osi_max_longitudinal_distance")));
+    }
+
     roadmanager::Position *lane_pos  = new roadmanager::Position();
     roadmanager::Position *track_pos = new roadmanager::Position();
 
@@ -531,6 +401,31 @@ int main(int argc, char **argv)
         }
         roadmanager::OpenDrive *odrManager = roadmanager::Position::GetOpenDrive();
 
+        traffic = new roadmanager::RoadNetworkExerciser(odrManager);
+        traffic->SetSpeedFactor(global_speed_factor);
+        traffic->SetStopAtEndOfRoad(stop_at_end_of_road);
+
+        if (opt.GetOptionSet("headless"))
+        {
+            // Only road coordinates needed, skip world coordinate evaluation
+            traffic->SetEvaluateWorldPos(false);
+            if (SetupCars(nullptr) == -1)
+            {
+                return 4;
+            }
+            LOG("%d cars added, run %.2f s headless", static_cast<int>(traffic->GetCars().size()), duration);
+
+            double dt = fixed_timestep > 0 ? fixed_timestep : stepSize;
+            for (double time = 0.0; time < duration - SMALL_NUMBER; time += dt)
+            {
+                traffic->Step(dt);
+            }
+            LogThroughput();
+
+            delete traffic;
+            return 0;
+        }
+
         osg::ArgumentParser arguments(&argc, argv);
         viewer::Viewer     *viewer = new viewer::Viewer(odrManager, modelFilename.c_str(), NULL, argv[0], arguments, &opt);
 
@@ -562,11 +457,6 @@ int main(int argc, char **argv)
             viewer->SetNodeMaskBits(viewer::NodeMask::NODE_MASK_OSI_POINTS);
         }
 
-        if (opt.GetOptionSet("stop_at_end_of_road"))
-        {
-            stop_at_end_of_road = true;
-        }
-
         if (opt.GetOptionSet("custom_fixed_camera") == true)
         {
             int counter = 0;
@@ -660,11 +550,11 @@ int main(int argc, char **argv)
             viewer->GetNodeMaskBit(viewer::NodeMask::NODE_MASK_OSI_LINES) ? "on" : "off",
             viewer->GetNodeMaskBit(viewer::NodeMask::NODE_MASK_OSI_POINTS) ? "on" : "off");
 
-        if (SetupCars(odrManager, viewer) == -1)
+        if (SetupCars(viewer) == -1)
         {
             return 4;
         }
-        LOG("%d cars added", static_cast<int>(cars.size()));
+        LOG("%d cars added", static_cast<int>(traffic->GetCars().size()));
 
         __int64 now, lastTimeStamp = 0;
 
@@ -697,30 +587,29 @@ int main(int argc, char **argv)
 
                 if (!(run_only_once && !first_time))
                 {
-                    for (size_t i = 0; i < cars.size(); i++)
-                    {
-                        updateCar(odrManager, cars[i], deltaSimTime);
-                    }
+                    traffic->Step(deltaSimTime);
+                    UpdateCarModels();
                     first_time = false;
                 }
 
                 // Set info text
+                std::vector<roadmanager::RoadNetworkExerciser::Car> &cars = traffic->GetCars();
                 if (static_cast<int>(cars.size()) > 0 && viewer->currentCarInFocus_ >= 0 &&
                     viewer->currentCarInFocus_ < static_cast<int>(cars.size()))
                 {
-                    Car *car = cars[static_cast<unsigned int>(viewer->currentCarInFocus_)];
+                    roadmanager::RoadNetworkExerciser::Car *car = &cars[static_cast<unsigned int>(viewer->currentCarInFocus_)];
                     snprintf(str_buf,
                              sizeof(str_buf),
                              "entity[%d]: %.2fkm/h (%d, %d, %.2f, %.2f) / (%.2f, %.2f %.2f)",
                              viewer->currentCarInFocus_,
-                             3.6 * car->pos->GetSpeedLimit() * car->speed_factor * global_speed_factor,
-                             car->pos->GetTrackId(),
-                             car->pos->GetLaneId(),
-                             fabs(car->pos->GetOffset()) < SMALL_NUMBER ? 0 : car->pos->GetOffset(),
-                             car->pos->GetS(),
-                             car->pos->GetX(),
-                             car->pos->GetY(),
-                             car->pos->GetH());
+                             3.6 * car->pos.GetSpeedLimit() * car->speed_factor * global_speed_factor,
+                             car->pos.GetTrackId(),
+                             car->pos.GetLaneId(),
+                             fabs(car->pos.GetOffset()) < SMALL_NUMBER ? 0 : car->pos.GetOffset(),
+                             car->pos.GetS(),
+                             car->pos.GetX(),
+                             car->pos.GetY(),
+                             car->pos.GetH());
                     viewer->SetInfoText(str_buf);
                 }
             }
@@ -731,6 +620,7 @@ int main(int argc, char **argv)
             viewer->osgViewer_->frame();
         }
         delete viewer;
+        LogThroughput();
     }
     catch (std::logic_error &e)
     {
@@ -743,10 +633,7 @@ int main(int argc, char **argv)
         return 3;
     }
 
-    for (size_t i = 0; i < cars.size(); i++)
-    {
-        delete (cars[i]);
-    }
+    delete traffic;
     delete track_pos;
     delete lane_pos;
 
@@ -0,0 +1,524 @@
+/*
+ * esmini - Environment Simulator Minimalistic
+ * https://github.com/esmini/esmini
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *
+ * Copyright (c) partners of Simulation Scenarios
+ * https://sites.google.com/view/simulationscenarios
+ */
+
+/*
+ * This application uses the Replay class to analyze one or more binary recordings without any viewer.
+ * For each pair of entities coming within a given range it reports collisions, minimum distance,
+ * minimum time-to-collision and minimum time headway. Files are processed in parallel.
+ */
+
+#include <clocale>
+#include <atomic>
+#include <thread>
+#include <map>
+#include <unordered_map>
+
+#include "Replay.hpp"
+#include "CommonMini.hpp"
+
+using namespace scenarioengine;
+
+#define MAX_LINE_LEN        2048
+#define DEFAULT_RANGE       50.0
+#define TIME_NOT_SET        (-1.0)
+#define COLLISION_TOLERANCE SMALL_NUMBER
+
+typedef struct
+{
+    int         id;
+    std::string name;
+    OBB2D       obb;
+    double      radius;  // bounding circle radius, around box center
+    double      vel[2];
+    double      speed;
+} Box;
+
+typedef struct
+{
+    int         id[2];
+    std::string name[2];
+    bool        collision;
+    double      collision_time;  // time of first collision
+    double      min_dist;
+    double      min_dist_time;
+    double      min_ttc;
+    double      min_ttc_time;
+    double      min_thw;  // minimum time headway, any of the two following the other
+    double      min_thw_time;
+} PairResult;
+
+typedef struct
+{
+    std::string             filename;
+    std::string             error;
+    int                     n_frames;
+    std::vector<PairResult> pairs;
+} FileResult;
+
+static void SetupBox(const ObjectStateStructDat& state, Box& box)
+{
+    SetOBB2D(static_cast<double>(state.pos.x),
+             static_cast<double>(state.pos.y),
+             static_cast<double>(state.pos.h),
+             static_cast<double>(state.info.boundingbox.center_.x_),
+             static_cast<double>(state.info.boundingbox.center_.y_),
+             static_cast<double>(state.info.boundingbox.dimensions_.length_),
+             static_cast<double>(state.info.boundingbox.dimensions_.width_),
+             box.obb);
+
+    box.id     = state.info.id;
+    box.name   = state.info.name;
+    box.radius = GetLengthOfVector2D(box.obb.half[0], box.obb.half[1]);
+    box.speed  = static_cast<double>(state.info.speed);
+    box.vel[0] = box.speed * box.obb.axis[0][0];
+    box.vel[1] = box.speed * box.obb.axis[0][1];
+}
+
+// Time headway of follower with respect to leader, LARGE_NUMBER if leader is not ahead in same path
+static double TimeHeadway(const Box& follower, const Box& leader, double dist)
+{
+    if (follower.speed < SMALL_NUMBER)
+    {
+        return LARGE_NUMBER;
+    }
+
+    double dx   = leader.obb.center[0] - follower.obb.center[0];
+    double dy   = leader.obb.center[1] - follower.obb.center[1];
+    double dlon = GetDotProduct2D(dx, dy, follower.obb.axis[0][0], follower.obb.axis[0][1]);
+    double dlat = GetDotProduct2D(dx, dy, follower.obb.axis[1][0], follower.obb.axis[1][1]);
+
+    if (dlon < 0.0 || fabs(dlat) > follower.obb.half[1] + leader.obb.half[1])
+    {
+        return LARGE_NUMBER;
+    }
+
+    return dist / follower.speed;
+}
+
+static void UpdatePair(PairResult& pair, const Box& b0, const Box& b1, double time)
+{
+    double dist = 0.0;
+
+    // same overlap and distance measures as the scenario engine, see Object::FreeSpaceDistance()
+    if (OverlapOBB2D(b0.obb, b1.obb, COLLISION_TOLERANCE))
+    {
+        if (!pair.collision)
+        {
+            pair.collision      = true;
+            pair.collision_time = time;
+        }
+    }
+    else
+    {
+        dist = FreeSpaceDistanceOBB2D(b0.obb, b1.obb);
+    }
+
+    if (dist < pair.min_dist)
+    {
+        pair.min_dist      = dist;
+        pair.min_dist_time = time;
+    }
+
+    // Time to collision based on closing speed along line between box centers
+    double dx      = b1.obb.center[0] - b0.obb.center[0];
+    double dy      = b1.obb.center[1] - b0.obb.center[1];
+    double len     = sqrt(dx * dx + dy * dy);
+    double closing = len > SMALL_NUMBER ? -GetDotProduct2D(b1.vel[0] - b0.vel[0], b1.vel[1] - b0.vel[1], dx, dy) / len : 0.0;
+
+    if (closing > SMALL_NUMBER)
+    {
+        double ttc = dist / closing;
+        if (ttc < pair.min_ttc)
+        {
+            pair.min_ttc      = ttc;
+            pair.min_ttc_time = time;
+        }
+    }
+
+    double thw = MIN(TimeHeadway(b0, b1, dist), TimeHeadway(b1, b0, dist));
+    if (thw < pair.min_thw)
+    {
+        pair.min_thw      = thw;
+        pair.min_thw_time = time;
+    }
+}
+
+static void AnalyzeFile(const std::string& filename, double range, FileResult& result)
+{
+    result.filename = filename;
+    result.n_frames = 0;
+
+    Replay* player = nullptr;
+    try
+    {
+        player = new Replay(filename, false);
+    }
+    catch (const std::exception& e)
+    {
+        result.error = e.what();
+        return;
+    }
+
+    std::map<std::pair<int, int>, PairResult> pairs;
+    std::vector<Box>                          boxes;
+    std::unordered_map<int, size_t>           box_index;  // entity id -> index in boxes of current frame
+    std::vector<size_t>                       order;  // box indices sorted on lower x bound, sweep and prune
+    std::vector<int>                          last_order_id;
+    double                                    last_time = -LARGE_NUMBER;
+    size_t                                    i         = 0;
+
+    while (i < player->data_.size())
+    {
+        // Collect one frame, i.e. all entries sharing the same timestamp
+        double time = static_cast<double>(player->data_[i].state.info.timeStamp);
+        size_t end  = i;
+        while (end < player->data_.size() && NEAR_NUMBERSF(player->data_[end].state.info.timeStamp, player->data_[i].state.info.timeStamp))
+        {
+            end++;
+        }
+
+        if (time <= last_time)
+        {
+            // skip any restarted sequence, e.g. ghost headstart, only analyze increasing time
+            i = end;
+            continue;
+        }
+        last_time = time;
+        result.n_frames++;
+
+        boxes.clear();
+        box_index.clear();
+        for (size_t j = i; j < end; j++)
+        {
+            Box box;
+            SetupBox(player->data_[j].state, box);
+
+            // keep latest instance of any duplicate entry
+            auto it = box_index.emplace(box.id, boxes.size());
+            if (it.second)
+            {
+                boxes.push_back(box);
+            }
+            else
+            {
+                boxes[it.first->second] = box;
+            }
+        }
+        i = end;
+
+        // Entities rarely change order between frames, so start from previous order and insertion sort it.
+        // The set of entities might change, then fall back to the order given by the recording.
+        bool same_set = last_order_id.size() == boxes.size();
+        for (size_t j = 0; j < boxes.size() && same_set; j++)
+        {
+            same_set = boxes[j].id == last_order_id[j];
+        }
+        if (!same_set)
+        {
+            order.resize(boxes.size());
+            for (size_t j = 0; j < boxes.size(); j++)
+            {
+                order[j] = j;
+            }
+            last_order_id.resize(boxes.size());
+            for (size_t j = 0; j < boxes.size(); j++)
+            {
+                last_order_id[j] = boxes[j].id;
+            }
+        }
+
+        for (size_t j = 1; j < order.size(); j++)
+        {
+            size_t idx = order[j];
+            double key = boxes[idx].obb.center[0] - boxes[idx].radius;
+            size_t k   = j;
+            while (k > 0 && boxes[order[k - 1]].obb.center[0] - boxes[order[k - 1]].radius > key)
+            {
+                order[k] = order[k - 1];
+                k--;
+            }
+            order[k] = idx;
+        }
+
+        // Sweep along x, only pairs with overlapping extended intervals are candidates
+        for (size_t j = 0; j < order.size(); j++)
+        {
+            const Box& b0   = boxes[order[j]];
+            double     xmax = b0.obb.center[0] + b0.radius + range;
+
+            for (size_t k = j + 1; k < order.size(); k++)
+            {
+                const Box& b1 = boxes[order[k]];
+                if (b1.obb.center[0] - b1.radius > xmax)
+                {
+                    break;  // remaining boxes are further away along x
+                }
+
+                if (fabs(b1.obb.center[1] - b0.obb.center[1]) > b0.radius + b1.radius + range)
+                {
+                    continue;
+                }
+
+                const Box& first  = b0.id < b1.id ? b0 : b1;
+                const Box& second = b0.id < b1.id ? b1 : b0;
+
+                auto it = pairs.find(std::make_pair(first.id, second.id));
+                if (it == pairs.end())
+                {
+                    PairResult pair;
+                    pair.id[0]          = first.id;
+                    pair.id[1]          = second.id;
+                    pair.name[0]        = first.name;
+                    pair.name[1]        = second.name;
+                    pair.collision      = false;
+                    pair.collision_time = TIME_NOT_SET;
+                    pair.min_dist       = LARGE_NUMBER;
+                    pair.min_dist_time  = TIME_NOT_SET;
+                    pair.min_ttc        = LARGE_NUMBER;
+                    pair.min_ttc_time   = TIME_NOT_SET;
+                    pair.min_thw        = LARGE_NUMBER;
+                    pair.min_thw_time   = TIME_NOT_SET;
+                    it                  = pairs.insert(std::make_pair(std::make_pair(first.id, second.id), pair)).first;
+                }
+
+                UpdatePair(it->second, first, second, time);
+            }
+        }
+    }
+
+    for (auto& pair : pairs)
+    {
+        result.pairs.push_back(pair.second);
+    }
+
+    delete player;
+}
+
+static std::string ValueStr(double value, bool json)
+{
+    char str[64];
+
+    if (value > LARGE_NUMBER - SMALL_NUMBER)
+    {
+        return json ? "null" : "";
+    }
+    snprintf(str, sizeof(str), "%.3f", value);
+
+    return str;
+}
+
+// Escape quotes, backslashes and control characters for use in a JSON string
+static std::string JSONEscape(const std::string& str)
+{
+    std::string escaped;
+    char        buf[8];
+
+    for (char c : str)
+    {
+        switch (c)
+        {
+            case '"':
+                escaped += "\\\"";
+                break;
+            case '\\':
+                escaped += "\\\\";
+                break;
+            case '\n':
+                escaped += "\\n";
+                break;
+            case '\r':
+                escaped += "\\r";
+                break;
+            case '\t':
+                escaped += "\\t";
+                break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20)
+                {
+                    snprintf(buf, sizeof(buf), "\\u%04x", static_cast<unsigned int>(c));
+                    escaped += buf;
+                }
+                else
+                {
+                    escaped += c;
+                }
+        }
+    }
+
+    return escaped;
+}
+
+static void WriteCSV(std::ostream& out, const std::vector<FileResult>& results)
+{
+    static char line[MAX_LINE_LEN];
+
+    out << "file, id0, name0, id1, name1, collision, collision_time, min_dist, min_dist_time, min_ttc, min_ttc_time, min_thw, min_thw_time\n";
+    for (const FileResult& file : results)
+    {
+        if (!file.error.empty())
+        {
+            out << "# " << file.filename << ": " << file.error << "\n";
+            continue;
+        }
+
+        for (const PairResult& pair : file.pairs)
+        {
+            snprintf(line,
+                     MAX_LINE_LEN,
+                     "%s, %d, %s, %d, %s, %d, %s, %s, %s, %s, %s, %s, %s\n",
+                     file.filename.c_str(),
+                     pair.id[0],
+                     pair.name[0].c_str(),
+                     pair.id[1],
+                     pair.name[1].c_str(),
+                     pair.collision ? 1 : 0,
+                     pair.collision ? ValueStr(pair.collision_time, false).c_str() : "",
+                     ValueStr(pair.min_dist, false).c_str(),
+                     ValueStr(pair.min_dist_time, false).c_str(),
+                     ValueStr(pair.min_ttc, false).c_str(),
+                     pair.min_ttc_time < 0.0 ? "" : ValueStr(pair.min_ttc_time, false).c_str(),
+                     ValueStr(pair.min_thw, false).c_str(),
+                     pair.min_thw_time < 0.0 ? "" : ValueStr(pair.min_thw_time, false).c_str());
+            out << line;
+        }
+    }
+}
+
+static void WriteJSON(std::ostream& out, const std::vector<FileResult>& results)
+{
+    out << "[\n";
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        const FileResult& file = results[i];
+
+        out << "  {\"file\": \"" << JSONEscape(file.filename) << "\", \"frames\": " << file.n_frames;
+        if (!file.error.empty())
+        {
+            out << ", \"error\": \"" << JSONEscape(file.error) << "\"";
+        }
+        out << ", \"pairs\": [";
+        for (size_t j = 0; j < file.pairs.size(); j++)
+        {
+            const PairResult& pair = file.pairs[j];
+            out << (j > 0 ? "," : "") << "\n    {\"id0\": " << pair.id[0] << ", \"name0\": \"" << JSONEscape(pair.name[0]) << "\", \"id1\": " << pair.id[1]
+                << ", \"name1\": \"" << JSONEscape(pair.name[1]) << "\", \"collision\": " << (pair.collision ? "true" : "false")
+                << ", \"collision_time\": " << (pair.collision ? ValueStr(pair.collision_time, true) : "null")
+                << ", \"min_dist\": " << ValueStr(pair.min_dist, true) << ", \"min_dist_time\": " << ValueStr(pair.min_dist_time, true)
+                << ", \"min_ttc\": " << ValueStr(pair.min_ttc, true)
+                << ", \"min_ttc_time\": " << (pair.min_ttc_time < 0.0 ? "null" : ValueStr(pair.min_ttc_time, true))
+                << ", \"min_thw\": " << ValueStr(pair.min_thw, true)
+                << ", \"min_thw_time\": " << (pair.min_thw_time < 0.0 ? "null" : ValueStr(pair.min_thw_time, true)) << "}";
+        }
+        out << (file.pairs.size() > 0 ? "\n  ]}" : "]}") << (i < results.size() - 1 ? "," : "") << "\n";
+    }
+    out << "]\n";
+}
+
+static void PrintUsage(const char* app)
+{
+    printf("Usage: %s [options] <file1.dat> [file2.dat ...]\n", app);
+    printf("Options:\n");
+    printf("  --output <filename>  Write summary to file instead of stdout\n");
+    printf("  --json               Write summary in JSON format instead of CSV\n");
+    printf("  --range <distance>   Only analyze entity pairs within this free space distance (default %.0f m)\n", DEFAULT_RANGE);
+    printf("  --threads <number>   Number of files to process in parallel (default number of hardware threads)\n");
+}
+
+int main(int argc, char** argv)
+{
+    std::setlocale(LC_ALL, "C.UTF-8");
+
+    std::vector<std::string> filenames;
+    std::string              output;
+    bool                     json      = false;
+    double                   range     = DEFAULT_RANGE;
+    unsigned int             n_threads = std::thread::hardware_concurrency();
+
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        if (arg == "--output" && i < argc - 1)
+        {
+            output = argv[++i];
+        }
+        else if (arg == "--json")
+        {
+            json = true;
+        }
+        else if (arg == "--range" && i < argc - 1)
+        {
+            range = strtod(argv[++i]);
+        }
+        else if (arg == "--threads" && i < argc - 1)
+        {
+            n_threads = static_cast<unsigned int>(strtoi(argv[++i]));
+        }
+        else if (arg.substr(0, 2) == "--")
+        {
+            printf("Unknown or incomplete option: %s\n", arg.c_str());
+            PrintUsage(argv[0]);
+            return -1;
+        }
+        else
+        {
+            filenames.push_back(arg);
+        }
+    }
+
+    if (filenames.empty())
+    {
+        PrintUsage(argv[0]);
+        return -1;
+    }
+
+    n_threads = CLAMP(n_threads, 1u, static_cast<unsigned int>(filenames.size()));
+
+    // Each worker picks next unprocessed file, results are stored in input order
+    std::vector<FileResult>  results(filenames.size());
+    std::atomic<size_t>      next_file(0);
+    std::vector<std::thread> workers;
+
+    for (unsigned int i = 0; i < n_threads; i++)
+    {
+        workers.push_back(std::thread(
+            [&]()
+            {
+                for (size_t j = next_file++; j < filenames.size(); j = next_file++)
+                {
+                    AnalyzeFile(filenames[j], range, results[j]);
+                }
+            }));
+    }
+
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+
+    if (output.empty())
+    {
+        json ? WriteJSON(std::cout, results) : WriteCSV(std::cout, results);
+    }
+    else
+    {
+        std::ofstream file(output);
+        if (!file.is_open())
+        {
+            printf("Failed to create file %s\n", output.c_str());
+            return -1;
+        }
+        json ? WriteJSON(file, results) : WriteCSV(file, results);
+        file.close();
+    }
+
+    return 0;
+}
@@ -486,19 +486,8 @@ int main(int argc, char** argv)
                     CombineDirectoryPathAndFilepath(SE_Env::Inst().GetPaths()[i] + "/xodr/", player->header_.odr_filename));
             }
 
-            size_t i;
-            for (i = 0; i < file_name_candidates.size(); i++)
-            {
-                if (FileExists(file_name_candidates[i].c_str()))
-                {
-                    if (roadmanager::Position::LoadOpenDrive(file_name_candidates[i].c_str()))
-                    {
-                        break;
-                    }
-                }
-            }
-
-            if (i == file_name_candidates.size())
+            std::string path = SE_Env::Inst().LocateFile(file_name_candidates);
+            if (path.empty() || !roadmanager::Position::LoadOpenDrive(path.c_str()))
             {
                 printf("Failed to load OpenDRIVE file %s. Tried:\n", player->header_.odr_filename);
                 for (int j = 0; j < static_cast<int>(file_name_candidates.size()); j++)
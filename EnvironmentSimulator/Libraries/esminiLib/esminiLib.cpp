@@ -74,6 +74,7 @@ static void resetScenario(void)
         delete player;
         player = nullptr;
         SE_Env::Inst().ClearModelFilenames();
+        SE_Env::Inst().ClearFileCache();
     }
     if (argv_)
     {
@@ -455,6 +456,38 @@ static int InitScenario()
     return 0;
 }
 
+template <typename T>
+static int GetParametersByHandle(Parameters &params, const int *handles, int n, T *values)
+{
+    int retval = 0;
+
+    for (int i = 0; i < n; i++)
+    {
+        if (params.getParameterValueByHandle(handles[i], values[i]) != 0)
+        {
+            retval = -1;
+        }
+    }
+
+    return retval;
+}
+
+template <typename T>
+static int SetParametersByHandle(Parameters &params, const int *handles, int n, const T *values)
+{
+    int retval = 0;
+
+    for (int i = 0; i < n; i++)
+    {
+        if (params.setParameterValueByHandle(handles[i], values[i]) != 0)
+        {
+            retval = -1;
+        }
+    }
+
+    return retval;
+}
+
 extern "C"
 {
     SE_DLL_API int SE_AddPath(const char *path)
@@ -830,6 +863,41 @@ extern "C"
         return ScenarioReader::parameters.setParameterValue(parameterName, value);
     }
 
+    SE_DLL_API int SE_GetParameterHandle(const char *parameterName)
+    {
+        return ScenarioReader::parameters.getParameterHandle(parameterName);
+    }
+
+    SE_DLL_API int SE_GetParametersIntByHandle(const int *handles, int n, int *values)
+    {
+        return GetParametersByHandle(ScenarioReader::parameters, handles, n, values);
+    }
+
+    SE_DLL_API int SE_GetParametersDoubleByHandle(const int *handles, int n, double *values)
+    {
+        return GetParametersByHandle(ScenarioReader::parameters, handles, n, values);
+    }
+
+    SE_DLL_API int SE_GetParametersBoolByHandle(const int *handles, int n, bool *values)
+    {
+        return GetParametersByHandle(ScenarioReader::parameters, handles, n, values);
+    }
+
+    SE_DLL_API int SE_SetParametersIntByHandle(const int *handles, int n, const int *values)
+    {
+        return SetParametersByHandle(ScenarioReader::parameters, handles, n, values);
+    }
+
+    SE_DLL_API int SE_SetParametersDoubleByHandle(const int *handles, int n, const double *values)
+    {
+        return SetParametersByHandle(ScenarioReader::parameters, handles, n, values);
+    }
+
+    SE_DLL_API int SE_SetParametersBoolByHandle(const int *handles, int n, const bool *values)
+    {
+        return SetParametersByHandle(ScenarioReader::parameters, handles, n, values);
+    }
+
     SE_DLL_API int SE_SetVariable(SE_Variable variable)
     {
         return ScenarioReader::variables.setParameterValue(variable.name, variable.value);
@@ -880,6 +948,41 @@ extern "C"
         return ScenarioReader::variables.setParameterValue(variableName, value);
     }
 
+    SE_DLL_API int SE_GetVariableHandle(const char *variableName)
+    {
+        return ScenarioReader::variables.getParameterHandle(variableName);
+    }
+
+    SE_DLL_API int SE_GetVariablesIntByHandle(const int *handles, int n, int *values)
+    {
+        return GetParametersByHandle(ScenarioReader::variables, handles, n, values);
+    }
+
+    SE_DLL_API int SE_GetVariablesDoubleByHandle(const int *handles, int n, double *values)
+    {
+        return GetParametersByHandle(ScenarioReader::variables, handles, n, values);
+    }
+
+    SE_DLL_API int SE_GetVariablesBoolByHandle(const int *handles, int n, bool *values)
+    {
+        return GetParametersByHandle(ScenarioReader::variables, handles, n, values);
+    }
+
+    SE_DLL_API int SE_SetVariablesIntByHandle(const int *handles, int n, const int *values)
+    {
+        return SetParametersByHandle(ScenarioReader::variables, handles, n, values);
+    }
+
+    SE_DLL_API int SE_SetVariablesDoubleByHandle(const int *handles, int n, const double *values)
+    {
+        return SetParametersByHandle(ScenarioReader::variables, handles, n, values);
+    }
+
+    SE_DLL_API int SE_SetVariablesBoolByHandle(const int *handles, int n, const bool *values)
+    {
+        return SetParametersByHandle(ScenarioReader::variables, handles, n, values);
+    }
+
     SE_DLL_API void *SE_GetODRManager()
     {
         if (player != nullptr)
@@ -1625,7 +1728,7 @@ extern "C"
 #ifdef _USE_OSI
         if (player != nullptr)
         {
-            return player->osiReporter->UpdateOSIGroundTruth(player->scenarioGateway->objectState_);
+            return player->osiReporter->UpdateOSIGroundTruth(player->scenarioGateway->objectState_, player->scenarioGateway->getFrameNr());
         }
 #endif  // _USE_OSI
 
@@ -1649,7 +1752,9 @@ extern "C"
 #ifdef _USE_OSI
         if (player != nullptr)
         {
-            return player->osiReporter->UpdateOSIDynamicGroundTruth(player->scenarioGateway->objectState_, reportGhost);
+            return player->osiReporter->UpdateOSIDynamicGroundTruth(player->scenarioGateway->objectState_,
+                                                                     reportGhost,
+                                                                     player->scenarioGateway->getFrameNr());
         }
 #else
         (void)reportGhost;
@@ -2147,6 +2252,52 @@ extern "C"
         return -1;
     }
 
+    SE_DLL_API int SE_SetTrafficSignalState(int signal_id, const char *state)
+    {
+        if (player == nullptr || state == nullptr)
+        {
+            return -1;
+        }
+
+        player->odr_manager->GetSignalStateRegistry().SetState(signal_id, state);
+
+        return 0;
+    }
+
+    SE_DLL_API const char *SE_GetTrafficSignalState(int signal_id)
+    {
+        if (player != nullptr)
+        {
+            const roadmanager::SignalStateRegistry::SignalState *s = player->odr_manager->GetSignalStateRegistry().GetState(signal_id);
+            if (s != nullptr)
+            {
+                return s->state.c_str();
+            }
+        }
+
+        return nullptr;
+    }
+
+    SE_DLL_API int SE_GetChangedTrafficSignals(unsigned int *version, int *ids, int max_n)
+    {
+        if (player == nullptr || version == nullptr)
+        {
+            return -1;
+        }
+
+        std::vector<int>                 &changed  = player->changed_signals_;
+        roadmanager::SignalStateRegistry &registry = player->odr_manager->GetSignalStateRegistry();
+        registry.GetChangedSignals(*version, changed);
+        *version = registry.GetVersion();
+
+        for (int i = 0; ids != nullptr && i < max_n && i < static_cast<int>(changed.size()); i++)
+        {
+            ids[i] = changed[static_cast<unsigned int>(i)];
+        }
+
+        return static_cast<int>(changed.size());
+    }
+
     SE_DLL_API void SE_ViewerShowFeature(int featureType, bool enable)
     {
 #ifdef _USE_OSG
@@ -325,6 +325,8 @@ extern "C"
 
     /**
             Configure tolerances/resolution for OSI road features
+            Points are placed adaptively, densest where curvature or elevation changes the most
+            Call before SE_Init, since the points are created when the OpenDRIVE file is loaded
             @param max_longitudinal_distance Maximum distance between OSI points, even on straight road. Default=50(m)
             @param max_lateral_deviation Control resolution w.r.t. curvature default=0.05(m)
             @return 0 if successful, -1 if not
@@ -589,6 +591,68 @@ extern "C"
     */
     SE_DLL_API int SE_SetParameterBool(const char *parameterName, bool value);
 
+    /**
+    Get handle of named parameter, for fast repeated access by the *ByHandle functions
+    The handle stays valid as long as the set of parameters is not changed (e.g. by loading a new scenario)
+    @parameterName Name of the parameter
+    @return handle (>= 0) if successful, -1 if not found
+    */
+    SE_DLL_API int SE_GetParameterHandle(const char *parameterName);
+
+    /**
+    Get typed values of multiple parameters specified by handles, see SE_GetParameterHandle()
+    @handles Array of handles
+    @n Number of handles
+    @values Array of at least n elements, receiving the values
+    @return 0 if successful, -1 if any of the parameters could not be read (e.g. wrong type)
+    */
+    SE_DLL_API int SE_GetParametersIntByHandle(const int *handles, int n, int *values);
+
+    /**
+    Get typed values of multiple parameters specified by handles, see SE_GetParameterHandle()
+    @handles Array of handles
+    @n Number of handles
+    @values Array of at least n elements, receiving the values
+    @return 0 if successful, -1 if any of the parameters could not be read (e.g. wrong type)
+    */
+    SE_DLL_API int SE_GetParametersDoubleByHandle(const int *handles, int n, double *values);
+
+    /**
+    Get typed values of multiple parameters specified by handles, see SE_GetParameterHandle()
+    @handles Array of handles
+    @n Number of handles
+    @values Array of at least n elements, receiving the values
+    @return 0 if successful, -1 if any of the parameters could not be read (e.g. wrong type)
+    */
+    SE_DLL_API int SE_GetParametersBoolByHandle(const int *handles, int n, bool *values);
+
+    /**
+    Set typed values of multiple parameters specified by handles, see SE_GetParameterHandle()
+    @handles Array of handles
+    @n Number of handles
+    @values Array of n values
+    @return 0 if successful, -1 if any of the parameters could not be set (e.g. wrong type)
+    */
+    SE_DLL_API int SE_SetParametersIntByHandle(const int *handles, int n, const int *values);
+
+    /**
+    Set typed values of multiple parameters specified by handles, see SE_GetParameterHandle()
+    @handles Array of handles
+    @n Number of handles
+    @values Array of n values
+    @return 0 if successful, -1 if any of the parameters could not be set (e.g. wrong type)
+    */
+    SE_DLL_API int SE_SetParametersDoubleByHandle(const int *handles, int n, const double *values);
+
+    /**
+    Set typed values of multiple parameters specified by handles, see SE_GetParameterHandle()
+    @handles Array of handles
+    @n Number of handles
+    @values Array of n values
+    @return 0 if successful, -1 if any of the parameters could not be set (e.g. wrong type)
+    */
+    SE_DLL_API int SE_SetParametersBoolByHandle(const int *handles, int n, const bool *values);
+
     SE_DLL_API int SE_SetVariable(SE_Variable variable);
 
     /**
@@ -658,6 +722,68 @@ extern "C"
     */
     SE_DLL_API int SE_SetVariableBool(const char *variableName, bool value);
 
+    /**
+    Get handle of named variable, for fast repeated access by the *ByHandle functions
+    The handle stays valid as long as the set of variables is not changed (e.g. by loading a new scenario)
+    @variableName Name of the variable
+    @return handle (>= 0) if successful, -1 if not found
+    */
+    SE_DLL_API int SE_GetVariableHandle(const char *variableName);
+
+    /**
+    Get typed values of multiple variables specified by handles, see SE_GetVariableHandle()
+    @handles Array of handles
+    @n Number of handles
+    @values Array of at least n elements, receiving the values
+    @return 0 if successful, -1 if any of the variables could not be read (e.g. wrong type)
+    */
+    SE_DLL_API int SE_GetVariablesIntByHandle(const int *handles, int n, int *values);
+
+    /**
+    Get typed values of multiple variables specified by handles, see SE_GetVariableHandle()
+    @handles Array of handles
+    @n Number of handles
+    @values Array of at least n elements, receiving the values
+    @return 0 if successful, -1 if any of the variables could not be read (e.g. wrong type)
+    */
+    SE_DLL_API int SE_GetVariablesDoubleByHandle(const int *handles, int n, double *values);
+
+    /**
+    Get typed values of multiple variables specified by handles, see SE_GetVariableHandle()
+    @handles Array of handles
+    @n Number of handles
+    @values Array of at least n elements, receiving the values
+    @return 0 if successful, -1 if any of the variables could not be read (e.g. wrong type)
+    */
+    SE_DLL_API int SE_GetVariablesBoolByHandle(const int *handles, int n, bool *values);
+
+    /**
+    Set typed values of multiple variables specified by handles, see SE_GetVariableHandle()
+    @handles Array of handles
+    @n Number of handles
+    @values Array of n values
+    @return 0 if successful, -1 if any of the variables could not be set (e.g. wrong type)
+    */
+    SE_DLL_API int SE_SetVariablesIntByHandle(const int *handles, int n, const int *values);
+
+    /**
+    Set typed values of multiple variables specified by handles, see SE_GetVariableHandle()
+    @handles Array of handles
+    @n Number of handles
+    @values Array of n values
+    @return 0 if successful, -1 if any of the variables could not be set (e.g. wrong type)
+    */
+    SE_DLL_API int SE_SetVariablesDoubleByHandle(const int *handles, int n, const double *values);
+
+    /**
+    Set typed values of multiple variables specified by handles, see SE_GetVariableHandle()
+    @handles Array of handles
+    @n Number of handles
+    @values Array of n values
+    @return 0 if successful, -1 if any of the variables could not be set (e.g. wrong type)
+    */
+    SE_DLL_API int SE_SetVariablesBoolByHandle(const int *handles, int n, const bool *values);
+
     SE_DLL_API void *SE_GetODRManager();
 
     /**
@@ -1146,6 +1272,30 @@ extern "C"
     */
     SE_DLL_API int SE_GetRoadSignValidityRecord(int road_id, int signIndex, int validityIndex, SE_RoadObjValidity *validity);
 
+    /**
+            Set state of specified traffic signal, e.g. "off;off;on"
+            @param signal_id Id of the signal
+            @param state State string
+            @return 0 if successful, -1 if not
+    */
+    SE_DLL_API int SE_SetTrafficSignalState(int signal_id, const char *state);
+
+    /**
+            Get current state of specified traffic signal
+            @param signal_id Id of the signal
+            @return State string, or NULL if no state has been set for the signal
+    */
+    SE_DLL_API const char *SE_GetTrafficSignalState(int signal_id);
+
+    /**
+            Get ids of traffic signals which changed state since specified version
+            @param version Pointer to the version of previous call, 0 for all signals. Updated with current version.
+            @param ids Array to be filled with signal ids
+            @param max_n Size of the ids array
+            @return Number of changed signals (may exceed max_n), -1 on error
+    */
+    SE_DLL_API int SE_GetChangedTrafficSignals(unsigned int *version, int *ids, int max_n);
+
     // OSI interface
     //
 
@@ -103,27 +103,23 @@ std::map<int, std::string> ParseModelIds()
         file_name_candidates.push_back(CombineDirectoryPathAndFilepath(SE_Env::Inst().GetPaths()[i] + "/../resources", filename));
     }
 
-    size_t i;
-    for (i = 0; i < file_name_candidates.size(); i++)
+    std::string   path = SE_Env::Inst().LocateFile(file_name_candidates);
+    std::ifstream infile;
+    if (!path.empty())
     {
-        if (FileExists(file_name_candidates[i].c_str()))
+        infile.open(path);
+    }
+
+    if (infile.is_open())
+    {
+        int         id;
+        std::string model3d;
+        while (infile >> id >> model3d)
         {
-            std::ifstream infile(file_name_candidates[i]);
-            if (infile.is_open())
-            {
-                int         id;
-                std::string model3d;
-                while (infile >> id >> model3d)
-                {
-                    entity_model_map[id] = model3d;
-                }
-                break;
-            }
-            infile.close();
+            entity_model_map[id] = model3d;
         }
     }
-
-    if (i == file_name_candidates.size())
+    else
     {
         LOG("Failed to load %s file. Tried:", filename.c_str());
         for (unsigned int j = 0; j < file_name_candidates.size(); j++)
@@ -445,6 +441,16 @@ double PointSquareDistance2D(double x0, double y0, double x1, double y1)
     return (x1 - x0) * (x1 - x0) + (y1 - y0) * (y1 - y0);
 }
 
+void PointSquareDistance2D(double x0, double y0, const double* x, const double* y, double* dist_sq, size_t n)
+{
+    for (size_t i = 0; i < n; i++)
+    {
+        double dx  = x[i] - x0;
+        double dy  = y[i] - y0;
+        dist_sq[i] = dx * dx + dy * dy;
+    }
+}
+
 double PointHeadingDistance2D(double x0, double y0, double h, double x1, double y1)
 {
     (void)h;
@@ -576,6 +582,99 @@ void Local2GlobalCoordinates(double& xTargetGlobal,
     yTargetGlobal = targetYforHost * cos(-thetaGlobal) - targetXforHost * sin(-thetaGlobal) + yHostGlobal;
 }
 
+void SetOBB2D(double x, double y, double h, double center_x, double center_y, double length, double width, OBB2D& obb)
+{
+    double cos_h = cos(h);
+    double sin_h = sin(h);
+
+    obb.axis[0][0] = cos_h;
+    obb.axis[0][1] = sin_h;
+    obb.axis[1][0] = -sin_h;
+    obb.axis[1][1] = cos_h;
+    obb.half[0]    = length / 2.0;
+    obb.half[1]    = width / 2.0;
+    obb.center[0]  = x + center_x * cos_h - center_y * sin_h;
+    obb.center[1]  = y + center_x * sin_h + center_y * cos_h;
+
+    // Corners, starting at first quadrant (front left) going counter clockwise
+    const double sign[4][2] = {{1.0, 1.0}, {-1.0, 1.0}, {-1.0, -1.0}, {1.0, -1.0}};
+    for (int i = 0; i < 4; i++)
+    {
+        double l          = sign[i][0] * obb.half[0];
+        double w          = sign[i][1] * obb.half[1];
+        obb.corners[i][0] = obb.center[0] + l * obb.axis[0][0] + w * obb.axis[1][0];
+        obb.corners[i][1] = obb.center[1] + l * obb.axis[0][1] + w * obb.axis[1][1];
+    }
+}
+
+void ProjectOBB2D(const OBB2D& obb, const double axis[2], double& min, double& max)
+{
+    double c = GetDotProduct2D(obb.center[0], obb.center[1], axis[0], axis[1]);
+    double r = obb.half[0] * fabs(GetDotProduct2D(obb.axis[0][0], obb.axis[0][1], axis[0], axis[1])) +
+               obb.half[1] * fabs(GetDotProduct2D(obb.axis[1][0], obb.axis[1][1], axis[0], axis[1]));
+    min      = c - r;
+    max      = c + r;
+}
+
+double DistanceFromPointToOBB2D(const OBB2D& obb, double x, double y, double* xProj, double* yProj)
+{
+    double dx = x - obb.center[0];
+    double dy = y - obb.center[1];
+
+    double l = CLAMP(GetDotProduct2D(dx, dy, obb.axis[0][0], obb.axis[0][1]), -obb.half[0], obb.half[0]);
+    double w = CLAMP(GetDotProduct2D(dx, dy, obb.axis[1][0], obb.axis[1][1]), -obb.half[1], obb.half[1]);
+
+    *xProj = obb.center[0] + l * obb.axis[0][0] + w * obb.axis[1][0];
+    *yProj = obb.center[1] + l * obb.axis[0][1] + w * obb.axis[1][1];
+
+    return GetLengthOfLine2D(x, y, *xProj, *yProj);
+}
+
+bool OverlapOBB2D(const OBB2D& obb0, const OBB2D& obb1, double tolerance)
+{
+    const OBB2D* obb[2] = {&obb0, &obb1};
+
+    for (int i = 0; i < 2; i++)
+    {
+        for (int j = 0; j < 2; j++)
+        {
+            double min[2] = {0.0, 0.0}, max[2] = {0.0, 0.0};
+            ProjectOBB2D(obb0, obb[i]->axis[j], min[0], max[0]);
+            ProjectOBB2D(obb1, obb[i]->axis[j], min[1], max[1]);
+
+            if (max[0] < min[1] - tolerance || min[0] > max[1] + tolerance)
+            {
+                return false;  // gap found
+            }
+        }
+    }
+
+    return true;
+}
+
+double FreeSpaceDistanceOBB2D(const OBB2D& obb0, const OBB2D& obb1)
+{
+    double       min_dist = LARGE_NUMBER;
+    const OBB2D* obb[2]   = {&obb0, &obb1};
+
+    for (int i = 0; i < 2; i++)
+    {
+        for (int j = 0; j < 4; j++)
+        {
+            double x_proj = 0.0;
+            double y_proj = 0.0;
+            double dist   = DistanceFromPointToOBB2D(*obb[(i + 1) % 2], obb[i]->corners[j][0], obb[i]->corners[j][1], &x_proj, &y_proj);
+
+            if (dist < min_dist)
+            {
+                min_dist = dist;
+            }
+        }
+    }
+
+    return min_dist;
+}
+
 void SwapByteOrder(unsigned char* buf, int data_type_size, int buf_size)
 {
     unsigned char* ptr = buf;
@@ -651,11 +750,50 @@ void SE_sleep(unsigned int msec)
 
 #endif
 
+#include <chrono>
+#ifdef __linux__
+#include <time.h>
+#include <errno.h>
+#endif
+
+// Remaining time before a deadline spent busy waiting, covering scheduler wake-up latency
+#define SE_SLEEP_SPIN_NS 200000
+
+__int64 SE_getMonotonicTimeNs()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void SE_sleepUntilNs(__int64 deadline_ns)
+{
+    __int64 sleep_until_ns = deadline_ns - SE_SLEEP_SPIN_NS;
+
+    if (SE_getMonotonicTimeNs() < sleep_until_ns)
+    {
+#ifdef __linux__
+        // steady_clock is CLOCK_MONOTONIC on Linux, so the absolute deadline can be passed on directly
+        struct timespec ts;
+        ts.tv_sec  = sleep_until_ns / 1000000000;
+        ts.tv_nsec = sleep_until_ns % 1000000000;
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, nullptr) == EINTR)
+        {
+        }
+#else
+        std::this_thread::sleep_until(std::chrono::steady_clock::time_point(std::chrono::nanoseconds(sleep_until_ns)));
+#endif
+    }
+
+    while (SE_getMonotonicTimeNs() < deadline_ns)
+    {
+        std::this_thread::yield();
+    }
+}
+
 double SE_getSimTimeStep(__int64& time_stamp, double min_time_step, double max_time_step)
 {
     double dt;
 
-    __int64 now = SE_getSystemTime();
+    __int64 now = SE_getMonotonicTimeNs();
 
     if (time_stamp == 0)
     {
@@ -664,17 +802,17 @@ double SE_getSimTimeStep(__int64& time_stamp, double min_time_step, double max_t
     }
     else
     {
-        dt = static_cast<double>(now - time_stamp) * 0.001;  // step size in seconds
+        dt = static_cast<double>(now - time_stamp) * 1E-9;  // step size in seconds
 
         if (dt > max_time_step)  // limit step size
         {
             dt = max_time_step;
         }
-        else if (dt < min_time_step)  // avoid CPU rush, sleep for a while
+        else if (dt < min_time_step)  // avoid CPU rush, sleep for the remaining part of the minimal step
         {
-            SE_sleep(static_cast<unsigned int>(static_cast<int>(min_time_step - dt) * 1000));
-            now = SE_getSystemTime();
-            dt  = static_cast<double>(now - time_stamp) * 0.001;
+            SE_sleepUntilNs(time_stamp + static_cast<__int64>(min_time_step * 1E9));
+            now = SE_getMonotonicTimeNs();
+            dt  = static_cast<double>(now - time_stamp) * 1E-9;
         }
     }
     time_stamp = now;
@@ -682,6 +820,63 @@ double SE_getSimTimeStep(__int64& time_stamp, double min_time_step, double max_t
     return dt;
 }
 
+void SE_RealTimePacer::Pace(double dt)
+{
+    if (!Enabled())
+    {
+        return;
+    }
+
+    __int64 now = SE_getMonotonicTimeNs();
+
+    if (deadline_ns_ == 0)
+    {
+        // First frame, start schedule from now
+        deadline_ns_ = now;
+        return;
+    }
+
+    deadline_ns_ += static_cast<__int64>(dt / factor_ * 1E9);
+    n_frames_++;
+
+    if (now > deadline_ns_)
+    {
+        double overrun = static_cast<double>(now - deadline_ns_) * 1E-9;
+
+        n_overruns_++;
+        total_overrun_ += overrun;
+        max_overrun_ = MAX(max_overrun_, overrun);
+
+        if (overrun > max_lag_)
+        {
+            // Too far behind, restart schedule instead of running subsequent frames back-to-back
+            deadline_ns_ = now;
+            n_resyncs_++;
+        }
+    }
+    else
+    {
+        SE_sleepUntilNs(deadline_ns_);
+    }
+}
+
+void SE_RealTimePacer::LogStats()
+{
+    if (n_frames_ == 0)
+    {
+        return;
+    }
+
+    LOG("Real-time pacing (factor %.2f): %u of %u frames overran deadline (%.1f%%), mean %.2f ms, max %.2f ms, %u resyncs",
+        factor_,
+        n_overruns_,
+        n_frames_,
+        100.0 * n_overruns_ / n_frames_,
+        1E3 * GetMeanOverrun(),
+        1E3 * max_overrun_,
+        n_resyncs_);
+}
+
 std::vector<std::string> SplitString(const std::string& s, char separator)
 {
     std::vector<std::string> output;
@@ -930,11 +1125,115 @@ int SE_Env::AddPath(std::string path)
             return -1;
         }
     }
+
+    std::lock_guard<std::mutex> lock(fileCacheMutex_);
+    CheckFileCache();
     paths_.push_back(path);
 
+    // An additional path might resolve failed lookups, while successful ones are still valid
+    DropFailedLookups();
+    cachedPaths_ = paths_;
+
     return 0;
 }
 
+void SE_Env::ClearPaths()
+{
+    std::lock_guard<std::mutex> lock(fileCacheMutex_);
+    paths_.clear();
+    locatedFiles_.clear();
+    resolvedFiles_.clear();
+    cachedPaths_.clear();
+}
+
+void SE_Env::CheckFileCache()
+{
+    // Any other change of registered paths invalidates the cache, e.g. when paths are modified via GetPaths()
+    if (cachedPaths_ != paths_)
+    {
+        locatedFiles_.clear();
+        resolvedFiles_.clear();
+        cachedPaths_ = paths_;
+    }
+}
+
+void SE_Env::DropFailedLookups()
+{
+    for (auto it = locatedFiles_.begin(); it != locatedFiles_.end();)
+    {
+        it = it->second.empty() ? locatedFiles_.erase(it) : std::next(it);
+    }
+
+    for (auto it = resolvedFiles_.begin(); it != resolvedFiles_.end();)
+    {
+        it = it->second.empty() ? resolvedFiles_.erase(it) : std::next(it);
+    }
+}
+
+std::string SE_Env::LocateFile(const std::vector<std::string>& candidates)
+{
+    std::string key;
+    for (size_t i = 0; i < candidates.size(); i++)
+    {
+        key.append(candidates[i]).push_back('\n');
+    }
+
+    std::lock_guard<std::mutex> lock(fileCacheMutex_);
+    CheckFileCache();
+
+    auto it = locatedFiles_.find(key);
+    if (it != locatedFiles_.end())
+    {
+        return it->second;
+    }
+
+    std::string path;
+    for (size_t i = 0; i < candidates.size(); i++)
+    {
+        if (FileExists(candidates[i].c_str()))
+        {
+            path = candidates[i];
+            break;
+        }
+    }
+    locatedFiles_.emplace(std::move(key), path);
+
+    return path;
+}
+
+std::string SE_Env::ResolveFilePath(const std::string& filename)
+{
+    std::lock_guard<std::mutex> lock(fileCacheMutex_);
+    CheckFileCache();
+
+    auto it = resolvedFiles_.find(filename);
+    if (it != resolvedFiles_.end())
+    {
+        return it->second;
+    }
+
+    std::string path;
+    for (size_t i = 0; i < paths_.size(); i++)
+    {
+        std::string candidate = CombineDirectoryPathAndFilepath(paths_[i], filename);
+        if (FileExists(candidate.c_str()))
+        {
+            path = candidate;
+            break;
+        }
+    }
+    resolvedFiles_.emplace(filename, path);
+
+    return path;
+}
+
+void SE_Env::ClearFileCache()
+{
+    std::lock_guard<std::mutex> lock(fileCacheMutex_);
+    locatedFiles_.clear();
+    resolvedFiles_.clear();
+}
+
 std::string SE_Env::GetModelFilenameById(int model_id)
 {
     std::string name;
@@ -984,6 +1283,12 @@ void Logger::Log(bool quit, bool trace, char const* file, char const* func, int
     static char complete_entry[2048];
     static char message[1024];
 
+    if (!quit && !IsEnabled())
+    {
+        // no receiver, skip formatting
+        return;
+    }
+
     mutex_.Lock();  // Protect from simultanous use from different threads
 
     va_list args;
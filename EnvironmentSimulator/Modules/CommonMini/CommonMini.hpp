@@ -21,6 +21,7 @@
 #include <condition_variable>
 #include <cstring>
 #include <map>
+#include <unordered_map>
 
 #ifndef _WIN32
 #include <inttypes.h>
@@ -57,6 +58,7 @@ typedef int64_t __int64;
 #define IS_IN_SPAN(x, y, z)           ((x) >= (y) && (x) <= (z))
 #define OSI_MAX_LONGITUDINAL_DISTANCE 50
 #define OSI_MAX_LATERAL_DEVIATION     0.05
+#define LOOKAHEAD_RESOLUTION          1.0
 #define LOG_FILENAME                  "log.txt"
 #define DAT_FILENAME                  "sim.dat"
 #define GHOST_TRAIL_SAMPLE_TIME       0.2
@@ -86,8 +88,12 @@ typedef int64_t __int64;
 
 // Time functions
 __int64 SE_getSystemTime();
+__int64 SE_getMonotonicTimeNs();  // steady clock, nanoseconds, unaffected by wall clock adjustments
 void    SE_sleep(unsigned int msec);
-double  SE_getSimTimeStep(__int64& time_stamp, double min_time_step, double max_time_step);
+void    SE_sleepUntilNs(__int64 deadline_ns);  // sleep until given SE_getMonotonicTimeNs() time, spinning the last fraction
+
+// Returns elapsed wall time since previous call, clamped to [min_time_step, max_time_step]. time_stamp is opaque (ns).
+double SE_getSimTimeStep(__int64& time_stamp, double min_time_step, double max_time_step);
 
 // Useful types
 enum class KeyType  // copy key enums from OSG GUIEventAdapter
@@ -381,6 +387,18 @@ double PointToLineDistance2DSigned(double px, double py, double lx0, double ly0,
 */
 double PointSquareDistance2D(double x0, double y0, double x1, double y1);
 
+/**
+        Calculate square distance from one 2D point to each point of an array, batch variant of the function above
+        Coordinates are given in separate x and y arrays, a layout which allows the compiler to vectorize the loop
+        @param x0 X coordinate of the reference point
+        @param y0 Y coordinate of the reference point
+        @param x X coordinates of the points to measure to
+        @param y Y coordinates of the points to measure to
+        @param dist_sq Resulting square distances, one per point
+        @param n Number of points
+*/
+void PointSquareDistance2D(double x0, double y0, const double* x, const double* y, double* dist_sq, size_t n);
+
 /**
         Project a 2D point on a 2D line (specified start- and endpoint)
         Project a 2D point on a 2D vector (from origin to specified point)
@@ -523,6 +541,62 @@ void Local2GlobalCoordinates(double& xTargetGlobal,
                              double  targetXforHost,
                              double  targetYforHost);
 
+/**
+        Oriented bounding box in world coordinates
+*/
+typedef struct
+{
+    double corners[4][2];  // x, y of corners, starting at front left going counter clockwise
+    double axis[2][2];     // unit vectors along longitudinal and lateral box sides, also serving as edge normals
+    double center[2];      // x, y of box center
+    double half[2];        // half length and half width
+} OBB2D;
+
+/**
+        Establish oriented bounding box from reference point, heading and box dimensions
+        @param x X-coordinate of the reference point
+        @param y Y-coordinate of the reference point
+        @param h Heading
+        @param center_x Longitudinal offset of box center relative reference point
+        @param center_y Lateral offset of box center relative reference point
+        @param length Box length
+        @param width Box width
+        @param obb Resulting box
+*/
+void SetOBB2D(double x, double y, double h, double center_x, double center_y, double length, double width, OBB2D& obb);
+
+/**
+        Project oriented bounding box onto given unit axis, returning the resulting interval
+*/
+void ProjectOBB2D(const OBB2D& obb, const double axis[2], double& min, double& max);
+
+/**
+        Measure distance from point to oriented bounding box. Strategy: Clamp the point, expressed in box local coordinates, to the box extent
+        @param obb The box
+        @param x X-coordinate of the point to check
+        @param y Y-coordinate of the point to check
+        @param xProj Return the X-coordinate of closest point on box
+        @param yProj Return the Y-coordinate of closest point on box
+        @return the distance, zero if point is inside the box
+*/
+double DistanceFromPointToOBB2D(const OBB2D& obb, double x, double y, double* xProj, double* yProj);
+
+/**
+        Check whether two oriented bounding boxes overlap. Strategy: Separating Axis Theorem (SAT), since the boxes
+        have parallel sides only the two side normals of each box need to be checked
+        @param tolerance Gaps up to this size are regarded as overlap
+        @return true if overlapping, else false
+*/
+bool OverlapOBB2D(const OBB2D& obb0, const OBB2D& obb1, double tolerance);
+
+/**
+        Measure free space distance between two separated oriented bounding boxes. Strategy: For two separated convex
+        polygons the closest points are found between a vertex of one of them and the other polygon, hence measure
+        from each corner of one box to the other box, and vice versa
+        @return the distance, not valid for overlapping boxes
+*/
+double FreeSpaceDistanceOBB2D(const OBB2D& obb0, const OBB2D& obb1);
+
 /**
         Normalize a 2D vector
 */
@@ -695,6 +769,12 @@ public:
         return file_.is_open();
     }
 
+    // True if log entries will end up anywhere, i.e. file or callback
+    bool IsEnabled()
+    {
+        return file_.is_open() || callback_ != 0;
+    }
+
 private:
     Logger();
     ~Logger();
@@ -904,6 +984,92 @@ public:
     }
 };
 
+/**
+        Keeps a fixed timestep simulation in pace with wall clock time, scaled by a real-time factor.
+        Deadlines are absolute, so sleep jitter does not accumulate over frames. Frames finishing
+        after their deadline are counted as overruns. Overruns exceeding max_lag resynchronize
+        the schedule instead of rushing subsequent frames to catch up.
+*/
+class SE_RealTimePacer
+{
+public:
+    SE_RealTimePacer() : factor_(0.0), max_lag_(0.1), deadline_ns_(0)
+    {
+        ResetStats();
+    }
+
+    /**
+            Set real-time factor, e.g. 1.0 = real time, 2.0 = twice as fast. 0.0 (or negative) disables pacing.
+    */
+    void SetFactor(double factor)
+    {
+        factor_      = factor;
+        deadline_ns_ = 0;
+    }
+
+    /**
+            Start a new schedule from next call to Pace(), e.g. after a pause
+    */
+    void Restart()
+    {
+        deadline_ns_ = 0;
+    }
+    double GetFactor()
+    {
+        return factor_;
+    }
+    bool Enabled()
+    {
+        return factor_ > SMALL_NUMBER;
+    }
+
+    /**
+            Wait until the wall clock has caught up with the simulation having advanced dt seconds
+            since previous call. First call only establishes the start of the schedule.
+    */
+    void Pace(double dt);
+
+    void ResetStats()
+    {
+        n_frames_      = 0;
+        n_overruns_    = 0;
+        n_resyncs_     = 0;
+        max_overrun_   = 0.0;
+        total_overrun_ = 0.0;
+    }
+    unsigned int GetNumberOfFrames()
+    {
+        return n_frames_;
+    }
+    unsigned int GetNumberOfOverruns()
+    {
+        return n_overruns_;
+    }
+    double GetMaxOverrun()
+    {
+        return max_overrun_;
+    }
+    double GetMeanOverrun()
+    {
+        return n_overruns_ > 0 ? total_overrun_ / n_overruns_ : 0.0;
+    }
+
+    /**
+            Log overrun statistics, if any frames have been paced
+    */
+    void LogStats();
+
+private:
+    double       factor_;
+    double       max_lag_;
+    __int64      deadline_ns_;
+    unsigned int n_frames_;
+    unsigned int n_overruns_;
+    unsigned int n_resyncs_;
+    double       max_overrun_;
+    double       total_overrun_;
+};
+
 class SE_SimulationTimer
 {
 public:
@@ -1099,10 +1265,13 @@ public:
     SE_Env()
         : osiMaxLongitudinalDistance_(OSI_MAX_LONGITUDINAL_DISTANCE),
           osiMaxLateralDeviation_(OSI_MAX_LATERAL_DEVIATION),
+          lookAheadResolution_(LOOKAHEAD_RESOLUTION),
           logFilePath_(LOG_FILENAME),
           datFilePath_(""),
           offScreenRendering_(true),
-          collisionDetection_(false)
+          collisionDetection_(false),
+          loadThreads_(0),
+          profileLoad_(false)
     {
     }
 
@@ -1124,6 +1293,20 @@ public:
     {
         return osiMaxLateralDeviation_;
     }
+
+    /**
+            Specify max distance between points of road and lane profiles, used for look-ahead by controllers
+            Note: Needs to be called prior to loading the road network
+            @param resolution Max distance (m) between profile points, default 1.0
+    */
+    void SetLookAheadResolution(double resolution)
+    {
+        lookAheadResolution_ = resolution;
+    }
+    double GetLookAheadResolution()
+    {
+        return lookAheadResolution_;
+    }
     void SetOffScreenRendering(bool enable)
     {
         offScreenRendering_ = enable;
@@ -1140,15 +1323,52 @@ public:
     {
         return collisionDetection_;
     }
+
+    /**
+            Specify number of threads for parallel stages of OpenDRIVE loading
+            @param n_threads Number of threads, 0 (default) for one per hardware thread, 1 to load sequentially
+    */
+    void SetLoadThreads(int n_threads)
+    {
+        loadThreads_ = n_threads;
+    }
+    int GetLoadThreads()
+    {
+        return loadThreads_;
+    }
+    void SetProfileLoad(bool enable)
+    {
+        profileLoad_ = enable;
+    }
+    bool GetProfileLoad()
+    {
+        return profileLoad_;
+    }
     std::vector<std::string>& GetPaths()
     {
         return paths_;
     }
     int  AddPath(std::string path);
-    void ClearPaths()
-    {
-        paths_.clear();
-    }
+    void ClearPaths();
+
+    /**
+            Find first existing file among given candidates. The result, including a failed lookup, is cached.
+            Failed lookups are dropped from the cache by AddPath(), ClearPaths() and ClearFileCache(). The whole
+            cache is dropped by ClearPaths(), ClearFileCache() or any other change of the registered paths.
+            @param candidates File paths in order of preference
+            @return Path of first existing candidate, empty string if none found
+    */
+    std::string LocateFile(const std::vector<std::string>& candidates);
+
+    /**
+            Find file in registered paths. The result is cached in the same way as for LocateFile().
+            @param filename File path relative any of the registered paths
+            @return Path of first match, empty string if not found
+    */
+    std::string ResolveFilePath(const std::string& filename);
+
+    void ClearFileCache();
+
     double GetSystemTime()
     {
         return systemTime_.GetS();
@@ -1211,13 +1431,25 @@ private:
     std::vector<std::string>   paths_;
     double                     osiMaxLongitudinalDistance_;
     double                     osiMaxLateralDeviation_;
+    double                     lookAheadResolution_;
     std::string                logFilePath_;
     std::string                datFilePath_;
     SE_SystemTime              systemTime_;
     SE_Rand                    rand_;
     bool                       offScreenRendering_;
     bool                       collisionDetection_;
+    int                        loadThreads_;
+    bool                       profileLoad_;
     std::map<int, std::string> entity_model_map;
+
+    // file lookup cache, guarded since models might be resolved from the viewer thread
+    std::unordered_map<std::string, std::string> locatedFiles_;   // candidates joined by '\n' -> first existing file, empty if none
+    std::unordered_map<std::string, std::string> resolvedFiles_;  // filename -> path found in registered paths, empty if none
+    std::vector<std::string>                     cachedPaths_;    // registered paths at time of caching
+    std::mutex                                   fileCacheMutex_;
+
+    void CheckFileCache();
+    void DropFailedLookups();
 };
 
 /**
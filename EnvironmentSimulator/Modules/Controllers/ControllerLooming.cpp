@@ -39,6 +39,12 @@ ControllerLooming::ControllerLooming(InitArgs* args) : Controller(args)
     }
 }
 
+// Angle to a point, relative to the heading of the position
+static double RelativeAngle(const roadmanager::Position& pos, double x, double y)
+{
+    return GetAngleInIntervalMinusPIPlusPI(atan2(y - pos.GetY(), x - pos.GetX()) - pos.GetH());
+}
+
 void ControllerLooming::Step(double timeStep)
 {
     // looming controller properties
@@ -52,241 +58,109 @@ void ControllerLooming::Step(double timeStep)
     double far_x     = 0.0;
     double far_y     = 0.0;
     double far_tan_s = 0.0;
+    double nearAngle = 0.0;
+    double near_x    = 0.0;
+    double near_y    = 0.0;
 
-    hasFarTan              = false;
-    int    road_counter    = -1;
-    int    laneSec_counter = -1;
-    bool   isIntersection  = false;
-    double dist            = 0.0;
+    hasFarTan = false;
 
     currentSpeed_ = object_->GetSpeed();
 
-    roadmanager::RoadProbeInfo s_data;
+    // Look-ahead along current lane from precalculated lane profiles, shared with other vehicles on same stretch of lane
+    roadmanager::Position& pos       = object_->pos_;
+    int                    direction = IsAngleForward(pos.GetHRelative()) ? 1 : -1;
+    const roadmanager::LookAheadPath& path =
+        roadmanager::Position::GetOpenDrive()->GetLookAheadPath(pos.GetTrackIdx(), pos.GetLaneSectionIdx(), pos.GetLaneId(), pos.GetS(), direction, farPointDistance);
+
+    double d0   = direction * (pos.GetS() - path.s_start);  // path distance at ego position
+    double dist = path.GetLength() - d0;                     // distance to end of look-ahead path
+
     // fixed near point
-    object_->pos_.GetProbeInfo(nearPointDistance, &s_data, roadmanager::Position::LookAheadMode::LOOKAHEADMODE_AT_LANE_CENTER);
-    double nearAngle = s_data.relative_h;
+    if (path.GetPos(d0 + nearPointDistance, 1, near_x, near_y))
+    {
+        nearAngle = RelativeAngle(pos, near_x, near_y);
+    }
+    else
+    {
+        // path too short, e.g. junction ahead, probe along road network instead
+        roadmanager::RoadProbeInfo s_data;
+        pos.GetProbeInfo(nearPointDistance, &s_data, roadmanager::Position::LookAheadMode::LOOKAHEADMODE_AT_LANE_CENTER);
+        nearAngle = s_data.relative_h;
+    }
 
-    roadmanager::OpenDrive* odr = roadmanager::Position::GetOpenDrive();
-    if (odr != NULL)
+    // Search far tangent point, where angle to lane border points stops increasing (or decreasing)
+    int    counter[2]         = {0, 0};      // left, right
+    double angle_diff_prev[2] = {0.0, 0.0};  // left, right
+    double far_x_prev[2]      = {0.0, 0.0};
+    double far_y_prev[2]      = {0.0, 0.0};
+    double far_tan_s_prev[2]  = {0.0, 0.0};
+    double h_drive            = pos.GetHRoad() + (direction == 1 ? 0.0 : M_PI);  // road heading in driving direction
+    double far_angle_prev[2]  =  // initial angle to points parallel to Ego
+        {GetAngleInIntervalMinusPIPlusPI(h_drive + M_PI_2), GetAngleInIntervalMinusPIPlusPI(h_drive - M_PI_2)};  // left, right
+    double dist_left = -1.0;  // the distance from ego vehicle to the tangent point found on left side
+
+    for (int m = 0; m < 2; m++)  // m==0: Left, m==1: Right
     {
-        roadmanager::Road* road = odr->GetRoadById(object_->pos_.GetTrackId());
-        if (road == nullptr)
+        for (const roadmanager::LookAheadPath::Point& point : path.points)
         {
-            LOG("Road ID %d", object_->pos_.GetTrackId());
-            return;
-        }
-
-        int    counter[2]         = {0, 0};      // left, right
-        double angle_diff_prev[2] = {0.0, 0.0};  // left, right
-        double far_x_prev[2]      = {0.0, 0.0};
-        double far_y_prev[2]      = {0.0, 0.0};
-        double far_tan_s_prev[2]  = {0.0, 0.0};
-        double far_angle_prev[2]  =  // initial angle to points parallel to Ego
-            {GetAngleInIntervalMinusPIPlusPI(object_->pos_.GetHRoad() + M_PI_2),
-             GetAngleInIntervalMinusPIPlusPI(object_->pos_.GetHRoad() - M_PI_2)};  // left, right
-
-        if (!IsAngleForward(object_->pos_.GetHRelative()))
-        {  // According to direction switch initial angle to points parallel to Ego
-            far_angle_prev[0] = GetAngleInIntervalMinusPIPlusPI(object_->pos_.GetHRoad() - M_PI_2);
-            far_angle_prev[1] = GetAngleInIntervalMinusPIPlusPI(object_->pos_.GetHRoad() + M_PI_2);
-        }
-
-        roadmanager::Road* roadTemp       = nullptr;
-        int                direction      = IsAngleForward(object_->pos_.GetHRelative());
-        int                direction_prev = direction;
-        roadmanager::Lane* lane           = nullptr;
+            double farTanS_tmp = point.ds - d0;
 
-        while (!hasFarTan && dist < farPointDistance)
-        {
-            roadmanager::LaneSection* lsec = nullptr;
-            if (road_counter == -1)  // first time, first road, same as ego vehicle is located
+            if (farTanS_tmp < SMALL_NUMBER)
             {
-                roadTemp = road;
-                // On this road, find out whether we're moving along the road s-direction or not
-                direction = IsAngleForward(object_->pos_.GetHRelative()) ? 1 : -1;
+                continue;  // only check points in front of ego
             }
-            else
+            else if (farTanS_tmp > farPointDistance)
             {
-                // decide whether to pick next road as successor or predecessor
-                // based on the current direction
-                roadmanager::RoadLink* roadLink =
-                    roadTemp->GetLink(direction == 1 ? roadmanager::LinkType::SUCCESSOR : roadmanager::LinkType::PREDECESSOR);
-
-                if (roadLink == nullptr)
-                {
-                    break;  // no more connecting roads
-                }
-
-                if (roadLink->GetElementType() == roadmanager::RoadLink::ElementType::ELEMENT_TYPE_JUNCTION)
-                {
-                    isIntersection = true;
-                    break;  // currently intersection not considered.
-                }
-
-                roadTemp = odr->GetRoadById(roadLink->GetElementId());
-
-                // we just entered a new road, and we have a road link.
-                // Compare direction of new road with the previous one
-                direction_prev = direction;
-                if ((direction == 1 && roadLink->GetContactPointType() == roadmanager::ContactPointType::CONTACT_POINT_END) ||
-                    (direction == -1 && roadLink->GetContactPointType() == roadmanager::ContactPointType::CONTACT_POINT_START))
-                {
-                    // New road has opposite direction, change sign of direction variable
-                    direction *= -1;
-                }
+                break;  // looked passed 80 meters, we can quit now
             }
-
-            road_counter++;
-            double dist_lsec = 0.0;
-            for (int n = 0; !hasFarTan && dist + dist_lsec < farPointDistance && n < roadTemp->GetNumberOfLaneSections(); n++)
+            else if (m == 1 && hasFarTan && farTanS_tmp > dist_left)
             {
-                int current_laneSec_idx = n;
-                if (direction == -1)
-                {  // switch lanesec index according to direction of ego
-                    current_laneSec_idx = roadTemp->GetNumberOfLaneSections() - 1 - n;
-                }
-
-                lsec = roadTemp->GetLaneSectionByIdx(current_laneSec_idx);  // pick lanesec by lanesec id
-                if (lsec == nullptr)
-                {
-                    LOG("Unexpected missing lane Section");
-                    return;
-                }
-                if (road_counter == 0)
-                {
-                    // lane = lsec->GetLaneById(object_->pos_.GetLaneId());
-                    if (laneSec_counter < 0)
-                    {
-                        lane = lsec->GetLaneById(object_->pos_.GetLaneId());
-                    }
-                    else if (laneSec_counter >= 0)
-                    {
-                        lane = lsec->GetLaneById(
-                            lane->GetLink(direction_prev == 1 ? roadmanager::LinkType::SUCCESSOR : roadmanager::LinkType::PREDECESSOR)->GetId());
-                    }
-                }
-                else if (road_counter > 0)
-                {
-                    // for lane links, we look from previous lane, hence switch direction
-                    roadmanager::LaneLink* link =
-                        lane->GetLink(direction_prev == 1 ? roadmanager::LinkType::SUCCESSOR : roadmanager::LinkType::PREDECESSOR);
-                    if (link == nullptr)
-                    {
-                        LOG("Unexpected missing lane link");
-                        return;
-                    }
+                // we're on right side, and already passed a found tangent point on left side
+                // no need to look further. Left side "win".
+                break;
+            }
 
-                    lane = lsec->GetLaneById(link->GetId());
-                }
-                std::vector<roadmanager::PointStruct> osi_points = lane->GetOSIPoints()->GetPoints();
+            double far_x_tmp    = point.x[m == 0 ? 0 : 2];
+            double far_y_tmp    = point.y[m == 0 ? 0 : 2];
+            double farAngle_tmp = GetAngleInIntervalMinusPIPlusPI(atan2(far_y_tmp - pos.GetY(), far_x_tmp - pos.GetX()));
+            angleDiff           = GetAngleDifference(farAngle_tmp, far_angle_prev[m]);
 
-                double dist_left = -1.0;  // the distance from ego vehicle to the closest found tangent point
-                laneSec_counter++;
-                for (int m = 0; m < 2; m++)  // m==0: Left, m==1: Right
+            if (counter[m] > 0)
+            {
+                if (abs(angleDiff) > SMALL_NUMBER &&  // skip points at same angle (e.g. identical position)
+                    SIGN(angleDiff) != SIGN(angle_diff_prev[m]))
                 {
-                    // road 0: start from first OSI point, othe roads: skip first since coinciding with last on previous
-                    for (size_t k = road_counter == 0 ? 0 : 1; k < osi_points.size(); k++)
+                    hasFarTan = true;
+                    far_x     = far_x_prev[m];
+                    far_y     = far_y_prev[m];
+                    far_tan_s = far_tan_s_prev[m];
+                    far_angle = far_angle_prev[m];
+
+                    if (m == 0)
                     {
-                        size_t cur_idx = k;
-                        if (direction == -1)  // first road
-                        {
-                            cur_idx = osi_points.size() - 1 - k;
-                        }
-
-                        if ((road_counter == 0 &&  // first road
-                             ((direction == 1 && osi_points[cur_idx].s - object_->pos_.GetS() > farPointDistance) ||
-                              (direction == -1 && object_->pos_.GetS() - osi_points[cur_idx].s > farPointDistance))) ||
-                            // Not first road
-                            (road_counter > 0 &&  // missed this check
-                             ((direction == 1 && dist + osi_points[cur_idx].s > farPointDistance) ||
-                              (direction == -1 && dist + dist_lsec - osi_points[cur_idx].s > farPointDistance))))
-                        {
-                            break;  // looked passed 80 meters, we can quit now
-                        }
-
-                        // we're on right side, and already passed a found tangent point on left side
-                        // no need to look further. Left side "win".
-                        else if (m == 1 && hasFarTan &&
-                                 ((road_counter == 0 &&  // first road
-                                   ((direction == 1 && osi_points[cur_idx].s > object_->pos_.GetS() + dist_left) ||
-                                    (direction == -1 && osi_points[cur_idx].s < object_->pos_.GetS() - dist_left))) ||
-                                  (road_counter > 0 &&  // Not first road
-                                   ((direction == 1 && osi_points[cur_idx].s > dist_left - dist) ||
-                                    (direction == -1 && lsec->GetLength() - osi_points[cur_idx].s > dist_left - dist)))))
-                        {
-                            break;
-                        }
-
-                        else if (road_counter > 0 ||  // Not first round, let's look at OSI points from start of road
-                                                      // First round, only check OSI points in front of ego
-                                 (direction == 1 && osi_points[cur_idx].s > object_->pos_.GetS()) ||
-                                 (direction == -1 && osi_points[cur_idx].s < object_->pos_.GetS()))
-                        {
-                            double xr = 0.0, yr = 0.0;
-                            double local_x = 0.0;
-                            double local_y = (m == 0 ? +1 : -1) * road->GetLaneWidthByS(osi_points[cur_idx].s, object_->pos_.GetLaneId()) / 2;
-                            local_y        = (direction == 1 ? local_y : -local_y);  // switch y position according to ego driving side
-                            RotateVec2D(local_x, local_y, osi_points[cur_idx].h, xr, yr);
-                            double far_x_tmp   = osi_points[cur_idx].x + xr;
-                            double far_y_tmp   = osi_points[cur_idx].y + yr;
-                            double farTanS_tmp = dist + (direction == 1 ? osi_points[cur_idx].s : dist_lsec - osi_points[cur_idx].s);
-                            if (road_counter == 0)
-                            {
-                                // subtract object position
-                                farTanS_tmp -= (direction == 1 ? object_->pos_.GetS() : road->GetLength() - object_->pos_.GetS());
-                            }
-
-                            double farAngle_tmp =
-                                GetAngleInIntervalMinusPIPlusPI(atan2(far_y_tmp - object_->pos_.GetY(), far_x_tmp - object_->pos_.GetX()));
-                            angleDiff = GetAngleDifference(farAngle_tmp, far_angle_prev[m]);
-
-                            if (counter[m] > 0)
-                            {
-                                if (abs(angleDiff) > SMALL_NUMBER &&  // skip points at same angle (e.g. identical position)
-                                    SIGN(angleDiff) != SIGN(angle_diff_prev[m]))
-                                {
-                                    // LOG("has far tan");
-                                    hasFarTan = true;
-                                    far_x     = far_x_prev[m];
-                                    far_y     = far_y_prev[m];
-                                    far_tan_s = far_tan_s_prev[m];
-                                    far_angle = far_angle_prev[m];
-
-                                    if (m == 0)
-                                    {
-                                        dist_left = far_tan_s_prev[m];
-                                    }
-                                    break;
-                                }
-                            }
-
-                            // Store info on farest point so far on this side of the road
-                            far_x_prev[m]     = far_x_tmp;
-                            far_y_prev[m]     = far_y_tmp;
-                            far_tan_s_prev[m] = farTanS_tmp;
-                            far_angle_prev[m] = farAngle_tmp;
-                            if (abs(angleDiff) > SMALL_NUMBER)
-                            {
-                                angle_diff_prev[m] = angleDiff;
-                            }
-
-                            counter[m] += 1;  // Switch to right side
-                        }
+                        dist_left = far_tan_s_prev[m];
                     }
+                    break;
                 }
-                dist_lsec += lsec->GetLength();
             }
-            if (road_counter == 0)  // first time
-            {
-                dist += (direction == 1 ? road->GetLength() - object_->pos_.GetS() : object_->pos_.GetS());
-            }
-            else
+
+            // Store info on farest point so far on this side of the road
+            far_x_prev[m]     = far_x_tmp;
+            far_y_prev[m]     = far_y_tmp;
+            far_tan_s_prev[m] = farTanS_tmp;
+            far_angle_prev[m] = farAngle_tmp;
+            if (abs(angleDiff) > SMALL_NUMBER)
             {
-                dist += roadTemp->GetLength();
+                angle_diff_prev[m] = angleDiff;
             }
+
+            counter[m] += 1;
         }
     }
 
+    // intersection ahead within far point distance, unless a tangent point was found before it
+    bool isIntersection = path.junction && dist < farPointDistance && !hasFarTan;
+
     bool         hasLeadFar   = false;
     int          minObjIndex  = -1;
     double       minGapLength = LARGE_NUMBER;
@@ -357,11 +231,19 @@ void ControllerLooming::Step(double timeStep)
     if (!hasFarTan && !hasLeadFar)
     {
         // dynamic far road points
-        object_->pos_.GetProbeInfo(farPointDistance, &s_data, roadmanager::Position::LookAheadMode::LOOKAHEADMODE_AT_LANE_CENTER);
-        far_angle = s_data.relative_h;
+        if (path.GetPos(d0 + farPointDistance, 1, far_x, far_y))
+        {
+            far_angle = RelativeAngle(pos, far_x, far_y);
+        }
+        else
+        {
+            roadmanager::RoadProbeInfo s_data;
+            pos.GetProbeInfo(farPointDistance, &s_data, roadmanager::Position::LookAheadMode::LOOKAHEADMODE_AT_LANE_CENTER);
+            far_angle = s_data.relative_h;
 
-        far_x = s_data.road_lane_info.pos[0];
-        far_y = s_data.road_lane_info.pos[1];
+            far_x = s_data.road_lane_info.pos[0];
+            far_y = s_data.road_lane_info.pos[1];
+        }
     }
 
     if (minObjIndex > -1)
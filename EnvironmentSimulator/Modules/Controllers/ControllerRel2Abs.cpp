@@ -39,7 +39,9 @@ ControllerRel2Abs::ControllerRel2Abs(InitArgs* args)
     : Controller(args),
       pred_horizon(1),
       switching_threshold_dist(1.5),
-      switching_threshold_speed(1.5)
+      switching_threshold_speed(1.5),
+      interaction_radius(0.0),
+      pred_nbr_obj_(0)
 {
     // ControllerRel2Abs forced into additive mode - will only react on scenario actions
     if (mode_ != Mode::MODE_ADDITIVE)
@@ -59,6 +61,10 @@ ControllerRel2Abs::ControllerRel2Abs(InitArgs* args)
     {
         switching_threshold_dist = strtod(args->properties->GetValueStr("thresholdDist"));
     }
+    if (args->properties->ValueExists("interactionRadius"))
+    {
+        interaction_radius = strtod(args->properties->GetValueStr("interactionRadius"));
+    }
 }
 
 void ControllerRel2Abs::Init()
@@ -135,139 +141,7 @@ void ControllerRel2Abs::Step(double timeStep)
             actualData.posY.clear();
             actualData.speeds.clear();
 
-            std::vector<ControllerRel2Abs::position_copy*> positionsCopied;
-            // Copy positions, i.e. save original position and speed, keep object reference.
-            for (unsigned int i = 0; i < entities_->object_.size(); i++)
-            {
-                position_copy* obj_copy = new position_copy();
-                CopyPosition(entities_->object_[i], obj_copy);
-                positionsCopied.push_back(obj_copy);  // Add copy dirty bits?
-            }
-
-            data.time.push_back(currentTime);
-            data.posX.push_back(object_->pos_.GetX());
-            data.posY.push_back(object_->pos_.GetY());
-            data.speeds.push_back(object_->GetSpeed());
-
-            // Vector of copies of all active private actions in scenario. Will in reality only contain private actions
-            std::vector<OSCAction*> activeActionsCopies;
-            for (unsigned int i = 0; i < entities_->object_.size(); i++)
-            {
-                std::vector<OSCPrivateAction*> actions =
-                    entities_->object_[i]->getPrivateActions();  // getActions creates the vector => it's not updated by SE (only event vector is)
-                std::vector<OSCPrivateAction*> activeActions;
-
-                // Add init actions as well
-                for (size_t j = 0; j < entities_->object_[i]->initActions_.size(); j++)
-                {
-                    actions.push_back(entities_->object_[i]->initActions_[j]);
-                }
-
-                for (size_t j = 0; j < actions.size(); j++)
-                {
-                    // OBS IsActive will return true if next state is running as well
-                    if (actions[j]->IsActive())
-                    {
-                        activeActions.push_back(actions[j]);
-                    }
-                }
-
-                for (unsigned int j = 0; j < activeActions.size(); j++)
-                {
-                    OSCPrivateAction* action_copy = activeActions[j]->Copy();
-                    action_copy->object_          = entities_->object_[i];
-                    if (std::find(std::begin(action_whitelist), std::end(action_whitelist), activeActions[j]->type_) != std::end(action_whitelist))
-                    {
-                        activeActionsCopies.push_back(static_cast<OSCAction*>(action_copy));
-                    }
-                }
-            }
-
-            // Start all copied actions
-            for (unsigned int i = 0; i < activeActionsCopies.size(); i++)
-            {
-                activeActionsCopies[i]->Start(currentTime, pred_timestep);
-            }
-
-            // Simulation loop
-            for (int i = 0; i < pred_nbr_timesteps; i++)
-            {
-                currentTime += pred_timestep;
-                data.time.push_back(currentTime);
-
-                for (unsigned int j = 0; j < entities_->object_.size(); j++)
-                {
-                    Object* object = entities_->object_[j];
-                    for (unsigned int k = 0; k < activeActionsCopies.size(); k++)
-                    {
-                        OSCPrivateAction* pa = static_cast<OSCPrivateAction*>(activeActionsCopies[k]);
-                        if (pa->object_ == object)
-                        {
-                            activeActionsCopies[k]->Step(currentTime, pred_timestep);
-                        }
-                    }
-
-                    // Default controller - i.e. point mass model w. constant speed.
-                    double v       = object->GetSpeed();
-                    double steplen = v * pred_timestep;
-                    // Add or subtract stepsize according to curvature and offset, in order to keep constant speed
-                    double curvature = object->pos_.GetCurvature();
-                    double offset    = object->pos_.GetT();
-                    if (abs(curvature) > SMALL_NUMBER)
-                    {
-                        // Approximate delta length by sampling curvature in current position
-                        steplen += steplen * curvature * offset;
-                    }
-
-                    if (!object->CheckDirtyBits(Object::DirtyBit::LONGITUDINAL))
-                    {
-                        if (object->pos_.GetRoute())
-                        {
-                            object->pos_.MoveRouteDS(steplen);
-                        }
-                        else
-                        {
-                            // Adjustment movement to heading and road direction
-                            if (GetAbsAngleDifference(object->pos_.GetH(), object->pos_.GetDrivingDirection()) > M_PI_2)
-                            {
-                                // If pointing in other direction
-                                steplen *= -1;
-                            }
-                            object->pos_.MoveAlongS(steplen);
-                        }
-                    }
-
-                    // LOG("Object[%d] speed = %lf, y: %lf", object->id_, object->GetSpeed(), object->pos_.GetY());
-
-                    object->ClearDirtyBits(Object::DirtyBit::LATERAL | Object::DirtyBit::LONGITUDINAL | Object::DirtyBit::SPEED |
-                                           Object::DirtyBit::WHEEL_ANGLE | Object::DirtyBit::WHEEL_ROTATION);
-
-                    if (object == object_)
-                    {
-                        double newX = object->pos_.GetX();
-                        double newY = object->pos_.GetY();
-                        // We leave out caculating the new heading for now
-                        data.posX.push_back(newX);
-                        data.posY.push_back(newY);
-                        data.speeds.push_back(v);
-                    }
-                }
-            }
-
-            for (unsigned int i = 0; i < positionsCopied.size(); i++)
-            {
-                position_copy* cpy  = positionsCopied[i];
-                cpy->object->pos_   = *cpy->pos;
-                cpy->object->speed_ = cpy->speed;
-                cpy->object->SetDirty(cpy->dirtyBits);
-                delete (positionsCopied[i]);
-            }
-
-            // Free memory allocated through Action.copy()
-            for (unsigned int i = 0; i < activeActionsCopies.size(); i++)
-            {
-                delete (activeActionsCopies[i]);
-            }
+            Predict(currentTime);
         }
 
         currentTime = scenario_engine_->getSimulationTime();
@@ -641,18 +515,151 @@ void ControllerRel2Abs::ReportKeyEvent(int key, bool down)
     (void)down;
 }
 
-// Method for copying position and saving speed for object. Contains pointer to object which Returns struct with action pointer,
-// speed and position objects
-void ControllerRel2Abs::CopyPosition(Object* object, position_copy* obj_copy)
+void ControllerRel2Abs::Predict(double currentTime)
 {
-    roadmanager::Position* saved_pos = new roadmanager::Position();
+    Object* ego = entities_->object_[static_cast<unsigned int>(ego_obj)];
 
-    *saved_pos = object->pos_;  // Copy object->pos_ into newly alloced mem. pointed at by saved_pos
+    // Collect objects within interaction radius of ego. Save original state and copy active whitelisted actions.
+    pred_nbr_obj_ = 0;
+    for (size_t i = 0; i < entities_->object_.size(); i++)
+    {
+        Object* object = entities_->object_[i];
+
+        if (interaction_radius > SMALL_NUMBER && object != ego && object != object_ &&
+            PointSquareDistance2D(object->pos_.GetX(), object->pos_.GetY(), ego->pos_.GetX(), ego->pos_.GetY()) >
+                interaction_radius * interaction_radius)
+        {
+            continue;
+        }
+
+        if (static_cast<size_t>(pred_nbr_obj_) == pred_obj_.size())
+        {
+            pred_obj_.emplace_back();
+        }
+        PredObject& po = pred_obj_[static_cast<size_t>(pred_nbr_obj_++)];
+        po.object      = object;
+        po.pos         = object->pos_;
+        po.speed       = object->speed_;
+        po.dirtyBits   = object->GetDirtyBitMask();
+        po.actions.clear();
+
+        // Look at both event actions and init actions. OBS IsActive will return true if next state is running as well
+        for (size_t j = 0; j < object->objectEvents_.size(); j++)
+        {
+            for (size_t k = 0; k < object->objectEvents_[j]->action_.size(); k++)
+            {
+                OSCAction* action = object->objectEvents_[j]->action_[k];
+                if (action->base_type_ == OSCAction::BaseType::PRIVATE && action->IsActive())
+                {
+                    OSCPrivateAction* pa = static_cast<OSCPrivateAction*>(action);
+                    if (std::find(std::begin(action_whitelist), std::end(action_whitelist), pa->type_) != std::end(action_whitelist))
+                    {
+                        po.actions.push_back(pa);
+                    }
+                }
+            }
+        }
+        for (size_t j = 0; j < object->initActions_.size(); j++)
+        {
+            OSCPrivateAction* pa = object->initActions_[j];
+            if (pa->IsActive() && std::find(std::begin(action_whitelist), std::end(action_whitelist), pa->type_) != std::end(action_whitelist))
+            {
+                po.actions.push_back(pa);
+            }
+        }
+
+        // Replace references to original actions by copies
+        for (size_t j = 0; j < po.actions.size(); j++)
+        {
+            po.actions[j]          = po.actions[j]->Copy();
+            po.actions[j]->object_ = object;
+        }
+    }
+
+    // Start all copied actions, once the state of all involved objects has been saved
+    for (size_t i = 0; i < static_cast<size_t>(pred_nbr_obj_); i++)
+    {
+        for (size_t j = 0; j < pred_obj_[i].actions.size(); j++)
+        {
+            pred_obj_[i].actions[j]->Start(currentTime, pred_timestep);
+        }
+    }
+
+    data.time.push_back(currentTime);
+    data.posX.push_back(object_->pos_.GetX());
+    data.posY.push_back(object_->pos_.GetY());
+    data.speeds.push_back(object_->GetSpeed());
 
-    double saved_speed = object->speed_;
+    // Simulation loop
+    for (int i = 0; i < pred_nbr_timesteps; i++)
+    {
+        currentTime += pred_timestep;
+        data.time.push_back(currentTime);
+
+        for (size_t j = 0; j < static_cast<size_t>(pred_nbr_obj_); j++)
+        {
+            PredObject& po     = pred_obj_[j];
+            Object*     object = po.object;
+
+            for (size_t k = 0; k < po.actions.size(); k++)
+            {
+                po.actions[k]->Step(currentTime, pred_timestep);
+            }
 
-    obj_copy->object    = object;
-    obj_copy->pos       = saved_pos;
-    obj_copy->speed     = saved_speed;
-    obj_copy->dirtyBits = object->GetDirtyBitMask();
-}
\ No newline at end of file
+            // Default controller - i.e. point mass model w. constant speed.
+            double v       = object->GetSpeed();
+            double steplen = v * pred_timestep;
+            // Add or subtract stepsize according to curvature and offset, in order to keep constant speed
+            double curvature = object->pos_.GetCurvature();
+            double offset    = object->pos_.GetT();
+            if (abs(curvature) > SMALL_NUMBER)
+            {
+                // Approximate delta length by sampling curvature in current position
+                steplen += steplen * curvature * offset;
+            }
+
+            if (!object->CheckDirtyBits(Object::DirtyBit::LONGITUDINAL))
+            {
+                if (object->pos_.GetRoute())
+                {
+                    object->pos_.MoveRouteDS(steplen);
+                }
+                else
+                {
+                    // Adjustment movement to heading and road direction
+                    if (GetAbsAngleDifference(object->pos_.GetH(), object->pos_.GetDrivingDirection()) > M_PI_2)
+                    {
+                        // If pointing in other direction
+                        steplen *= -1;
+                    }
+                    object->pos_.MoveAlongS(steplen);
+                }
+            }
+
+            object->ClearDirtyBits(Object::DirtyBit::LATERAL | Object::DirtyBit::LONGITUDINAL | Object::DirtyBit::SPEED |
+                                   Object::DirtyBit::WHEEL_ANGLE | Object::DirtyBit::WHEEL_ROTATION);
+
+            if (object == object_)
+            {
+                // We leave out caculating the new heading for now
+                data.posX.push_back(object->pos_.GetX());
+                data.posY.push_back(object->pos_.GetY());
+                data.speeds.push_back(v);
+            }
+        }
+    }
+
+    // Restore original state and free memory allocated through Action.copy()
+    for (size_t i = 0; i < static_cast<size_t>(pred_nbr_obj_); i++)
+    {
+        PredObject& po     = pred_obj_[i];
+        po.object->pos_    = po.pos;
+        po.object->speed_  = po.speed;
+        po.object->SetDirty(po.dirtyBits);
+        for (size_t j = 0; j < po.actions.size(); j++)
+        {
+            delete po.actions[j];
+        }
+        po.actions.clear();
+    }
+}
@@ -35,12 +35,14 @@ namespace scenarioengine
             std::vector<double> posY;
         };
 
-        struct position_copy
+        // Prediction state of one object. Original state is saved here and restored after the prediction.
+        struct PredObject
         {
-            Object*                object;
-            roadmanager::Position* pos;
-            double                 speed;
-            int                    dirtyBits;
+            Object*                        object;
+            roadmanager::Position          pos;
+            double                         speed;
+            int                            dirtyBits;
+            std::vector<OSCPrivateAction*> actions;  // copies of active whitelisted actions, owned by the prediction
         };
 
         enum ctrl_mode
@@ -67,6 +69,7 @@ namespace scenarioengine
                                                             OSCPrivateAction::ActionType::FOLLOW_TRAJECTORY};
         double                       switching_threshold_dist;
         double                       switching_threshold_speed;
+        double                       interaction_radius;  // only objects within this distance from ego are predicted, 0 = no limit
 
         // CSV loggning
         std::ofstream logData;
@@ -78,7 +81,21 @@ namespace scenarioengine
         void Step(double timeStep);
         void Activate(DomainActivation lateral, DomainActivation longitudinal);
         void ReportKeyEvent(int key, bool down);
-        void CopyPosition(Object* object, position_copy* obj_copy);
+
+        /**
+        Simulate objects within interaction radius of ego over the prediction horizon, storing the trajectory of the
+        controlled object in data. All objects are restored to their original state afterwards.
+        @param currentTime Start time of the prediction
+        */
+        void Predict(double currentTime);
+
+        /**
+        Number of objects involved in the last prediction, including ego and the controlled object
+        */
+        int GetNumberOfPredictedObjects()
+        {
+            return pred_nbr_obj_;
+        }
 
         static const char* GetTypeNameStatic()
         {
@@ -104,6 +121,9 @@ namespace scenarioengine
         bool   switchNow;
         // vector with pairs of timestep and speed before that timestep
         std::vector<std::pair<double, double>> speeds;
+        // prediction buffer, reused between predictions to avoid reallocation. First pred_nbr_obj_ elements are in use.
+        std::vector<PredObject> pred_obj_;
+        int                     pred_nbr_obj_;
 
         // alters ego_obj to correct entities index for ego
         void findEgo();
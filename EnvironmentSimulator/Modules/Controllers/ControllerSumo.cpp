@@ -113,11 +113,11 @@ void ControllerSumo::Step(double timeStep)
                 LOG("SUMO controller: Add vehicle to scenario: %s", deplist[i].c_str());
                 vehicle->name_       = deplist[i];
                 vehicle->controller_ = this;
-                vehicle->model3d_    = template_vehicle_->model3d_;
                 vehicle->scaleMode_  = EntityScaleMode::BB_TO_MODEL;
                 vehicle->role_       = Vehicle::Role::CIVIL;
                 vehicle->category_   = Vehicle::Category::CAR;
                 vehicle->odometer_   = 0.0;
+                entities_->setObjectModel3D(vehicle, template_vehicle_->model3d_);
                 entities_->addObject(vehicle, true);
             }
         }
@@ -137,7 +137,6 @@ void ControllerSumo::Step(double timeStep)
                     if (obj != nullptr)
                     {
                         LOG("SUMO controller: Remove vehicle from scenario: %s", arrivelist[i].c_str());
-                        gateway_->removeObject(arrivelist[i]);
                         if (obj->objectEvents_.size() > 0 || obj->initActions_.size() > 0)
                         {
                             entities_->deactivateObject(obj);
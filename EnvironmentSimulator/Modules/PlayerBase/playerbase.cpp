@@ -70,7 +70,8 @@ ScenarioPlayer::ScenarioPlayer(int argc, char* argv[])
     viewer_              = nullptr;
 
 #ifdef _USE_OSG
-    viewerState_ = ViewerState::VIEWER_STATE_NOT_STARTED;
+    viewerState_             = ViewerState::VIEWER_STATE_NOT_STARTED;
+    entity_event_subscriber_ = -1;
 #ifdef _USE_OSI
     OSISensorDetection = nullptr;
 #endif  // _USE_OSI
@@ -79,6 +80,8 @@ ScenarioPlayer::ScenarioPlayer(int argc, char* argv[])
 
 ScenarioPlayer::~ScenarioPlayer()
 {
+    realtime_pacer_.LogStats();
+
     if (launch_server)
     {
         StopServer();
@@ -180,6 +183,7 @@ int ScenarioPlayer::Frame(double timestep_s)
                     retval = ScenarioFrame(ghost_solo_dt, false);
                 }
             }
+            realtime_pacer_.Restart();  // ghost solo steps are not part of the real-time schedule
         }
 
         if (retval == 0)
@@ -193,9 +197,18 @@ int ScenarioPlayer::Frame(double timestep_s)
         }
         scenarioEngine->mutex_.Unlock();
     }
+    else
+    {
+        realtime_pacer_.Restart();  // resume schedule from end of pause
+    }
 
     Draw();
 
+    if (GetFixedTimestep() > SMALL_NUMBER && !IsPaused())
+    {
+        realtime_pacer_.Pace(timestep_s);
+    }
+
     if (scenarioEngine->getSimulationTime() > 3600 && !messageShown)
     {
         LOG("Info: Simulation time > 1 hour. Put a stopTrigger for automatic ending");
@@ -285,7 +298,7 @@ void ScenarioPlayer::ScenarioPostFrame()
         {
             if ((GetCounter() - 1) % osi_freq_ == 0)
             {
-                osiReporter->UpdateOSIGroundTruth(scenarioGateway->objectState_);
+                osiReporter->UpdateOSIGroundTruth(scenarioGateway->objectState_, scenarioGateway->getFrameNr());
                 if (osiReporter->GetCounter() == 1)
                 {
                     // Clear the static data now when it has been reported once
@@ -320,42 +333,43 @@ void ScenarioPlayer::ViewerFrame(bool init)
 
     mutex.Lock();
 
-    // remove deleted cars
-    osg::Vec4 trail_color;
-    trail_color.set(color_blue[0], color_blue[1], color_blue[2], 1.0);
-    for (size_t i = 0; i < viewer_->entities_.size() && i < scenarioEngine->entities_.object_.size(); i++)
+    // Add, remove and replace entity models according to entity events since previous frame
+    scenarioEngine->entities_.PollEvents(entity_event_subscriber_, entity_events_);
+    for (const Entities::EntityEvent& event : entity_events_)
     {
-        if (scenarioEngine->entities_.object_[i]->name_ != viewer_->entities_[i]->name_ ||
-            scenarioEngine->entities_.object_[i]->model3d_ != viewer_->entities_[i]->filename_)
+        if (event.type == Entities::EntityEvent::Type::REMOVED || event.type == Entities::EntityEvent::Type::MODEL_CHANGED)
         {
-            // Object has most probably been deleted from the entity list
-            viewer_->RemoveCar(static_cast<int>(i));
-            i--;  // test same object again against next in viewer list
+            auto model = entity_models_.find(event.id);
+            if (model != entity_models_.end())
+            {
+                if (model->second->trajectory_->activeRMTrajectory_)
+                {
+                    model->second->trajectory_->Disable();
+                }
+                viewer_->RemoveCar(model->second);
+                entity_models_.erase(model);
+            }
         }
-    }
-
-    // Add missing cars
-    while (viewer_->entities_.size() < scenarioEngine->entities_.object_.size())
-    {
-        Object* obj = scenarioEngine->entities_.object_[viewer_->entities_.size()];
-        viewer_->AddEntityModel(viewer_->CreateEntityModel(obj->model3d_,
-                                                           trail_color,
-                                                           viewer::EntityModel::EntityType::VEHICLE,
-                                                           false,
-                                                           obj->name_,
-                                                           &obj->boundingbox_,
-                                                           obj->scaleMode_));
-        InitVehicleModel(obj, static_cast<viewer::CarModel*>(viewer_->entities_.back()));
-    }
 
-    // remove obsolete cars
-    while (viewer_->entities_.size() > scenarioEngine->entities_.object_.size())
-    {
-        if (viewer_->entities_.back()->trajectory_->activeRMTrajectory_)
+        if (event.type == Entities::EntityEvent::Type::ADDED || event.type == Entities::EntityEvent::Type::MODEL_CHANGED)
         {
-            viewer_->entities_.back()->trajectory_->Disable();
+            // Object might have been removed again after the event, then skip it
+            Object* obj = scenarioEngine->entities_.GetObjectById(event.id);
+            if (obj != nullptr && obj->IsActive() && entity_models_.count(event.id) == 0)
+            {
+                osg::Vec4 trail_color;
+                trail_color.set(color_blue[0], color_blue[1], color_blue[2], 1.0);
+                viewer_->AddEntityModel(viewer_->CreateEntityModel(obj->model3d_,
+                                                                   trail_color,
+                                                                   viewer::EntityModel::EntityType::VEHICLE,
+                                                                   false,
+                                                                   obj->name_,
+                                                                   &obj->boundingbox_,
+                                                                   obj->scaleMode_));
+                InitVehicleModel(obj, static_cast<viewer::CarModel*>(viewer_->entities_.back()));
+                entity_models_[event.id] = viewer_->entities_.back();
+            }
         }
-        viewer_->RemoveCar(static_cast<int>(viewer_->entities_.size() - 1));
     }
 
     if (!init)
@@ -363,8 +377,13 @@ void ScenarioPlayer::ViewerFrame(bool init)
         // Visualize entities
         for (size_t i = 0; i < scenarioEngine->entities_.object_.size(); i++)
         {
-            viewer::EntityModel* entity = viewer_->entities_[i];
-            Object*              obj    = scenarioEngine->entities_.object_[i];
+            Object* obj   = scenarioEngine->entities_.object_[i];
+            auto    model = entity_models_.find(obj->GetId());
+            if (model == entity_models_.end())
+            {
+                continue;
+            }
+            viewer::EntityModel* entity = model->second;
 
             entity->SetPosition(obj->pos_.GetX(), obj->pos_.GetY(), obj->pos_.GetZ());
             entity->SetRotation(obj->pos_.GetH(), obj->pos_.GetP(), obj->pos_.GetR());
@@ -465,9 +484,22 @@ void ScenarioPlayer::ViewerFrame(bool init)
 
         // Update info text
         static char str_buf[128];
+        Object*     obj = nullptr;
         if (viewer_->currentCarInFocus_ >= 0 && static_cast<unsigned int>(viewer_->currentCarInFocus_) < viewer_->entities_.size())
         {
-            Object* obj = scenarioEngine->entities_.object_[static_cast<unsigned int>(viewer_->currentCarInFocus_)];
+            // viewer entity order does not follow object order once entities have been added or removed, look up by id
+            viewer::EntityModel* focus = viewer_->entities_[static_cast<unsigned int>(viewer_->currentCarInFocus_)];
+            for (auto& model : entity_models_)
+            {
+                if (model.second == focus)
+                {
+                    obj = scenarioEngine->entities_.GetObjectById(model.first);
+                    break;
+                }
+            }
+        }
+        if (obj != nullptr)
+        {
             snprintf(str_buf,
                      sizeof(str_buf),
                      "%.2fs entity[%d]: %s (%d) %.2fkm/h %.2fm (%d, %d, %.2f, %.2f) / (%.2f, %.2f %.2f)",
@@ -620,6 +652,12 @@ void ScenarioPlayer::CloseViewer()
         delete viewer_;
         viewer_ = nullptr;
     }
+    if (entity_event_subscriber_ >= 0 && scenarioEngine != nullptr)
+    {
+        scenarioEngine->entities_.UnsubscribeEvents(entity_event_subscriber_);
+        entity_event_subscriber_ = -1;
+    }
+    entity_models_.clear();
     viewerState_ = ScenarioPlayer::ViewerState::VIEWER_STATE_DONE;
 }
 
@@ -931,6 +969,9 @@ int ScenarioPlayer::InitViewer()
         }
     }
 
+    // Subscribe before creating models of current entities, their ADDED events are skipped once the models exist
+    entity_event_subscriber_ = scenarioEngine->entities_.SubscribeEvents();
+
     //  Create visual models
     for (size_t i = 0; i < scenarioEngine->entities_.object_.size(); i++)
     {
@@ -976,6 +1017,8 @@ int ScenarioPlayer::InitViewer()
             return -1;
         }
 
+        entity_models_[obj->GetId()] = viewer_->entities_.back();
+
         // Connect callback for setting transparency
         viewer::VisibilityCallback* cb = new viewer::VisibilityCallback(obj, viewer_->entities_.back());
         viewer_->entities_.back()->txNode_->setUpdateCallback(cb);
@@ -1071,7 +1114,11 @@ void ScenarioPlayer::AddObjectSensor(int    object_index,
     if (viewer_)
     {
         mutex.Lock();
-        sensorFrustum.push_back(new viewer::SensorViewFrustum(sensor.back(), viewer_->entities_[static_cast<unsigned int>(object_index)]->txNode_));
+        auto model = entity_models_.find(scenarioEngine->entities_.object_[static_cast<unsigned int>(object_index)]->GetId());
+        if (model != entity_models_.end())
+        {
+            sensorFrustum.push_back(new viewer::SensorViewFrustum(sensor.back(), model->second->txNode_));
+        }
         mutex.Unlock();
     }
 #endif
@@ -1122,7 +1169,11 @@ void ScenarioPlayer::AddOSIDetection(int object_index)
         if (!OSISensorDetection)
         {
             mutex.Lock();
-            OSISensorDetection = new viewer::OSISensorDetection(viewer_->entities_[static_cast<unsigned int>(object_index)]->txNode_);
+            auto model = entity_models_.find(scenarioEngine->entities_.object_[static_cast<unsigned int>(object_index)]->GetId());
+            if (model != entity_models_.end())
+            {
+                OSISensorDetection = new viewer::OSISensorDetection(model->second->txNode_);
+            }
             mutex.Unlock();
         }
 #endif  // _USE_OSI
@@ -1140,10 +1191,10 @@ void ScenarioPlayer::SteeringSensorSetVisible(int object_index, bool value)
         return;
     }
 
-    int obj_index = scenarioEngine->entities_.GetObjectIdxById(object_index);
-    if (obj_index >= 0)
+    auto model = entity_models_.find(object_index);
+    if (model != entity_models_.end())
     {
-        viewer::EntityModel* m = viewer_->entities_[static_cast<unsigned int>(obj_index)];
+        viewer::EntityModel* m = model->second;
         if (m->IsMoving())
         {
             if (value == true)
@@ -1234,8 +1285,12 @@ int ScenarioPlayer::Init()
     opt.AddOption("hide_route_waypoints", "Disable route waypoint visualization (toggle with key 'R')");
     opt.AddOption("hide_trajectories", "Hide trajectories from start (toggle with key 'n')");
     opt.AddOption("info_text", "Show on-screen info text (toggle key 'i') mode 0=None 1=current (default) 2=per_object 3=both", "mode");
+    opt.AddOption("load_threads", "Number of threads for loading the OpenDRIVE file (default: one per hardware thread)", "number");
+    opt.AddOption("lookahead_resolution", "Max distance (m) between road profile points used for look-ahead by controllers (default: 1.0)", "distance");
     opt.AddOption("logfile_path", "logfile path/filename, e.g. \"../esmini.log\" (default: log.txt)", "path");
     opt.AddOption("osc_str", "OpenSCENARIO XML string", "string");
+    opt.AddOption("osi_max_lateral_deviation", "Max lateral deviation (m) of OSI points from road geometry (default: 0.05)", "distance");
+    opt.AddOption("osi_max_longitudinal_distance", "Max longitudinal distance (m) between OSI points (default: 50)", "distance");
 #ifdef _USE_OSI
     opt.AddOption("osi_file", "save osi trace file", "filename", DEFAULT_OSI_TRACE_FILENAME);
     opt.AddOption("osi_freq", "relative frequence for writing the .osi file e.g. --osi_freq=2 -> we write every two simulation steps", "frequence");
@@ -1249,6 +1304,8 @@ int ScenarioPlayer::Init()
 #ifdef _USE_IMPLOT
     opt.AddOption("plot", "Show window with line-plots of interesting data", "mode (asynchronous|synchronous)", "asynchronous");
 #endif
+    opt.AddOption("profile_load", "Report duration of each stage of OpenDRIVE file loading");
+    opt.AddOption("realtime_factor", "Pace fixed timestep runs at factor times real time, e.g. 1.0 (default: 0 = as fast as possible)", "factor");
     opt.AddOption("record", "Record position data into a file for later replay", "filename");
     opt.AddOption("road_features", "Show OpenDRIVE road features (\"on\", \"off\"  (default)) (toggle during simulation by press 'o') ", "mode");
     opt.AddOption("return_nr_permutations", "Return number of permutations without executing the scenario (-1 = error)");
@@ -1425,6 +1482,19 @@ int ScenarioPlayer::Init()
         LOG("Run simulation decoupled from realtime, with fixed timestep: %.2f", GetFixedTimestep());
     }
 
+    if ((arg_str = opt.GetOptionArg("realtime_factor")) != "")
+    {
+        SetRealTimeFactor(strtod(arg_str));
+        if (GetFixedTimestep() > SMALL_NUMBER)
+        {
+            LOG("Pace simulation at %.2f times real time", GetRealTimeFactor());
+        }
+        else
+        {
+            LOG("Ignoring realtime_factor, only applicable in combination with fixed_timestep");
+        }
+    }
+
     if (opt.GetOptionArg("path") != "")
     {
         int counter = 0;
@@ -1459,6 +1529,31 @@ int ScenarioPlayer::Init()
         SE_Env::Inst().SetCollisionDetection(true);
     }
 
+    if ((arg_str = opt.GetOptionArg("load_threads")) != "")
+    {
+        SE_Env::Inst().SetLoadThreads(strtoi(arg_str));
+    }
+
+    if (opt.GetOptionSet("profile_load"))
+    {
+        SE_Env::Inst().SetProfileLoad(true);
+    }
+
+    if ((arg_str = opt.GetOptionArg("lookahead_resolution")) != "")
+    {
+        SE_Env::Inst().SetLookAheadResolution(strtod(arg_str));
+    }
+
+    if ((arg_str = opt.GetOptionArg("osi_max_lateral_deviation")) != "")
+    {
+        SE_Env::Inst().SetOSIMaxLateralDeviation(strtod(arg_str));
+    }
+
+    if ((arg_str = opt.GetOptionArg("osi_max_longitudinal_distance")) != "")
+    {
+        SE_Env::Inst().SetOSIMaxLongitudinalDistance(strtod(arg_str));
+    }
+
     if (opt.GetOptionSet("disable_off_screen"))
     {
         SE_Env::Inst().SetOffScreenRendering(false);
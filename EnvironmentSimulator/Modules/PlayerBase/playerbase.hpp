@@ -109,6 +109,14 @@ namespace scenarioengine
         {
             return fixed_timestep_;
         }
+        void SetRealTimeFactor(double factor)
+        {
+            realtime_pacer_.SetFactor(factor);
+        }
+        double GetRealTimeFactor()
+        {
+            return realtime_pacer_.GetFactor();
+        }
         int GetOSIFreq()
         {
             return osi_freq_;
@@ -187,6 +195,12 @@ namespace scenarioengine
         viewer::OSISensorDetection *OSISensorDetection;
 #endif  // _USE_OSI
         ViewerState viewerState_;
+
+        // Entity events keep the viewer models, mapped by object id, in sync with the scenario entities
+        int                                            entity_event_subscriber_;
+        std::vector<Entities::EntityEvent>             entity_events_;
+        std::unordered_map<int, viewer::EntityModel *> entity_models_;
+
         int         InitViewer();
         void        CloseViewer();
         void        ViewerFrame(bool init = false);
@@ -208,27 +222,29 @@ namespace scenarioengine
         const double                minStepSize;
         SE_Options                  opt;
         std::vector<ObjCallback>    objCallback;
+        std::vector<int>            changed_signals_;  // result buffer of changed traffic signal queries, e.g. via esminiLib
         std::string                 exe_path_;
         SE_Semaphore                player_init_semaphore;
         SE_Semaphore                viewer_init_semaphore;
 
     private:
-        double      trail_dt;
-        SE_Thread   thread;
-        SE_Mutex    mutex;
-        bool        quit_request;
-        bool        threads;
-        bool        launch_server;
-        bool        launch_action_server;
-        bool        disable_controllers_;
-        double      fixed_timestep_;
-        int         osi_freq_;
-        int         frame_counter_;
-        std::string osi_receiver_addr;
-        int         argc_;
-        char      **argv_;
-        std::string titleString;
-        PlayerState state_;
+        double           trail_dt;
+        SE_Thread        thread;
+        SE_Mutex         mutex;
+        bool             quit_request;
+        bool             threads;
+        bool             launch_server;
+        bool             launch_action_server;
+        bool             disable_controllers_;
+        double           fixed_timestep_;
+        SE_RealTimePacer realtime_pacer_;
+        int              osi_freq_;
+        int              frame_counter_;
+        std::string      osi_receiver_addr;
+        int              argc_;
+        char           **argv_;
+        std::string      titleString;
+        PlayerState      state_;
     };
 
 }  // namespace scenarioengine
@@ -52,6 +52,12 @@
 #include <algorithm>
 #include <map>
 #include <sstream>
+#include <chrono>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <functional>
+#include <exception>
 
 #include "RoadManager.hpp"
 #include "odrSpiral.h"
@@ -61,18 +67,136 @@
 using namespace std;
 using namespace roadmanager;
 
-#define CURV_ZERO                  0.00001
-#define MAX_TRACK_DIST             10
-#define OSI_POINT_CALC_STEPSIZE    1     // [m]
-#define OSI_TANGENT_LINE_TOLERANCE 0.01  // [m]
-#define OSI_POINT_DIST_SCALE       0.025
-#define ROADMARK_WIDTH_STANDARD    0.15
-#define ROADMARK_WIDTH_BOLD        0.20
-#define NURBS_STEPLENGTH           1.0
+#define CURV_ZERO                    0.00001
+#define MAX_TRACK_DIST               10
+#define OSI_POINT_MIN_SEGMENT_LENGTH 0.2   // [m]
+#define OSI_POINT_DISCONTINUITY_DS   0.01  // [m]
+#define ROADMARK_WIDTH_STANDARD      0.15
+#define ROADMARK_WIDTH_BOLD          0.20
+#define NURBS_STEPLENGTH             1.0
 
 static int g_Lane_id;
 static int g_Laneb_id;
 
+// Incremented whenever roads are cleared or replaced, invalidating any road data cached by Position objects
+static std::atomic<unsigned int> g_road_network_generation(1);
+
+// Global ids are handed out in order of creation. While roads are processed in parallel, requested ids are
+// recorded per road instead and then assigned in road order, resulting in same ids as a sequential load.
+typedef struct
+{
+    int* id;
+    bool boundary;  // lane boundary id, else lane id
+} DeferredGlobalId;
+
+typedef struct
+{
+    Road*                         road;
+    SpeedUnit                     speed_unit;
+    std::vector<DeferredGlobalId> global_ids;
+} RoadSlot;
+
+static thread_local std::vector<DeferredGlobalId>* g_deferred_ids = nullptr;
+static std::mutex                                  g_signals_types_mutex;
+
+static void SetNewGlobalId(int& id, bool boundary)
+{
+    if (g_deferred_ids != nullptr)
+    {
+        g_deferred_ids->push_back({&id, boundary});
+    }
+    else
+    {
+        id = boundary ? GetNewGlobalLaneBoundaryId() : GetNewGlobalLaneId();
+    }
+}
+
+static void AssignDeferredGlobalIds(const std::vector<DeferredGlobalId>& ids)
+{
+    for (const DeferredGlobalId& deferred : ids)
+    {
+        *deferred.id = deferred.boundary ? GetNewGlobalLaneBoundaryId() : GetNewGlobalLaneId();
+    }
+}
+
+// Record global ids requested by current thread, until going out of scope
+class DeferGlobalIds
+{
+public:
+    DeferGlobalIds(std::vector<DeferredGlobalId>* ids)
+    {
+        g_deferred_ids = ids;
+    }
+    ~DeferGlobalIds()
+    {
+        g_deferred_ids = nullptr;
+    }
+};
+
+static int GetNumberOfLoadThreads(int n_tasks)
+{
+    int n_threads = SE_Env::Inst().GetLoadThreads();
+
+    if (n_threads < 1)
+    {
+        n_threads = static_cast<int>(std::thread::hardware_concurrency());
+    }
+
+    return MAX(1, MIN(n_threads, n_tasks));
+}
+
+// Run task for index 0..n_tasks-1, claimed in increasing order by n_threads workers.
+// First exception thrown by any task is rethrown when all workers are done.
+static void RunParallel(int n_tasks, int n_threads, const std::function<void(int)>& task)
+{
+    if (n_threads < 2)
+    {
+        for (int i = 0; i < n_tasks; i++)
+        {
+            task(i);
+        }
+        return;
+    }
+
+    std::atomic<int>         next_task(0);
+    std::exception_ptr       exception = nullptr;
+    std::mutex               exception_mutex;
+    std::vector<std::thread> workers;
+
+    for (int i = 0; i < n_threads; i++)
+    {
+        workers.emplace_back(
+            [&]()
+            {
+                for (int j = next_task++; j < n_tasks; j = next_task++)
+                {
+                    try
+                    {
+                        task(j);
+                    }
+                    catch (...)
+                    {
+                        std::lock_guard<std::mutex> lock(exception_mutex);
+                        if (exception == nullptr)
+                        {
+                            exception = std::current_exception();
+                        }
+                    }
+                }
+            });
+    }
+
+    for (std::thread& worker : workers)
+    {
+        worker.join();
+    }
+
+    if (exception != nullptr)
+    {
+        std::rethrow_exception(exception);
+    }
+}
+
 const char* object_type_str[] = {"barrier",   "bike",     "building",     "bus",          "car",           "crosswalk",  "gantry",
                                  "motorbike", "none",     "obstacle",     "parkingspace", "patch",         "pedestrian", "pole",
                                  "railing",   "roadmark", "soundbarrier", "streetlamp",   "trafficisland", "trailer",    "train",
@@ -980,17 +1104,17 @@ void LaneLink::Print() const
 
 void Lane::SetGlobalId()
 {
-    global_id_ = GetNewGlobalLaneId();
+    SetNewGlobalId(global_id_, false);
 }
 
 void LaneBoundaryOSI::SetGlobalId()
 {
-    global_id_ = GetNewGlobalLaneBoundaryId();
+    SetNewGlobalId(global_id_, true);
 }
 
 void LaneRoadMarkTypeLine::SetGlobalId()
 {
-    global_id_ = GetNewGlobalLaneBoundaryId();
+    SetNewGlobalId(global_id_, true);
 }
 
 LaneWidth* Lane::GetWidthByIndex(int index) const
@@ -2581,53 +2705,23 @@ bool Road::IsDirectlyConnected(Road* road, LinkType link_type, ContactPointType*
         return false;
     }
 
-    RoadLink* link = GetLink(link_type);
-    if (link == nullptr)
+    const std::vector<OpenDrive::DirectLink>* links = Position::GetOpenDrive()->GetDirectLinks(GetId(), road->GetId(), link_type);
+    if (links == nullptr)
     {
-        return false;  // lacking successor
+        return false;
     }
 
-    if (link->GetElementType() == RoadLink::ElementType::ELEMENT_TYPE_ROAD)
+    // Road link, or junction connections from this road to the connecting road in order of definition
+    for (const OpenDrive::DirectLink& link : *links)
     {
-        if (link->GetElementId() == road->GetId())
+        if (contact_point != nullptr)
         {
-            if (contact_point != nullptr)
-            {
-                *contact_point = link->GetContactPointType();
-            }
-            return true;
+            *contact_point = link.contact_point;
         }
-    }
-    else if (link->GetElementType() == RoadLink::ElementType::ELEMENT_TYPE_JUNCTION)
-    {
-        // Check all connections
-        Junction* junction = Position::GetOpenDrive()->GetJunctionById(link->GetElementId());
-        for (int i = 0; junction != nullptr && i < (int)junction->GetNumberOfConnections(); i++)
-        {
-            Connection* connection = junction->GetConnectionByIdx(i);
-            if (connection->GetIncomingRoad() == this && connection->GetConnectingRoad() == road)
-            {
-                if (contact_point != nullptr)
-                {
-                    *contact_point = connection->GetContactPoint();
-                }
-                // need to calculate contact point for non direct junctions?
 
-                if (fromLaneId != 0)
-                {
-                    for (int j = 0; j < (int)connection->GetNumberOfLaneLinks(); j++)
-                    {
-                        if (connection->GetLaneLink(j)->from_ == fromLaneId)
-                        {
-                            return true;
-                        }
-                    }
-                }
-                else
-                {
-                    return true;
-                }
-            }
+        if (link.any_lane || fromLaneId == 0 || std::find(link.from_lanes.begin(), link.from_lanes.end(), fromLaneId) != link.from_lanes.end())
+        {
+            return true;
         }
     }
 
@@ -3025,1233 +3119,1442 @@ std::string ReadAttribute(pugi::xml_node node, std::string attribute_name, bool
     return "";
 }
 
-void OpenDrive::Clear()
+bool SignalStateRegistry::SetState(int signal_id, const std::string& state)
 {
-    InitGlobalLaneIds();
+    auto it = states_.find(signal_id);
+    if (it != states_.end() && it->second.state == state)
+    {
+        return false;
+    }
 
-    for (size_t i = 0; i < road_.size(); i++)
+    version_++;
+    if (it == states_.end())
     {
-        delete road_[i];
+        states_[signal_id] = {state, version_};
+    }
+    else
+    {
+        it->second.state   = state;
+        it->second.version = version_;
     }
-    road_.clear();
 
-    for (size_t i = 0; i < junction_.size(); i++)
+    // Drop outdated entries once in a while, keeping the log proportional to number of signals
+    if (change_log_.size() > 2 * states_.size() + 64)
     {
-        delete junction_[i];
+        std::vector<std::pair<unsigned int, int>> log;
+        for (auto& entry : change_log_)
+        {
+            if (states_[entry.second].version == entry.first)
+            {
+                log.push_back(entry);
+            }
+        }
+        change_log_.swap(log);
     }
-    junction_.clear();
+    change_log_.push_back(std::make_pair(version_, signal_id));
 
-    SetSpeedUnit(SpeedUnit::UNDEFINED);
+    return true;
 }
 
-bool OpenDrive::LoadOpenDriveFile(const char* filename, bool replace)
+const SignalStateRegistry::SignalState* SignalStateRegistry::GetState(int signal_id) const
 {
-    if (replace)
+    auto it = states_.find(signal_id);
+    return it != states_.end() ? &it->second : nullptr;
+}
+
+void SignalStateRegistry::GetChangedSignals(unsigned int version, std::vector<int>& ids) const
+{
+    ids.clear();
+
+    if (version == 0 || version < clear_version_)
     {
-        Clear();
+        // key frame, all signals
+        for (auto& entry : states_)
+        {
+            ids.push_back(entry.first);
+        }
+        return;
     }
 
-    odr_filename_ = filename;
+    auto it = std::upper_bound(change_log_.begin(),
+                               change_log_.end(),
+                               version,
+                               [](unsigned int v, const std::pair<unsigned int, int>& entry) { return v < entry.first; });
 
-    if (odr_filename_ == "")
+    for (; it != change_log_.end(); ++it)
     {
-        return false;
+        // only report latest change of each signal
+        if (states_.at(it->second).version == it->first)
+        {
+            ids.push_back(it->second);
+        }
     }
+}
 
-    pugi::xml_document doc;
+int SignalStateRegistry::AddPhaseSchedule(const std::string& name, double delay, const std::vector<Phase>& phases)
+{
+    PhaseSchedule schedule;
+    schedule.name          = name;
+    schedule.delay         = delay;
+    schedule.phases        = phases;
+    schedule.cycle_time    = 0.0;
+    schedule.current_phase = -1;
 
-    // First assume absolute path
-    pugi::xml_parse_result result = doc.load_file(filename);
-    if (!result)
+    // Precompute phase start times within the cycle
+    for (auto& phase : phases)
     {
-        LOG("%s at offset (character position): %d", result.description(), result.offset);
-        return false;
+        schedule.phase_start.push_back(schedule.cycle_time);
+        schedule.cycle_time += phase.duration;
     }
 
-    pugi::xml_node node = doc.child("OpenDRIVE");
-    if (node == NULL)
+    if (schedule.cycle_time < SMALL_NUMBER)
     {
-        LOG("Invalid OpenDRIVE file, can't find OpenDRIVE element");
-        return false;
+        LOG("Signal phase schedule %s has no duration, skipping", name.c_str());
+        return -1;
     }
 
-    // Initialize GeoRef structure
-    geo_ref_ = {std::numeric_limits<double>::quiet_NaN(),
-                "",
-                std::numeric_limits<double>::quiet_NaN(),
-                "",
-                std::numeric_limits<double>::quiet_NaN(),
-                std::numeric_limits<double>::quiet_NaN(),
-                std::numeric_limits<double>::quiet_NaN(),
-                std::numeric_limits<double>::quiet_NaN(),
-                std::numeric_limits<double>::quiet_NaN(),
-                std::numeric_limits<double>::quiet_NaN(),
-                "",
-                "",
-                "",
-                "",
-                std::numeric_limits<double>::quiet_NaN(),
-                std::numeric_limits<double>::quiet_NaN(),
-                "",
-                "",
-                std::numeric_limits<double>::quiet_NaN(),
-                std::numeric_limits<int>::quiet_NaN()};
+    schedules_.push_back(schedule);
 
-    pugi::xml_node header_node = node.child("header");
-    if (node != NULL)
+    return 0;
+}
+
+void SignalStateRegistry::Update(double time)
+{
+    for (auto& schedule : schedules_)
     {
-        versionMajor_ = strtoi(header_node.attribute("revMajor").value());
-        versionMinor_ = strtoi(header_node.attribute("revMinor").value());
+        double t = time - schedule.delay;
+        if (t < 0.0)
+        {
+            continue;
+        }
 
-        if (header_node.child("geoReference") != NULL)
+        double t_cycle = fmod(t, schedule.cycle_time);
+        auto   it      = std::upper_bound(schedule.phase_start.begin(), schedule.phase_start.end(), t_cycle);
+        int    phase   = static_cast<int>(it - schedule.phase_start.begin()) - 1;
+
+        if (phase != schedule.current_phase)
         {
-            // Get the string to parse, geoReference tag is just a string with the data separated by spaces and each attribute start with a +
-            // character
-            std::string geo_ref_str = header_node.child_value("geoReference");
-            ParseGeoLocalization(geo_ref_str);
+            schedule.current_phase = phase;
+            for (auto& state : schedule.phases[static_cast<unsigned int>(phase)].states)
+            {
+                SetState(state.first, state.second);
+            }
         }
     }
+}
 
-    for (pugi::xml_node road_node = node.child("road"); road_node; road_node = road_node.next_sibling("road"))
+void SignalStateRegistry::Clear()
+{
+    states_.clear();
+    change_log_.clear();
+    schedules_.clear();
+    clear_version_ = ++version_;
+}
+
+void OpenDrive::Clear()
+{
+    g_road_network_generation++;
+    signal_states_.Clear();
+    lookahead_cache_.clear();
+    InitGlobalLaneIds();
+
+    for (size_t i = 0; i < road_.size(); i++)
     {
-        std::string rname = road_node.attribute("name").value();
+        delete road_[i];
+    }
+    road_.clear();
 
-        int rid = (int)road_.size();  // preliminary road id, use if not specified in OpenDRIVE file
-        if (road_node.attribute("id").empty() || !strcmp(road_node.attribute("id").value(), ""))
-        {
-            LOG("Id for road \"%s\" missing, assigning id %d", rname.c_str(), rid);
-        }
-        else
+    for (size_t i = 0; i < junction_.size(); i++)
+    {
+        delete junction_[i];
+    }
+    junction_.clear();
+
+    direct_links_[0].clear();
+    direct_links_[1].clear();
+    indirect_links_.clear();
+
+    SetSpeedUnit(SpeedUnit::UNDEFINED);
+}
+
+Road* OpenDrive::ParseRoad(pugi::xml_node road_node, int preliminary_id, SpeedUnit& speed_unit)
+{
+    std::string rname = road_node.attribute("name").value();
+
+    int rid = preliminary_id;  // preliminary road id, use if not specified in OpenDRIVE file
+    if (road_node.attribute("id").empty() || !strcmp(road_node.attribute("id").value(), ""))
+    {
+        LOG("Id for road \"%s\" missing, assigning id %d", rname.c_str(), rid);
+    }
+    else
+    {
+        rid = atoi(road_node.attribute("id").value());
+    }
+
+    double         roadlength  = atof(road_node.attribute("length").value());
+    int            junction_id = atoi(road_node.attribute("junction").value());
+    Road::RoadRule rrule       = Road::RoadRule::RIGHT_HAND_TRAFFIC;  // right hand traffic is default
+
+    if (!road_node.attribute("rule").empty())
+    {
+        std::string rule_str = road_node.attribute("rule").value();
+        if (rule_str == "LHT" || rule_str == "lht")
         {
-            rid = atoi(road_node.attribute("id").value());
+            rrule = Road::RoadRule::LEFT_HAND_TRAFFIC;
         }
+    }
 
-        double         roadlength  = atof(road_node.attribute("length").value());
-        int            junction_id = atoi(road_node.attribute("junction").value());
-        Road::RoadRule rrule       = Road::RoadRule::RIGHT_HAND_TRAFFIC;  // right hand traffic is default
+    Road* r = new Road(rid, rname, rrule);
+    r->SetLength(roadlength);
+    r->SetJunction(junction_id);
 
-        if (!road_node.attribute("rule").empty())
+    for (pugi::xml_node type_node = road_node.child("type"); type_node; type_node = type_node.next_sibling("type"))
+    {
+        Road::RoadTypeEntry* r_type = new Road::RoadTypeEntry();
+
+        std::string type = type_node.attribute("type").value();
+        if (type == "unknown")
         {
-            std::string rule_str = road_node.attribute("rule").value();
-            if (rule_str == "LHT" || rule_str == "lht")
-            {
-                rrule = Road::RoadRule::LEFT_HAND_TRAFFIC;
-            }
+            r_type->road_type_ = Road::RoadType::ROADTYPE_UNKNOWN;
+        }
+        else if (type == "rural")
+        {
+            r_type->road_type_ = Road::RoadType::ROADTYPE_RURAL;
+        }
+        else if (type == "motorway")
+        {
+            r_type->road_type_ = Road::RoadType::ROADTYPE_MOTORWAY;
+        }
+        else if (type == "town")
+        {
+            r_type->road_type_ = Road::RoadType::ROADTYPE_TOWN;
+        }
+        else if (type == "lowSpeed")
+        {
+            r_type->road_type_ = Road::RoadType::ROADTYPE_LOWSPEED;
+        }
+        else if (type == "pedestrian")
+        {
+            r_type->road_type_ = Road::RoadType::ROADTYPE_PEDESTRIAN;
+        }
+        else if (type == "bicycle")
+        {
+            r_type->road_type_ = Road::RoadType::ROADTYPE_BICYCLE;
+        }
+        else if (type == "")
+        {
+            LOG("Missing road type - setting default (rural)");
+            r_type->road_type_ = Road::RoadType::ROADTYPE_RURAL;
+        }
+        else
+        {
+            LOG("Unsupported road type: %s - assuming rural", type.c_str());
+            r_type->road_type_ = Road::RoadType::ROADTYPE_RURAL;
         }
 
-        Road* r = new Road(rid, rname, rrule);
-        r->SetLength(roadlength);
-        r->SetJunction(junction_id);
+        r_type->s_ = atof(type_node.attribute("s").value());
 
-        for (pugi::xml_node type_node = road_node.child("type"); type_node; type_node = type_node.next_sibling("type"))
+        // Check for optional speed record
+        r_type->unit_        = SpeedUnit::MS;  // default
+        pugi::xml_node speed = type_node.child("speed");
+        if (speed != NULL)
         {
-            Road::RoadTypeEntry* r_type = new Road::RoadTypeEntry();
-
-            std::string type = type_node.attribute("type").value();
-            if (type == "unknown")
+            r_type->speed_   = atof(speed.attribute("max").value());
+            std::string unit = speed.attribute("unit").value();
+            if (unit == "km/h")
             {
-                r_type->road_type_ = Road::RoadType::ROADTYPE_UNKNOWN;
+                r_type->speed_ /= 3.6;  // Convert to m/s from km/h
+                r_type->unit_ = SpeedUnit::KMH;
             }
-            else if (type == "rural")
+            else if (unit == "mph")
             {
-                r_type->road_type_ = Road::RoadType::ROADTYPE_RURAL;
+                r_type->speed_ *= 0.44704;  // Convert to m/s from mph
+                r_type->unit_ = SpeedUnit::MPH;
             }
-            else if (type == "motorway")
+            else if (unit == "m/s")
             {
-                r_type->road_type_ = Road::RoadType::ROADTYPE_MOTORWAY;
+                // SI unit - do nothing
             }
-            else if (type == "town")
+            else
             {
-                r_type->road_type_ = Road::RoadType::ROADTYPE_TOWN;
+                LOG("Unsupported speed unit: %s - set UNDEFINED", unit.c_str());
+                r_type->unit_ = SpeedUnit::UNDEFINED;
             }
-            else if (type == "lowSpeed")
+        }
+        if (speed_unit == SpeedUnit::UNDEFINED)
+        {
+            speed_unit = r_type->unit_;
+        }
+
+        r->AddRoadType(r_type);
+    }
+
+    pugi::xml_node link = road_node.child("link");
+    if (link != NULL)
+    {
+        pugi::xml_node successor = link.child("successor");
+        if (successor != NULL)
+        {
+            r->AddLink(new RoadLink(SUCCESSOR, successor));
+        }
+
+        pugi::xml_node predecessor = link.child("predecessor");
+        if (predecessor != NULL)
+        {
+            r->AddLink(new RoadLink(PREDECESSOR, predecessor));
+        }
+
+        if (r->GetJunction() != -1)
+        {
+            // As connecting road it is expected to have connections in both ends
+            if (successor == NULL)
             {
-                r_type->road_type_ = Road::RoadType::ROADTYPE_LOWSPEED;
+                LOG("Warning: connecting road %d in junction %d lacks successor", r->GetId(), r->GetJunction());
             }
-            else if (type == "pedestrian")
+            if (predecessor == NULL)
             {
-                r_type->road_type_ = Road::RoadType::ROADTYPE_PEDESTRIAN;
+                LOG("Warning: connecting road %d in junction %d lacks predesessor", r->GetId(), r->GetJunction());
             }
-            else if (type == "bicycle")
+        }
+    }
+
+    pugi::xml_node plan_view = road_node.child("planView");
+    if (plan_view != NULL)
+    {
+        for (pugi::xml_node geometry = plan_view.child("geometry"); geometry; geometry = geometry.next_sibling())
+        {
+            double s       = atof(geometry.attribute("s").value());
+            double x       = atof(geometry.attribute("x").value());
+            double y       = atof(geometry.attribute("y").value());
+            double hdg     = atof(geometry.attribute("hdg").value());
+            double glength = atof(geometry.attribute("length").value());
+
+            pugi::xml_node type = geometry.last_child();
+            if (type != NULL)
             {
-                r_type->road_type_ = Road::RoadType::ROADTYPE_BICYCLE;
-            }
-            else if (type == "")
-            {
-                LOG("Missing road type - setting default (rural)");
-                r_type->road_type_ = Road::RoadType::ROADTYPE_RURAL;
-            }
-            else
-            {
-                LOG("Unsupported road type: %s - assuming rural", type.c_str());
-                r_type->road_type_ = Road::RoadType::ROADTYPE_RURAL;
-            }
-
-            r_type->s_ = atof(type_node.attribute("s").value());
-
-            // Check for optional speed record
-            r_type->unit_        = SpeedUnit::MS;  // default
-            pugi::xml_node speed = type_node.child("speed");
-            if (speed != NULL)
-            {
-                r_type->speed_   = atof(speed.attribute("max").value());
-                std::string unit = speed.attribute("unit").value();
-                if (unit == "km/h")
+                // Find out the type of geometry
+                if (!strcmp(type.name(), "line"))
+                {
+                    r->AddLine(new Line(s, x, y, hdg, glength));
+                }
+                else if (!strcmp(type.name(), "arc"))
                 {
-                    r_type->speed_ /= 3.6;  // Convert to m/s from km/h
-                    r_type->unit_ = SpeedUnit::KMH;
+                    double curvature = atof(type.attribute("curvature").value());
+                    r->AddArc(new Arc(s, x, y, hdg, glength, curvature));
                 }
-                else if (unit == "mph")
+                else if (!strcmp(type.name(), "spiral"))
                 {
-                    r_type->speed_ *= 0.44704;  // Convert to m/s from mph
-                    r_type->unit_ = SpeedUnit::MPH;
+                    double curv_start = atof(type.attribute("curvStart").value());
+                    double curv_end   = atof(type.attribute("curvEnd").value());
+                    r->AddSpiral(new Spiral(s, x, y, hdg, glength, curv_start, curv_end));
                 }
-                else if (unit == "m/s")
+                else if (!strcmp(type.name(), "poly3"))
                 {
-                    // SI unit - do nothing
+                    double a = atof(type.attribute("a").value());
+                    double b = atof(type.attribute("b").value());
+                    double c = atof(type.attribute("c").value());
+                    double d = atof(type.attribute("d").value());
+                    r->AddPoly3(new Poly3(s, x, y, hdg, glength, a, b, c, d));
+                }
+                else if (!strcmp(type.name(), "paramPoly3"))
+                {
+                    double                 aU      = atof(type.attribute("aU").value());
+                    double                 bU      = atof(type.attribute("bU").value());
+                    double                 cU      = atof(type.attribute("cU").value());
+                    double                 dU      = atof(type.attribute("dU").value());
+                    double                 aV      = atof(type.attribute("aV").value());
+                    double                 bV      = atof(type.attribute("bV").value());
+                    double                 cV      = atof(type.attribute("cV").value());
+                    double                 dV      = atof(type.attribute("dV").value());
+                    ParamPoly3::PRangeType p_range = ParamPoly3::P_RANGE_NORMALIZED;
+
+                    pugi::xml_attribute attr = type.attribute("pRange");
+                    if (attr && !strcmp(attr.value(), "arcLength"))
+                    {
+                        p_range = ParamPoly3::P_RANGE_ARC_LENGTH;
+                    }
+
+                    ParamPoly3* pp3 = new ParamPoly3(s, x, y, hdg, glength, aU, bU, cU, dU, aV, bV, cV, dV, p_range);
+                    if (pp3 != NULL)
+                    {
+                        r->AddParamPoly3(pp3);
+                    }
+                    else
+                    {
+                        LOG("ParamPoly3: Major error");
+                    }
                 }
                 else
                 {
-                    LOG("Unsupported speed unit: %s - set UNDEFINED", unit.c_str());
-                    r_type->unit_ = SpeedUnit::UNDEFINED;
+                    cout << "Unknown geometry type: " << type.name() << endl;
                 }
             }
-            if (Position::GetOpenDrive()->GetSpeedUnit() == SpeedUnit::UNDEFINED)
+            else
             {
-                Position::GetOpenDrive()->SetSpeedUnit(r_type->unit_);
+                cout << "Type == NULL" << endl;
             }
-
-            r->AddRoadType(r_type);
         }
+    }
 
-        pugi::xml_node link = road_node.child("link");
-        if (link != NULL)
+    pugi::xml_node elevation_profile = road_node.child("elevationProfile");
+    if (elevation_profile != NULL)
+    {
+        for (pugi::xml_node elevation = elevation_profile.child("elevation"); elevation; elevation = elevation.next_sibling())
         {
-            pugi::xml_node successor = link.child("successor");
-            if (successor != NULL)
+            double s = atof(elevation.attribute("s").value());
+            double a = atof(elevation.attribute("a").value());
+            double b = atof(elevation.attribute("b").value());
+            double c = atof(elevation.attribute("c").value());
+            double d = atof(elevation.attribute("d").value());
+
+            Elevation* ep = new Elevation(s, a, b, c, d);
+            if (ep != NULL)
             {
-                r->AddLink(new RoadLink(SUCCESSOR, successor));
+                r->AddElevation(ep);
             }
-
-            pugi::xml_node predecessor = link.child("predecessor");
-            if (predecessor != NULL)
+            else
             {
-                r->AddLink(new RoadLink(PREDECESSOR, predecessor));
+                LOG("Elevation: Major error");
             }
+        }
+    }
 
-            if (r->GetJunction() != -1)
+    pugi::xml_node super_elevation_profile = road_node.child("lateralProfile");
+    if (super_elevation_profile != NULL)
+    {
+        for (pugi::xml_node super_elevation = super_elevation_profile.child("superelevation"); super_elevation;
+             super_elevation                = super_elevation.next_sibling("superelevation"))
+        {
+            double s = atof(super_elevation.attribute("s").value());
+            double a = atof(super_elevation.attribute("a").value());
+            double b = atof(super_elevation.attribute("b").value());
+            double c = atof(super_elevation.attribute("c").value());
+            double d = atof(super_elevation.attribute("d").value());
+
+            Elevation* ep = new Elevation(s, a, b, c, d);
+            if (ep != NULL)
             {
-                // As connecting road it is expected to have connections in both ends
-                if (successor == NULL)
-                {
-                    LOG("Warning: connecting road %d in junction %d lacks successor", r->GetId(), r->GetJunction());
-                }
-                if (predecessor == NULL)
-                {
-                    LOG("Warning: connecting road %d in junction %d lacks predesessor", r->GetId(), r->GetJunction());
-                }
+                r->AddSuperElevation(ep);
+            }
+            else
+            {
+                LOG("SuperElevation: Major error");
             }
         }
+    }
 
-        pugi::xml_node plan_view = road_node.child("planView");
-        if (plan_view != NULL)
+    pugi::xml_node lanes = road_node.child("lanes");
+    if (lanes != NULL)
+    {
+        for (pugi::xml_node_iterator child = lanes.children().begin(); child != lanes.children().end(); child++)
         {
-            for (pugi::xml_node geometry = plan_view.child("geometry"); geometry; geometry = geometry.next_sibling())
+            if (!strcmp(child->name(), "laneOffset"))
+            {
+                double s = atof(child->attribute("s").value());
+                double a = atof(child->attribute("a").value());
+                double b = atof(child->attribute("b").value());
+                double c = atof(child->attribute("c").value());
+                double d = atof(child->attribute("d").value());
+                r->AddLaneOffset(new LaneOffset(s, a, b, c, d));
+            }
+            else if (!strcmp(child->name(), "laneSection"))
             {
-                double s       = atof(geometry.attribute("s").value());
-                double x       = atof(geometry.attribute("x").value());
-                double y       = atof(geometry.attribute("y").value());
-                double hdg     = atof(geometry.attribute("hdg").value());
-                double glength = atof(geometry.attribute("length").value());
+                double       s            = atof(child->attribute("s").value());
+                LaneSection* lane_section = new LaneSection(s);
+                r->AddLaneSection(lane_section);
 
-                pugi::xml_node type = geometry.last_child();
-                if (type != NULL)
+                for (pugi::xml_node_iterator child2 = child->children().begin(); child2 != child->children().end(); child2++)
                 {
-                    // Find out the type of geometry
-                    if (!strcmp(type.name(), "line"))
+                    if (!strcmp(child2->name(), "left"))
+                    {
+                        // LOG("Lane left");
+                    }
+                    else if (!strcmp(child2->name(), "right"))
                     {
-                        r->AddLine(new Line(s, x, y, hdg, glength));
+                        // LOG("Lane right");
                     }
-                    else if (!strcmp(type.name(), "arc"))
+                    else if (!strcmp(child2->name(), "center"))
                     {
-                        double curvature = atof(type.attribute("curvature").value());
-                        r->AddArc(new Arc(s, x, y, hdg, glength, curvature));
+                        // LOG("Lane center");
                     }
-                    else if (!strcmp(type.name(), "spiral"))
+                    else if (!strcmp(child2->name(), "userData"))
                     {
-                        double curv_start = atof(type.attribute("curvStart").value());
-                        double curv_end   = atof(type.attribute("curvEnd").value());
-                        r->AddSpiral(new Spiral(s, x, y, hdg, glength, curv_start, curv_end));
+                        // Not supported
+                        continue;
                     }
-                    else if (!strcmp(type.name(), "poly3"))
+                    else
                     {
-                        double a = atof(type.attribute("a").value());
-                        double b = atof(type.attribute("b").value());
-                        double c = atof(type.attribute("c").value());
-                        double d = atof(type.attribute("d").value());
-                        r->AddPoly3(new Poly3(s, x, y, hdg, glength, a, b, c, d));
+                        LOG("Unsupported lane side: %s", child2->name());
+                        continue;
                     }
-                    else if (!strcmp(type.name(), "paramPoly3"))
+
+                    for (pugi::xml_node_iterator lane_node = child2->children().begin(); lane_node != child2->children().end(); lane_node++)
                     {
-                        double                 aU      = atof(type.attribute("aU").value());
-                        double                 bU      = atof(type.attribute("bU").value());
-                        double                 cU      = atof(type.attribute("cU").value());
-                        double                 dU      = atof(type.attribute("dU").value());
-                        double                 aV      = atof(type.attribute("aV").value());
-                        double                 bV      = atof(type.attribute("bV").value());
-                        double                 cV      = atof(type.attribute("cV").value());
-                        double                 dV      = atof(type.attribute("dV").value());
-                        ParamPoly3::PRangeType p_range = ParamPoly3::P_RANGE_NORMALIZED;
-
-                        pugi::xml_attribute attr = type.attribute("pRange");
-                        if (attr && !strcmp(attr.value(), "arcLength"))
+                        if (strcmp(lane_node->name(), "lane"))
                         {
-                            p_range = ParamPoly3::P_RANGE_ARC_LENGTH;
+                            LOG("Unexpected element: %s, expected \"lane\"", lane_node->name());
+                            continue;
                         }
 
-                        ParamPoly3* pp3 = new ParamPoly3(s, x, y, hdg, glength, aU, bU, cU, dU, aV, bV, cV, dV, p_range);
-                        if (pp3 != NULL)
+                        Lane::LaneType lane_type = Lane::LANE_TYPE_NONE;
+                        if (lane_node->attribute("type") == 0 || !strcmp(lane_node->attribute("type").value(), ""))
                         {
-                            r->AddParamPoly3(pp3);
+                            LOG("Lane type error");
                         }
-                        else
+                        if (!strcmp(lane_node->attribute("type").value(), "none"))
                         {
-                            LOG("ParamPoly3: Major error");
+                            lane_type = Lane::LANE_TYPE_NONE;
                         }
-                    }
-                    else
-                    {
-                        cout << "Unknown geometry type: " << type.name() << endl;
-                    }
-                }
-                else
-                {
-                    cout << "Type == NULL" << endl;
-                }
-            }
-        }
-
-        pugi::xml_node elevation_profile = road_node.child("elevationProfile");
-        if (elevation_profile != NULL)
-        {
-            for (pugi::xml_node elevation = elevation_profile.child("elevation"); elevation; elevation = elevation.next_sibling())
-            {
-                double s = atof(elevation.attribute("s").value());
-                double a = atof(elevation.attribute("a").value());
-                double b = atof(elevation.attribute("b").value());
-                double c = atof(elevation.attribute("c").value());
-                double d = atof(elevation.attribute("d").value());
-
-                Elevation* ep = new Elevation(s, a, b, c, d);
-                if (ep != NULL)
-                {
-                    r->AddElevation(ep);
-                }
-                else
-                {
-                    LOG("Elevation: Major error");
-                }
-            }
-        }
-
-        pugi::xml_node super_elevation_profile = road_node.child("lateralProfile");
-        if (super_elevation_profile != NULL)
-        {
-            for (pugi::xml_node super_elevation = super_elevation_profile.child("superelevation"); super_elevation;
-                 super_elevation                = super_elevation.next_sibling("superelevation"))
-            {
-                double s = atof(super_elevation.attribute("s").value());
-                double a = atof(super_elevation.attribute("a").value());
-                double b = atof(super_elevation.attribute("b").value());
-                double c = atof(super_elevation.attribute("c").value());
-                double d = atof(super_elevation.attribute("d").value());
-
-                Elevation* ep = new Elevation(s, a, b, c, d);
-                if (ep != NULL)
-                {
-                    r->AddSuperElevation(ep);
-                }
-                else
-                {
-                    LOG("SuperElevation: Major error");
-                }
-            }
-        }
-
-        pugi::xml_node lanes = road_node.child("lanes");
-        if (lanes != NULL)
-        {
-            for (pugi::xml_node_iterator child = lanes.children().begin(); child != lanes.children().end(); child++)
-            {
-                if (!strcmp(child->name(), "laneOffset"))
-                {
-                    double s = atof(child->attribute("s").value());
-                    double a = atof(child->attribute("a").value());
-                    double b = atof(child->attribute("b").value());
-                    double c = atof(child->attribute("c").value());
-                    double d = atof(child->attribute("d").value());
-                    r->AddLaneOffset(new LaneOffset(s, a, b, c, d));
-                }
-                else if (!strcmp(child->name(), "laneSection"))
-                {
-                    double       s            = atof(child->attribute("s").value());
-                    LaneSection* lane_section = new LaneSection(s);
-                    r->AddLaneSection(lane_section);
-
-                    for (pugi::xml_node_iterator child2 = child->children().begin(); child2 != child->children().end(); child2++)
-                    {
-                        if (!strcmp(child2->name(), "left"))
+                        else if (!strcmp(lane_node->attribute("type").value(), "driving"))
                         {
-                            // LOG("Lane left");
+                            lane_type = Lane::LANE_TYPE_DRIVING;
                         }
-                        else if (!strcmp(child2->name(), "right"))
+                        else if (!strcmp(lane_node->attribute("type").value(), "stop"))
                         {
-                            // LOG("Lane right");
+                            lane_type = Lane::LANE_TYPE_STOP;
                         }
-                        else if (!strcmp(child2->name(), "center"))
+                        else if (!strcmp(lane_node->attribute("type").value(), "shoulder"))
                         {
-                            // LOG("Lane center");
+                            lane_type = Lane::LANE_TYPE_SHOULDER;
                         }
-                        else if (!strcmp(child2->name(), "userData"))
+                        else if (!strcmp(lane_node->attribute("type").value(), "biking"))
                         {
-                            // Not supported
-                            continue;
+                            lane_type = Lane::LANE_TYPE_BIKING;
+                        }
+                        else if (!strcmp(lane_node->attribute("type").value(), "sidewalk"))
+                        {
+                            lane_type = Lane::LANE_TYPE_SIDEWALK;
+                        }
+                        else if (!strcmp(lane_node->attribute("type").value(), "border"))
+                        {
+                            lane_type = Lane::LANE_TYPE_BORDER;
+                        }
+                        else if (!strcmp(lane_node->attribute("type").value(), "restricted"))
+                        {
+                            lane_type = Lane::LANE_TYPE_RESTRICTED;
+                        }
+                        else if (!strcmp(lane_node->attribute("type").value(), "parking"))
+                        {
+                            lane_type = Lane::LANE_TYPE_PARKING;
+                        }
+                        else if (!strcmp(lane_node->attribute("type").value(), "bidirectional"))
+                        {
+                            lane_type = Lane::LANE_TYPE_BIDIRECTIONAL;
+                        }
+                        else if (!strcmp(lane_node->attribute("type").value(), "median"))
+                        {
+                            lane_type = Lane::LANE_TYPE_MEDIAN;
+                        }
+                        else if (!strcmp(lane_node->attribute("type").value(), "special1"))
+                        {
+                            lane_type = Lane::LANE_TYPE_SPECIAL1;
+                        }
+                        else if (!strcmp(lane_node->attribute("type").value(), "special2"))
+                        {
+                            lane_type = Lane::LANE_TYPE_SPECIAL2;
+                        }
+                        else if (!strcmp(lane_node->attribute("type").value(), "special3"))
+                        {
+                            lane_type = Lane::LANE_TYPE_SPECIAL3;
+                        }
+                        else if (!strcmp(lane_node->attribute("type").value(), "roadmarks"))
+                        {
+                            lane_type = Lane::LANE_TYPE_ROADMARKS;
+                        }
+                        else if (!strcmp(lane_node->attribute("type").value(), "tram"))
+                        {
+                            lane_type = Lane::LANE_TYPE_TRAM;
+                        }
+                        else if (!strcmp(lane_node->attribute("type").value(), "rail"))
+                        {
+                            lane_type = Lane::LANE_TYPE_RAIL;
+                        }
+                        else if (!strcmp(lane_node->attribute("type").value(), "entry") ||
+                                 !strcmp(lane_node->attribute("type").value(), "mwyEntry"))
+                        {
+                            lane_type = Lane::LANE_TYPE_ENTRY;
+                        }
+                        else if (!strcmp(lane_node->attribute("type").value(), "exit") ||
+                                 !strcmp(lane_node->attribute("type").value(), "mwyExit"))
+                        {
+                            lane_type = Lane::LANE_TYPE_EXIT;
+                        }
+                        else if (!strcmp(lane_node->attribute("type").value(), "offRamp"))
+                        {
+                            lane_type = Lane::LANE_TYPE_OFF_RAMP;
+                        }
+                        else if (!strcmp(lane_node->attribute("type").value(), "onRamp"))
+                        {
+                            lane_type = Lane::LANE_TYPE_ON_RAMP;
                         }
                         else
                         {
-                            LOG("Unsupported lane side: %s", child2->name());
-                            continue;
+                            LOG("unknown lane type: %s (road id=%d)", lane_node->attribute("type").value(), r->GetId());
                         }
 
-                        for (pugi::xml_node_iterator lane_node = child2->children().begin(); lane_node != child2->children().end(); lane_node++)
+                        int lane_id = atoi(lane_node->attribute("id").value());
+
+                        // If lane ID == 0, make sure it's not a driving lane
+                        if (lane_id == 0 && lane_type == Lane::LANE_TYPE_DRIVING)
                         {
-                            if (strcmp(lane_node->name(), "lane"))
-                            {
-                                LOG("Unexpected element: %s, expected \"lane\"", lane_node->name());
-                                continue;
-                            }
+                            lane_type = Lane::LANE_TYPE_NONE;
+                        }
 
-                            Lane::LaneType lane_type = Lane::LANE_TYPE_NONE;
-                            if (lane_node->attribute("type") == 0 || !strcmp(lane_node->attribute("type").value(), ""))
-                            {
-                                LOG("Lane type error");
-                            }
-                            if (!strcmp(lane_node->attribute("type").value(), "none"))
-                            {
-                                lane_type = Lane::LANE_TYPE_NONE;
-                            }
-                            else if (!strcmp(lane_node->attribute("type").value(), "driving"))
-                            {
-                                lane_type = Lane::LANE_TYPE_DRIVING;
-                            }
-                            else if (!strcmp(lane_node->attribute("type").value(), "stop"))
-                            {
-                                lane_type = Lane::LANE_TYPE_STOP;
-                            }
-                            else if (!strcmp(lane_node->attribute("type").value(), "shoulder"))
-                            {
-                                lane_type = Lane::LANE_TYPE_SHOULDER;
-                            }
-                            else if (!strcmp(lane_node->attribute("type").value(), "biking"))
-                            {
-                                lane_type = Lane::LANE_TYPE_BIKING;
-                            }
-                            else if (!strcmp(lane_node->attribute("type").value(), "sidewalk"))
-                            {
-                                lane_type = Lane::LANE_TYPE_SIDEWALK;
-                            }
-                            else if (!strcmp(lane_node->attribute("type").value(), "border"))
-                            {
-                                lane_type = Lane::LANE_TYPE_BORDER;
-                            }
-                            else if (!strcmp(lane_node->attribute("type").value(), "restricted"))
-                            {
-                                lane_type = Lane::LANE_TYPE_RESTRICTED;
-                            }
-                            else if (!strcmp(lane_node->attribute("type").value(), "parking"))
+                        Lane* lane = new Lane(lane_id, lane_type);
+                        if (lane == NULL)
+                        {
+                            LOG("Error: creating lane");
+                            return nullptr;
+                        }
+                        lane_section->AddLane(lane);
+
+                        // Link
+                        pugi::xml_node lane_link = lane_node->child("link");
+                        if (lane_link != NULL)
+                        {
+                            pugi::xml_node successor = lane_link.child("successor");
+                            if (successor != NULL)
                             {
-                                lane_type = Lane::LANE_TYPE_PARKING;
+                                lane->AddLink(new LaneLink(SUCCESSOR, atoi(successor.attribute("id").value())));
                             }
-                            else if (!strcmp(lane_node->attribute("type").value(), "bidirectional"))
+                            pugi::xml_node predecessor = lane_link.child("predecessor");
+                            if (predecessor != NULL)
                             {
-                                lane_type = Lane::LANE_TYPE_BIDIRECTIONAL;
+                                lane->AddLink(new LaneLink(PREDECESSOR, atoi(predecessor.attribute("id").value())));
                             }
-                            else if (!strcmp(lane_node->attribute("type").value(), "median"))
+                        }
+
+                        // Width
+                        for (pugi::xml_node width = lane_node->child("width"); width; width = width.next_sibling("width"))
+                        {
+                            double s_offset = atof(width.attribute("sOffset").value());
+                            double a        = atof(width.attribute("a").value());
+                            double b        = atof(width.attribute("b").value());
+                            double c        = atof(width.attribute("c").value());
+                            double d        = atof(width.attribute("d").value());
+                            lane->AddLaneWidth(new LaneWidth(s_offset, a, b, c, d));
+                        }
+
+                        // roadMark
+                        for (pugi::xml_node roadMark = lane_node->child("roadMark"); roadMark; roadMark = roadMark.next_sibling("roadMark"))
+                        {
+                            // s_offset
+                            double s_offset = atof(roadMark.attribute("sOffset").value());
+
+                            // type
+                            LaneRoadMark::RoadMarkType roadMark_type = LaneRoadMark::NONE_TYPE;
+                            if (roadMark.attribute("type") == 0 || !strcmp(roadMark.attribute("type").value(), ""))
                             {
-                                lane_type = Lane::LANE_TYPE_MEDIAN;
+                                LOG("Lane road mark type error");
                             }
-                            else if (!strcmp(lane_node->attribute("type").value(), "special1"))
+                            if (!strcmp(roadMark.attribute("type").value(), "none"))
                             {
-                                lane_type = Lane::LANE_TYPE_SPECIAL1;
+                                roadMark_type = LaneRoadMark::NONE_TYPE;
                             }
-                            else if (!strcmp(lane_node->attribute("type").value(), "special2"))
+                            else if (!strcmp(roadMark.attribute("type").value(), "solid"))
                             {
-                                lane_type = Lane::LANE_TYPE_SPECIAL2;
+                                roadMark_type = LaneRoadMark::SOLID;
                             }
-                            else if (!strcmp(lane_node->attribute("type").value(), "special3"))
+                            else if (!strcmp(roadMark.attribute("type").value(), "broken"))
                             {
-                                lane_type = Lane::LANE_TYPE_SPECIAL3;
+                                roadMark_type = LaneRoadMark::BROKEN;
                             }
-                            else if (!strcmp(lane_node->attribute("type").value(), "roadmarks"))
+                            else if (!strcmp(roadMark.attribute("type").value(), "solid solid"))
                             {
-                                lane_type = Lane::LANE_TYPE_ROADMARKS;
+                                roadMark_type = LaneRoadMark::SOLID_SOLID;
                             }
-                            else if (!strcmp(lane_node->attribute("type").value(), "tram"))
+                            else if (!strcmp(roadMark.attribute("type").value(), "solid broken"))
                             {
-                                lane_type = Lane::LANE_TYPE_TRAM;
+                                roadMark_type = LaneRoadMark::SOLID_BROKEN;
                             }
-                            else if (!strcmp(lane_node->attribute("type").value(), "rail"))
+                            else if (!strcmp(roadMark.attribute("type").value(), "broken solid"))
                             {
-                                lane_type = Lane::LANE_TYPE_RAIL;
+                                roadMark_type = LaneRoadMark::BROKEN_SOLID;
                             }
-                            else if (!strcmp(lane_node->attribute("type").value(), "entry") ||
-                                     !strcmp(lane_node->attribute("type").value(), "mwyEntry"))
+                            else if (!strcmp(roadMark.attribute("type").value(), "broken broken"))
                             {
-                                lane_type = Lane::LANE_TYPE_ENTRY;
+                                roadMark_type = LaneRoadMark::BROKEN_BROKEN;
                             }
-                            else if (!strcmp(lane_node->attribute("type").value(), "exit") ||
-                                     !strcmp(lane_node->attribute("type").value(), "mwyExit"))
+                            else if (!strcmp(roadMark.attribute("type").value(), "botts dots"))
                             {
-                                lane_type = Lane::LANE_TYPE_EXIT;
+                                roadMark_type = LaneRoadMark::BOTTS_DOTS;
                             }
-                            else if (!strcmp(lane_node->attribute("type").value(), "offRamp"))
+                            else if (!strcmp(roadMark.attribute("type").value(), "grass"))
                             {
-                                lane_type = Lane::LANE_TYPE_OFF_RAMP;
+                                roadMark_type = LaneRoadMark::GRASS;
                             }
-                            else if (!strcmp(lane_node->attribute("type").value(), "onRamp"))
+                            else if (!strcmp(roadMark.attribute("type").value(), "curb"))
                             {
-                                lane_type = Lane::LANE_TYPE_ON_RAMP;
+                                roadMark_type = LaneRoadMark::CURB;
                             }
                             else
                             {
-                                LOG("unknown lane type: %s (road id=%d)", lane_node->attribute("type").value(), r->GetId());
-                            }
-
-                            int lane_id = atoi(lane_node->attribute("id").value());
-
-                            // If lane ID == 0, make sure it's not a driving lane
-                            if (lane_id == 0 && lane_type == Lane::LANE_TYPE_DRIVING)
-                            {
-                                lane_type = Lane::LANE_TYPE_NONE;
+                                LOG("unknown lane road mark type: %s (road id=%d)", roadMark.attribute("type").value(), r->GetId());
                             }
 
-                            Lane* lane = new Lane(lane_id, lane_type);
-                            if (lane == NULL)
+                            // weight - consider it optional with default value = STANDARD
+                            LaneRoadMark::RoadMarkWeight roadMark_weight = LaneRoadMark::STANDARD;
+                            if (roadMark.attribute("weight") != 0 && strcmp(roadMark.attribute("weight").value(), ""))
                             {
-                                LOG("Error: creating lane");
-                                return false;
-                            }
-                            lane_section->AddLane(lane);
-
-                            // Link
-                            pugi::xml_node lane_link = lane_node->child("link");
-                            if (lane_link != NULL)
-                            {
-                                pugi::xml_node successor = lane_link.child("successor");
-                                if (successor != NULL)
+                                if (!strcmp(roadMark.attribute("weight").value(), "standard"))
                                 {
-                                    lane->AddLink(new LaneLink(SUCCESSOR, atoi(successor.attribute("id").value())));
+                                    roadMark_weight = LaneRoadMark::STANDARD;
                                 }
-                                pugi::xml_node predecessor = lane_link.child("predecessor");
-                                if (predecessor != NULL)
+                                else if (!strcmp(roadMark.attribute("weight").value(), "bold"))
+                                {
+                                    roadMark_weight = LaneRoadMark::BOLD;
+                                }
+                                else
                                 {
-                                    lane->AddLink(new LaneLink(PREDECESSOR, atoi(predecessor.attribute("id").value())));
+                                    LOG("unknown lane road mark weight: %s (road id=%d) setting to standard",
+                                        roadMark.attribute("type").value(),
+                                        r->GetId());
+                                    roadMark_weight = LaneRoadMark::STANDARD;
                                 }
                             }
 
-                            // Width
-                            for (pugi::xml_node width = lane_node->child("width"); width; width = width.next_sibling("width"))
+                            // color - consider it optional with default value = STANDARD_COLOR
+                            RoadMarkColor roadMark_color = LaneRoadMark::ParseColor(roadMark);
+                            if (GetVersionMajor() == 1 && GetVersionMinor() > 4 && roadMark_color == RoadMarkColor::UNDEFINED)
                             {
-                                double s_offset = atof(width.attribute("sOffset").value());
-                                double a        = atof(width.attribute("a").value());
-                                double b        = atof(width.attribute("b").value());
-                                double c        = atof(width.attribute("c").value());
-                                double d        = atof(width.attribute("d").value());
-                                lane->AddLaneWidth(new LaneWidth(s_offset, a, b, c, d));
+                                LOG("Missing lane road mark color: %s (road id=%d), set to standard (white)",
+                                    LaneRoadMark::RoadMarkColor2Str(roadMark_color).c_str(),
+                                    r->GetId());
+                                roadMark_color = RoadMarkColor::STANDARD_COLOR;
                             }
 
-                            // roadMark
-                            for (pugi::xml_node roadMark = lane_node->child("roadMark"); roadMark; roadMark = roadMark.next_sibling("roadMark"))
-                            {
-                                // s_offset
-                                double s_offset = atof(roadMark.attribute("sOffset").value());
+                            // material
+                            LaneRoadMark::RoadMarkMaterial roadMark_material = LaneRoadMark::STANDARD_MATERIAL;
 
-                                // type
-                                LaneRoadMark::RoadMarkType roadMark_type = LaneRoadMark::NONE_TYPE;
-                                if (roadMark.attribute("type") == 0 || !strcmp(roadMark.attribute("type").value(), ""))
-                                {
-                                    LOG("Lane road mark type error");
-                                }
-                                if (!strcmp(roadMark.attribute("type").value(), "none"))
-                                {
-                                    roadMark_type = LaneRoadMark::NONE_TYPE;
-                                }
-                                else if (!strcmp(roadMark.attribute("type").value(), "solid"))
-                                {
-                                    roadMark_type = LaneRoadMark::SOLID;
-                                }
-                                else if (!strcmp(roadMark.attribute("type").value(), "broken"))
-                                {
-                                    roadMark_type = LaneRoadMark::BROKEN;
-                                }
-                                else if (!strcmp(roadMark.attribute("type").value(), "solid solid"))
-                                {
-                                    roadMark_type = LaneRoadMark::SOLID_SOLID;
-                                }
-                                else if (!strcmp(roadMark.attribute("type").value(), "solid broken"))
-                                {
-                                    roadMark_type = LaneRoadMark::SOLID_BROKEN;
-                                }
-                                else if (!strcmp(roadMark.attribute("type").value(), "broken solid"))
-                                {
-                                    roadMark_type = LaneRoadMark::BROKEN_SOLID;
-                                }
-                                else if (!strcmp(roadMark.attribute("type").value(), "broken broken"))
-                                {
-                                    roadMark_type = LaneRoadMark::BROKEN_BROKEN;
-                                }
-                                else if (!strcmp(roadMark.attribute("type").value(), "botts dots"))
-                                {
-                                    roadMark_type = LaneRoadMark::BOTTS_DOTS;
-                                }
-                                else if (!strcmp(roadMark.attribute("type").value(), "grass"))
-                                {
-                                    roadMark_type = LaneRoadMark::GRASS;
-                                }
-                                else if (!strcmp(roadMark.attribute("type").value(), "curb"))
+                            // optional laneChange
+                            LaneRoadMark::RoadMarkLaneChange roadMark_laneChange = LaneRoadMark::NONE_LANECHANGE;
+                            if (!roadMark.attribute("laneChange").empty())
+                            {
+                                if (!strcmp(roadMark.attribute("laneChange").value(), ""))
                                 {
-                                    roadMark_type = LaneRoadMark::CURB;
+                                    LOG("Lane roadmark lanechange error");
                                 }
                                 else
                                 {
-                                    LOG("unknown lane road mark type: %s (road id=%d)", roadMark.attribute("type").value(), r->GetId());
-                                }
-
-                                // weight - consider it optional with default value = STANDARD
-                                LaneRoadMark::RoadMarkWeight roadMark_weight = LaneRoadMark::STANDARD;
-                                if (roadMark.attribute("weight") != 0 && strcmp(roadMark.attribute("weight").value(), ""))
-                                {
-                                    if (!strcmp(roadMark.attribute("weight").value(), "standard"))
+                                    if (!strcmp(roadMark.attribute("laneChange").value(), "none"))
                                     {
-                                        roadMark_weight = LaneRoadMark::STANDARD;
+                                        roadMark_laneChange = LaneRoadMark::NONE_LANECHANGE;
                                     }
-                                    else if (!strcmp(roadMark.attribute("weight").value(), "bold"))
+                                    else if (!strcmp(roadMark.attribute("laneChange").value(), "increase"))
                                     {
-                                        roadMark_weight = LaneRoadMark::BOLD;
+                                        roadMark_laneChange = LaneRoadMark::INCREASE;
                                     }
-                                    else
+                                    else if (!strcmp(roadMark.attribute("laneChange").value(), "decrease"))
                                     {
-                                        LOG("unknown lane road mark weight: %s (road id=%d) setting to standard",
-                                            roadMark.attribute("type").value(),
-                                            r->GetId());
-                                        roadMark_weight = LaneRoadMark::STANDARD;
+                                        roadMark_laneChange = LaneRoadMark::DECREASE;
                                     }
-                                }
-
-                                // color - consider it optional with default value = STANDARD_COLOR
-                                RoadMarkColor roadMark_color = LaneRoadMark::ParseColor(roadMark);
-                                if (GetVersionMajor() == 1 && GetVersionMinor() > 4 && roadMark_color == RoadMarkColor::UNDEFINED)
-                                {
-                                    LOG("Missing lane road mark color: %s (road id=%d), set to standard (white)",
-                                        LaneRoadMark::RoadMarkColor2Str(roadMark_color).c_str(),
-                                        r->GetId());
-                                    roadMark_color = RoadMarkColor::STANDARD_COLOR;
-                                }
-
-                                // material
-                                LaneRoadMark::RoadMarkMaterial roadMark_material = LaneRoadMark::STANDARD_MATERIAL;
-
-                                // optional laneChange
-                                LaneRoadMark::RoadMarkLaneChange roadMark_laneChange = LaneRoadMark::NONE_LANECHANGE;
-                                if (!roadMark.attribute("laneChange").empty())
-                                {
-                                    if (!strcmp(roadMark.attribute("laneChange").value(), ""))
+                                    else if (!strcmp(roadMark.attribute("laneChange").value(), "both"))
                                     {
-                                        LOG("Lane roadmark lanechange error");
+                                        roadMark_laneChange = LaneRoadMark::BOTH;
                                     }
                                     else
                                     {
-                                        if (!strcmp(roadMark.attribute("laneChange").value(), "none"))
-                                        {
-                                            roadMark_laneChange = LaneRoadMark::NONE_LANECHANGE;
-                                        }
-                                        else if (!strcmp(roadMark.attribute("laneChange").value(), "increase"))
-                                        {
-                                            roadMark_laneChange = LaneRoadMark::INCREASE;
-                                        }
-                                        else if (!strcmp(roadMark.attribute("laneChange").value(), "decrease"))
-                                        {
-                                            roadMark_laneChange = LaneRoadMark::DECREASE;
-                                        }
-                                        else if (!strcmp(roadMark.attribute("laneChange").value(), "both"))
-                                        {
-                                            roadMark_laneChange = LaneRoadMark::BOTH;
-                                        }
-                                        else
-                                        {
-                                            LOG("unknown lane road mark lane change: %s (road id=%d)",
-                                                roadMark.attribute("laneChange").value(),
-                                                r->GetId());
-                                        }
+                                        LOG("unknown lane road mark lane change: %s (road id=%d)",
+                                            roadMark.attribute("laneChange").value(),
+                                            r->GetId());
                                     }
                                 }
+                            }
 
-                                double roadMark_width;
-                                if (roadMark.attribute("width").empty())
-                                {
-                                    roadMark_width = (roadMark_weight == LaneRoadMark::BOLD) ? ROADMARK_WIDTH_BOLD : ROADMARK_WIDTH_STANDARD;
-                                }
-                                else
-                                {
-                                    roadMark_width = atof(roadMark.attribute("width").value());
-                                }
+                            double roadMark_width;
+                            if (roadMark.attribute("width").empty())
+                            {
+                                roadMark_width = (roadMark_weight == LaneRoadMark::BOLD) ? ROADMARK_WIDTH_BOLD : ROADMARK_WIDTH_STANDARD;
+                            }
+                            else
+                            {
+                                roadMark_width = atof(roadMark.attribute("width").value());
+                            }
 
-                                double        roadMark_height = atof(roadMark.attribute("height").value());
-                                LaneRoadMark* lane_roadMark   = new LaneRoadMark(s_offset,
-                                                                               roadMark_type,
-                                                                               roadMark_weight,
-                                                                               roadMark_color,
-                                                                               roadMark_material,
-                                                                               roadMark_laneChange,
-                                                                               roadMark_width,
-                                                                               roadMark_height);
-                                lane->AddLaneRoadMark(lane_roadMark);
-
-                                // sub_type
-                                LaneRoadMarkType* lane_roadMarkType = 0;
-                                for (pugi::xml_node sub_type = roadMark.child("type"); sub_type; sub_type = sub_type.next_sibling("type"))
+                            double        roadMark_height = atof(roadMark.attribute("height").value());
+                            LaneRoadMark* lane_roadMark   = new LaneRoadMark(s_offset,
+                                                                           roadMark_type,
+                                                                           roadMark_weight,
+                                                                           roadMark_color,
+                                                                           roadMark_material,
+                                                                           roadMark_laneChange,
+                                                                           roadMark_width,
+                                                                           roadMark_height);
+                            lane->AddLaneRoadMark(lane_roadMark);
+
+                            // sub_type
+                            LaneRoadMarkType* lane_roadMarkType = 0;
+                            for (pugi::xml_node sub_type = roadMark.child("type"); sub_type; sub_type = sub_type.next_sibling("type"))
+                            {
+                                if (sub_type != NULL)
                                 {
-                                    if (sub_type != NULL)
+                                    std::string sub_type_name  = sub_type.attribute("name").value();
+                                    double      sub_type_width = atof(sub_type.attribute("width").value());
+                                    lane_roadMarkType          = new LaneRoadMarkType(sub_type_name, sub_type_width);
+                                    lane_roadMark->AddType(std::shared_ptr<LaneRoadMarkType>{lane_roadMarkType});
+
+                                    for (pugi::xml_node line = sub_type.child("line"); line; line = line.next_sibling("line"))
                                     {
-                                        std::string sub_type_name  = sub_type.attribute("name").value();
-                                        double      sub_type_width = atof(sub_type.attribute("width").value());
-                                        lane_roadMarkType          = new LaneRoadMarkType(sub_type_name, sub_type_width);
-                                        lane_roadMark->AddType(std::shared_ptr<LaneRoadMarkType>{lane_roadMarkType});
+                                        double llength    = atof(line.attribute("length").value());
+                                        double space      = atof(line.attribute("space").value());
+                                        double t_offset   = atof(line.attribute("tOffset").value());
+                                        double s_offset_l = atof(line.attribute("sOffset").value());
 
-                                        for (pugi::xml_node line = sub_type.child("line"); line; line = line.next_sibling("line"))
+                                        if (!line.attribute("color").empty())
                                         {
-                                            double llength    = atof(line.attribute("length").value());
-                                            double space      = atof(line.attribute("space").value());
-                                            double t_offset   = atof(line.attribute("tOffset").value());
-                                            double s_offset_l = atof(line.attribute("sOffset").value());
-
-                                            if (!line.attribute("color").empty())
+                                            RoadMarkColor tmp_color = LaneRoadMark::ParseColor(line);
+                                            if (tmp_color != RoadMarkColor::UNDEFINED)
                                             {
-                                                RoadMarkColor tmp_color = LaneRoadMark::ParseColor(line);
-                                                if (tmp_color != RoadMarkColor::UNDEFINED)
-                                                {
-                                                    roadMark_color =
-                                                        tmp_color;  // supersedes the setting in <RoadMark> element (available from odr v1.5)
-                                                }
+                                                roadMark_color =
+                                                    tmp_color;  // supersedes the setting in <RoadMark> element (available from odr v1.5)
                                             }
+                                        }
 
-                                            // rule (optional)
-                                            LaneRoadMarkTypeLine::RoadMarkTypeLineRule rule = LaneRoadMarkTypeLine::NONE;
-                                            if (line.attribute("rule") != 0 && strcmp(line.attribute("rule").value(), ""))
+                                        // rule (optional)
+                                        LaneRoadMarkTypeLine::RoadMarkTypeLineRule rule = LaneRoadMarkTypeLine::NONE;
+                                        if (line.attribute("rule") != 0 && strcmp(line.attribute("rule").value(), ""))
+                                        {
+                                            if (!strcmp(line.attribute("rule").value(), "none"))
                                             {
-                                                if (!strcmp(line.attribute("rule").value(), "none"))
-                                                {
-                                                    rule = LaneRoadMarkTypeLine::NONE;
-                                                }
-                                                else if (!strcmp(line.attribute("rule").value(), "caution"))
-                                                {
-                                                    rule = LaneRoadMarkTypeLine::CAUTION;
-                                                }
-                                                else if (!strcmp(line.attribute("rule").value(), "no passing"))
-                                                {
-                                                    rule = LaneRoadMarkTypeLine::NO_PASSING;
-                                                }
-                                                else
-                                                {
-                                                    LOG("unknown lane road mark type line rule: %s (road id=%d)",
-                                                        line.attribute("rule").value(),
-                                                        r->GetId());
-                                                }
+                                                rule = LaneRoadMarkTypeLine::NONE;
+                                            }
+                                            else if (!strcmp(line.attribute("rule").value(), "caution"))
+                                            {
+                                                rule = LaneRoadMarkTypeLine::CAUTION;
+                                            }
+                                            else if (!strcmp(line.attribute("rule").value(), "no passing"))
+                                            {
+                                                rule = LaneRoadMarkTypeLine::NO_PASSING;
                                             }
+                                            else
+                                            {
+                                                LOG("unknown lane road mark type line rule: %s (road id=%d)",
+                                                    line.attribute("rule").value(),
+                                                    r->GetId());
+                                            }
+                                        }
 
-                                            double width = atof(line.attribute("width").value());
+                                        double width = atof(line.attribute("width").value());
 
-                                            LaneRoadMarkTypeLine* lane_roadMarkTypeLine =
-                                                new LaneRoadMarkTypeLine(llength, space, t_offset, s_offset_l, rule, width, roadMark_color);
-                                            lane_roadMarkType->AddLine(std::shared_ptr<LaneRoadMarkTypeLine>(lane_roadMarkTypeLine));
-                                        }
+                                        LaneRoadMarkTypeLine* lane_roadMarkTypeLine =
+                                            new LaneRoadMarkTypeLine(llength, space, t_offset, s_offset_l, rule, width, roadMark_color);
+                                        lane_roadMarkType->AddLine(std::shared_ptr<LaneRoadMarkTypeLine>(lane_roadMarkTypeLine));
                                     }
                                 }
-                                if (lane_roadMarkType == 0)
+                            }
+                            if (lane_roadMarkType == 0)
+                            {
+                                if (roadMark_type == LaneRoadMark::NONE_TYPE)
                                 {
-                                    if (roadMark_type == LaneRoadMark::NONE_TYPE)
-                                    {
-                                        lane_roadMarkType = new LaneRoadMarkType("stand-in", roadMark_width);
-                                        lane_roadMark->AddType(std::shared_ptr<LaneRoadMarkType>{lane_roadMarkType});
-                                        LaneRoadMarkTypeLine::RoadMarkTypeLineRule rule = LaneRoadMarkTypeLine::NONE;
-                                        LaneRoadMarkTypeLine*                      lane_roadMarkTypeLine =
-                                            new LaneRoadMarkTypeLine(0, 0, 0, 0, rule, roadMark_width, roadMark_color);
-                                        lane_roadMarkType->AddLine(std::shared_ptr<LaneRoadMarkTypeLine>{lane_roadMarkTypeLine});
-                                    }
-                                    else if (roadMark_type == LaneRoadMark::SOLID || roadMark_type == LaneRoadMark::CURB)
-                                    {
-                                        lane_roadMarkType = new LaneRoadMarkType("stand-in", roadMark_width);
-                                        lane_roadMark->AddType(std::shared_ptr<LaneRoadMarkType>{lane_roadMarkType});
-                                        LaneRoadMarkTypeLine::RoadMarkTypeLineRule rule = LaneRoadMarkTypeLine::NONE;
-                                        LaneRoadMarkTypeLine*                      lane_roadMarkTypeLine =
-                                            new LaneRoadMarkTypeLine(0, 0, 0, 0, rule, roadMark_width, roadMark_color);
-                                        lane_roadMarkType->AddLine(std::shared_ptr<LaneRoadMarkTypeLine>{lane_roadMarkTypeLine});
-                                    }
-                                    else if (roadMark_type == LaneRoadMark::SOLID_SOLID)
-                                    {
-                                        lane_roadMarkType = new LaneRoadMarkType("stand-in", roadMark_width);
-                                        lane_roadMark->AddType(std::shared_ptr<LaneRoadMarkType>{lane_roadMarkType});
-                                        LaneRoadMarkTypeLine::RoadMarkTypeLineRule rule = LaneRoadMarkTypeLine::NONE;
-                                        LaneRoadMarkTypeLine*                      lane_roadMarkTypeLine =
-                                            new LaneRoadMarkTypeLine(0, 0, -roadMark_width, 0, rule, roadMark_width, roadMark_color);
-                                        lane_roadMarkType->AddLine(std::shared_ptr<LaneRoadMarkTypeLine>{lane_roadMarkTypeLine});
-                                        LaneRoadMarkTypeLine* lane_roadMarkTypeLine2 =
-                                            new LaneRoadMarkTypeLine(0, 0, roadMark_width, 0, rule, roadMark_width, roadMark_color);
-                                        lane_roadMarkType->AddLine(std::shared_ptr<LaneRoadMarkTypeLine>{lane_roadMarkTypeLine2});
-                                    }
-                                    else if (roadMark_type == LaneRoadMark::BROKEN)
-                                    {
-                                        lane_roadMarkType = new LaneRoadMarkType("stand-in", roadMark_width);
-                                        lane_roadMark->AddType(std::shared_ptr<LaneRoadMarkType>{lane_roadMarkType});
-                                        LaneRoadMarkTypeLine::RoadMarkTypeLineRule rule = LaneRoadMarkTypeLine::NONE;
-                                        LaneRoadMarkTypeLine*                      lane_roadMarkTypeLine =
-                                            new LaneRoadMarkTypeLine(4, 8, 0, 0, rule, roadMark_width, roadMark_color);
-                                        lane_roadMarkType->AddLine(std::shared_ptr<LaneRoadMarkTypeLine>{lane_roadMarkTypeLine});
-                                    }
-                                    else if (roadMark_type == LaneRoadMark::BROKEN_BROKEN)
-                                    {
-                                        lane_roadMarkType = new LaneRoadMarkType("stand-in", roadMark_width);
-                                        lane_roadMark->AddType(std::shared_ptr<LaneRoadMarkType>{lane_roadMarkType});
-                                        LaneRoadMarkTypeLine::RoadMarkTypeLineRule rule = LaneRoadMarkTypeLine::NONE;
-                                        LaneRoadMarkTypeLine*                      lane_roadMarkTypeLine =
-                                            new LaneRoadMarkTypeLine(4, 8, -roadMark_width, 0, rule, roadMark_width, roadMark_color);
-                                        lane_roadMarkType->AddLine(std::shared_ptr<LaneRoadMarkTypeLine>{lane_roadMarkTypeLine});
-                                        LaneRoadMarkTypeLine* lane_roadMarkTypeLine2 =
-                                            new LaneRoadMarkTypeLine(4, 8, roadMark_width, 0, rule, roadMark_width, roadMark_color);
-                                        lane_roadMarkType->AddLine(std::shared_ptr<LaneRoadMarkTypeLine>{lane_roadMarkTypeLine2});
-                                    }
-                                    else
-                                    {
-                                        LOG("No road mark created for road %d lane %d. Type %d not supported. Either switch type or add a roadMark <type> element.",
-                                            r->GetId(),
-                                            lane_id,
-                                            roadMark_type);
-                                    }
+                                    lane_roadMarkType = new LaneRoadMarkType("stand-in", roadMark_width);
+                                    lane_roadMark->AddType(std::shared_ptr<LaneRoadMarkType>{lane_roadMarkType});
+                                    LaneRoadMarkTypeLine::RoadMarkTypeLineRule rule = LaneRoadMarkTypeLine::NONE;
+                                    LaneRoadMarkTypeLine*                      lane_roadMarkTypeLine =
+                                        new LaneRoadMarkTypeLine(0, 0, 0, 0, rule, roadMark_width, roadMark_color);
+                                    lane_roadMarkType->AddLine(std::shared_ptr<LaneRoadMarkTypeLine>{lane_roadMarkTypeLine});
+                                }
+                                else if (roadMark_type == LaneRoadMark::SOLID || roadMark_type == LaneRoadMark::CURB)
+                                {
+                                    lane_roadMarkType = new LaneRoadMarkType("stand-in", roadMark_width);
+                                    lane_roadMark->AddType(std::shared_ptr<LaneRoadMarkType>{lane_roadMarkType});
+                                    LaneRoadMarkTypeLine::RoadMarkTypeLineRule rule = LaneRoadMarkTypeLine::NONE;
+                                    LaneRoadMarkTypeLine*                      lane_roadMarkTypeLine =
+                                        new LaneRoadMarkTypeLine(0, 0, 0, 0, rule, roadMark_width, roadMark_color);
+                                    lane_roadMarkType->AddLine(std::shared_ptr<LaneRoadMarkTypeLine>{lane_roadMarkTypeLine});
+                                }
+                                else if (roadMark_type == LaneRoadMark::SOLID_SOLID)
+                                {
+                                    lane_roadMarkType = new LaneRoadMarkType("stand-in", roadMark_width);
+                                    lane_roadMark->AddType(std::shared_ptr<LaneRoadMarkType>{lane_roadMarkType});
+                                    LaneRoadMarkTypeLine::RoadMarkTypeLineRule rule = LaneRoadMarkTypeLine::NONE;
+                                    LaneRoadMarkTypeLine*                      lane_roadMarkTypeLine =
+                                        new LaneRoadMarkTypeLine(0, 0, -roadMark_width, 0, rule, roadMark_width, roadMark_color);
+                                    lane_roadMarkType->AddLine(std::shared_ptr<LaneRoadMarkTypeLine>{lane_roadMarkTypeLine});
+                                    LaneRoadMarkTypeLine* lane_roadMarkTypeLine2 =
+                                        new LaneRoadMarkTypeLine(0, 0, roadMark_width, 0, rule, roadMark_width, roadMark_color);
+                                    lane_roadMarkType->AddLine(std::shared_ptr<LaneRoadMarkTypeLine>{lane_roadMarkTypeLine2});
+                                }
+                                else if (roadMark_type == LaneRoadMark::BROKEN)
+                                {
+                                    lane_roadMarkType = new LaneRoadMarkType("stand-in", roadMark_width);
+                                    lane_roadMark->AddType(std::shared_ptr<LaneRoadMarkType>{lane_roadMarkType});
+                                    LaneRoadMarkTypeLine::RoadMarkTypeLineRule rule = LaneRoadMarkTypeLine::NONE;
+                                    LaneRoadMarkTypeLine*                      lane_roadMarkTypeLine =
+                                        new LaneRoadMarkTypeLine(4, 8, 0, 0, rule, roadMark_width, roadMark_color);
+                                    lane_roadMarkType->AddLine(std::shared_ptr<LaneRoadMarkTypeLine>{lane_roadMarkTypeLine});
+                                }
+                                else if (roadMark_type == LaneRoadMark::BROKEN_BROKEN)
+                                {
+                                    lane_roadMarkType = new LaneRoadMarkType("stand-in", roadMark_width);
+                                    lane_roadMark->AddType(std::shared_ptr<LaneRoadMarkType>{lane_roadMarkType});
+                                    LaneRoadMarkTypeLine::RoadMarkTypeLineRule rule = LaneRoadMarkTypeLine::NONE;
+                                    LaneRoadMarkTypeLine*                      lane_roadMarkTypeLine =
+                                        new LaneRoadMarkTypeLine(4, 8, -roadMark_width, 0, rule, roadMark_width, roadMark_color);
+                                    lane_roadMarkType->AddLine(std::shared_ptr<LaneRoadMarkTypeLine>{lane_roadMarkTypeLine});
+                                    LaneRoadMarkTypeLine* lane_roadMarkTypeLine2 =
+                                        new LaneRoadMarkTypeLine(4, 8, roadMark_width, 0, rule, roadMark_width, roadMark_color);
+                                    lane_roadMarkType->AddLine(std::shared_ptr<LaneRoadMarkTypeLine>{lane_roadMarkTypeLine2});
+                                }
+                                else
+                                {
+                                    LOG("No road mark created for road %d lane %d. Type %d not supported. Either switch type or add a roadMark <type> element.",
+                                        r->GetId(),
+                                        lane_id,
+                                        roadMark_type);
                                 }
                             }
                         }
                     }
-                    // Check lane indices and identify road edge
+                }
+                // Check lane indices and identify road edge
 
-                    int last_road_lane_right_id = 0;
-                    int last_road_lane_left_id  = 0;
+                int last_road_lane_right_id = 0;
+                int last_road_lane_left_id  = 0;
 
-                    int lastLaneId = 0;
-                    for (int i = 0; i < lane_section->GetNumberOfLanes(); i++)
-                    {
-                        Lane* lane = lane_section->GetLaneByIdx(i);
+                int lastLaneId = 0;
+                for (int i = 0; i < lane_section->GetNumberOfLanes(); i++)
+                {
+                    Lane* lane = lane_section->GetLaneByIdx(i);
 
-                        if (i > 0 && lane->GetId() != lastLaneId - 1)
-                        {
-                            LOG("Warning: expected laneId %d missing of roadId %d. Found laneIds %d and %d",
-                                lastLaneId - 1,
-                                r->GetId(),
-                                lastLaneId,
-                                lane->GetId());
-                        }
-                        lastLaneId = lane->GetId();
+                    if (i > 0 && lane->GetId() != lastLaneId - 1)
+                    {
+                        LOG("Warning: expected laneId %d missing of roadId %d. Found laneIds %d and %d",
+                            lastLaneId - 1,
+                            r->GetId(),
+                            lastLaneId,
+                            lane->GetId());
+                    }
+                    lastLaneId = lane->GetId();
 
-                        if (lane->GetLaneType() & roadmanager::Lane::LaneType::LANE_TYPE_ANY_ROAD)
+                    if (lane->GetLaneType() & roadmanager::Lane::LaneType::LANE_TYPE_ANY_ROAD)
+                    {
+                        if (lane->GetId() < 0)
                         {
-                            if (lane->GetId() < 0)
+                            if (lane->GetId() < last_road_lane_right_id)
                             {
-                                if (lane->GetId() < last_road_lane_right_id)
-                                {
-                                    last_road_lane_right_id = lane->GetId();
-                                }
-                            }
-                            else if (lane->GetId() > 0)
-                            {
-                                if (lane->GetId() > last_road_lane_left_id)
-                                {
-                                    last_road_lane_left_id = lane->GetId();
-                                }
+                                last_road_lane_right_id = lane->GetId();
                             }
-                            else
+                        }
+                        else if (lane->GetId() > 0)
+                        {
+                            if (lane->GetId() > last_road_lane_left_id)
                             {
-                                LOG("Unexpected lane id %d", lane->GetId());
+                                last_road_lane_left_id = lane->GetId();
                             }
                         }
+                        else
+                        {
+                            LOG("Unexpected lane id %d", lane->GetId());
+                        }
                     }
+                }
 
-                    if (last_road_lane_right_id < 0)
-                    {
-                        lane_section->GetLaneById(last_road_lane_right_id)->SetRoadEdge(true);
-                    }
-
-                    if (last_road_lane_left_id > 0)
-                    {
-                        lane_section->GetLaneById(last_road_lane_left_id)->SetRoadEdge(true);
-                    }
+                if (last_road_lane_right_id < 0)
+                {
+                    lane_section->GetLaneById(last_road_lane_right_id)->SetRoadEdge(true);
+                }
 
-                    if (last_road_lane_right_id == 0 || last_road_lane_left_id == 0)
-                    {
-                        // at least one side of reference lane is empty, set as road boundary
-                        lane_section->GetLaneById(0)->SetRoadEdge(true);
-                    }
+                if (last_road_lane_left_id > 0)
+                {
+                    lane_section->GetLaneById(last_road_lane_left_id)->SetRoadEdge(true);
                 }
-                else
+
+                if (last_road_lane_right_id == 0 || last_road_lane_left_id == 0)
                 {
-                    LOG("Unsupported lane type: %s", child->name());
+                    // at least one side of reference lane is empty, set as road boundary
+                    lane_section->GetLaneById(0)->SetRoadEdge(true);
                 }
             }
+            else
+            {
+                LOG("Unsupported lane type: %s", child->name());
+            }
         }
+    }
+
+    if (r->GetNumberOfLaneSections() == 0)
+    {
+        // Add empty center reference lane
+        LaneSection* lane_section = new LaneSection(0.0);
+        lane_section->AddLane(new Lane(0, Lane::LANE_TYPE_NONE));
+        r->AddLaneSection(lane_section);
+    }
+
+    return r;
+}
 
-        road_.push_back(r);
+void OpenDrive::ParseRoadSignalsAndObjects(Road* r, pugi::xml_node road_node)
+{
+    int rid = r->GetId();
 
-        pugi::xml_node signals = road_node.child("signals");
-        if (signals != NULL)
+    pugi::xml_node signals = road_node.child("signals");
+    if (signals != NULL)
+    {
+        // Variables to check if the country file is loaded
+        bool        country_file_loaded = false;
+        std::string current_country     = "";
+        for (pugi::xml_node signal = signals.child("signal"); signal; signal = signal.next_sibling())
         {
-            // Variables to check if the country file is loaded
-            bool        country_file_loaded = false;
-            std::string current_country     = "";
-            for (pugi::xml_node signal = signals.child("signal"); signal; signal = signal.next_sibling())
+            if (!strcmp(signal.name(), "signal"))
             {
-                if (!strcmp(signal.name(), "signal"))
+                double      s    = atof(signal.attribute("s").value());
+                double      t    = atof(signal.attribute("t").value());
+                int         ids  = atoi(signal.attribute("id").value());
+                std::string name = signal.attribute("name").value();
+
+                // dynamic
+                bool dynamic = false;
+                if (!strcmp(signal.attribute("dynamic").value(), ""))
                 {
-                    double      s    = atof(signal.attribute("s").value());
-                    double      t    = atof(signal.attribute("t").value());
-                    int         ids  = atoi(signal.attribute("id").value());
-                    std::string name = signal.attribute("name").value();
-
-                    // dynamic
-                    bool dynamic = false;
-                    if (!strcmp(signal.attribute("dynamic").value(), ""))
-                    {
-                        LOG("Signal dynamic check error");
-                    }
-                    if (!strcmp(signal.attribute("dynamic").value(), "no"))
-                    {
-                        dynamic = false;
-                    }
-                    else if (!strcmp(signal.attribute("dynamic").value(), "yes"))
-                    {
-                        dynamic = true;
-                    }
-                    else
-                    {
-                        LOG("unknown dynamic signal identification: %s (road ids=%d)", signal.attribute("dynamic").value(), r->GetId());
-                    }
+                    LOG("Signal dynamic check error");
+                }
+                if (!strcmp(signal.attribute("dynamic").value(), "no"))
+                {
+                    dynamic = false;
+                }
+                else if (!strcmp(signal.attribute("dynamic").value(), "yes"))
+                {
+                    dynamic = true;
+                }
+                else
+                {
+                    LOG("unknown dynamic signal identification: %s (road ids=%d)", signal.attribute("dynamic").value(), r->GetId());
+                }
+
+                // orientation
+                Signal::Orientation orientation = Signal::NONE;
+                if (signal.attribute("orientation") == 0 || !strcmp(signal.attribute("orientation").value(), ""))
+                {
+                    LOG("Road signal orientation error");
+                }
+                if (!strcmp(signal.attribute("orientation").value(), "none"))
+                {
+                    orientation = Signal::NONE;
+                }
+                else if (!strcmp(signal.attribute("orientation").value(), "+"))
+                {
+                    orientation = Signal::POSITIVE;
+                }
+                else if (!strcmp(signal.attribute("orientation").value(), "-"))
+                {
+                    orientation = Signal::NEGATIVE;
+                }
+                else
+                {
+                    LOG("unknown road signal orientation: %s (road ids=%d)", signal.attribute("orientation").value(), r->GetId());
+                }
 
-                    // orientation
-                    Signal::Orientation orientation = Signal::NONE;
-                    if (signal.attribute("orientation") == 0 || !strcmp(signal.attribute("orientation").value(), ""))
-                    {
-                        LOG("Road signal orientation error");
-                    }
-                    if (!strcmp(signal.attribute("orientation").value(), "none"))
-                    {
-                        orientation = Signal::NONE;
-                    }
-                    else if (!strcmp(signal.attribute("orientation").value(), "+"))
-                    {
-                        orientation = Signal::POSITIVE;
-                    }
-                    else if (!strcmp(signal.attribute("orientation").value(), "-"))
-                    {
-                        orientation = Signal::NEGATIVE;
-                    }
-                    else
-                    {
-                        LOG("unknown road signal orientation: %s (road ids=%d)", signal.attribute("orientation").value(), r->GetId());
-                    }
+                double      z_offset = atof(signal.attribute("zOffset").value());
+                std::string country  = ToLower(signal.attribute("country").value());
 
-                    double      z_offset = atof(signal.attribute("zOffset").value());
-                    std::string country  = ToLower(signal.attribute("country").value());
+                // Type table is shared by roads parsed in parallel
+                std::unique_lock<std::mutex> signals_types_lock(g_signals_types_mutex);
 
-                    // Load the country file for types
-                    if (!country.empty() && (!country_file_loaded || current_country != country))
-                    {
-                        current_country     = country;
-                        country_file_loaded = LoadSignalsByCountry(country);
-                    }
+                // Load the country file for types
+                if (!country.empty() && (!country_file_loaded || current_country != country))
+                {
+                    current_country     = country;
+                    country_file_loaded = LoadSignalsByCountry(country);
+                }
+
+                std::string type;
+                std::string subtype;
+                std::string value;
 
-                    std::string type;
-                    std::string subtype;
-                    std::string value;
+                type         = signal.attribute("type").value();
+                subtype      = signal.attribute("subtype").value();
+                value        = signal.attribute("value").value();
+                int osi_type = static_cast<int>(Signal::OSIType::TYPE_UNKNOWN);
 
-                    type         = signal.attribute("type").value();
-                    subtype      = signal.attribute("subtype").value();
-                    value        = signal.attribute("value").value();
-                    int osi_type = static_cast<int>(Signal::OSIType::TYPE_UNKNOWN);
+                if (!type.empty())
+                {
+                    std::string type_to_find = Signal::GetCombinedTypeSubtypeValueStr(type, subtype, value);
 
-                    if (!type.empty())
+                    if (signals_types_.count(country + type_to_find) != 0)
                     {
-                        std::string type_to_find = Signal::GetCombinedTypeSubtypeValueStr(type, subtype, value);
+                        std::string enum_string = signals_types_.find(country + type_to_find)->second;
+                        osi_type                = static_cast<int>(Signal::GetOSITypeFromString(enum_string));
+                    }
 
-                        if (signals_types_.count(country + type_to_find) != 0)
+                    if (osi_type == static_cast<int>(Signal::OSIType::TYPE_UNKNOWN))
+                    {
+                        // Try without value
+                        if (signals_types_.count(country + type + (subtype.empty() ? "" : "." + subtype)) != 0)
                         {
-                            std::string enum_string = signals_types_.find(country + type_to_find)->second;
+                            std::string enum_string = signals_types_.find(country + type + (subtype.empty() ? "" : "." + subtype))->second;
                             osi_type                = static_cast<int>(Signal::GetOSITypeFromString(enum_string));
                         }
-
                         if (osi_type == static_cast<int>(Signal::OSIType::TYPE_UNKNOWN))
                         {
-                            // Try without value
-                            if (signals_types_.count(country + type + (subtype.empty() ? "" : "." + subtype)) != 0)
-                            {
-                                std::string enum_string = signals_types_.find(country + type + (subtype.empty() ? "" : "." + subtype))->second;
-                                osi_type                = static_cast<int>(Signal::GetOSITypeFromString(enum_string));
-                            }
-                            if (osi_type == static_cast<int>(Signal::OSIType::TYPE_UNKNOWN))
-                            {
-                                LOG("Signal Type %s doesn't exists for country %s", type_to_find.c_str(), country.c_str());
-                            }
+                            LOG("Signal Type %s doesn't exists for country %s", type_to_find.c_str(), country.c_str());
                         }
                     }
+                }
 
-                    std::string unit     = signal.attribute("unit").value();
-                    double      height   = atof(signal.attribute("height").value());
-                    double      width    = atof(signal.attribute("width").value());
-                    std::string text     = signal.attribute("text").value();
-                    double      h_offset = atof(signal.attribute("hOffset").value());
-                    double      pitch    = atof(signal.attribute("pitch").value());
-                    double      roll     = atof(signal.attribute("roll").value());
-
-                    Position pos(rid, s, t);
-
-                    Signal* sig = new Signal(s,
-                                             t,
-                                             ids,
-                                             name,
-                                             dynamic,
-                                             orientation,
-                                             z_offset,
-                                             country,
-                                             osi_type,
-                                             type,
-                                             subtype,
-                                             value,
-                                             unit,
-                                             height,
-                                             width,
-                                             text,
-                                             h_offset,
-                                             pitch,
-                                             roll,
-                                             pos.GetX(),
-                                             pos.GetY(),
-                                             pos.GetZ(),
-                                             pos.GetHRoad() + (orientation == Signal::Orientation::NEGATIVE ? M_PI : 0.0));
-                    if (sig != NULL)
-                    {
-                        r->AddSignal(sig);
-                    }
-                    else
-                    {
-                        LOG("Signal: Major error");
-                    }
+                signals_types_lock.unlock();
 
-                    for (pugi::xml_node validity_node = signal.child("validity"); validity_node;
-                         validity_node                = validity_node.next_sibling("validity"))
-                    {
-                        ValidityRecord validity;
-                        validity.fromLane_ = atoi(validity_node.attribute("fromLane").value());
-                        validity.toLane_   = atoi(validity_node.attribute("toLane").value());
-                        sig->validity_.push_back(validity);
-                    }
+                std::string unit     = signal.attribute("unit").value();
+                double      height   = atof(signal.attribute("height").value());
+                double      width    = atof(signal.attribute("width").value());
+                std::string text     = signal.attribute("text").value();
+                double      h_offset = atof(signal.attribute("hOffset").value());
+                double      pitch    = atof(signal.attribute("pitch").value());
+                double      roll     = atof(signal.attribute("roll").value());
+
+                Position pos(rid, s, t);
+
+                Signal* sig = new Signal(s,
+                                         t,
+                                         ids,
+                                         name,
+                                         dynamic,
+                                         orientation,
+                                         z_offset,
+                                         country,
+                                         osi_type,
+                                         type,
+                                         subtype,
+                                         value,
+                                         unit,
+                                         height,
+                                         width,
+                                         text,
+                                         h_offset,
+                                         pitch,
+                                         roll,
+                                         pos.GetX(),
+                                         pos.GetY(),
+                                         pos.GetZ(),
+                                         pos.GetHRoad() + (orientation == Signal::Orientation::NEGATIVE ? M_PI : 0.0));
+                if (sig != NULL)
+                {
+                    r->AddSignal(sig);
                 }
                 else
                 {
-                    LOG_ONCE("INFO: signal element \"%s\" not supported yet", signal.name());
+                    LOG("Signal: Major error");
+                }
+
+                for (pugi::xml_node validity_node = signal.child("validity"); validity_node;
+                     validity_node                = validity_node.next_sibling("validity"))
+                {
+                    ValidityRecord validity;
+                    validity.fromLane_ = atoi(validity_node.attribute("fromLane").value());
+                    validity.toLane_   = atoi(validity_node.attribute("toLane").value());
+                    sig->validity_.push_back(validity);
                 }
             }
+            else
+            {
+                LOG_ONCE("INFO: signal element \"%s\" not supported yet", signal.name());
+            }
         }
+    }
 
-        pugi::xml_node objects = road_node.child("objects");
-        if (objects != NULL)
+    pugi::xml_node objects = road_node.child("objects");
+    if (objects != NULL)
+    {
+        for (pugi::xml_node object = objects.child("object"); object; object = object.next_sibling("object"))
         {
-            for (pugi::xml_node object = objects.child("object"); object; object = object.next_sibling("object"))
+            // Read any repeat element first, since its s-value overrides the one in the object element
+
+            std::vector<Repeat*> Repeats;
+            for (pugi::xml_node repeat_node = object.child("repeat"); repeat_node; repeat_node = repeat_node.next_sibling("repeat"))
             {
-                // Read any repeat element first, since its s-value overrides the one in the object element
+                std::string rattr;
+                double      rs            = (rattr = ReadAttribute(repeat_node, "s", true)) == "" ? 0.0 : std::stod(rattr);
+                double      rlength       = (rattr = ReadAttribute(repeat_node, "length", true)) == "" ? 0.0 : std::stod(rattr);
+                double      rdistance     = (rattr = ReadAttribute(repeat_node, "distance", true)) == "" ? 0.0 : std::stod(rattr);
+                double      rtStart       = (rattr = ReadAttribute(repeat_node, "tStart", true)) == "" ? 0.0 : std::stod(rattr);
+                double      rtEnd         = (rattr = ReadAttribute(repeat_node, "tEnd", true)) == "" ? 0.0 : std::stod(rattr);
+                double      rheightStart  = (rattr = ReadAttribute(repeat_node, "heightStart", true)) == "" ? 0.0 : std::stod(rattr);
+                double      rheightEnd    = (rattr = ReadAttribute(repeat_node, "heightEnd", true)) == "" ? 0.0 : std::stod(rattr);
+                double      rzOffsetStart = (rattr = ReadAttribute(repeat_node, "zOffsetStart", true)) == "" ? 0.0 : std::stod(rattr);
+                double      rzOffsetEnd   = (rattr = ReadAttribute(repeat_node, "zOffsetEnd", true)) == "" ? 0.0 : std::stod(rattr);
 
-                std::vector<Repeat*> Repeats;
-                for (pugi::xml_node repeat_node = object.child("repeat"); repeat_node; repeat_node = repeat_node.next_sibling("repeat"))
+                double rwidthStart  = (rattr = ReadAttribute(repeat_node, "widthStart", false)) == "" ? 0.0 : std::stod(rattr);
+                double rwidthEnd    = (rattr = ReadAttribute(repeat_node, "widthEnd", false)) == "" ? 0.0 : std::stod(rattr);
+                double rlengthStart = (rattr = ReadAttribute(repeat_node, "lengthStart", false)) == "" ? 0.0 : std::stod(rattr);
+                double rlengthEnd   = (rattr = ReadAttribute(repeat_node, "lengthEnd", false)) == "" ? 0.0 : std::stod(rattr);
+                double rradiusStart = (rattr = ReadAttribute(repeat_node, "radiusStart", false)) == "" ? 0.0 : std::stod(rattr);
+                double rradiusEnd   = (rattr = ReadAttribute(repeat_node, "radiusEnd", false)) == "" ? 0.0 : std::stod(rattr);
+
+                Repeat* repeat = new Repeat(rs, rlength, rdistance, rtStart, rtEnd, rheightStart, rheightEnd, rzOffsetStart, rzOffsetEnd);
+                Repeats.push_back(repeat);
+
+                if (fabs(rwidthStart) > SMALL_NUMBER)
+                    repeat->SetWidthStart(rwidthStart);
+                if (fabs(rwidthEnd) > SMALL_NUMBER)
+                    repeat->SetWidthEnd(rwidthEnd);
+                if (fabs(rlengthStart) > SMALL_NUMBER)
+                    repeat->SetLengthStart(rlengthStart);
+                if (fabs(rlengthEnd) > SMALL_NUMBER)
+                    repeat->SetLengthEnd(rlengthEnd);
+
+                if (fabs(rradiusStart) > SMALL_NUMBER)
+                    printf("Attribute object/repeat/radiusStart not supported yet\n");
+                if (fabs(rradiusEnd) > SMALL_NUMBER)
+                    printf("Attribute object/repeat/radiusEnd not supported yet\n");
+            }
+
+            double s;
+            if (Repeats.size() > 0)
+            {
+                s = Repeats[0]->GetS();
+            }
+            else
+            {
+                s = atof(object.attribute("s").value());
+            }
+            double      t    = atof(object.attribute("t").value());
+            int         ids  = atoi(object.attribute("id").value());
+            std::string name = object.attribute("name").value();
+
+            // orientation
+            RMObject::Orientation orientation = RMObject::Orientation::NONE;
+            if (object.attribute("orientation") != 0 && strcmp(object.attribute("orientation").value(), ""))
+            {
+                if (!strcmp(object.attribute("orientation").value(), "none"))
                 {
-                    std::string rattr;
-                    double      rs            = (rattr = ReadAttribute(repeat_node, "s", true)) == "" ? 0.0 : std::stod(rattr);
-                    double      rlength       = (rattr = ReadAttribute(repeat_node, "length", true)) == "" ? 0.0 : std::stod(rattr);
-                    double      rdistance     = (rattr = ReadAttribute(repeat_node, "distance", true)) == "" ? 0.0 : std::stod(rattr);
-                    double      rtStart       = (rattr = ReadAttribute(repeat_node, "tStart", true)) == "" ? 0.0 : std::stod(rattr);
-                    double      rtEnd         = (rattr = ReadAttribute(repeat_node, "tEnd", true)) == "" ? 0.0 : std::stod(rattr);
-                    double      rheightStart  = (rattr = ReadAttribute(repeat_node, "heightStart", true)) == "" ? 0.0 : std::stod(rattr);
-                    double      rheightEnd    = (rattr = ReadAttribute(repeat_node, "heightEnd", true)) == "" ? 0.0 : std::stod(rattr);
-                    double      rzOffsetStart = (rattr = ReadAttribute(repeat_node, "zOffsetStart", true)) == "" ? 0.0 : std::stod(rattr);
-                    double      rzOffsetEnd   = (rattr = ReadAttribute(repeat_node, "zOffsetEnd", true)) == "" ? 0.0 : std::stod(rattr);
-
-                    double rwidthStart  = (rattr = ReadAttribute(repeat_node, "widthStart", false)) == "" ? 0.0 : std::stod(rattr);
-                    double rwidthEnd    = (rattr = ReadAttribute(repeat_node, "widthEnd", false)) == "" ? 0.0 : std::stod(rattr);
-                    double rlengthStart = (rattr = ReadAttribute(repeat_node, "lengthStart", false)) == "" ? 0.0 : std::stod(rattr);
-                    double rlengthEnd   = (rattr = ReadAttribute(repeat_node, "lengthEnd", false)) == "" ? 0.0 : std::stod(rattr);
-                    double rradiusStart = (rattr = ReadAttribute(repeat_node, "radiusStart", false)) == "" ? 0.0 : std::stod(rattr);
-                    double rradiusEnd   = (rattr = ReadAttribute(repeat_node, "radiusEnd", false)) == "" ? 0.0 : std::stod(rattr);
-
-                    Repeat* repeat = new Repeat(rs, rlength, rdistance, rtStart, rtEnd, rheightStart, rheightEnd, rzOffsetStart, rzOffsetEnd);
-                    Repeats.push_back(repeat);
-
-                    if (fabs(rwidthStart) > SMALL_NUMBER)
-                        repeat->SetWidthStart(rwidthStart);
-                    if (fabs(rwidthEnd) > SMALL_NUMBER)
-                        repeat->SetWidthEnd(rwidthEnd);
-                    if (fabs(rlengthStart) > SMALL_NUMBER)
-                        repeat->SetLengthStart(rlengthStart);
-                    if (fabs(rlengthEnd) > SMALL_NUMBER)
-                        repeat->SetLengthEnd(rlengthEnd);
-
-                    if (fabs(rradiusStart) > SMALL_NUMBER)
-                        printf("Attribute object/repeat/radiusStart not supported yet\n");
-                    if (fabs(rradiusEnd) > SMALL_NUMBER)
-                        printf("Attribute object/repeat/radiusEnd not supported yet\n");
+                    orientation = RMObject::Orientation::NONE;
                 }
-
-                double s;
-                if (Repeats.size() > 0)
+                else if (!strcmp(object.attribute("orientation").value(), "+"))
                 {
-                    s = Repeats[0]->GetS();
+                    orientation = RMObject::Orientation::POSITIVE;
                 }
-                else
+                else if (!strcmp(object.attribute("orientation").value(), "-"))
                 {
-                    s = atof(object.attribute("s").value());
+                    orientation = RMObject::Orientation::NEGATIVE;
                 }
-                double      t    = atof(object.attribute("t").value());
-                int         ids  = atoi(object.attribute("id").value());
-                std::string name = object.attribute("name").value();
-
-                // orientation
-                RMObject::Orientation orientation = RMObject::Orientation::NONE;
-                if (object.attribute("orientation") != 0 && strcmp(object.attribute("orientation").value(), ""))
+                else
                 {
-                    if (!strcmp(object.attribute("orientation").value(), "none"))
-                    {
-                        orientation = RMObject::Orientation::NONE;
-                    }
-                    else if (!strcmp(object.attribute("orientation").value(), "+"))
-                    {
-                        orientation = RMObject::Orientation::POSITIVE;
-                    }
-                    else if (!strcmp(object.attribute("orientation").value(), "-"))
-                    {
-                        orientation = RMObject::Orientation::NEGATIVE;
-                    }
-                    else
-                    {
-                        LOG("unknown road object orientation: %s (road ids=%d)", object.attribute("orientation").value(), r->GetId());
-                    }
+                    LOG("unknown road object orientation: %s (road ids=%d)", object.attribute("orientation").value(), r->GetId());
                 }
-                std::string          type_str = object.attribute("type").value();
-                RMObject::ObjectType type     = RMObject::Str2Type(type_str);
-                double               z_offset = atof(object.attribute("zOffset").value());
-                double               length   = atof(object.attribute("length").value());
-                double               height   = atof(object.attribute("height").value());
-                double               width    = atof(object.attribute("width").value());
-                double               heading  = atof(object.attribute("hdg").value());
-                double               pitch    = atof(object.attribute("pitch").value());
-                double               roll     = atof(object.attribute("roll").value());
-
-                Position pos(rid, s, t);
-
-                RMObject* obj = new RMObject(s,
-                                             t,
-                                             ids,
-                                             name,
-                                             orientation,
-                                             z_offset,
-                                             type,
-                                             length,
-                                             height,
-                                             width,
-                                             heading,
-                                             pitch,
-                                             roll,
-                                             pos.GetX(),
-                                             pos.GetY(),
-                                             pos.GetZ(),
-                                             pos.GetHRoad());
-
-                if (Repeats.size() > 0)
+            }
+            std::string          type_str = object.attribute("type").value();
+            RMObject::ObjectType type     = RMObject::Str2Type(type_str);
+            double               z_offset = atof(object.attribute("zOffset").value());
+            double               length   = atof(object.attribute("length").value());
+            double               height   = atof(object.attribute("height").value());
+            double               width    = atof(object.attribute("width").value());
+            double               heading  = atof(object.attribute("hdg").value());
+            double               pitch    = atof(object.attribute("pitch").value());
+            double               roll     = atof(object.attribute("roll").value());
+
+            Position pos(rid, s, t);
+
+            RMObject* obj = new RMObject(s,
+                                         t,
+                                         ids,
+                                         name,
+                                         orientation,
+                                         z_offset,
+                                         type,
+                                         length,
+                                         height,
+                                         width,
+                                         heading,
+                                         pitch,
+                                         roll,
+                                         pos.GetX(),
+                                         pos.GetY(),
+                                         pos.GetZ(),
+                                         pos.GetHRoad());
+
+            if (Repeats.size() > 0)
+            {
+                for (Repeat* rp : Repeats)
                 {
-                    for (Repeat* rp : Repeats)
-                    {
-                        obj->AddRepeat(rp);
-                    }
-                    obj->SetRepeat(Repeats[0]);
+                    obj->AddRepeat(rp);
                 }
+                obj->SetRepeat(Repeats[0]);
+            }
 
-                pugi::xml_node outlines_node = object.child("outlines");
-                if (outlines_node != NULL)
+            pugi::xml_node outlines_node = object.child("outlines");
+            if (outlines_node != NULL)
+            {
+                for (pugi::xml_node outline_node = outlines_node.child("outline"); outline_node; outline_node = outline_node.next_sibling())
                 {
-                    for (pugi::xml_node outline_node = outlines_node.child("outline"); outline_node; outline_node = outline_node.next_sibling())
+                    int      id      = atoi(outline_node.attribute("id").value());
+                    bool     closed  = !strcmp(outline_node.attribute("closed").value(), "true") ? true : false;
+                    Outline* outline = new Outline(id, Outline::FillType::FILL_TYPE_UNDEFINED, closed);
+
+                    for (pugi::xml_node corner_node = outline_node.first_child(); corner_node; corner_node = corner_node.next_sibling())
                     {
-                        int      id      = atoi(outline_node.attribute("id").value());
-                        bool     closed  = !strcmp(outline_node.attribute("closed").value(), "true") ? true : false;
-                        Outline* outline = new Outline(id, Outline::FillType::FILL_TYPE_UNDEFINED, closed);
+                        OutlineCorner* corner = 0;
 
-                        for (pugi::xml_node corner_node = outline_node.first_child(); corner_node; corner_node = corner_node.next_sibling())
+                        if (!strcmp(corner_node.name(), "cornerRoad"))
                         {
-                            OutlineCorner* corner = 0;
-
-                            if (!strcmp(corner_node.name(), "cornerRoad"))
-                            {
-                                double sc      = atof(corner_node.attribute("s").value());
-                                double tc      = atof(corner_node.attribute("t").value());
-                                double dz      = atof(corner_node.attribute("dz").value());
-                                double heightc = atof(corner_node.attribute("height").value());
+                            double sc      = atof(corner_node.attribute("s").value());
+                            double tc      = atof(corner_node.attribute("t").value());
+                            double dz      = atof(corner_node.attribute("dz").value());
+                            double heightc = atof(corner_node.attribute("height").value());
 
-                                corner = (OutlineCorner*)(new OutlineCornerRoad(r->GetId(), sc, tc, dz, heightc, s, t, heading));
-                            }
-                            else if (!strcmp(corner_node.name(), "cornerLocal"))
-                            {
-                                double u       = atof(corner_node.attribute("u").value());
-                                double v       = atof(corner_node.attribute("v").value());
-                                double zLocal  = atof(corner_node.attribute("z").value());
-                                double heightc = atof(corner_node.attribute("height").value());
+                            corner = (OutlineCorner*)(new OutlineCornerRoad(r->GetId(), sc, tc, dz, heightc, s, t, heading));
+                        }
+                        else if (!strcmp(corner_node.name(), "cornerLocal"))
+                        {
+                            double u       = atof(corner_node.attribute("u").value());
+                            double v       = atof(corner_node.attribute("v").value());
+                            double zLocal  = atof(corner_node.attribute("z").value());
+                            double heightc = atof(corner_node.attribute("height").value());
 
-                                corner =
-                                    (OutlineCorner*)(new OutlineCornerLocal(r->GetId(), obj->GetS(), obj->GetT(), u, v, zLocal, heightc, heading));
-                            }
-                            outline->AddCorner(corner);
+                            corner =
+                                (OutlineCorner*)(new OutlineCornerLocal(r->GetId(), obj->GetS(), obj->GetT(), u, v, zLocal, heightc, heading));
                         }
-                        obj->AddOutline(outline);
+                        outline->AddCorner(corner);
                     }
+                    obj->AddOutline(outline);
                 }
+            }
 
-                for (pugi::xml_node validity_node = object.child("validity"); validity_node; validity_node = validity_node.next_sibling("validity"))
-                {
-                    ValidityRecord validity;
-                    validity.fromLane_ = atoi(validity_node.attribute("fromLane").value());
-                    validity.toLane_   = atoi(validity_node.attribute("toLane").value());
-                    obj->validity_.push_back(validity);
-                }
+            for (pugi::xml_node validity_node = object.child("validity"); validity_node; validity_node = validity_node.next_sibling("validity"))
+            {
+                ValidityRecord validity;
+                validity.fromLane_ = atoi(validity_node.attribute("fromLane").value());
+                validity.toLane_   = atoi(validity_node.attribute("toLane").value());
+                obj->validity_.push_back(validity);
+            }
 
-                if (obj != NULL)
-                {
-                    r->AddObject(obj);
-                }
-                else
-                {
-                    LOG("RMObject: Major error");
-                }
+            if (obj != NULL)
+            {
+                r->AddObject(obj);
             }
+            else
+            {
+                LOG("RMObject: Major error");
+            }
+        }
+    }
+}
+
+bool OpenDrive::LoadOpenDriveFile(const char* filename, bool replace)
+{
+    auto load_start  = std::chrono::steady_clock::now();
+    auto stage_start = load_start;
+    auto stage_time  = [&stage_start]()
+    {
+        auto   now      = std::chrono::steady_clock::now();
+        double duration = std::chrono::duration<double>(now - stage_start).count();
+        stage_start     = now;
+        return duration;
+    };
+
+    load_profile_ = {};
+
+    if (replace)
+    {
+        Clear();
+    }
+
+    odr_filename_ = filename;
+
+    if (odr_filename_ == "")
+    {
+        return false;
+    }
+
+    pugi::xml_document doc;
+
+    // First assume absolute path
+    pugi::xml_parse_result result = doc.load_file(filename);
+    if (!result)
+    {
+        LOG("%s at offset (character position): %d", result.description(), result.offset);
+        return false;
+    }
+
+    pugi::xml_node node = doc.child("OpenDRIVE");
+    if (node == NULL)
+    {
+        LOG("Invalid OpenDRIVE file, can't find OpenDRIVE element");
+        return false;
+    }
+    load_profile_.xml_parse = stage_time();
+
+    // Initialize GeoRef structure
+    geo_ref_ = {std::numeric_limits<double>::quiet_NaN(),
+                "",
+                std::numeric_limits<double>::quiet_NaN(),
+                "",
+                std::numeric_limits<double>::quiet_NaN(),
+                std::numeric_limits<double>::quiet_NaN(),
+                std::numeric_limits<double>::quiet_NaN(),
+                std::numeric_limits<double>::quiet_NaN(),
+                std::numeric_limits<double>::quiet_NaN(),
+                std::numeric_limits<double>::quiet_NaN(),
+                "",
+                "",
+                "",
+                "",
+                std::numeric_limits<double>::quiet_NaN(),
+                std::numeric_limits<double>::quiet_NaN(),
+                "",
+                "",
+                std::numeric_limits<double>::quiet_NaN(),
+                std::numeric_limits<int>::quiet_NaN()};
+
+    pugi::xml_node header_node = node.child("header");
+    if (node != NULL)
+    {
+        versionMajor_ = strtoi(header_node.attribute("revMajor").value());
+        versionMinor_ = strtoi(header_node.attribute("revMinor").value());
+
+        if (header_node.child("geoReference") != NULL)
+        {
+            // Get the string to parse, geoReference tag is just a string with the data separated by spaces and each attribute start with a +
+            // character
+            std::string geo_ref_str = header_node.child_value("geoReference");
+            ParseGeoLocalization(geo_ref_str);
+        }
+    }
+
+    // Roads are independent while being parsed. Parse them in parallel into preallocated slots, then add them
+    // in file order. Signals and objects are parsed in a second parallel pass, since positioned on the roads.
+    std::vector<pugi::xml_node> road_nodes;
+    for (pugi::xml_node road_node = node.child("road"); road_node; road_node = road_node.next_sibling("road"))
+    {
+        road_nodes.push_back(road_node);
+    }
+
+    int                   n_roads        = static_cast<int>(road_nodes.size());
+    int                   first_road_idx = static_cast<int>(road_.size());
+    std::vector<RoadSlot> road_slots(road_nodes.size());
+    load_profile_.n_threads = GetNumberOfLoadThreads(n_roads);
+
+    RunParallel(n_roads,
+                load_profile_.n_threads,
+                [&](int i)
+                {
+                    DeferGlobalIds defer_ids(&road_slots[i].global_ids);
+                    road_slots[i].speed_unit = SpeedUnit::UNDEFINED;
+                    road_slots[i].road       = ParseRoad(road_nodes[i], first_road_idx + i, road_slots[i].speed_unit);
+                });
+    load_profile_.road_parse = stage_time();
+
+    if (std::any_of(road_slots.begin(), road_slots.end(), [](const RoadSlot& slot) { return slot.road == nullptr; }))
+    {
+        // Nothing registered yet, just free the successfully parsed roads
+        for (RoadSlot& slot : road_slots)
+        {
+            delete slot.road;
         }
+        return false;
+    }
 
-        if (r->GetNumberOfLaneSections() == 0)
+    for (RoadSlot& slot : road_slots)
+    {
+        AssignDeferredGlobalIds(slot.global_ids);
+        if (Position::GetOpenDrive()->GetSpeedUnit() == SpeedUnit::UNDEFINED)
         {
-            // Add empty center reference lane
-            LaneSection* lane_section = new LaneSection(0.0);
-            lane_section->AddLane(new Lane(0, Lane::LANE_TYPE_NONE));
-            r->AddLaneSection(lane_section);
+            Position::GetOpenDrive()->SetSpeedUnit(slot.speed_unit);
         }
+        road_.push_back(slot.road);
     }
+    load_profile_.road_registration = stage_time();
+
+    RunParallel(n_roads, load_profile_.n_threads, [&](int i) { ParseRoadSignalsAndObjects(road_slots[i].road, road_nodes[i]); });
+    load_profile_.road_features = stage_time();
 
     for (pugi::xml_node controller_node = node.child("controller"); controller_node; controller_node = controller_node.next_sibling("controller"))
     {
@@ -4367,17 +4670,41 @@ bool OpenDrive::LoadOpenDriveFile(const char* filename, bool replace)
 
         junction_.push_back(j);
     }
+    load_profile_.junction_parse = stage_time();
 
+    // Link resolution adds missing connections, hence sequential
     CheckConnections();
+    BuildConnectivityTables();
+    load_profile_.link_resolution = stage_time();
 
     if (!SetRoadOSI())
     {
         LOG("Failed to create OSI points for OpenDrive road!");
     }
+    load_profile_.validation = stage_time();
+    load_profile_.total      = std::chrono::duration<double>(stage_start - load_start).count();
+
+    if (SE_Env::Inst().GetProfileLoad())
+    {
+        PrintLoadProfile();
+    }
 
     return true;
 }
 
+void OpenDrive::PrintLoadProfile() const
+{
+    LOG("OpenDRIVE load profile (%d roads, %d threads):", GetNumOfRoads(), load_profile_.n_threads);
+    LOG("  xml parse:         %8.2f ms", 1E3 * load_profile_.xml_parse);
+    LOG("  road parse:        %8.2f ms", 1E3 * load_profile_.road_parse);
+    LOG("  road registration: %8.2f ms", 1E3 * load_profile_.road_registration);
+    LOG("  signals, objects:  %8.2f ms", 1E3 * load_profile_.road_features);
+    LOG("  junction parse:    %8.2f ms", 1E3 * load_profile_.junction_parse);
+    LOG("  link resolution:   %8.2f ms", 1E3 * load_profile_.link_resolution);
+    LOG("  validation (OSI):  %8.2f ms", 1E3 * load_profile_.validation);
+    LOG("  total:             %8.2f ms", 1E3 * load_profile_.total);
+}
+
 void RMObject::SetRepeat(Repeat* repeat)
 {
     repeat_ = repeat;
@@ -4518,7 +4845,7 @@ LaneRoadLaneConnection Junction::GetRoadConnectionByIdx(int roadId, int laneId,
 }
 void Junction::SetGlobalId()
 {
-    global_id_ = GetNewGlobalLaneId();
+    SetNewGlobalId(global_id_, false);
 }
 
 bool Junction::IsOsiIntersection() const
@@ -5081,146 +5408,172 @@ int OpenDrive::GetTrackIdByIdx(int idx) const
 bool OpenDrive::IsIndirectlyConnected(int road1_id, int road2_id, int*& connecting_road_id, int*& connecting_lane_id, int lane1_id, int lane2_id)
     const
 {
-    Road*     road1 = GetRoadById(road1_id);
-    Road*     road2 = GetRoadById(road2_id);
-    RoadLink* link  = 0;
-
-    LinkType link_type[2] = {SUCCESSOR, PREDECESSOR};
+    auto it = indirect_links_.find(RoadPairKey(road1_id, road2_id));
 
-    // Try both ends
-    for (int k = 0; k < 2; k++)
+    if (it != indirect_links_.end())
     {
-        link = road1->GetLink(link_type[k]);
-        if (link == 0)
+        // Entries are ordered as the links are visited, successor first
+        const std::vector<IndirectLink>& links = it->second;
+        for (size_t i = 0; i < links.size(); i++)
         {
-            continue;
-        }
-
-        LaneSection* lane_section = 0;
+            const IndirectLink& link = links[i];
 
-        if (link->GetElementType() == RoadLink::ELEMENT_TYPE_ROAD)
-        {
-            if (link->GetElementId() == road2->GetId())
+            if (link.type == INDIRECT_ROAD_LINK)
             {
-                if (lane1_id != 0 && lane2_id != 0)
+                if (lane1_id == 0 || lane2_id == 0)
                 {
-                    // Check lane connected
-                    if (link_type[k] == SUCCESSOR)
-                    {
-                        lane_section = road1->GetLaneSectionByIdx(road1->GetNumberOfLaneSections() - 1);
-                    }
-                    else if (link_type[k] == PREDECESSOR)
-                    {
-                        lane_section = road1->GetLaneSectionByIdx(0);
-                    }
-                    else
+                    return true;
+                }
+
+                // Check lane connected, decisive since roads are directly linked
+                for (size_t j = i + 1; j < links.size() && links[j].type == INDIRECT_ROAD_LANE; j++)
+                {
+                    if (links[j].lane1_id == lane1_id)
                     {
-                        LOG("Error LinkType %d not suppoered", link_type[k]);
-                        return false;
+                        return links[j].lane2_id == lane2_id;
                     }
-                    if (lane_section == 0)
+                }
+                return false;
+            }
+            else if (link.type == INDIRECT_CONNECTION_LANE)
+            {
+                if (link.lane1_id == lane1_id && link.lane2_id == lane2_id)
+                {
+                    return true;
+                }
+            }
+            else if (link.type == INDIRECT_CONNECTING_ROAD)
+            {
+                if (link.lane1_id == lane1_id && link.lane2_id == lane2_id)
+                {
+                    // Found link
+                    if (connecting_road_id != 0)
                     {
-                        LOG("Error lane section == 0");
-                        return false;
+                        *connecting_road_id = link.connecting_road_id;
                     }
-                    Lane* lane = lane_section->GetLaneById(lane1_id);
-                    (void)lane;
-                    if (!(lane_section->GetConnectingLaneId(lane1_id, link_type[k]) == lane2_id))
+                    if (connecting_lane_id != 0)
                     {
-                        return false;
+                        *connecting_lane_id = link.connecting_lane_id;
                     }
-                    // Now, check other end lane connectivitiy
+                    return true;
                 }
-                return true;
             }
         }
-        // check whether the roads are connected via a junction connecting road and specified lane
-        else if (link->GetElementType() == RoadLink::ELEMENT_TYPE_JUNCTION)
+    }
+
+    LOG("Link not found");
+
+    return false;
+}
+
+const std::vector<OpenDrive::DirectLink>* OpenDrive::GetDirectLinks(int road1_id, int road2_id, LinkType link_type) const
+{
+    const std::unordered_map<unsigned long long, std::vector<DirectLink>>& links = direct_links_[link_type == LinkType::SUCCESSOR ? 0 : 1];
+
+    auto it = links.find(RoadPairKey(road1_id, road2_id));
+
+    return it != links.end() ? &it->second : nullptr;
+}
+
+void OpenDrive::BuildConnectivityTables()
+{
+    LinkType link_type[2] = {SUCCESSOR, PREDECESSOR};
+
+    direct_links_[0].clear();
+    direct_links_[1].clear();
+    indirect_links_.clear();
+
+    for (size_t r = 0; r < road_.size(); r++)
+    {
+        Road* road1 = road_[r];
+
+        // Successor first, the order of links is significant for queries
+        for (int k = 0; k < 2; k++)
         {
-            Junction* junction = GetJunctionById(link->GetElementId());
+            RoadLink* link = road1->GetLink(link_type[k]);
+            if (link == nullptr)
+            {
+                continue;
+            }
 
-            for (int i = 0; i < junction->GetNumberOfConnections(); i++)
+            if (link->GetElementType() == RoadLink::ELEMENT_TYPE_ROAD)
             {
-                Connection* connection = junction->GetConnectionByIdx(i);
+                direct_links_[k][RoadPairKey(road1->GetId(), link->GetElementId())].push_back({link->GetContactPointType(), true, {}});
 
-                if (connection->GetIncomingRoad()->GetId() == road1_id)
+                std::vector<IndirectLink>& indirect = indirect_links_[RoadPairKey(road1->GetId(), link->GetElementId())];
+                LaneSection* lane_section = road1->GetLaneSectionByIdx(link_type[k] == SUCCESSOR ? road1->GetNumberOfLaneSections() - 1 : 0);
+                indirect.push_back({INDIRECT_ROAD_LINK, 0, 0, -1, -1});
+                for (int j = 0; lane_section != nullptr && j < lane_section->GetNumberOfLanes(); j++)
                 {
-                    Road*     connecting_road = connection->GetConnectingRoad();
-                    RoadLink* exit_link       = 0;
-
-                    // Found a connecting road - first check if this is the second road
-                    if (connecting_road->GetId() == road2_id)
+                    int lane_id = lane_section->GetLaneByIdx(j)->GetId();
+                    if (lane_id != 0)
                     {
-                        // Check lanes
-                        for (int j = 0; j < connection->GetNumberOfLaneLinks(); j++)
-                        {
-                            if (connection->GetLaneLink(j)->from_ == lane1_id && connection->GetLaneLink(j)->to_ == lane2_id)
-                            {
-                                return true;
-                            }
-                        }
+                        indirect.push_back({INDIRECT_ROAD_LANE, lane_id, lane_section->GetConnectingLaneId(lane_id, link_type[k]), -1, -1});
+                    }
+                }
+            }
+            else if (link->GetElementType() == RoadLink::ELEMENT_TYPE_JUNCTION)
+            {
+                Junction* junction = GetJunctionById(link->GetElementId());
+
+                for (int i = 0; junction != nullptr && i < junction->GetNumberOfConnections(); i++)
+                {
+                    Connection* connection = junction->GetConnectionByIdx(i);
+                    if (connection->GetIncomingRoad() != road1)
+                    {
+                        continue;
                     }
 
-                    // Then check if it connects to second road
-                    if (connection->GetContactPoint() == ContactPointType::CONTACT_POINT_START)
+                    Road*      connecting_road = connection->GetConnectingRoad();
+                    DirectLink direct          = {connection->GetContactPoint(), false, {}};
+                    for (int j = 0; j < connection->GetNumberOfLaneLinks(); j++)
                     {
-                        exit_link = connecting_road->GetLink(SUCCESSOR);
+                        direct.from_lanes.push_back(connection->GetLaneLink(j)->from_);
+                        indirect_links_[RoadPairKey(road1->GetId(), connecting_road->GetId())].push_back(
+                            {INDIRECT_CONNECTION_LANE, connection->GetLaneLink(j)->from_, connection->GetLaneLink(j)->to_, -1, -1});
                     }
-                    else
+                    direct_links_[k][RoadPairKey(road1->GetId(), connecting_road->GetId())].push_back(direct);
+
+                    // Then lanes connected through the connecting road to the road at its other end
+                    RoadLink* exit_link =
+                        connecting_road->GetLink(connection->GetContactPoint() == ContactPointType::CONTACT_POINT_START ? SUCCESSOR : PREDECESSOR);
+                    LaneSection* lane_section = connecting_road->GetLaneSectionByIdx(0);  // Assume connecting road has only one lane section
+                    if (exit_link == nullptr || lane_section == nullptr)
                     {
-                        exit_link = connecting_road->GetLink(PREDECESSOR);
+                        continue;
                     }
 
-                    if (exit_link->GetElementId() == road2_id)
+                    for (int j = 0; j < lane_section->GetNumberOfLanes(); j++)
                     {
-                        // Finally check that lanes are connected through the junction
-                        // Look at lane section and locate lane connecting both roads
-                        // Assume connecting road has only one lane section
-                        lane_section = connecting_road->GetLaneSectionByIdx(0);
-                        if (lane_section == 0)
+                        Lane*     lane                  = lane_section->GetLaneByIdx(j);
+                        LaneLink* lane_link_predecessor = lane->GetLink(PREDECESSOR);
+                        LaneLink* lane_link_successor   = lane->GetLink(SUCCESSOR);
+                        if (lane_link_predecessor == nullptr || lane_link_successor == nullptr)
                         {
-                            LOG("Error lane section == 0");
-                            return false;
+                            continue;
                         }
-                        for (int j = 0; j < lane_section->GetNumberOfLanes(); j++)
+
+                        IndirectLink indirect = {INDIRECT_CONNECTING_ROAD, 0, 0, connecting_road->GetId(), lane->GetId()};
+                        if (connection->GetContactPoint() == ContactPointType::CONTACT_POINT_START)
                         {
-                            Lane*     lane                  = lane_section->GetLaneByIdx(j);
-                            LaneLink* lane_link_predecessor = lane->GetLink(PREDECESSOR);
-                            LaneLink* lane_link_successor   = lane->GetLink(SUCCESSOR);
-                            if (lane_link_predecessor == 0 || lane_link_successor == 0)
-                            {
-                                continue;
-                            }
-                            if ((connection->GetContactPoint() == ContactPointType::CONTACT_POINT_START &&
-                                 lane_link_predecessor->GetId() == lane1_id && lane_link_successor->GetId() == lane2_id) ||
-                                (connection->GetContactPoint() == ContactPointType::CONTACT_POINT_END && lane_link_predecessor->GetId() == lane2_id &&
-                                 lane_link_successor->GetId() == lane1_id))
-                            {
-                                // Found link
-                                if (connecting_road_id != 0)
-                                {
-                                    *connecting_road_id = connection->GetConnectingRoad()->GetId();
-                                }
-                                if (connecting_lane_id != 0)
-                                {
-                                    *connecting_lane_id = lane->GetId();
-                                }
-                                return true;
-                            }
+                            indirect.lane1_id = lane_link_predecessor->GetId();
+                            indirect.lane2_id = lane_link_successor->GetId();
+                        }
+                        else if (connection->GetContactPoint() == ContactPointType::CONTACT_POINT_END)
+                        {
+                            indirect.lane1_id = lane_link_successor->GetId();
+                            indirect.lane2_id = lane_link_predecessor->GetId();
+                        }
+                        else
+                        {
+                            continue;
                         }
+                        indirect_links_[RoadPairKey(road1->GetId(), exit_link->GetElementId())].push_back(indirect);
                     }
                 }
             }
         }
-        else
-        {
-            LOG("Error: LinkElementType %d unsupported", link->GetElementType());
-        }
     }
-
-    LOG("Link not found");
-
-    return false;
 }
 
 int OpenDrive::CheckConnectedRoad(Road* road, RoadLink* link, ContactPointType expected_contact_point_type, RoadLink* link2)
@@ -5655,59 +6008,44 @@ bool OpenDrive::LoadSignalsByCountry(const std::string& country)
             CombineDirectoryPathAndFilepath(SE_Env::Inst().GetPaths()[i], "/../resources/traffic_signals/" + sign_filename));
     }
 
-    size_t i;
-    bool   located = false;
-    for (i = 0; i < file_name_candidates.size(); i++)
+    std::string path = SE_Env::Inst().LocateFile(file_name_candidates);
+    if (path.empty())
     {
-        if (FileExists(file_name_candidates[i].c_str()))
+        LOG("Failed to locate %s file. Tried:", sign_filename.c_str());
+        for (int j = 0; j < file_name_candidates.size(); j++)
         {
-            located = true;
-            std::string line;
-            // assuming the file is text
-            std::ifstream fs;
-            fs.open(file_name_candidates[i].c_str());
+            LOG("  %s", file_name_candidates[j].c_str());
+        }
+        return false;
+    }
 
-            if (fs.fail())
-            {
-                LOG("Signal: Error to load traffic signals file - %s", file_name_candidates[i].c_str());
-                if (i < file_name_candidates.size() - 1)
-                {
-                    LOG("  -> trying: %s", file_name_candidates[i + 1].c_str());
-                }
-            }
-            else
-            {
-                const char delimiter = '=';
+    // assuming the file is text
+    std::ifstream fs;
+    fs.open(path.c_str());
 
-                // process each line in turn
-                while (std::getline(fs, line))
-                {
-                    std::stringstream sstream(country + line);
-                    std::string       key   = "";
-                    std::string       value = "";
+    if (fs.fail())
+    {
+        LOG("Signal: Error to load traffic signals file - %s", path.c_str());
+        return false;
+    }
 
-                    std::getline(sstream, key, delimiter);
-                    std::getline(sstream, value, delimiter);
+    const char  delimiter = '=';
+    std::string line;
 
-                    signals_types_.emplace(key, value);
-                }
+    // process each line in turn
+    while (std::getline(fs, line))
+    {
+        std::stringstream sstream(country + line);
+        std::string       key   = "";
+        std::string       value = "";
 
-                fs.close();
+        std::getline(sstream, key, delimiter);
+        std::getline(sstream, value, delimiter);
 
-                break;
-            }
-        }
+        signals_types_.emplace(key, value);
     }
 
-    if (i == file_name_candidates.size())
-    {
-        LOG("Failed to load %s file. Tried:", sign_filename.c_str());
-        for (int j = 0; j < file_name_candidates.size(); j++)
-        {
-            LOG("  %s", file_name_candidates[j].c_str());
-        }
-        return false;
-    }
+    fs.close();
 
     return true;
 }
@@ -5761,6 +6099,8 @@ void Position::Init()
     snapToLaneTypes_        = Lane::LaneType::LANE_TYPE_ANY_DRIVING;
     status_                 = 0;
     lockOnLane_             = false;
+    defer_world_pos_        = false;
+    world_pos_stale_        = false;
 
     z_road_              = 0.0;
     track_idx_           = -1;
@@ -5820,6 +6160,7 @@ bool Position::LoadOpenDrive(const char* filename)
 
 bool Position::LoadOpenDrive(OpenDrive* odr)
 {
+    g_road_network_generation++;
     *GetOpenDrive() = *odr;
     return (GetOpenDrive() != nullptr);
 }
@@ -5894,61 +6235,214 @@ bool OpenDrive::CheckLaneOSIRequirement(std::vector<double> x0, std::vector<doub
     }
 }
 
-static double
-GetMaxSegmentLen(Position* pivot, Position* pos, double min, double max, double pitchResScale, double rollResScale, bool& osi_requirement)
+// Error bounded tessellation of curves along a road, e.g. lane centers, lane borders and road mark lines.
+// Initial samples are derived once per road from its definition and shared by all curves along it,
+// then each curve is refined by recursive bisection until within tolerance.
+class RoadTessellation
 {
-    double max_segment_length;
+public:
+    typedef std::function<void(double s, PointStruct& p)> Evaluator;
+
+    RoadTessellation(Road* road, double max_deviation, double max_segment_length)
+        : max_deviation_(MAX(SMALL_NUMBER, max_deviation)),
+          max_segment_length_(MAX(2 * OSI_POINT_MIN_SEGMENT_LENGTH, max_segment_length))
+    {
+        std::vector<double> breakpoints = {0.0, road->GetLength()};
 
-    // Consider rate of change of pitch and roll for segment length to influence
-    // the tesselation (triangulation) of road surface model
+        // Split at any change of road definition, so that each interval is described by one set of polynomials
+        for (int i = 0; i < road->GetNumberOfGeometries(); i++)
+        {
+            breakpoints.push_back(road->GetGeometry(i)->GetS());
+        }
+        for (int i = 0; i < road->GetNumberOfElevations(); i++)
+        {
+            breakpoints.push_back(road->GetElevation(i)->GetS());
+        }
+        for (int i = 0; i < road->GetNumberOfSuperElevations(); i++)
+        {
+            breakpoints.push_back(road->GetSuperElevation(i)->GetS());
+        }
+        for (int i = 0; i < road->GetNumberOfLaneOffsets(); i++)
+        {
+            breakpoints.push_back(road->GetLaneOffsetByIdx(i)->GetS());
+        }
+        for (int i = 0; i < road->GetNumberOfLaneSections(); i++)
+        {
+            LaneSection* lsec = road->GetLaneSectionByIdx(i);
+            breakpoints.push_back(lsec->GetS());
+            for (int j = 0; j < lsec->GetNumberOfLanes(); j++)
+            {
+                Lane* lane = lsec->GetLaneByIdx(j);
+                for (int k = 0; k < lane->GetNumberOfLaneWidths(); k++)
+                {
+                    breakpoints.push_back(lsec->GetS() + lane->GetWidthByIndex(k)->GetSOffset());
+                }
+            }
+        }
+        std::sort(breakpoints.begin(), breakpoints.end());
+        breakpoints.erase(std::unique(breakpoints.begin(),
+                                      breakpoints.end(),
+                                      [](double a, double b) { return b - a < OSI_POINT_MIN_SEGMENT_LENGTH; }),
+                          breakpoints.end());
+        breakpoints.back() = MAX(breakpoints.back(), road->GetLength());
+        breakpoints_       = breakpoints;
 
-    double zRoadPrimPrim                 = pos->GetZRoadPrimPrim();
-    double roadSuperElevationPrim        = pos->GetRoadSuperElevationPrim();
-    double max_segment_length_candidate1 = pitchResScale / MAX(SMALL_NUMBER, abs(zRoadPrimPrim));
-    double max_segment_length_candidate2 = rollResScale / MAX(SMALL_NUMBER, abs(roadSuperElevationPrim));
+        // Subdivide each interval evenly based on curvature. A chord over an arc of curvature k and length L
+        // deviates k * L^2 / 8 from the arc, hence intervals of sqrt(8 * max_deviation / k) are within tolerance.
+        int geometry_idx  = 0;
+        int elevation_idx = -1;
+        for (size_t i = 0; i + 1 < breakpoints.size(); i++)
+        {
+            double s0            = breakpoints[i];
+            double s1            = breakpoints[i + 1];
+            double max_curvature = 0.0;
+            double z, z_prim, z_prim_prim, pitch;
 
-    max_segment_length = MIN(max_segment_length_candidate1, max_segment_length_candidate2);
+            while (geometry_idx < road->GetNumberOfGeometries() - 1 && road->GetGeometry(geometry_idx + 1)->GetS() < s0 + SMALL_NUMBER)
+            {
+                geometry_idx++;
+            }
+            Geometry* geometry = road->GetNumberOfGeometries() > 0 ? road->GetGeometry(geometry_idx) : nullptr;
 
-    // Adjust for slope
-    max_segment_length = max_segment_length / sqrt(pow(pos->GetZRoadPrim(), 2) + 1);
+            // Sample curvature inside the interval, since next polynomial starts at s1
+            for (double s : {s0, 0.5 * (s0 + s1), s1 - OSI_POINT_DISCONTINUITY_DS})
+            {
+                if (geometry != nullptr)
+                {
+                    double ds     = CLAMP(s - geometry->GetS(), 0.0, geometry->GetLength());
+                    max_curvature = MAX(max_curvature, fabs(geometry->EvaluateCurvatureDS(ds)));
+                }
+                if (road->GetZAndPitchByS(s, &z, &z_prim, &z_prim_prim, &pitch, &elevation_idx))
+                {
+                    max_curvature = MAX(max_curvature, fabs(z_prim_prim));
+                }
+            }
 
-    max_segment_length = MAX(min, MIN(max, max_segment_length));
+            double spacing = max_segment_length_;
+            if (max_curvature > SMALL_NUMBER)
+            {
+                spacing = MIN(spacing, sqrt(8 * max_deviation_ / max_curvature));
+            }
+            int n = MAX(1, static_cast<int>(ceil((s1 - s0) / spacing - SMALL_NUMBER)));
+            for (int j = 0; j < n; j++)
+            {
+                samples_.push_back(s0 + j * (s1 - s0) / n);
+            }
+        }
+        samples_.push_back(breakpoints.back());
+    }
 
-    if (pivot)
+    /**
+            Tessellate curve from s_start to s_end into points, making sure that
+              - no segment is longer than max_segment_length (along s)
+              - the curve deviates at most max_deviation from each segment, laterally and vertically,
+                checked at quarter, half and three quarters of the segment
+            Discontinuities, e.g. steps in lane width or elevation, can only occur at road breakpoints. They are
+            represented by two points, just before and at the breakpoint.
+            @param s_start Start of curve along the road reference line
+            @param s_end End of curve along the road reference line
+            @param evaluate Function returning the curve point at given s
+            @param points Resulting points, appended to the list
+    */
+    void Tessellate(double s_start, double s_end, const Evaluator& evaluate, std::vector<PointStruct>& points) const
     {
-        // check slope and delta z for discontinuities
-        if (
-            // radical change of slope
-            abs(pos->GetZRoadPrim() - pivot->GetZRoadPrim()) > 0.1 - SMALL_NUMBER ||
-            // change of z not according to slope (discontinuity found)
-            abs((pos->GetZ() - pivot->GetZ()) - pivot->GetZRoadPrim() * (pos->GetS() - pivot->GetS())) > 0.1 - SMALL_NUMBER)  // actual
+        PointStruct p0, p1;
+
+        evaluate(s_start, p0);
+        points.push_back(p0);
+
+        auto it = std::upper_bound(samples_.begin(), samples_.end(), s_start + OSI_POINT_MIN_SEGMENT_LENGTH);
+        for (; it != samples_.end() && *it < s_end - OSI_POINT_MIN_SEGMENT_LENGTH; ++it)
         {
-            max_segment_length = min;
-            osi_requirement    = false;
+            evaluate(*it, p1);
+            if (std::binary_search(breakpoints_.begin(), breakpoints_.end(), *it))
+            {
+                PointStruct p_before;
+                evaluate(*it - OSI_POINT_DISCONTINUITY_DS, p_before);
+                if (GetDistance(p_before, p1) > max_deviation_ + OSI_POINT_DISCONTINUITY_DS)
+                {
+                    Subdivide(p0, p_before, nullptr, evaluate, points);
+                    points.push_back(p1);
+                    p0 = p1;
+                    continue;
+                }
+            }
+            Subdivide(p0, p1, nullptr, evaluate, points);
+            p0 = p1;
         }
+
+        evaluate(s_end, p1);
+        Subdivide(p0, p1, nullptr, evaluate, points);
     }
 
-    return max_segment_length;
-}
+private:
+    std::vector<double> breakpoints_;  // s values where road definition changes, sorted
+    std::vector<double> samples_;      // initial subdivision of the road, sorted
+    double              max_deviation_;
+    double              max_segment_length_;
+
+    static double GetDistance(const PointStruct& p0, const PointStruct& p1)
+    {
+        return sqrt(pow(p1.x - p0.x, 2) + pow(p1.y - p0.y, 2) + pow(p1.z - p0.z, 2));
+    }
+
+    static double GetDeviation(const PointStruct& p0, const PointStruct& p1, const PointStruct& p, double factor)
+    {
+        double lateral  = DistanceFromPointToEdge2D(p.x, p.y, p0.x, p0.y, p1.x, p1.y, nullptr, nullptr);
+        double vertical = fabs(p.z - (p0.z + factor * (p1.z - p0.z)));
+        return MAX(lateral, vertical);
+    }
+
+    // Append points following p0 up to and including p1. The mid point, if already evaluated by the parent segment, is reused.
+    void Subdivide(const PointStruct& p0, const PointStruct& p1, const PointStruct* mid, const Evaluator& evaluate, std::vector<PointStruct>& points)
+        const
+    {
+        double length = p1.s - p0.s;
+
+        if (length > 2 * OSI_POINT_MIN_SEGMENT_LENGTH)
+        {
+            PointStruct quarter, half, three_quarters;
+
+            if (mid != nullptr)
+            {
+                half = *mid;
+            }
+            else
+            {
+                evaluate(p0.s + 0.5 * length, half);
+            }
+            evaluate(p0.s + 0.25 * length, quarter);
+            evaluate(p0.s + 0.75 * length, three_quarters);
+
+            if (length > max_segment_length_ + SMALL_NUMBER || GetDeviation(p0, p1, half, 0.5) > max_deviation_ ||
+                GetDeviation(p0, p1, quarter, 0.25) > max_deviation_ || GetDeviation(p0, p1, three_quarters, 0.75) > max_deviation_)
+            {
+                Subdivide(p0, half, &quarter, evaluate, points);
+                Subdivide(half, p1, &three_quarters, evaluate, points);
+                return;
+            }
+        }
+
+        points.push_back(p1);
+    }
+};
 
-void OpenDrive::SetLaneOSIPoints()
+void OpenDrive::SetLaneOSIPoints(int road_idx)
 {
     // Initialization
-    Position                 pos_pivot, pos_tmp, pos_candidate;
+    Position                 pos;
     Road*                    road;
     LaneSection*             lsec;
     Lane*                    lane;
     int                      number_of_lane_sections, number_of_lanes;
     double                   lsec_end;
     std::vector<PointStruct> osi_point;
-    std::vector<double>      x0, y0, x1, y1;
-    bool                     osi_requirement;
-    double                   max_segment_length = SE_Env::Inst().GetOSIMaxLongitudinalDistance();
-    double                   min_segment_length = 0.2;
     int                      osiintersection;
 
-    // Looping through each road
-    for (int i = 0; i < road_.size(); i++)
+    // Looping through each road, or only specified one
+    int first_road = road_idx < 0 ? 0 : road_idx;
+    int last_road  = road_idx < 0 ? GetNumOfRoads() : MIN(road_idx + 1, GetNumOfRoads());
+    for (int i = first_road; i < last_road; i++)
     {
         road = road_[i];
 
@@ -5969,6 +6463,8 @@ void OpenDrive::SetLaneOSIPoints()
             }
         }
 
+        RoadTessellation tessellation(road, SE_Env::Inst().GetOSIMaxLateralDeviation(), SE_Env::Inst().GetOSIMaxLongitudinalDistance());
+
         // Looping through each lane section
         number_of_lane_sections = road_[i]->GetNumberOfLaneSections();
         for (int j = 0; j < number_of_lane_sections; j++)
@@ -5988,327 +6484,378 @@ void OpenDrive::SetLaneOSIPoints()
             number_of_lanes = lsec->GetNumberOfLanes();
             for (int k = 0; k < number_of_lanes; k++)
             {
-                lane        = lsec->GetLaneByIdx(k);
-                int counter = 0;
+                lane = lsec->GetLaneByIdx(k);
 
-                // [XO, YO] = Real position with no tolerance
-                if (pos_pivot.SetLanePos(road->GetId(), lane->GetId(), lsec->GetS(), 0, j) != Position::ReturnCode::OK)
+                if (pos.SetLanePos(road->GetId(), lane->GetId(), lsec->GetS(), 0, j) != Position::ReturnCode::OK)
                 {
                     break;
                 }
 
-                // Add the starting point of each lane as osi point
-                PointStruct p = {lsec->GetS(), pos_pivot.GetX(), pos_pivot.GetY(), pos_pivot.GetZ(), pos_pivot.GetHRoad()};
-                osi_point.push_back(p);
+                tessellation.Tessellate(
+                    lsec->GetS(),
+                    lsec_end,
+                    [&](double s, PointStruct& p)
+                    {
+                        // Make sure we stay within lane section length
+                        pos.SetLanePos(road->GetId(), lane->GetId(), MIN(s, lsec_end - SMALL_NUMBER / 2), 0, j);
+                        p = {s, pos.GetX(), pos.GetY(), pos.GetZ(), pos.GetHRoad()};
+                    },
+                    osi_point);
+
+                // Set all collected osi points for the current lane
+                lane->osi_points_.Set(osi_point);
+                lane->SetOSIIntersection(osiintersection);
+
+                // Clear osi collectors for next iteration
+                osi_point.clear();
+            }
+        }
+    }
+}
 
-                // [XO, YO] = closest position with given (-) tolerance
-                pos_tmp.SetLanePos(road->GetId(), lane->GetId(), MAX(0, lsec->GetS() - OSI_TANGENT_LINE_TOLERANCE), 0, j);
-                x0.push_back(pos_tmp.GetX());
-                y0.push_back(pos_tmp.GetY());
+void OpenDrive::SetLaneBoundaryPoints(int road_idx)
+{
+    // Initialization
+    Position                 pos;
+    Road*                    road;
+    LaneSection*             lsec;
+    Lane*                    lane;
+    int                      number_of_lane_sections, number_of_lanes;
+    double                   lsec_end;
+    std::vector<PointStruct> osi_point;
 
-                // Push real position between the +/- tolerance points
-                x0.push_back(pos_pivot.GetX());
-                y0.push_back(pos_pivot.GetY());
+    // Looping through each road, or only specified one
+    int first_road = road_idx < 0 ? 0 : road_idx;
+    int last_road  = road_idx < 0 ? GetNumOfRoads() : MIN(road_idx + 1, GetNumOfRoads());
+    for (int i = first_road; i < last_road; i++)
+    {
+        road = road_[i];
 
-                // [XO, YO] = closest position with given (+) tolerance
-                pos_tmp.SetLanePos(road->GetId(), lane->GetId(), MIN(lsec->GetS() + OSI_TANGENT_LINE_TOLERANCE, lsec_end), 0, j);
-                x0.push_back(pos_tmp.GetX());
-                y0.push_back(pos_tmp.GetY());
+        RoadTessellation tessellation(road, SE_Env::Inst().GetOSIMaxLateralDeviation(), SE_Env::Inst().GetOSIMaxLongitudinalDistance());
 
-                bool   insert = false;
-                double step   = OSI_POINT_CALC_STEPSIZE;
+        // Looping through each lane section
+        number_of_lane_sections = road_[i]->GetNumberOfLaneSections();
+        for (int j = 0; j < number_of_lane_sections; j++)
+        {
+            // Get the ending position of the current lane section
+            lsec = road->GetLaneSectionByIdx(j);
+            if (j == number_of_lane_sections - 1)
+            {
+                lsec_end = road->GetLength();
+            }
+            else
+            {
+                lsec_end = road->GetLaneSectionByIdx(j + 1)->GetS();
+            }
 
-                pos_candidate = pos_pivot;
+            // Looping through each lane
+            number_of_lanes = lsec->GetNumberOfLanes();
+            for (int k = 0; k < number_of_lanes; k++)
+            {
+                lane = lsec->GetLaneByIdx(k);
 
-                // Looping through sequential points along the track determined by "OSI_POINT_CALC_STEPSIZE"
-                while (++counter)
+                // Lanes with road marks get their boundaries from the road mark lines
+                if (lane->GetNumberOfRoadMarks() == 0)
                 {
-                    // Make sure we stay within lane section length
-                    double s = MIN(pos_candidate.GetS() + step, lsec_end - SMALL_NUMBER / 2);
+                    tessellation.Tessellate(
+                        lsec->GetS(),
+                        lsec_end,
+                        [&](double s, PointStruct& p)
+                        {
+                            // Make sure we stay within lane section length
+                            pos.SetLaneBoundaryPos(road->GetId(), lane->GetId(), MAX(0, MIN(s, lsec_end - SMALL_NUMBER)), 0, j);
+                            p = {s, pos.GetX(), pos.GetY(), pos.GetZ(), pos.GetHRoad()};
+                        },
+                        osi_point);
 
-                    // [X1, Y1] = Real position with no tolerance
-                    pos_candidate.SetLanePos(road->GetId(), lane->GetId(), s, 0, j);
+                    // Initialization of LaneBoundary class
+                    LaneBoundaryOSI* lb = new LaneBoundaryOSI((int)0);
+                    // add the lane boundary class to the lane class and generating the global id
+                    lane->SetLaneBoundary(lb);
+                    // Fills up the osi points in the lane boundary class
+                    lb->osi_points_.Set(osi_point);
+                    // Clear osi collectors for next iteration
+                    osi_point.clear();
+                }
+            }
+        }
+    }
+}
 
-                    // [X1, Y1] = closest position with given (-) tolerance
-                    pos_tmp.SetLanePos(road->GetId(), lane->GetId(), MAX(s - OSI_TANGENT_LINE_TOLERANCE, 0), 0, j);
-                    x1.push_back(pos_tmp.GetX());
-                    y1.push_back(pos_tmp.GetY());
+void OpenDrive::SetRoadProfile(int road_idx)
+{
+    double resolution = SE_Env::Inst().GetLookAheadResolution();
+    if (resolution < SMALL_NUMBER)
+    {
+        LOG_ONCE("Look-ahead resolution %.2f too small, using default %.2f", resolution, LOOKAHEAD_RESOLUTION);
+        resolution = LOOKAHEAD_RESOLUTION;
+    }
 
-                    x1.push_back(pos_candidate.GetX());
-                    y1.push_back(pos_candidate.GetY());
+    // Looping through each road, or only specified one
+    int first_road = road_idx < 0 ? 0 : road_idx;
+    int last_road  = road_idx < 0 ? GetNumOfRoads() : MIN(road_idx + 1, GetNumOfRoads());
+    for (int i = first_road; i < last_road; i++)
+    {
+        Road*                         road     = road_[i];
+        int                           geom_idx = 0;
+        std::vector<RoadProfilePoint> profile;
+        std::vector<int>              lsec_first_idx;
 
-                    // [X1, Y1] = closest position with given (+) tolerance
-                    pos_tmp.SetLanePos(road->GetId(), lane->GetId(), MIN(s + OSI_TANGENT_LINE_TOLERANCE, lsec_end), 0, j);
-                    x1.push_back(pos_tmp.GetX());
-                    y1.push_back(pos_tmp.GetY());
+        if (road->GetNumberOfGeometries() == 0)
+        {
+            continue;
+        }
 
-                    // Check OSI Requirement between current given points
-                    if (NEAR_NUMBERS(pos_pivot.GetH(), pos_candidate.GetH()))
-                    {
-                        if (DistanceFromPointToLine2DWithAngle(pos_candidate.GetX(),
-                                                               pos_candidate.GetY(),
-                                                               pos_pivot.GetX(),
-                                                               pos_pivot.GetY(),
-                                                               pos_pivot.GetH()) < min_segment_length)
-                        {
-                            osi_requirement = true;  // points on a straight segment
-                        }
-                        else
-                        {
-                            osi_requirement = false;  // same heading but not on a straight line => lane discontinuity
-                        }
-                    }
-                    else
-                    {
-                        osi_requirement = CheckLaneOSIRequirement(x0, y0, x1, y1);
-                    }
+        // Reference line, each lane section sampled evenly. Last point of a lane section is first point of next one.
+        for (int j = 0; j < road->GetNumberOfLaneSections(); j++)
+        {
+            LaneSection* lsec      = road->GetLaneSectionByIdx(j);
+            bool         last_lsec = j == road->GetNumberOfLaneSections() - 1;
+            double       lsec_end  = last_lsec ? road->GetLength() : road->GetLaneSectionByIdx(j + 1)->GetS();
+            int          n_steps   = MAX(1, static_cast<int>(ceil((lsec_end - lsec->GetS()) / resolution)));
 
-                    // If requirement is satisfied -> look further points
-                    // If requirement is not satisfied:
-                    //    Assign last unique satisfied point as OSI point
-                    //    Continue searching from the last satisfied point
+            lsec_first_idx.push_back(static_cast<int>(profile.size()));
+            for (int k = 0; k < (last_lsec ? n_steps + 1 : n_steps); k++)
+            {
+                RoadProfilePoint p;
+                p.s = lsec->GetS() + (lsec_end - lsec->GetS()) * k / n_steps;
 
-                    // Make sure max segment length is longer than stepsize and considering elevation change rate
-                    if (osi_requirement)
-                    {
-                        max_segment_length = GetMaxSegmentLen(&pos_pivot,
-                                                              &pos_candidate,
-                                                              1.1 * OSI_POINT_CALC_STEPSIZE,
-                                                              SE_Env::Inst().GetOSIMaxLongitudinalDistance(),
-                                                              OSI_POINT_DIST_SCALE,
-                                                              OSI_POINT_DIST_SCALE,
-                                                              osi_requirement);
-                    }
+                while (geom_idx < road->GetNumberOfGeometries() - 1 && p.s > road->GetGeometry(geom_idx + 1)->GetS())
+                {
+                    geom_idx++;
+                }
+                Geometry* geom = road->GetGeometry(geom_idx);
+                geom->EvaluateDS(p.s - geom->GetS(), &p.x, &p.y, &p.h);
+                p.curvature = geom->EvaluateCurvatureDS(p.s - geom->GetS());
 
-                    if (pos_candidate.GetS() + SMALL_NUMBER > lsec_end - SMALL_NUMBER ||  // end of the lane reached, assign as final OSI point
-                        osi_requirement && pos_candidate.GetS() - pos_pivot.GetS() > max_segment_length - SMALL_NUMBER ||
-                        abs(step) < min_segment_length + SMALL_NUMBER)
-                    {
-                        p = {pos_candidate.GetS(), pos_candidate.GetX(), pos_candidate.GetY(), pos_candidate.GetZ(), pos_candidate.GetHRoad()};
-                        osi_point.push_back(p);
-                        insert = false;
+                double lane_offset = road->GetLaneOffset(p.s);
+                p.x -= lane_offset * sin(p.h);
+                p.y += lane_offset * cos(p.h);
 
-                        if (pos_candidate.GetS() + SMALL_NUMBER > lsec_end - SMALL_NUMBER)
-                        {
-                            break;
-                        }
+                profile.push_back(p);
+            }
+        }
+        lsec_first_idx.push_back(static_cast<int>(profile.size()) - 1);
 
-                        // If last step length was small, guess next one will also be small to reduce search
-                        step = MIN(OSI_POINT_CALC_STEPSIZE, 2.0 * (pos_candidate.GetS() - pos_pivot.GetS()));
+        // Lane center and borders of driving lanes at each reference line point of the lane section
+        for (int j = 0; j < road->GetNumberOfLaneSections(); j++)
+        {
+            LaneSection* lsec = road->GetLaneSectionByIdx(j);
 
-                        pos_pivot = pos_candidate;
+            for (int k = 0; k < lsec->GetNumberOfLanes(); k++)
+            {
+                Lane* lane = lsec->GetLaneByIdx(k);
+                if (!lane->IsDriving())
+                {
+                    continue;
+                }
 
-                        // reuse candidate x-y collectors for pivot position
-                        x0 = x1;
-                        y0 = y1;
-                    }
-                    else
+                std::vector<LaneProfilePoint> lane_profile;
+                for (int l = lsec_first_idx[static_cast<unsigned int>(j)]; l <= lsec_first_idx[static_cast<unsigned int>(j) + 1]; l++)
+                {
+                    const RoadProfilePoint& p          = profile[static_cast<unsigned int>(l)];
+                    double                  t_center   = SIGN(lane->GetId()) * lsec->GetCenterOffset(p.s, lane->GetId());
+                    double                  half_width = lsec->GetWidth(p.s, lane->GetId()) / 2;
+                    double                  t[3]       = {t_center + half_width, t_center, t_center - half_width};
+                    LaneProfilePoint        lp;
+
+                    lp.profile_idx = l;
+                    for (int m = 0; m < 3; m++)
                     {
-                        if (osi_requirement == false)
-                        {
-                            insert = true;              // indicate that a point needs to be inserted
-                            step   = -abs(step) / 2.0;  // look backwards half current stepsize
-                        }
-                        else if (insert)
-                        {
-                            step = abs(step) / 2.0;  // look forward half current stepsize
-                        }
+                        lp.x[m] = p.x - t[m] * sin(p.h);
+                        lp.y[m] = p.y + t[m] * cos(p.h);
                     }
-
-                    // Clear x-y collectors for next iteration
-                    x1.clear();
-                    y1.clear();
+                    lane_profile.push_back(lp);
                 }
-
-                // Set all collected osi points for the current lane
-                lane->osi_points_.Set(osi_point);
-                lane->SetOSIIntersection(osiintersection);
-
-                // Clear osi collectors for next iteration
-                osi_point.clear();
+                lane->SetProfile(lane_profile);
             }
         }
+
+        road->SetProfile(profile);
     }
 }
 
-void OpenDrive::SetLaneBoundaryPoints()
+bool LookAheadPath::GetPos(double ds, int idx, double& x, double& y) const
 {
-    // Initialization
-    Position                 pos;
-    Road*                    road;
-    LaneSection*             lsec;
-    Lane*                    lane;
-    int                      number_of_lane_sections, number_of_lanes;
-    double                   lsec_end;
-    std::vector<double>      x0, y0, x1, y1;
-    std::vector<PointStruct> osi_point;
-    double                   s0, s1, s1_prev;
-    bool                     osi_requirement;
-    double                   max_segment_length = SE_Env::Inst().GetOSIMaxLongitudinalDistance();
+    if (points.empty() || ds < points.front().ds || ds > points.back().ds)
+    {
+        return false;
+    }
 
-    // Looping through each road
-    for (int i = 0; i < road_.size(); i++)
+    // first point beyond given distance, or last point
+    auto it = std::upper_bound(points.begin(), points.end(), ds, [](double d, const Point& p) { return d < p.ds; });
+    if (it == points.end())
     {
-        road = road_[i];
+        x = points.back().x[idx];
+        y = points.back().y[idx];
+        return true;
+    }
 
-        // Looping through each lane section
-        number_of_lane_sections = road_[i]->GetNumberOfLaneSections();
-        for (int j = 0; j < number_of_lane_sections; j++)
+    const Point& p0     = *(it - 1);
+    const Point& p1     = *it;
+    double       factor = (ds - p0.ds) / MAX(p1.ds - p0.ds, SMALL_NUMBER);
+
+    x = p0.x[idx] + factor * (p1.x[idx] - p0.x[idx]);
+    y = p0.y[idx] + factor * (p1.y[idx] - p0.y[idx]);
+
+    return true;
+}
+
+const LookAheadPath& OpenDrive::GetLookAheadPath(int road_idx, int lsec_idx, int lane_id, double s, int direction, double length)
+{
+    int            bucket = static_cast<int>(floor(s / LOOKAHEAD_S_BUCKET_SIZE));
+    LookAheadPath& path   = lookahead_cache_[std::make_tuple(road_idx, lsec_idx, lane_id, bucket, direction)];
+
+    // Path starts at the bucket border behind s, hence add bucket size to make sure length is covered from any s in the bucket
+    if (path.max_length < LOOKAHEAD_S_BUCKET_SIZE + length)
+    {
+        LaneSection* lsec = GetRoadByIdx(road_idx) ? GetRoadByIdx(road_idx)->GetLaneSectionByIdx(lsec_idx) : nullptr;
+
+        path.s_start = (direction == 1 ? bucket : bucket + 1) * LOOKAHEAD_S_BUCKET_SIZE;
+        if (lsec != nullptr)
         {
-            // Get the ending position of the current lane section
-            lsec = road->GetLaneSectionByIdx(j);
-            if (j == number_of_lane_sections - 1)
-            {
-                lsec_end = road->GetLength();
-            }
-            else
-            {
-                lsec_end = road->GetLaneSectionByIdx(j + 1)->GetS();
-            }
+            // stay within the lane section of s, since lane id is only valid there
+            path.s_start = CLAMP(path.s_start, lsec->GetS(), lsec->GetS() + lsec->GetLength());
+        }
+        BuildLookAheadPath(path, road_idx, lsec_idx, lane_id, direction, LOOKAHEAD_S_BUCKET_SIZE + length);
+    }
+    path.frame = lookahead_frame_;
 
-            // Starting points of the each lane section for OSI calculations
-            s0      = lsec->GetS();
-            s1      = s0 + OSI_POINT_CALC_STEPSIZE;
-            s1_prev = s0;
+    return path;
+}
 
-            // Looping through each lane
-            number_of_lanes = lsec->GetNumberOfLanes();
-            for (int k = 0; k < number_of_lanes; k++)
-            {
-                lane            = lsec->GetLaneByIdx(k);
-                int counter     = 0;
-                int n_roadmarks = lane->GetNumberOfRoadMarks();
+void OpenDrive::PruneLookAheadCache()
+{
+    for (auto it = lookahead_cache_.begin(); it != lookahead_cache_.end();)
+    {
+        if (it->second.frame != lookahead_frame_)
+        {
+            it = lookahead_cache_.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+    lookahead_frame_++;
+}
 
-                if (n_roadmarks == 0)
-                {
-                    // Looping through sequential points along the track determined by "OSI_POINT_CALC_STEPSIZE"
-                    while (true)
-                    {
-                        counter++;
+void OpenDrive::BuildLookAheadPath(LookAheadPath& path, int road_idx, int lsec_idx, int lane_id, int direction, double length) const
+{
+    Road*                road       = GetRoadByIdx(road_idx);
+    double               s_entry    = path.s_start;  // s value where the path enters current road
+    double               ds_road    = 0.0;           // path distance at s_entry
+    LookAheadPath::Point behind     = {};            // latest point behind start of path
+    bool                 has_behind = false;
 
-                        // Make sure we stay within lane section length
-                        s1 = MIN(s1, lsec_end - OSI_TANGENT_LINE_TOLERANCE);
+    path.points.clear();
+    path.junction   = false;
+    path.max_length = length;
 
-                        // [XO, YO] = closest position with given (-) tolerance
-                        pos.SetLaneBoundaryPos(road->GetId(), lane->GetId(), MAX(0, s0 - OSI_TANGENT_LINE_TOLERANCE), 0, j);
-                        x0.push_back(pos.GetX());
-                        y0.push_back(pos.GetY());
+    while (road != nullptr)
+    {
+        LaneSection* lsec = road->GetLaneSectionByIdx(lsec_idx);
+        Lane*        lane = lsec != nullptr ? lsec->GetLaneById(lane_id) : nullptr;
 
-                        // [XO, YO] = Real position with no tolerance
-                        pos.SetLaneBoundaryPos(road->GetId(), lane->GetId(), s0, 0, j);
-                        x0.push_back(pos.GetX());
-                        y0.push_back(pos.GetY());
+        if (lane == nullptr || lane->GetProfile().empty() || road->GetProfile().empty())
+        {
+            break;  // not a driving lane
+        }
 
-                        // Add the starting point of each lane as osi point
-                        if (counter == 1)
-                        {
-                            PointStruct p = {s0, pos.GetX(), pos.GetY(), pos.GetZ(), pos.GetHRoad()};
-                            osi_point.push_back(p);
-                        }
+        const std::vector<LaneProfilePoint>& lane_profile = lane->GetProfile();
+        const std::vector<RoadProfilePoint>& road_profile = road->GetProfile();
 
-                        // [XO, YO] = closest position with given (+) tolerance
-                        pos.SetLaneBoundaryPos(road->GetId(), lane->GetId(), s0 + OSI_TANGENT_LINE_TOLERANCE, 0, j);
-                        x0.push_back(pos.GetX());
-                        y0.push_back(pos.GetY());
+        for (size_t k = 0; k < lane_profile.size(); k++)
+        {
+            const LaneProfilePoint& lp = lane_profile[direction == 1 ? k : lane_profile.size() - 1 - k];
+            LookAheadPath::Point    p;
 
-                        // [X1, Y1] = closest position with given (-) tolerance
-                        pos.SetLaneBoundaryPos(road->GetId(), lane->GetId(), s1 - OSI_TANGENT_LINE_TOLERANCE, 0, j);
-                        x1.push_back(pos.GetX());
-                        y1.push_back(pos.GetY());
+            p.ds = ds_road + direction * (road_profile[static_cast<unsigned int>(lp.profile_idx)].s - s_entry);
+            for (int m = 0; m < 3; m++)
+            {
+                // left and right as seen in driving direction
+                int idx = direction == 1 ? m : 2 - m;
+                p.x[m]  = lp.x[idx];
+                p.y[m]  = lp.y[idx];
+            }
 
-                        // [X1, Y1] = Real position with no tolerance
-                        pos.SetLaneBoundaryPos(road->GetId(), lane->GetId(), s1, 0, j);
-                        x1.push_back(pos.GetX());
-                        y1.push_back(pos.GetY());
+            if (p.ds < -SMALL_NUMBER)
+            {
+                // keep the closest point behind start, so that the path covers its start
+                behind     = p;
+                has_behind = true;
+                continue;
+            }
 
-                        // [X1, Y1] = closest position with given (+) tolerance
-                        pos.SetLaneBoundaryPos(road->GetId(), lane->GetId(), s1 + OSI_TANGENT_LINE_TOLERANCE, 0, j);
-                        x1.push_back(pos.GetX());
-                        y1.push_back(pos.GetY());
+            if (path.points.empty() && has_behind && p.ds > SMALL_NUMBER)
+            {
+                path.points.push_back(behind);
+            }
 
-                        // Check OSI Requirement between current given points
-                        if (x1[1] - x0[1] != 0 && y1[1] - y0[1] != 0)
-                        {
-                            osi_requirement = CheckLaneOSIRequirement(x0, y0, x1, y1);
-                        }
-                        else
-                        {
-                            osi_requirement = true;
-                        }
+            if (!path.points.empty() && p.ds < path.points.back().ds + SMALL_NUMBER)
+            {
+                continue;  // coincides with previous point, at lane section or road border
+            }
 
-                        // Make sure max segment length is longer than stepsize
-                        if (osi_requirement)
-                        {
-                            max_segment_length = GetMaxSegmentLen(0,
-                                                                  &pos,
-                                                                  1.1 * OSI_POINT_CALC_STEPSIZE,
-                                                                  SE_Env::Inst().GetOSIMaxLongitudinalDistance(),
-                                                                  OSI_POINT_DIST_SCALE,
-                                                                  OSI_POINT_DIST_SCALE,
-                                                                  osi_requirement);
-                        }
+            path.points.push_back(p);
+            if (p.ds > length)
+            {
+                return;
+            }
+        }
 
-                        // If requirement is satisfied -> look further points
-                        // If requirement is not satisfied:
-                        // Assign last satisfied point as OSI point
-                        // Continue searching from the last satisfied point
-                        if (osi_requirement && s1 - s0 < max_segment_length)
-                        {
-                            s1_prev = s1;
-                            s1      = s1 + OSI_POINT_CALC_STEPSIZE;
-                        }
-                        else
-                        {
-                            s0      = s1_prev;
-                            s1_prev = s1;
-                            s1      = s0 + OSI_POINT_CALC_STEPSIZE;
+        // Proceed to linked lane on next lane section, or next road
+        bool      next_lsec = lsec_idx + direction >= 0 && lsec_idx + direction < road->GetNumberOfLaneSections();
+        RoadLink* road_link = next_lsec ? nullptr : road->GetLink(direction == 1 ? LinkType::SUCCESSOR : LinkType::PREDECESSOR);
 
-                            if (counter != 1)
-                            {
-                                pos.SetLaneBoundaryPos(road->GetId(), lane->GetId(), s0, 0, j);
-                                PointStruct p = {s0, pos.GetX(), pos.GetY(), pos.GetZ(), pos.GetHRoad()};
-                                osi_point.push_back(p);
-                            }
-                        }
+        if (road_link != nullptr && road_link->GetElementType() == RoadLink::ElementType::ELEMENT_TYPE_JUNCTION)
+        {
+            // lanes are connected by the junction, not by lane links
+            path.junction = true;
+            break;
+        }
 
-                        // If the end of the lane reached, assign end of the lane as final OSI point for current lane
-                        if (s1 + OSI_TANGENT_LINE_TOLERANCE >= lsec_end)
-                        {
-                            pos.SetLaneBoundaryPos(road->GetId(), lane->GetId(), MAX(0, lsec_end - SMALL_NUMBER), 0, j);
-                            PointStruct p = {lsec_end, pos.GetX(), pos.GetY(), pos.GetZ(), pos.GetHRoad()};
-                            osi_point.push_back(p);
-                            break;
-                        }
+        LaneLink* lane_link = lane->GetLink(direction == 1 ? LinkType::SUCCESSOR : LinkType::PREDECESSOR);
+        if (lane_link == nullptr || (!next_lsec && road_link == nullptr))
+        {
+            break;
+        }
 
-                        // Clear x-y collectors for next iteration
-                        x0.clear();
-                        y0.clear();
-                        x1.clear();
-                        y1.clear();
-                    }
-                    // Initialization of LaneBoundary class
-                    LaneBoundaryOSI* lb = new LaneBoundaryOSI((int)0);
-                    // add the lane boundary class to the lane class and generating the global id
-                    lane->SetLaneBoundary(lb);
-                    // Fills up the osi points in the lane boundary class
-                    lb->osi_points_.Set(osi_point);
-                    // Clear osi collectors for next iteration
-                    osi_point.clear();
+        if (next_lsec)
+        {
+            lsec_idx += direction;
+        }
+        else
+        {
+            ds_road += direction == 1 ? road->GetLength() - s_entry : s_entry;
+            road = GetRoadById(road_link->GetElementId());
+            if (road == nullptr)
+            {
+                break;
+            }
 
-                    // Re-assign the starting point of the next lane as the start point of the current lane section for OSI calculations
-                    s0      = lsec->GetS();
-                    s1      = s0 + OSI_POINT_CALC_STEPSIZE;
-                    s1_prev = s0;
-                }
+            // Direction on next road depends on which end we enter
+            if (road_link->GetContactPointType() == ContactPointType::CONTACT_POINT_END)
+            {
+                direction = -1;
+                lsec_idx  = road->GetNumberOfLaneSections() - 1;
+                s_entry   = road->GetLength();
+            }
+            else
+            {
+                direction = 1;
+                lsec_idx  = 0;
+                s_entry   = 0.0;
             }
         }
+        lane_id = lane_link->GetId();
     }
 }
 
-void OpenDrive::SetRoadMarkOSIPoints()
+void OpenDrive::SetRoadMarkOSIPoints(int road_idx)
 {
     // Initialization
-    Position                 pos_pivot, pos_tmp, pos_candidate;
+    Position                 pos_candidate;
     Road*                    road;
     LaneSection*             lsec;
     Lane*                    lane;
@@ -6317,17 +6864,17 @@ void OpenDrive::SetRoadMarkOSIPoints()
     LaneRoadMarkTypeLine*    lane_roadMarkTypeLine;
     int                      number_of_lane_sections, number_of_lanes, number_of_roadmarks, number_of_roadmarktypes, number_of_roadmarklines;
     double                   lsec_end, s_roadmark, s_end_roadmark, s_roadmarkline, s_end_roadmarkline;
-    std::vector<double>      x0, y0, x1, y1;
     std::vector<PointStruct> osi_point;
-    bool                     osi_requirement;
-    double                   max_segment_length = SE_Env::Inst().GetOSIMaxLongitudinalDistance();
-    double                   min_segment_length = 0.2;
 
-    // Looping through each road
-    for (int i = 0; i < road_.size(); i++)
+    // Looping through each road, or only specified one
+    int first_road = road_idx < 0 ? 0 : road_idx;
+    int last_road  = road_idx < 0 ? GetNumOfRoads() : MIN(road_idx + 1, GetNumOfRoads());
+    for (int i = first_road; i < last_road; i++)
     {
         road = road_[i];
 
+        RoadTessellation tessellation(road, SE_Env::Inst().GetOSIMaxLateralDeviation(), SE_Env::Inst().GetOSIMaxLongitudinalDistance());
+
         // Looping through each lane section
         number_of_lane_sections = road_[i]->GetNumberOfLaneSections();
         for (int j = 0; j < number_of_lane_sections; j++)
@@ -6487,158 +7034,15 @@ void OpenDrive::SetRoadMarkOSIPoints()
                                     else if (lane_roadMark->GetType() == LaneRoadMark::RoadMarkType::SOLID ||
                                              lane_roadMark->GetType() == LaneRoadMark::RoadMarkType::SOLID_SOLID || !broken)
                                     {
-                                        int counter = 0;
-
-                                        // [XO, YO] = Real position with no tolerance
-                                        pos_pivot.SetRoadMarkPos(road->GetId(), lane->GetId(), m, 0, n, s_roadmarkline, 0, j);
-
-                                        // Add the starting point of each lane as osi point
-                                        PointStruct p = {s_roadmarkline, pos_pivot.GetX(), pos_pivot.GetY(), pos_pivot.GetZ(), pos_pivot.GetHRoad()};
-                                        osi_point.push_back(p);
-
-                                        // [XO, YO] = closest position with given (-) tolerance
-                                        pos_tmp.SetRoadMarkPos(road->GetId(),
-                                                               lane->GetId(),
-                                                               m,
-                                                               0,
-                                                               n,
-                                                               MAX(0, s_roadmarkline - OSI_TANGENT_LINE_TOLERANCE),
-                                                               0,
-                                                               j);
-                                        x0.push_back(pos_tmp.GetX());
-                                        y0.push_back(pos_tmp.GetY());
-
-                                        // Push real position between the +/- tolerance points
-                                        x0.push_back(pos_pivot.GetX());
-                                        y0.push_back(pos_pivot.GetY());
-
-                                        // [XO, YO] = closest position with given (+) tolerance
-                                        pos_tmp.SetRoadMarkPos(road->GetId(),
-                                                               lane->GetId(),
-                                                               m,
-                                                               0,
-                                                               n,
-                                                               MIN(s_roadmarkline + OSI_TANGENT_LINE_TOLERANCE, road->GetLength()),
-                                                               0,
-                                                               j);
-                                        x0.push_back(pos_tmp.GetX());
-                                        y0.push_back(pos_tmp.GetY());
-
-                                        bool   insert = false;
-                                        double step   = OSI_POINT_CALC_STEPSIZE;
-
-                                        pos_candidate = pos_pivot;
-
-                                        while (++counter)
-                                        {
-                                            // Make sure we stay within lane section length
-                                            double s = MIN(pos_candidate.GetS() + step, s_end_roadmark - SMALL_NUMBER / 2);
-
-                                            // [X1, Y1] = Real position with no tolerance
-                                            pos_candidate.SetRoadMarkPos(road->GetId(), lane->GetId(), m, 0, n, s, 0, j);
-
-                                            // [X1, Y1] = closest position with given (-) tolerance
-                                            pos_tmp
-                                                .SetRoadMarkPos(road->GetId(), lane->GetId(), m, 0, n, MAX(s - OSI_TANGENT_LINE_TOLERANCE, 0), 0, j);
-                                            x1.push_back(pos_tmp.GetX());
-                                            y1.push_back(pos_tmp.GetY());
-
-                                            x1.push_back(pos_candidate.GetX());
-                                            y1.push_back(pos_candidate.GetY());
-
-                                            // [X1, Y1] = closest position with given (+) tolerance
-                                            pos_tmp.SetRoadMarkPos(road->GetId(),
-                                                                   lane->GetId(),
-                                                                   m,
-                                                                   0,
-                                                                   n,
-                                                                   MIN(s + OSI_TANGENT_LINE_TOLERANCE, lsec_end),
-                                                                   0,
-                                                                   j);
-                                            x1.push_back(pos_tmp.GetX());
-                                            y1.push_back(pos_tmp.GetY());
-
-                                            // Check OSI Requirement between current given points
-                                            if (NEAR_NUMBERS(pos_pivot.GetH(), pos_candidate.GetH()))
+                                        tessellation.Tessellate(
+                                            s_roadmarkline,
+                                            s_end_roadmark,
+                                            [&](double s, PointStruct& p)
                                             {
-                                                if (DistanceFromPointToLine2DWithAngle(pos_candidate.GetX(),
-                                                                                       pos_candidate.GetY(),
-                                                                                       pos_pivot.GetX(),
-                                                                                       pos_pivot.GetY(),
-                                                                                       pos_pivot.GetH()) < min_segment_length)
-                                                {
-                                                    osi_requirement = true;  // points on a straight segment
-                                                }
-                                                else
-                                                {
-                                                    osi_requirement = false;  // same heading but not on a straight line => lane discontinuity
-                                                }
-                                            }
-                                            else
-                                            {
-                                                osi_requirement = CheckLaneOSIRequirement(x0, y0, x1, y1);
-                                            }
-
-                                            // If requirement is satisfied -> look further points
-                                            // If requirement is not satisfied:
-                                            //    Assign last unique satisfied point as OSI point
-                                            //    Continue searching from the last satisfied point
-
-                                            // Make sure max segment length is longer than stepsize and considering elevation change rate
-                                            if (osi_requirement)
-                                            {
-                                                max_segment_length = GetMaxSegmentLen(&pos_pivot,
-                                                                                      &pos_candidate,
-                                                                                      1.1 * OSI_POINT_CALC_STEPSIZE,
-                                                                                      SE_Env::Inst().GetOSIMaxLongitudinalDistance(),
-                                                                                      OSI_POINT_DIST_SCALE,
-                                                                                      OSI_POINT_DIST_SCALE,
-                                                                                      osi_requirement);
-                                            }
-
-                                            if (pos_candidate.GetS() + SMALL_NUMBER >
-                                                    s_end_roadmark - SMALL_NUMBER ||  // end of the lane reached, assign as final OSI point
-                                                osi_requirement && pos_candidate.GetS() - pos_pivot.GetS() > max_segment_length - SMALL_NUMBER ||
-                                                abs(step) < min_segment_length + SMALL_NUMBER)
-                                            {
-                                                p = {pos_candidate.GetS(),
-                                                     pos_candidate.GetX(),
-                                                     pos_candidate.GetY(),
-                                                     pos_candidate.GetZ(),
-                                                     pos_candidate.GetHRoad()};
-                                                osi_point.push_back(p);
-                                                insert = false;
-
-                                                if (pos_candidate.GetS() + SMALL_NUMBER > s_end_roadmark - SMALL_NUMBER)
-                                                {
-                                                    break;
-                                                }
-
-                                                // If last step length was small, guess next one will also be small to reduce search
-                                                step = MIN(OSI_POINT_CALC_STEPSIZE, 2.0 * (pos_candidate.GetS() - pos_pivot.GetS()));
-
-                                                pos_pivot = pos_candidate;
-
-                                                // reuse candidate x-y collectors for pivot position
-                                                x0 = x1;
-                                                y0 = y1;
-                                            }
-                                            else
-                                            {
-                                                if (osi_requirement == false)
-                                                {
-                                                    insert = true;              // indicate that a point needs to be inserted
-                                                    step   = -abs(step) / 2.0;  // look backwards half current stepsize
-                                                }
-                                                else if (insert)
-                                                {
-                                                    step = abs(step) / 2.0;  // look forward half current stepsize
-                                                }
-                                            }
-                                            // Clear x-y collectors for next iteration
-                                            x1.clear();
-                                            y1.clear();
-                                        }
+                                                pos_candidate.SetRoadMarkPos(road->GetId(), lane->GetId(), m, 0, n, s, 0, j);
+                                                p = {s, pos_candidate.GetX(), pos_candidate.GetY(), pos_candidate.GetZ(), pos_candidate.GetHRoad()};
+                                            },
+                                            osi_point);
                                     }
 
                                     // Set all collected osi points for the current lane rpadmarkline
@@ -6667,9 +7071,25 @@ bool OpenDrive::SetRoadOSI()
 {
     if (this == Position::GetOpenDrive())
     {
-        SetLaneOSIPoints();
-        SetRoadMarkOSIPoints();
-        SetLaneBoundaryPoints();
+        // Roads are independent, only lane boundary ids need to be assigned in road order
+        int                                        n_roads = GetNumOfRoads();
+        std::vector<std::vector<DeferredGlobalId>> global_ids(road_.size());
+
+        RunParallel(n_roads,
+                    GetNumberOfLoadThreads(n_roads),
+                    [&](int i)
+                    {
+                        DeferGlobalIds defer_ids(&global_ids[i]);
+                        SetLaneOSIPoints(i);
+                        SetRoadMarkOSIPoints(i);
+                        SetLaneBoundaryPoints(i);
+                        SetRoadProfile(i);
+                    });
+
+        for (const std::vector<DeferredGlobalId>& ids : global_ids)
+        {
+            AssignDeferredGlobalIds(ids);
+        }
         return true;
     }
 
@@ -7403,6 +7823,10 @@ Position::ReturnCode Position::XYZH2TrackPos(double x3, double y3, double z3, do
         }
     }
 
+    // World coordinates are needed below, temporarily disable any deferred evaluation
+    bool defer_world_pos = defer_world_pos_;
+    defer_world_pos_     = false;
+
     // Set position exact on center line
     ReturnCode retvalue = SetTrackPos(roadMin->GetId(), closestS, 0, true);
 
@@ -7452,6 +7876,8 @@ Position::ReturnCode Position::XYZH2TrackPos(double x3, double y3, double z3, do
         CalcRoutePosition();
     }
 
+    defer_world_pos_ = defer_world_pos;
+
     return retvalue;
 }
 
@@ -7509,12 +7935,15 @@ Position::ReturnCode Position::Track2XYZ()
     }
 
     geometry->EvaluateDS(s_ - geometry->GetS(), &x_, &y_, &h_road_);
+    world_pos_stale_ = false;
 
     // Consider lateral t position, perpendicular to track heading
-    double x_local = (t_ + road->GetLaneOffset(s_)) * cos(h_road_ + M_PI_2);
-    double y_local = (t_ + road->GetLaneOffset(s_)) * sin(h_road_ + M_PI_2);
+    LaneOffset* lane_offset   = GetLaneOffsetRecord(road);
+    double      t_lane_offset = lane_offset ? lane_offset->GetLaneOffset(s_) : 0.0;
+    double      x_local       = (t_ + t_lane_offset) * cos(h_road_ + M_PI_2);
+    double      y_local       = (t_ + t_lane_offset) * sin(h_road_ + M_PI_2);
 
-    h_road_ += atan(road->GetLaneOffsetPrim(s_)) + h_offset_;
+    h_road_ += atan(lane_offset ? lane_offset->GetLaneOffsetPrim(s_) : 0.0) + h_offset_;
     h_road_ = GetAngleInInterval2PI(h_road_);
 
     x_ += x_local;
@@ -7528,6 +7957,178 @@ Position::ReturnCode Position::Track2XYZ()
     return ReturnCode::OK;
 }
 
+bool Position::UpdateLaneWidthCache(LaneSection* lane_section)
+{
+    LaneWidthCache& cache = lane_width_cache_;
+
+    if (cache.generation == g_road_network_generation && cache.lane_section == lane_section && cache.lane_id == lane_id_ &&
+        s_ >= cache.s_min && (s_ < cache.s_max || (cache.s_max_closed && s_ <= cache.s_max)))
+    {
+        return true;
+    }
+
+    // Outside lane section the width functions clamp s, leave those cases to the lane section
+    double s_lsec = lane_section->GetS();
+    if (lane_id_ == 0 || s_ < s_lsec || s_ > s_lsec + lane_section->GetLength())
+    {
+        return false;
+    }
+
+    cache.s_min        = s_lsec;
+    cache.s_max        = s_lsec + lane_section->GetLength();
+    cache.s_max_closed = true;
+    cache.s_origin     = s_;
+
+    // Sum up the active width polynomial of each lane from current lane to the reference lane
+    double coeff[4]  = {0.0, 0.0, 0.0, 0.0};
+    int    n_varying = 0;
+    int    step      = lane_id_ < 0 ? +1 : -1;
+    cache.width.Set(0.0, 0.0, 0.0, 0.0);
+
+    for (int lane_id = lane_id_; lane_id != 0; lane_id += step)
+    {
+        Lane* lane = lane_section->GetLaneById(lane_id);
+        if (lane == nullptr || lane->GetNumberOfLaneWidths() == 0)
+        {
+            continue;
+        }
+
+        // Find active record, same way as Lane::GetWidthByS()
+        int n_widths = lane->GetNumberOfLaneWidths();
+        int idx      = 0;
+        while (idx + 1 < n_widths && s_ - s_lsec >= lane->GetWidthByIndex(idx + 1)->GetSOffset())
+        {
+            idx++;
+        }
+        LaneWidth* lane_width = lane->GetWidthByIndex(idx);
+
+        if (idx > 0)
+        {
+            cache.s_min = MAX(cache.s_min, s_lsec + lane_width->GetSOffset());
+        }
+        if (idx + 1 < n_widths && s_lsec + lane->GetWidthByIndex(idx + 1)->GetSOffset() <= cache.s_max)
+        {
+            cache.s_max        = s_lsec + lane->GetWidthByIndex(idx + 1)->GetSOffset();
+            cache.s_max_closed = false;
+        }
+
+        // Express polynomial in s - s_origin
+        Polynomial& poly  = lane_width->poly3_;
+        double      ds    = s_ - (s_lsec + lane_width->GetSOffset());
+        double      scale = poly.GetPscale();
+        double      a     = poly.Evaluate(ds);
+        double      b     = scale * poly.EvaluatePrim(ds);
+        double      c     = scale * scale * poly.EvaluatePrimPrim(ds) / 2.0;
+        double      d     = scale * scale * scale * poly.GetD();
+
+        coeff[0] += a;
+        coeff[1] += b;
+        coeff[2] += c;
+        coeff[3] += d;
+
+        if (lane_id == lane_id_)
+        {
+            cache.width.Set(a, b, c, d);
+        }
+
+        if (!NEAR_ZERO(poly.GetB()) || !NEAR_ZERO(poly.GetC()) || !NEAR_ZERO(poly.GetD()))
+        {
+            n_varying++;
+        }
+    }
+
+    cache.outer_offset.Set(coeff[0], coeff[1], coeff[2], coeff[3]);
+    cache.single_slope = n_varying < 2;
+    cache.generation   = g_road_network_generation;
+    cache.lane_section = lane_section;
+    cache.lane_id      = lane_id_;
+
+    return true;
+}
+
+double Position::GetLaneWidthOffset(LaneSection* lane_section, bool center, double& heading)
+{
+    if (!UpdateLaneWidthCache(lane_section))
+    {
+        if (center)
+        {
+            heading = lane_section->GetCenterOffsetHeading(s_, lane_id_);
+            return lane_section->GetCenterOffset(s_, lane_id_);
+        }
+        heading = lane_section->GetOuterOffsetHeading(s_, lane_id_);
+        return lane_section->GetOuterOffset(s_, lane_id_);
+    }
+
+    double ds           = s_ - lane_width_cache_.s_origin;
+    double outer_offset = lane_width_cache_.outer_offset.Evaluate(ds);
+
+    // Headings are summed per lane, atan(w1') + atan(w2') + ... Only when at most one lane width varies, this
+    // equals atan(w1' + w2' + ...), i.e. can be derived from the summed polynomial
+    if (center)
+    {
+        if (lane_width_cache_.single_slope)
+        {
+            double outer_prim = lane_width_cache_.outer_offset.EvaluatePrim(ds);
+            double inner_prim = outer_prim - lane_width_cache_.width.EvaluatePrim(ds);
+            heading           = atan((inner_prim + outer_prim) / 2.0);
+        }
+        else
+        {
+            heading = lane_section->GetCenterOffsetHeading(s_, lane_id_);
+        }
+        return outer_offset - lane_width_cache_.width.Evaluate(ds) / 2;
+    }
+
+    if (lane_width_cache_.single_slope)
+    {
+        heading = atan(lane_width_cache_.outer_offset.EvaluatePrim(ds));
+    }
+    else
+    {
+        heading = lane_section->GetOuterOffsetHeading(s_, lane_id_);
+    }
+    return outer_offset;
+}
+
+LaneOffset* Position::GetLaneOffsetRecord(Road* road)
+{
+    LaneOffsetCache& cache = lane_offset_cache_;
+
+    if (cache.generation == g_road_network_generation && cache.road == road && s_ >= cache.s_min && s_ < cache.s_max)
+    {
+        return cache.lane_offset;
+    }
+
+    // Find active record, same way as Road::GetLaneOffset()
+    int n_offsets     = road->GetNumberOfLaneOffsets();
+    int idx           = 0;
+    cache.lane_offset = nullptr;
+    cache.s_min       = -LARGE_NUMBER;
+    cache.s_max       = LARGE_NUMBER;
+
+    if (n_offsets > 0)
+    {
+        while (idx + 1 < n_offsets && s_ >= road->GetLaneOffsetByIdx(idx + 1)->GetS())
+        {
+            idx++;
+        }
+        cache.lane_offset = road->GetLaneOffsetByIdx(idx);
+        if (idx > 0)
+        {
+            cache.s_min = cache.lane_offset->GetS();
+        }
+        if (idx + 1 < n_offsets)
+        {
+            cache.s_max = road->GetLaneOffsetByIdx(idx + 1)->GetS();
+        }
+    }
+
+    cache.generation = g_road_network_generation;
+    cache.road       = road;
+
+    return cache.lane_offset;
+}
+
 void Position::LaneBoundary2Track()
 {
     Road* road = GetOpenDrive()->GetRoadByIdx(track_idx_);
@@ -7539,8 +8140,9 @@ void Position::LaneBoundary2Track()
 
         if (lane_section != 0 && lane_id_ != 0)
         {
-            t_        = offset_ + lane_section->GetOuterOffset(s_, lane_id_) * (lane_id_ < 0 ? -1 : 1);
-            h_offset_ = lane_section->GetOuterOffsetHeading(s_, lane_id_) * (lane_id_ < 0 ? -1 : 1);
+            double heading = 0.0;
+            t_             = offset_ + GetLaneWidthOffset(lane_section, false, heading) * (lane_id_ < 0 ? -1 : 1);
+            h_offset_      = heading * (lane_id_ < 0 ? -1 : 1);
         }
     }
 }
@@ -7556,8 +8158,9 @@ void Position::Lane2Track()
 
         if (lane_section != 0)
         {
-            t_        = offset_ + lane_section->GetCenterOffset(s_, lane_id_) * (lane_id_ < 0 ? -1 : 1);
-            h_offset_ = lane_section->GetCenterOffsetHeading(s_, lane_id_) * (lane_id_ < 0 ? -1 : 1);
+            double heading = 0.0;
+            t_             = offset_ + GetLaneWidthOffset(lane_section, true, heading) * (lane_id_ < 0 ? -1 : 1);
+            h_offset_      = heading * (lane_id_ < 0 ? -1 : 1);
         }
     }
 }
@@ -7573,8 +8176,9 @@ void Position::RoadMark2Track()
 
         if (lane_section != 0 && lane_id_ != 0)
         {
-            t_        = offset_ + lane_section->GetOuterOffset(s_, lane_id_) * (lane_id_ < 0 ? -1 : 1);
-            h_offset_ = lane_section->GetOuterOffsetHeading(s_, lane_id_) * (lane_id_ < 0 ? -1 : 1);
+            double heading = 0.0;
+            t_             = offset_ + GetLaneWidthOffset(lane_section, false, heading) * (lane_id_ < 0 ? -1 : 1);
+            h_offset_      = heading * (lane_id_ < 0 ? -1 : 1);
         }
 
         Lane*                 lane                  = lane_section->GetLaneByIdx(lane_idx_);
@@ -8100,6 +8704,7 @@ double Position::DistanceToDS(double ds)
         if (curvature * offset > 1.0 - SMALL_NUMBER)
         {
             // Radius not large enough for offset, probably being closer to another road segment
+            EvaluateWorldPos();
             XYZH2TrackPos(GetX(), GetY(), GetY(), GetH(), true);
             SetHeadingRelative(GetHRelative());
             curvature = GetCurvature();
@@ -8136,6 +8741,9 @@ Position::ReturnCode Position::MoveAlongS(double ds, double dLaneOffset, double
         // Then move laterally
         pos.SetLanePos(pos.track_id_, pos.lane_id_ + this->lane_id_, pos.s_, pos.offset_ + this->offset_);
 
+        // World coordinates are copied directly, make sure they are evaluated
+        pos.EvaluateWorldPos();
+
         this->x_ = pos.x_;
         this->y_ = pos.y_;
         this->z_ = pos.z_;
@@ -8352,11 +8960,39 @@ Position::ReturnCode Position::SetLanePos(int track_id, int lane_id, double s, d
     }
 
     Lane2Track();
-    Track2XYZ();
+
+    if (defer_world_pos_)
+    {
+        world_pos_stale_ = true;
+    }
+    else
+    {
+        Track2XYZ();
+    }
 
     return retvalue;
 }
 
+void Position::SetDeferWorldPos(bool mode)
+{
+    defer_world_pos_ = mode;
+
+    if (!defer_world_pos_)
+    {
+        EvaluateWorldPos();
+    }
+}
+
+Position::ReturnCode Position::EvaluateWorldPos()
+{
+    if (!world_pos_stale_)
+    {
+        return ReturnCode::OK;
+    }
+
+    return Track2XYZ();
+}
+
 void Position::SetLaneBoundaryPos(int track_id, int lane_id, double s, double offset, int lane_section_idx)
 {
     offset_                 = offset;
@@ -8580,6 +9216,8 @@ int Position::SetInertiaPos(double x, double y, double z, double h, double p, do
     y_ = std::isnan(y) ? 0.0 : y;
     z_ = std::isnan(z) ? 0.0 : z;
 
+    world_pos_stale_ = false;
+
     if (updateTrackPos)
     {
         XYZ2Track();
@@ -8636,6 +9274,8 @@ int Position::SetInertiaPos(double x, double y, double h, bool updateTrackPos)
     x_ = x;
     y_ = y;
 
+    world_pos_stale_ = false;
+
     if (updateTrackPos)
     {
         XYZ2Track();
@@ -8659,6 +9299,38 @@ int Position::SetInertiaPos(double x, double y, double h, bool updateTrackPos)
     return 0;
 }
 
+int Position::SetInertiaPosLocal(double x, double y, double h)
+{
+    x_ = x;
+    y_ = y;
+
+    world_pos_stale_ = false;
+
+    Road* road = GetOpenDrive()->GetRoadByIdx(track_idx_);
+    if (road == nullptr || static_cast<int>(XYZH2TrackPos(x_, y_, z_, h, false, road->GetId())) < 0 ||
+        (status_ & static_cast<int>(PositionStatusMode::POS_STATUS_END_OF_ROAD)) || s_ < SMALL_NUMBER ||
+        s_ > road->GetLength() - SMALL_NUMBER || IsOffRoad())
+    {
+        // not within current road, search all roads
+        XYZH2TrackPos(x_, y_, z_, h);
+    }
+
+    SetHeading(h);
+
+    EvaluateOrientation();
+
+    if (align_z_ == ALIGN_MODE::ALIGN_SOFT)
+    {
+        SetZRelative(z_relative_);
+    }
+    else if (align_z_ == ALIGN_MODE::ALIGN_HARD)
+    {
+        SetZ(z_road_);
+    }
+
+    return 0;
+}
+
 void Position::SetHeading(double heading)
 {
     h_          = heading;
@@ -10057,6 +10729,7 @@ Position::ReturnCode Position::MoveRouteDS(double ds, bool actualDistance)
         else if (entity_road2->GetJunction() > -1 || route_road2->GetJunction() > -1)
         {
             // Entity and route position not both in junction. Enforce synchronization.
+            EvaluateWorldPos();
             XYZH2TrackPos(GetX(), GetY(), GetZ(), GetH(), false, route_->GetTrackId(), false);
         }
     }
@@ -18,10 +18,12 @@
 #include <map>
 #include <vector>
 #include <list>
+#include <tuple>
 #include "pugixml.hpp"
 #include "CommonMini.hpp"
 
-#define PARAMPOLY3_STEPS 100
+#define PARAMPOLY3_STEPS        100
+#define LOOKAHEAD_S_BUCKET_SIZE 5.0  // (m) range of s values sharing a cached look-ahead path
 
 namespace roadmanager
 {
@@ -95,6 +97,22 @@ namespace roadmanager
         double h;
     } PointStruct;
 
+    typedef struct
+    {
+        double s;
+        double x;          // reference line, including lane offset
+        double y;
+        double h;          // heading of the reference line geometry
+        double curvature;  // curvature of the reference line geometry
+    } RoadProfilePoint;
+
+    typedef struct
+    {
+        int    profile_idx;  // index of corresponding point in the road profile
+        double x[3];         // 0: left border, 1: lane center, 2: right border, as seen in road s direction
+        double y[3];
+    } LaneProfilePoint;
+
     class OSIPoints
     {
     public:
@@ -811,6 +829,8 @@ namespace roadmanager
         double     length_;
     };
 
+    class LaneSection;
+
     class Lane
     {
     public:
@@ -932,6 +952,21 @@ namespace roadmanager
         {
             return &osi_points_;
         }
+
+        /**
+        Get lane profile, center and border points of the lane at each road profile point within the lane section
+        The table is established at load time for driving lanes, see OpenDrive::SetRoadProfile()
+        It serves as tangent point table for look-ahead, e.g. by the Looming controller
+        @return Reference to the lane profile, empty for non driving lanes
+        */
+        const std::vector<LaneProfilePoint> &GetProfile() const
+        {
+            return profile_;
+        }
+        void SetProfile(std::vector<LaneProfilePoint> profile)
+        {
+            profile_ = std::move(profile);
+        }
         std::vector<int> GetLineGlobalIds() const;
         LaneBoundaryOSI *GetLaneBoundary() const
         {
@@ -971,16 +1006,17 @@ namespace roadmanager
         }
 
     private:
-        int                         id_;               // center = 0, left > 0, right < 0
-        int                         global_id_;        // Unique ID for OSI
-        int                         osiintersection_;  // flag to see if the lane is part of an osi-lane section or not
-        LaneType                    type_;
-        int                         level_;  // boolean, true = keep lane on level
-        std::vector<LaneLink *>     link_;
-        std::vector<LaneWidth *>    lane_width_;
-        std::vector<LaneRoadMark *> lane_roadMark_;
-        LaneBoundaryOSI            *lane_boundary_;
-        bool                        road_edge_;  // indicates whether this is edge of the paved road (used for OSI ROAD_EDGE)
+        int                           id_;               // center = 0, left > 0, right < 0
+        int                           global_id_;        // Unique ID for OSI
+        int                           osiintersection_;  // flag to see if the lane is part of an osi-lane section or not
+        LaneType                      type_;
+        int                           level_;  // boolean, true = keep lane on level
+        std::vector<LaneLink *>       link_;
+        std::vector<LaneWidth *>      lane_width_;
+        std::vector<LaneRoadMark *>   lane_roadMark_;
+        LaneBoundaryOSI              *lane_boundary_;
+        bool                          road_edge_;  // indicates whether this is edge of the paved road (used for OSI ROAD_EDGE)
+        std::vector<LaneProfilePoint> profile_;
     };
 
     class LaneSection
@@ -2152,6 +2188,14 @@ namespace roadmanager
         {
             return (int)super_elevation_profile_.size();
         }
+        int GetNumberOfLaneOffsets() const
+        {
+            return (int)lane_offset_.size();
+        }
+        LaneOffset *GetLaneOffsetByIdx(int idx) const
+        {
+            return (idx >= 0 && idx < (int)lane_offset_.size()) ? lane_offset_[idx] : nullptr;
+        }
         double GetLaneOffset(double s) const;
         double GetLaneOffsetPrim(double s) const;
         int    GetNumberOfLanes(double s) const;
@@ -2216,6 +2260,22 @@ namespace roadmanager
         */
         double GetWidth(double s, int side, int laneTypeMask = Lane::LaneType::LANE_TYPE_ANY) const;  // side: -1=right, 1=left, 0=both
 
+        /**
+                Get road profile, reference line position, heading and curvature sampled along the road
+                Each lane section is sampled at even distance, not exceeding the look-ahead resolution
+                (see SE_Env::SetLookAheadResolution()). Points are shared by neighbor lane sections at their
+                border and the last point is at the end of the road. Established at load time.
+                @return Reference to the road profile
+        */
+        const std::vector<RoadProfilePoint> &GetProfile() const
+        {
+            return profile_;
+        }
+        void SetProfile(std::vector<RoadProfilePoint> profile)
+        {
+            profile_ = std::move(profile);
+        }
+
     protected:
         int         id_;
         std::string name_;
@@ -2232,6 +2292,8 @@ namespace roadmanager
         std::vector<LaneOffset *>    lane_offset_;
         std::vector<Signal *>        signal_;
         std::vector<RMObject *>      object_;
+
+        std::vector<RoadProfilePoint> profile_;
     };
 
     class LaneRoadLaneConnection
@@ -2493,6 +2555,148 @@ namespace roadmanager
         int         towgs84_;
     } GeoReference;
 
+    /**
+            Registry of dynamic signal (e.g. traffic light) states
+            Each state change is stamped with a new value of a global version counter, so that
+            consumers can pick up only the signals changed since their previous visit. The counter
+            is never reset, not even by Clear(), so a version from a previous visit stays valid.
+            States are set explicitly (e.g. by actions) or by phase schedules, established from
+            traffic signal controllers and evaluated by Update()
+    */
+    class SignalStateRegistry
+    {
+    public:
+        typedef struct
+        {
+            std::string  state;
+            unsigned int version;  // value of global version counter at latest change
+        } SignalState;
+
+        typedef struct
+        {
+            std::string                              name;
+            double                                   duration;
+            std::vector<std::pair<int, std::string>> states;  // signal id and state
+        } Phase;
+
+        SignalStateRegistry() : version_(0), clear_version_(0)
+        {
+        }
+
+        /**
+                Set state of a signal. Version is only updated if state differs from current one.
+                @param signal_id Id of the signal as specified in the OpenDRIVE file
+                @param state State string, e.g. "off;off;on"
+                @return true if state changed, else false
+        */
+        bool SetState(int signal_id, const std::string &state);
+
+        /**
+                Get current state of a signal
+                @param signal_id Id of the signal as specified in the OpenDRIVE file
+                @return Pointer to state entry, nullptr if no state has been registered for the signal
+        */
+        const SignalState *GetState(int signal_id) const;
+
+        /**
+                Collect ids of signals changed after given version
+                @param version Version from previous visit, 0 will return all signals (key frame). So will any
+                version preceding latest Clear(), since the states it refers to are gone.
+                @param ids Vector receiving the signal ids, in order of change
+        */
+        void GetChangedSignals(unsigned int version, std::vector<int> &ids) const;
+
+        /**
+                Get current value of the global version counter
+        */
+        unsigned int GetVersion() const
+        {
+            return version_;
+        }
+
+        int GetNumberOfSignals() const
+        {
+            return static_cast<int>(states_.size());
+        }
+
+        /**
+                Add a cyclic phase schedule, e.g. from an OpenSCENARIO TrafficSignalController
+                @param name Name of the schedule
+                @param delay Time before the first phase starts
+                @param phases Phases in order of execution
+                @return 0 if successful, -1 if the schedule is empty or has no duration
+        */
+        int AddPhaseSchedule(const std::string &name, double delay, const std::vector<Phase> &phases);
+
+        /**
+                Apply phase schedules for given time. Signal states are only set when a schedule enters a new phase.
+                @param time Simulation time
+        */
+        void Update(double time);
+
+        /**
+                Remove all states and schedules. The version counter is stepped, not reset.
+        */
+        void Clear();
+
+    private:
+        typedef struct
+        {
+            std::string         name;
+            double              delay;
+            double              cycle_time;
+            std::vector<Phase>  phases;
+            std::vector<double> phase_start;  // start time of each phase within the cycle
+            int                 current_phase;
+        } PhaseSchedule;
+
+        std::map<int, SignalState>                states_;
+        std::vector<std::pair<unsigned int, int>> change_log_;  // version and signal id, ordered by version
+        std::vector<PhaseSchedule>                schedules_;
+        unsigned int                              version_;
+        unsigned int                              clear_version_;  // version at latest Clear()
+    };
+
+    /**
+            Look-ahead along a lane in driving direction, collected from the lane profiles of the lane and
+            the lanes linked to it on following lane sections and roads. The path stops at a junction, at a
+            missing link or a non driving lane, or when the requested length has been covered.
+    */
+    class LookAheadPath
+    {
+    public:
+        typedef struct
+        {
+            double ds;    // distance along s from start of path
+            double x[3];  // 0: left border, 1: lane center, 2: right border, as seen in driving direction
+            double y[3];
+        } Point;
+
+        std::vector<Point> points;
+        double             s_start    = 0.0;    // s value of start of path, on the first road
+        double             max_length = 0.0;    // length requested when the path was collected
+        bool               junction   = false;  // path stopped at a junction
+        unsigned int       frame      = 0;      // cache frame when the path was last used
+
+        /**
+                Get length of the path
+        */
+        double GetLength() const
+        {
+            return points.empty() ? 0.0 : points.back().ds;
+        }
+
+        /**
+                Get position at given distance along the path, interpolated between profile points
+                @param ds Distance from start of path
+                @param idx 0: left border, 1: lane center, 2: right border, as seen in driving direction
+                @param x Resulting x coordinate
+                @param y Resulting y coordinate
+                @return true if the distance is within the path, else false
+        */
+        bool GetPos(double ds, int idx, double &x, double &y) const;
+    };
+
     class OpenDrive
     {
     public:
@@ -2527,17 +2731,61 @@ namespace roadmanager
 
         /**
                 Setting information based on the OSI standards for OpenDrive elements
+                Roads are processed in parallel, global ids are still assigned in road order
         */
         bool SetRoadOSI();
         bool CheckLaneOSIRequirement(std::vector<double> x0, std::vector<double> y0, std::vector<double> x1, std::vector<double> y1) const;
-        void SetLaneOSIPoints();
-        void SetRoadMarkOSIPoints();
+
+        /**
+                Create OSI points along lanes and road marks
+                Points are spaced adaptively, within tolerances given by SE_Env::GetOSIMaxLateralDeviation()
+                and SE_Env::GetOSIMaxLongitudinalDistance()
+                @param road_idx Index of road to process, -1 for all roads
+        */
+        void SetLaneOSIPoints(int road_idx = -1);
+        void SetRoadMarkOSIPoints(int road_idx = -1);
 
         /**
                 Checks all lanes - if a lane has RoadMarks it does nothing. If a lane does not have roadmarks
                 then it creates a LaneBoundary following the lane border (left border for left lanes, right border for right lanes)
+                @param road_idx Index of road to process, -1 for all roads
         */
-        void SetLaneBoundaryPoints();
+        void SetLaneBoundaryPoints(int road_idx = -1);
+
+        /**
+                Create road profile and lane profiles of driving lanes, see Road::GetProfile() and Lane::GetProfile()
+                Points are spaced evenly within each lane section, at most SE_Env::GetLookAheadResolution() apart
+                @param road_idx Index of road to process, -1 for all roads
+        */
+        void SetRoadProfile(int road_idx = -1);
+
+        /**
+                Get look-ahead path along a lane, starting from the s-bucket containing given s value. Paths are
+                cached and shared by all queries for same road, lane section, lane, s-bucket and direction, as long
+                as used every frame, see PruneLookAheadCache().
+                @param road_idx Road index
+                @param lsec_idx Lane section index
+                @param lane_id Lane id
+                @param s Position along the road
+                @param direction 1: along road s direction, -1: opposite direction
+                @param length Minimum look-ahead distance from s, unless the path stops earlier
+                @return Reference to the path, valid until the cache is cleared
+        */
+        const LookAheadPath &GetLookAheadPath(int road_idx, int lsec_idx, int lane_id, double s, int direction, double length);
+
+        /**
+                Remove look-ahead paths not used since previous call, and start a new cache frame
+                Call once per frame to limit the cache to paths in use
+        */
+        void PruneLookAheadCache();
+
+        /**
+                Clear the look-ahead path cache
+        */
+        void ClearLookAheadCache()
+        {
+            lookahead_cache_.clear();
+        }
 
         /**
                 Retrieve a road segment specified by road ID
@@ -2573,6 +2821,42 @@ namespace roadmanager
         bool IsIndirectlyConnected(int road1_id, int road2_id, int *&connecting_road_id, int *&connecting_lane_id, int lane1_id = 0, int lane2_id = 0)
             const;
 
+        typedef struct
+        {
+            ContactPointType contact_point;
+            bool             any_lane;    // direct road link, connected regardless of lane
+            std::vector<int> from_lanes;  // lanes of incoming road linked by junction connection
+        } DirectLink;
+
+        typedef enum
+        {
+            INDIRECT_ROAD_LINK,        // road link, followed by INDIRECT_ROAD_LANE entries
+            INDIRECT_ROAD_LANE,        // lane pair of preceding road link
+            INDIRECT_CONNECTION_LANE,  // junction lane link into connecting road
+            INDIRECT_CONNECTING_ROAD   // lane pair connected through junction connecting road
+        } IndirectLinkType;
+
+        typedef struct
+        {
+            IndirectLinkType type;
+            int              lane1_id;
+            int              lane2_id;
+            int              connecting_road_id;
+            int              connecting_lane_id;
+        } IndirectLink;
+
+        /**
+                Build lookup tables of road connectivity, used by IsIndirectlyConnected() and Road::IsDirectlyConnected().
+                Called when loading OpenDRIVE file. Call again if roads or junctions are modified afterwards.
+        */
+        void BuildConnectivityTables();
+
+        /**
+                Get junction connections or road link from road1 to road2 at given end of road1
+                @return Connections in order of junction definition, nullptr if not connected
+        */
+        const std::vector<DirectLink> *GetDirectLinks(int road1_id, int road2_id, LinkType link_type) const;
+
         /**
                 Add any missing connections so that road connectivity is two-ways
                 Look at all road connections, and make sure they are defined both ways
@@ -2626,6 +2910,34 @@ namespace roadmanager
             return versionMinor_;
         }
 
+        SignalStateRegistry &GetSignalStateRegistry()
+        {
+            return signal_states_;
+        }
+
+        typedef struct
+        {
+            int    n_threads;          // number of threads used for parallel stages
+            double xml_parse;          // read file into XML DOM
+            double road_parse;         // geometries, lanes and road marks, parallel per road
+            double road_registration;  // roads added in file order and global ids assigned
+            double road_features;      // signals and objects, parallel per road
+            double junction_parse;     // controllers and junctions
+            double link_resolution;    // connection checks and connectivity tables
+            double validation;         // OSI points and lane boundaries, parallel per road
+            double total;
+        } LoadProfile;
+
+        /**
+                Get duration (s) of each stage of latest LoadOpenDriveFile() call
+        */
+        const LoadProfile &GetLoadProfile() const
+        {
+            return load_profile_;
+        }
+
+        void PrintLoadProfile() const;
+
         void Print() const;
 
     private:
@@ -2639,6 +2951,36 @@ namespace roadmanager
         SpeedUnit                          speed_unit_;  // First specified speed unit. MS is default. Undefined if no speed entries.
         int                                versionMajor_;
         int                                versionMinor_;
+        SignalStateRegistry                signal_states_;
+        LoadProfile                        load_profile_ = {};
+
+        // Look-ahead paths, key is road index, lane section index, lane id, s-bucket and direction
+        std::map<std::tuple<int, int, int, int, int>, LookAheadPath> lookahead_cache_;
+        unsigned int                                                  lookahead_frame_ = 0;
+
+        void BuildLookAheadPath(LookAheadPath &path, int road_idx, int lsec_idx, int lane_id, int direction, double length) const;
+
+        // Connectivity lookup tables, key is combined road ids
+        std::unordered_map<unsigned long long, std::vector<DirectLink>>   direct_links_[2];  // successor and predecessor links
+        std::unordered_map<unsigned long long, std::vector<IndirectLink>> indirect_links_;
+
+        static unsigned long long RoadPairKey(int road1_id, int road2_id)
+        {
+            return (static_cast<unsigned long long>(static_cast<unsigned int>(road1_id)) << 32) | static_cast<unsigned int>(road2_id);
+        }
+
+        /**
+                Parse road header, geometries, elevations, lanes and road marks. Does not access other roads, may run in parallel.
+                @param preliminary_id Id to use if not specified in the file
+                @param speed_unit Set to first specified speed unit, unless already defined
+                @return The new road, not yet added to the road network
+        */
+        Road *ParseRoad(pugi::xml_node road_node, int preliminary_id, SpeedUnit &speed_unit);
+
+        /**
+                Parse signals and objects of a road. The road must have been added, since features are positioned on it.
+        */
+        void ParseRoadSignalsAndObjects(Road *r, pugi::xml_node road_node);
     };
 
     typedef struct
@@ -2823,7 +3165,18 @@ namespace roadmanager
         @param updateTrackPos True: road position will be calculated False: don't update road position
         @return Non zero return value indicates error of some kind
         */
-        int  SetInertiaPos(double x, double y, double h, bool updateTrackPos = true);
+        int SetInertiaPos(double x, double y, double h, bool updateTrackPos = true);
+
+        /**
+        Specify position by cartesian x, y and heading, expected to be close to current position, e.g. a trailer following its
+        tow vehicle. Road position is first resolved on current road only. Only if the new position falls outside current road a
+        full search over all roads is performed. z, pitch and roll will be aligned to road.
+        @param x x
+        @param y y
+        @param h heading
+        @return Non zero return value indicates error of some kind
+        */
+        int  SetInertiaPosLocal(double x, double y, double h);
         void SetHeading(double heading);
         void SetHeadingRelative(double heading);
         void SetHeadingRelativeRoadDirection(double heading);
@@ -3077,6 +3430,24 @@ namespace roadmanager
         */
         int GetTrackId() const;
 
+        /**
+        Retrieve the index of current road, as in OpenDrive::GetRoadByIdx()
+        @return road index, -1 if not on any road
+        */
+        int GetTrackIdx() const
+        {
+            return track_idx_;
+        }
+
+        /**
+        Retrieve the index of current lane section within the road
+        @return lane section index
+        */
+        int GetLaneSectionIdx() const
+        {
+            return lane_section_idx_;
+        }
+
         /**
         Retrieve the junction ID from the position object
         @return junction ID, -1 if not in a junction
@@ -3555,6 +3926,38 @@ namespace roadmanager
             lockOnLane_ = mode;
         }
 
+        /**
+                Controls whether world coordinates (x, y, z, h, p, r) are evaluated immediately when lane position is
+                updated (default) or deferred. In deferred mode SetLanePos, and hence MoveAlongS, only updates road
+                coordinates and marks world coordinates as stale. Useful when several road moves are done in sequence,
+                e.g. within an action step, to evaluate world coordinates only once for the final position.
+                World coordinate getters, e.g. GetX() or GetH(), return the previous values until world coordinates are
+                evaluated by EvaluateWorldPos() or by leaving deferred mode. Relative heading, pitch and roll can be set
+                while deferred, since orientation is evaluated along with the world coordinates.
+                @parameter mode True=defer evaluation False=evaluate immediately (default)
+        */
+        void SetDeferWorldPos(bool mode);
+
+        bool GetDeferWorldPos() const
+        {
+            return defer_world_pos_;
+        }
+
+        /**
+                Check whether world coordinates are out of date due to deferred evaluation
+                @return true if world coordinates need to be evaluated
+        */
+        bool IsWorldPosStale() const
+        {
+            return world_pos_stale_;
+        }
+
+        /**
+                Evaluate world coordinates from road coordinates, if stale due to deferred evaluation
+                @return 0 if successful or nothing to do, other codes see Position::ReturnCode
+        */
+        ReturnCode EvaluateWorldPos();
+
         int GetOrientationSetMask() const
         {
             return orientationSetMask;
@@ -3604,9 +4007,36 @@ namespace roadmanager
         ReturnCode SetLongitudinalTrackPos(int track_id, double s);
         bool       EvaluateRoadZPitchRoll();
 
+        /**
+                Make sure lane width cache is valid for current lane and s value
+                @param lane_section Current lane section
+                @return true if cache is valid, false if it is not applicable, e.g. for reference lane or s outside lane section
+        */
+        bool UpdateLaneWidthCache(LaneSection *lane_section);
+
+        /**
+                Get lateral offset of current lane from the reference lane, any lane offset excluded
+                @param lane_section Current lane section
+                @param center true for center of lane, false for outer border of lane
+                @param heading Returns heading of the lane center or border relative road reference line
+                @return Absolute lateral offset
+        */
+        double GetLaneWidthOffset(LaneSection *lane_section, bool center, double &heading);
+
+        /**
+                Get lane offset record of road at current s, cached for subsequent calls
+                @param road Current road
+                @return Lane offset record, nullptr if road has no lane offset
+        */
+        LaneOffset *GetLaneOffsetRecord(Road *road);
+
         // Control lane belonging
         bool lockOnLane_;  // if true then keep logical lane regardless of lateral position, default false
 
+        // Deferred evaluation of world coordinates
+        bool defer_world_pos_;  // if true then road coordinate updates will not evaluate world coordinates, default false
+        bool world_pos_stale_;  // indicates that world coordinates are not yet evaluated from current road coordinates
+
         // route reference
         Route *route_;  // if pointer set, the position corresponds to a point along (s) the route
 
@@ -3685,6 +4115,34 @@ namespace roadmanager
 
         int  orientationSetMask;  // use values from OrientationSetMask
         bool zSet;                // indicates whether z was explicitly set
+
+        // Lane width polynomials of current lane and the lanes between it and the reference lane, summed up
+        // and valid within an s range where no width record changes. Makes small steps along s evaluate in O(1)
+        typedef struct
+        {
+            unsigned int generation;    // road network generation the cache was built for
+            LaneSection *lane_section;  // key, together with lane_id
+            int          lane_id;
+            double       s_min;         // s range within which the polynomials are valid
+            double       s_max;
+            bool         s_max_closed;  // true if s_max is included in the range (end of lane section)
+            double       s_origin;      // polynomials are evaluated at s - s_origin
+            Polynomial   outer_offset;  // sum of lane widths from reference lane to outer border of lane_id
+            Polynomial   width;         // width of lane_id
+            bool         single_slope;  // at most one of the lane widths vary along s
+        } LaneWidthCache;
+
+        typedef struct
+        {
+            unsigned int generation;   // road network generation the cache was built for
+            Road        *road;         // key
+            double       s_min;        // s range within which the record is valid
+            double       s_max;
+            LaneOffset  *lane_offset;  // active record, nullptr if road has no lane offset
+        } LaneOffsetCache;
+
+        LaneWidthCache  lane_width_cache_  = {};
+        LaneOffsetCache lane_offset_cache_ = {};
     };
 
     // A route is a sequence of positions, at least one per road along the route
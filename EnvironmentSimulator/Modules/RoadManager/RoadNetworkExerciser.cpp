@@ -0,0 +1,203 @@
+/*
+ * esmini - Environment Simulator Minimalistic
+ * https://github.com/esmini/esmini
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *
+ * Copyright (c) partners of Simulation Scenarios
+ * https://sites.google.com/view/simulationscenarios
+ */
+
+#include <chrono>
+#include "CommonMini.hpp"
+#include "RoadNetworkExerciser.hpp"
+
+using namespace roadmanager;
+
+int RoadNetworkExerciser::Populate(double density, Road::RoadRule rule, double min_road_length)
+{
+    rule_ = rule;
+
+    if (density < 1E-10)
+    {
+        // Basically no vehicles
+        return 0;
+    }
+
+    double average_distance = 100.0 / density;
+
+    for (int r = 0; r < odr_->GetNumOfRoads(); r++)
+    {
+        Road          *road  = odr_->GetRoadByIdx(r);
+        Road::RoadRule rrule = GetRule(road);
+
+        // Check for open end
+        OpenEnd openEnd;
+        if (road->GetLink(LinkType::PREDECESSOR) == nullptr)
+        {
+            openEnd.road   = road;
+            openEnd.s      = 0;
+            openEnd.side   = rrule == Road::RoadRule::LEFT_HAND_TRAFFIC ? 1 : -1;
+            openEnd.nLanes = road->GetNumberOfDrivingLanesSide(openEnd.s, -1);
+            if (openEnd.nLanes > 0)
+            {
+                openEnds_.push_back(openEnd);
+            }
+        }
+        if (road->GetLink(LinkType::SUCCESSOR) == nullptr)
+        {
+            openEnd.road   = road;
+            openEnd.s      = road->GetLength();
+            openEnd.side   = rrule == Road::RoadRule::LEFT_HAND_TRAFFIC ? -1 : 1;
+            openEnd.nLanes = road->GetNumberOfDrivingLanesSide(openEnd.s, 1);
+            if (openEnd.nLanes > 0)
+            {
+                openEnds_.push_back(openEnd);
+            }
+        }
+
+        if (road->GetLength() > min_road_length)
+        {
+            // Populate road lanes with vehicles at some random distances
+            for (double s = 10; s < road->GetLength() - average_distance;
+                 s += average_distance + 0.2 * average_distance * SE_Env::Inst().GetRand().GetReal())
+            {
+                // Pick lane by random
+                int   lane_idx = SE_Env::Inst().GetRand().GetNumberBetween(0, road->GetNumberOfDrivingLanes(s) - 1);
+                Lane *lane     = road->GetDrivingLaneByIdx(s, lane_idx);
+                if (lane == 0)
+                {
+                    LOG("Failed locate driving lane %d at s %.2f", lane_idx, s);
+                    continue;
+                }
+
+                if (((SIGN(lane->GetId()) < 0) && (road->GetLength() - s < 50) && (road->GetLink(LinkType::SUCCESSOR) == 0)) ||
+                    ((SIGN(lane->GetId()) > 0) && (s < 50) && (road->GetLink(LinkType::PREDECESSOR) == 0)))
+                {
+                    // Skip vehicles too close to road end - and where connecting road is missing
+                    continue;
+                }
+
+                // Higher speeds in lanes closer to reference lane, vary between 0.5 to 1.0 times default speed
+                AddCar(road->GetId(), lane->GetId(), s, 0.5 + 0.5 / abs(lane->GetId()));
+            }
+        }
+    }
+
+    return static_cast<int>(cars_.size());
+}
+
+int RoadNetworkExerciser::AddCar(int road_id, int lane_id, double s, double speed_factor)
+{
+    Road *road = odr_->GetRoadById(road_id);
+    if (road == nullptr)
+    {
+        return -1;
+    }
+
+    cars_.emplace_back();
+    Car &car = cars_.back();
+
+    car.id           = static_cast<int>(cars_.size()) - 1;
+    car.road_id_init = road_id;
+    car.lane_id_init = lane_id;
+    car.s_init       = s;
+    car.speed_factor = speed_factor;
+    car.stopped      = false;
+    car.pos.SetDeferWorldPos(!evaluate_world_pos_);
+    car.pos.SetLanePos(road_id, lane_id, s, 0);
+    if (GetRule(road) == Road::RoadRule::LEFT_HAND_TRAFFIC)
+    {
+        car.pos.SetHeadingRelative(lane_id < 0 ? M_PI : 0);
+    }
+    else
+    {
+        car.pos.SetHeadingRelative(lane_id < 0 ? 0 : M_PI);
+    }
+    car.heading_init = car.pos.GetHRelative();
+
+    // respawn from beginning of lane section - not initial s-position
+    LaneSection *ls = road->GetLaneSectionByS(s);
+    car.s_respawn   = lane_id > 0 ? ls->GetS() + ls->GetLength() - 5 : ls->GetS() + 5;
+
+    return car.id;
+}
+
+void RoadNetworkExerciser::Respawn(Car &car)
+{
+    if (openEnds_.size() == 0)
+    {
+        // If no open ends, respawn based on initial position
+        car.pos.SetLanePos(car.road_id_init, car.lane_id_init, car.s_respawn, 0);
+        car.pos.SetHeadingRelative(car.heading_init);
+    }
+    else
+    {
+        // Choose random open end
+        OpenEnd &oe = openEnds_[static_cast<unsigned int>(SE_Env::Inst().GetRand().GetNumberBetween(0, static_cast<int>(openEnds_.size()) - 1))];
+
+        // Choose random lane
+        Lane *lane = oe.road->GetDrivingLaneSideByIdx(oe.s, oe.side, SE_Env::Inst().GetRand().GetNumberBetween(0, oe.nLanes - 1));
+
+        car.pos.SetLanePos(oe.road->GetId(), lane->GetId(), oe.s, 0);
+
+        // Ensure car is oriented along lane driving direction
+        if (GetRule(oe.road) == Road::RoadRule::LEFT_HAND_TRAFFIC)
+        {
+            car.pos.SetHeadingRelative(SIGN(lane->GetId()) > 0 ? 0.0 : M_PI);
+        }
+        else
+        {
+            car.pos.SetHeadingRelative(SIGN(lane->GetId()) > 0 ? M_PI : 0.0);
+        }
+    }
+}
+
+void RoadNetworkExerciser::Step(double dt)
+{
+    auto start = std::chrono::steady_clock::now();
+
+    for (Car &car : cars_)
+    {
+        if (car.stopped)
+        {
+            continue;
+        }
+
+        double ds = car.pos.GetSpeedLimit() * car.speed_factor * speed_factor_ * dt;
+
+        n_moves_++;
+        if (static_cast<int>(car.pos.MoveAlongS(ds)) < 0)
+        {
+            if (stop_at_end_of_road_)
+            {
+                car.stopped = true;
+            }
+            else
+            {
+                Respawn(car);
+            }
+        }
+    }
+
+    step_time_ += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+void RoadNetworkExerciser::SetEvaluateWorldPos(bool evaluate)
+{
+    evaluate_world_pos_ = evaluate;
+    for (Car &car : cars_)
+    {
+        car.pos.SetDeferWorldPos(!evaluate);
+    }
+}
+
+void RoadNetworkExerciser::Clear()
+{
+    cars_.clear();
+    openEnds_.clear();
+    n_moves_   = 0;
+    step_time_ = 0.0;
+}
@@ -0,0 +1,145 @@
+/*
+ * esmini - Environment Simulator Minimalistic
+ * https://github.com/esmini/esmini
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *
+ * Copyright (c) partners of Simulation Scenarios
+ * https://sites.google.com/view/simulationscenarios
+ */
+
+#pragma once
+
+#include <vector>
+#include "RoadManager.hpp"
+
+namespace roadmanager
+{
+    /**
+            Populates a road network with simple vehicles following their lanes, choosing random ways through
+            junctions and respawning at open road ends. Used by odrviewer for visualization and as a RoadManager
+            stress test of arbitrary OpenDRIVE files, e.g. for measuring MoveAlongS throughput.
+    */
+    class RoadNetworkExerciser
+    {
+    public:
+        typedef struct
+        {
+            int      id;
+            int      road_id_init;
+            int      lane_id_init;
+            double   heading_init;
+            double   s_init;
+            double   s_respawn;     // start of initial lane section, in driving direction
+            double   speed_factor;  // speed vary bewtween lanes
+            bool     stopped;
+            Position pos;
+        } Car;
+
+        typedef struct
+        {
+            Road  *road;
+            int    side;
+            int    nLanes;
+            double s;
+        } OpenEnd;
+
+        RoadNetworkExerciser(OpenDrive *odr) : odr_(odr)
+        {
+        }
+
+        /**
+                Populate driving lanes of all roads longer than min_road_length with vehicles at randomized distances
+                @param density Cars per 100 m
+                @param rule Enforced traffic rule, ROAD_RULE_UNDEFINED to respect the road rule attribute
+                @param min_road_length Roads shorter than this will not be populated, but may still be visited
+                @return Number of cars
+        */
+        int Populate(double density, Road::RoadRule rule = Road::RoadRule::ROAD_RULE_UNDEFINED, double min_road_length = 30.0);
+
+        /**
+                Add one single car at specified lane position
+                @return Index of the car
+        */
+        int AddCar(int road_id, int lane_id, double s, double speed_factor);
+
+        /**
+                Move all cars along their lanes
+                @param dt Timestep
+        */
+        void Step(double dt);
+
+        /**
+                Evaluation of world coordinates can be skipped when not needed, e.g. in headless runs.
+                Then the movement is limited to road coordinates. Default is to evaluate world coordinates.
+        */
+        void SetEvaluateWorldPos(bool evaluate);
+
+        void SetSpeedFactor(double speed_factor)
+        {
+            speed_factor_ = speed_factor;
+        }
+
+        void SetStopAtEndOfRoad(bool stop)
+        {
+            stop_at_end_of_road_ = stop;
+        }
+
+        std::vector<Car> &GetCars()
+        {
+            return cars_;
+        }
+
+        const std::vector<OpenEnd> &GetOpenEnds() const
+        {
+            return openEnds_;
+        }
+
+        /**
+                Get number of MoveAlongS calls performed by Step()
+        */
+        unsigned long long GetNumberOfMoves() const
+        {
+            return n_moves_;
+        }
+
+        /**
+                Get accumulated time (s) spent in Step()
+        */
+        double GetStepTime() const
+        {
+            return step_time_;
+        }
+
+        /**
+                Get number of MoveAlongS calls per second, including respawning
+        */
+        double GetMoveThroughput() const
+        {
+            return step_time_ > SMALL_NUMBER ? static_cast<double>(n_moves_) / step_time_ : 0.0;
+        }
+
+        void Clear();
+
+    private:
+        OpenDrive           *odr_;
+        std::vector<Car>     cars_;
+        std::vector<OpenEnd> openEnds_;
+        Road::RoadRule       rule_                = Road::RoadRule::ROAD_RULE_UNDEFINED;
+        double               speed_factor_        = 1.0;
+        bool                 stop_at_end_of_road_ = false;
+        bool                 evaluate_world_pos_  = true;
+        unsigned long long   n_moves_             = 0;
+        double               step_time_           = 0.0;
+
+        Road::RoadRule GetRule(const Road *road) const
+        {
+            return rule_ != Road::RoadRule::ROAD_RULE_UNDEFINED ? rule_ : road->GetRule();
+        }
+
+        void Respawn(Car &car);
+    };
+
+}  // namespace roadmanager
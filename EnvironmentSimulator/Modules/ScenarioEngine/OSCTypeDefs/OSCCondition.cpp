@@ -356,9 +356,9 @@ bool Trigger::Evaluate(StoryBoard* storyBoard, double sim_time)
         }
     }
 
-    if (result)
+    if (result && Logger::Inst().IsEnabled())
     {
-        // Log
+        // Log, only when there is any receiver since condition Log() functions compose strings
         LOG("Trigger /------------------------------------------------");
         for (size_t i = 0; i < conditionGroup_.size(); i++)
         {
@@ -381,11 +381,50 @@ bool Trigger::Evaluate(StoryBoard* storyBoard, double sim_time)
     return result;
 }
 
+void TrigByState::ResolveElement(StoryBoard* storyBoard)
+{
+    if (element_type_ == StoryBoardElement::ElementType::ACTION)
+    {
+        element_ = storyBoard->FindActionByName(element_name_);
+    }
+    else if (element_type_ == StoryBoardElement::ElementType::ACT)
+    {
+        element_ = storyBoard->FindActByName(element_name_);
+    }
+    else if (element_type_ == StoryBoardElement::ElementType::MANEUVER_GROUP)
+    {
+        element_ = storyBoard->FindManeuverGroupByName(element_name_);
+    }
+    else if (element_type_ == StoryBoardElement::ElementType::EVENT)
+    {
+        element_ = storyBoard->FindEventByName(element_name_);
+    }
+    else if (element_type_ == StoryBoardElement::ElementType::MANEUVER)
+    {
+        element_ = storyBoard->FindManeuverByName(element_name_);
+    }
+    else if (element_type_ == StoryBoardElement::ElementType::STORY)
+    {
+        // story state is derived from the condition itself, see CheckCondition()
+        return;
+    }
+    else
+    {
+        LOG("Story element type %d not supported yet", element_type_);
+        return;
+    }
+
+    if (element_ == 0)
+    {
+        LOG("Story board element \"%s\" not found", element_name_.c_str());
+    }
+}
+
 bool TrigByState::CheckCondition(StoryBoard* storyBoard, double sim_time)
 {
+    (void)storyBoard;
     (void)sim_time;
-    bool               result  = false;
-    StoryBoardElement* element = 0;
+    bool result = false;
 
     if (element_type_ == StoryBoardElement::ElementType::STORY)
     {
@@ -400,37 +439,12 @@ bool TrigByState::CheckCondition(StoryBoard* storyBoard, double sim_time)
     }
     else
     {
-        if (element_type_ == StoryBoardElement::ElementType::ACTION)
-        {
-            element = storyBoard->FindActionByName(element_name_);
-        }
-        else if (element_type_ == StoryBoardElement::ElementType::ACT)
-        {
-            element = storyBoard->FindActByName(element_name_);
-        }
-        else if (element_type_ == StoryBoardElement::ElementType::MANEUVER_GROUP)
-        {
-            element = storyBoard->FindManeuverGroupByName(element_name_);
-        }
-        else if (element_type_ == StoryBoardElement::ElementType::EVENT)
-        {
-            element = storyBoard->FindEventByName(element_name_);
-        }
-        else if (element_type_ == StoryBoardElement::ElementType::MANEUVER)
-        {
-            element = storyBoard->FindManeuverByName(element_name_);
-        }
-        else
-        {
-            LOG("Story element type %d not supported yet", element_type_);
-            return false;
-        }
-
-        if (element == 0)
+        // Element is resolved by ScenarioReader once the storyboard is parsed
+        if (element_ == 0)
         {
-            LOG("Story board element \"%s\" not found", element_name_.c_str());
             return false;
         }
+        StoryBoardElement* element = element_;
 
         if (element_state_ == CondElementState::STANDBY)
         {
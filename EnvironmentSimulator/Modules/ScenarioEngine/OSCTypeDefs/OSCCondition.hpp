@@ -471,11 +471,26 @@ namespace scenarioengine
             : OSCCondition(BY_STATE),
               element_state_(state),
               element_type_(element_type),
-              element_name_(element_name)
+              element_name_(element_name),
+              element_(nullptr)
         {
         }
         std::string CondElementState2Str(CondElementState state);
         void        Log();
+
+        /**
+        Look up the referenced storyboard element by name. Call once all storyboard elements are created.
+        @param storyBoard The complete storyboard
+        */
+        void ResolveElement(StoryBoard* storyBoard);
+
+        StoryBoardElement* GetElement() const
+        {
+            return element_;
+        }
+
+    private:
+        StoryBoardElement* element_;  // resolved from element_name_ by ResolveElement()
     };
 
     class TrigByValue : public OSCCondition
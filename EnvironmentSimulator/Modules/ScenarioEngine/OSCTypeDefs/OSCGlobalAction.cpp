@@ -66,6 +66,18 @@ void VariableSetAction::Step(double, double)
     OSCAction::Stop();
 }
 
+void TrafficSignalStateAction::Start(double simTime, double dt)
+{
+    LOG("Set traffic signal %d state = %s", signal_id_, state_.c_str());
+    roadmanager::Position::GetOpenDrive()->GetSignalStateRegistry().SetState(signal_id_, state_);
+    OSCAction::Start(simTime, dt);
+}
+
+void TrafficSignalStateAction::Step(double, double)
+{
+    OSCAction::Stop();
+}
+
 void AddEntityAction::Start(double simTime, double dt)
 {
     if (entity_ == nullptr)
@@ -106,8 +118,6 @@ void DeleteEntityAction::Start(double simTime, double dt)
         return;
     }
 
-    gateway_->removeObject(entity_->name_);
-
     LOG("Deleted entity %s", entity_->GetName().c_str());
 
     OSCAction::Start(simTime, dt);
@@ -248,9 +258,14 @@ void SwarmTrafficAction::Start(double simTime, double dt)
     {
         if (catalogs->catalog_[i]->GetType() == CatalogType::CATALOG_VEHICLE)
         {
-            for (size_t j = 0; j < catalogs->catalog_[i]->entry_.size(); j++)
+            for (size_t j = 0; j < catalogs->catalog_[i]->GetNumberOfEntries(); j++)
             {
-                Vehicle* vehicle = reader_->parseOSCVehicle(catalogs->catalog_[i]->entry_[j]->GetNode());
+                Entry* entry = catalogs->catalog_[i]->GetEntryByIdx(j);
+                if (entry == nullptr)
+                {
+                    continue;
+                }
+                Vehicle* vehicle = reader_->parseOSCVehicle(entry->GetNode());
                 if (vehicle->category_ == Vehicle::Category::CAR || vehicle->category_ == Vehicle::Category::BUS ||
                     vehicle->category_ == Vehicle::Category::TRUCK || vehicle->category_ == Vehicle::Category::VAN ||
                     vehicle->category_ == Vehicle::Category::MOTORBIKE)
@@ -662,8 +677,6 @@ int SwarmTrafficAction::despawn(double simTime)
                 {
                     trailer = static_cast<Vehicle*>(v->TrailerVehicle());
 
-                    gateway_->removeObject(v->name_);
-
                     if (v->objectEvents_.size() > 0 || v->initActions_.size() > 0)
                     {
                         entities_->deactivateObject(v);
@@ -680,7 +693,6 @@ int SwarmTrafficAction::despawn(double simTime)
 
             if (vehicle)
             {
-                gateway_->removeObject(vehicle->name_);
                 if (vehicle->objectEvents_.size() > 0 || vehicle->initActions_.size() > 0)
                 {
                     entities_->deactivateObject(vehicle);
@@ -40,7 +40,7 @@ namespace scenarioengine
             DELETE_ENTITY,
             PARAMETER_SET,
             VARIABLE_SET,
-            INFRASTRUCTURE,  // not supported yet
+            INFRASTRUCTURE,  // only TrafficSignalStateAction supported
             SWARM_TRAFFIC,
         } Type;
 
@@ -136,6 +136,39 @@ namespace scenarioengine
         }
     };
 
+    class TrafficSignalStateAction : public OSCGlobalAction
+    {
+    public:
+        int         signal_id_;
+        std::string state_;
+
+        TrafficSignalStateAction() : OSCGlobalAction(OSCGlobalAction::Type::INFRASTRUCTURE), signal_id_(-1), state_(""){};
+
+        TrafficSignalStateAction(const TrafficSignalStateAction& action) : OSCGlobalAction(OSCGlobalAction::Type::INFRASTRUCTURE)
+        {
+            signal_id_ = action.signal_id_;
+            state_     = action.state_;
+        }
+
+        OSCGlobalAction* Copy()
+        {
+            TrafficSignalStateAction* new_action = new TrafficSignalStateAction(*this);
+            return new_action;
+        }
+
+        std::string Type2Str()
+        {
+            return "TrafficSignalStateAction";
+        };
+
+        void Start(double simTime, double dt);
+        void Step(double simTime, double dt);
+
+        void print()
+        {
+        }
+    };
+
     class AddEntityAction : public OSCGlobalAction
     {
     public:
@@ -177,23 +210,17 @@ namespace scenarioengine
     class DeleteEntityAction : public OSCGlobalAction
     {
     public:
-        Object*          entity_;
-        Entities*        entities_;
-        ScenarioGateway* gateway_;
+        Object*   entity_;
+        Entities* entities_;
 
-        DeleteEntityAction() : OSCGlobalAction(OSCGlobalAction::Type::DELETE_ENTITY), entity_(nullptr), entities_(nullptr), gateway_(nullptr){};
+        DeleteEntityAction() : OSCGlobalAction(OSCGlobalAction::Type::DELETE_ENTITY), entity_(nullptr), entities_(nullptr){};
 
-        DeleteEntityAction(Object* entity)
-            : OSCGlobalAction(OSCGlobalAction::Type::DELETE_ENTITY),
-              entity_(entity),
-              entities_(nullptr),
-              gateway_(nullptr){};
+        DeleteEntityAction(Object* entity) : OSCGlobalAction(OSCGlobalAction::Type::DELETE_ENTITY), entity_(entity), entities_(nullptr){};
 
         DeleteEntityAction(const DeleteEntityAction& action) : OSCGlobalAction(OSCGlobalAction::Type::DELETE_ENTITY)
         {
             entity_   = action.entity_;
             entities_ = action.entities_;
-            gateway_  = action.gateway_;
         }
 
         OSCGlobalAction* Copy()
@@ -209,10 +236,6 @@ namespace scenarioengine
         {
             entities_ = entities;
         }
-        void SetGateway(ScenarioGateway* gateway)
-        {
-            gateway_ = gateway;
-        }
 
         void print()
         {
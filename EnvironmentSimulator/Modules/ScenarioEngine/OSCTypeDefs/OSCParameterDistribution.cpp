@@ -40,26 +40,8 @@ int OSCParameterDistribution::Load(std::string filename)
         file_name_candidates.push_back(CombineDirectoryPathAndFilepath(SE_Env::Inst().GetPaths()[i], filename));
     }
 
-    pugi::xml_parse_result result;
-    size_t                 i;
-    for (i = 0; i < file_name_candidates.size(); i++)
-    {
-        if (FileExists(file_name_candidates[i].c_str()))
-        {
-            result = doc_.load_file(file_name_candidates[i].c_str());
-            if (!result)
-            {
-                LOG("%s: %s at offset (character position): %d", file_name_candidates[i].c_str(), result.description(), result.offset);
-                return -1;
-            }
-            else
-            {
-                break;
-            }
-        }
-    }
-
-    if (i == file_name_candidates.size())
+    std::string path = SE_Env::Inst().LocateFile(file_name_candidates);
+    if (path.empty())
     {
         LOG("Failed to load parameter distribution file %s. Tried:", filename.c_str());
         for (unsigned int j = 0; j < file_name_candidates.size(); j++)
@@ -70,7 +52,13 @@ int OSCParameterDistribution::Load(std::string filename)
     }
     else
     {
-        filename_ = file_name_candidates[i];
+        pugi::xml_parse_result result = doc_.load_file(path.c_str());
+        if (!result)
+        {
+            LOG("%s: %s at offset (character position): %d", path.c_str(), result.description(), result.offset);
+            return -1;
+        }
+        filename_ = path;
         LOG("Loaded %s", filename_.c_str());
     }
 
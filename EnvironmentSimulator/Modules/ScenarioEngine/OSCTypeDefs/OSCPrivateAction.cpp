@@ -421,9 +421,7 @@ void FollowTrajectoryAction::Step(double simTime, double dt)
         (timing_domain_ != TimingDomain::NONE && time_ + timeOffset >= traj_->GetStartTime() + traj_->GetDuration()))
     {
         // Reached end of trajectory
-        // Calculate road coordinates from final inertia (X, Y) coordinates
-        object_->pos_.XYZH2TrackPos(object_->pos_.GetX(), object_->pos_.GetY(), object_->pos_.GetZ(), object_->pos_.GetH());
-
+        // Road coordinates will be calculated from final inertia (X, Y) coordinates below
         double remaningDistance = 0.0;
         if (timing_domain_ == TimingDomain::NONE && !traj_->closed_ && object_->pos_.GetTrajectoryS() > (traj_->GetLength() - SMALL_NUMBER))
         {
@@ -594,6 +592,9 @@ void LatLaneChangeAction::Start(double simTime, double dt)
     object_->pos_.ForceLaneId(target_lane_id_);
     internal_pos_ = object_->pos_;
 
+    // Internal position is only used for road coordinates, skip evaluation of world coordinates
+    internal_pos_.SetDeferWorldPos(true);
+
     // Make offsets agnostic to lane sign
     transition_.SetStartVal(SIGN(object_->pos_.GetLaneId()) * object_->pos_.GetOffset());
     transition_.SetTargetVal(SIGN(target_lane_id_) * target_lane_offset_);
@@ -639,6 +640,9 @@ void LatLaneChangeAction::Step(double simTime, double dt)
     double rate       = transition_.EvaluateScaledPrim();
     double old_offset = internal_pos_.GetOffset();
 
+    // Only road coordinates are needed while moving, world coordinates are evaluated once for the final position
+    object_->pos_.SetDeferWorldPos(true);
+
     // Restore position to target lane and new offset
     object_->pos_.SetLanePos(internal_pos_.GetTrackId(),
                              internal_pos_.GetLaneId(),
@@ -676,6 +680,9 @@ void LatLaneChangeAction::Step(double simTime, double dt)
         }
     }
 
+    // Evaluate world coordinates, needed for road heading below
+    object_->pos_.SetDeferWorldPos(false);
+
     if (transition_.GetParamVal() > transition_.GetParamTargetVal() - SMALL_NUMBER ||
         // Close enough?
         fabs(offset_agnostic - transition_.GetTargetVal()) < SMALL_NUMBER ||
@@ -709,8 +716,8 @@ void LatLaneChangeAction::Step(double simTime, double dt)
 
     if (!(object_->pos_.GetRoute() && object_->pos_.GetRoute()->IsValid()))
     {
-        // Attach object position to closest road and lane, look up via inertial coordinates
-        object_->pos_.XYZH2TrackPos(object_->pos_.GetX(), object_->pos_.GetY(), object_->pos_.GetZ(), object_->pos_.GetH());
+        // Road is known, just attach object to the lane it currently occupies. World coordinates are not affected.
+        object_->pos_.SetTrackPos(object_->pos_.GetTrackId(), object_->pos_.GetS(), object_->pos_.GetT(), false);
     }
 
     object_->SetDirtyBits(Object::DirtyBit::LATERAL | Object::DirtyBit::LONGITUDINAL | Object::DirtyBit::SPEED);
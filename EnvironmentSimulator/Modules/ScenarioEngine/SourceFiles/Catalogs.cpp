@@ -10,7 +10,11 @@
  * https://sites.google.com/view/simulationscenarios
  */
 
+#include <fstream>
+#include <sys/stat.h>
+
 #include "Catalogs.hpp"
+#include "Parameters.hpp"
 #include "pugixml.hpp"
 
 using namespace scenarioengine;
@@ -60,6 +64,248 @@ Entry::Entry(std::string name, pugi::xml_document root)
     type_ = GetTypeByNodeName(GetNode());
 }
 
+static long long GetFileModificationTime(const std::string& filename)
+{
+    struct stat file_stat;
+
+    if (stat(filename.c_str(), &file_stat) != 0)
+    {
+        return -1;
+    }
+
+    return static_cast<long long>(file_stat.st_mtime);
+}
+
+int CatalogFile::Load(const std::string& filename)
+{
+    std::ifstream file(filename, std::ios::binary);
+
+    if (!file.good())
+    {
+        return -1;
+    }
+
+    file.seekg(0, std::ios::end);
+    std::streamoff size = file.tellg();
+    if (size < 0)
+    {
+        LOG("Failed to read catalog %s", filename.c_str());
+        return -1;
+    }
+
+    filename_ = filename;
+    mod_time_ = GetFileModificationTime(filename);
+    buffer_.resize(static_cast<size_t>(size));
+    file.seekg(0, std::ios::beg);
+    file.read(&buffer_[0], static_cast<std::streamsize>(buffer_.size()));
+    entry_.clear();
+    name2idx_.clear();
+    param_names_ = false;
+
+    // Parse once to locate the entries, then keep only their positions
+    pugi::xml_document     doc;
+    pugi::xml_parse_result result = doc.load_buffer(buffer_.data(), buffer_.size());
+    if (!result)
+    {
+        LOG("Failed to parse catalog %s: %s", filename.c_str(), result.description());
+        return -1;
+    }
+
+    pugi::xml_node osc_node = doc.child("OpenSCENARIO");
+    if (!osc_node)
+    {
+        osc_node = doc.child("OpenScenario");
+        if (!osc_node)
+        {
+            LOG("Couldn't find Catalog OpenSCENARIO or OpenScenario element in %s - check XML!", filename.c_str());
+            return -1;
+        }
+    }
+    pugi::xml_node catalog_node = osc_node.child("Catalog");
+
+    for (pugi::xml_node entry_n = catalog_node.first_child(); entry_n; entry_n = entry_n.next_sibling())
+    {
+        EntryRecord record;
+        record.name_   = entry_n.attribute("name").value();
+        record.offset_ = static_cast<size_t>(entry_n.offset_debug() - 1);  // offset points at element name, step back to '<'
+        record.size_   = 0;
+
+        if (entry_.size() > 0)
+        {
+            entry_.back().size_ = record.offset_ - entry_.back().offset_;
+        }
+        else
+        {
+            type_ = Entry::GetTypeByNodeName(entry_n);
+        }
+
+        if (record.name_[0] == PARAMETER_PREFIX)
+        {
+            param_names_ = true;
+        }
+        else
+        {
+            // keep first occurrence in case of duplicate names
+            name2idx_.emplace(record.name_, entry_.size());
+        }
+
+        entry_.push_back(record);
+    }
+
+    if (entry_.size() > 0)
+    {
+        // Last entry ends where the catalog element ends
+        size_t end = buffer_.rfind(std::string("</") + catalog_node.name());
+        if (end == std::string::npos || end < entry_.back().offset_)
+        {
+            end = buffer_.size();
+        }
+        entry_.back().size_ = end - entry_.back().offset_;
+    }
+
+    return 0;
+}
+
+int CatalogFile::ParseEntry(size_t idx, pugi::xml_document& doc)
+{
+    if (idx >= entry_.size())
+    {
+        return -1;
+    }
+
+    pugi::xml_parse_result result = doc.load_buffer(buffer_.data() + entry_[idx].offset_, entry_[idx].size_);
+    if (!result || !doc.first_child())
+    {
+        LOG("Failed to parse entry %s in catalog %s: %s", entry_[idx].name_.c_str(), filename_.c_str(), result.description());
+        return -1;
+    }
+
+    return 0;
+}
+
+CatalogIndex& CatalogIndex::Inst()
+{
+    static CatalogIndex instance_;
+    return instance_;
+}
+
+std::shared_ptr<CatalogFile> CatalogIndex::GetFile(const std::string& filename)
+{
+    mutex_.Lock();
+
+    std::shared_ptr<CatalogFile> file;
+    auto                         it = file_.find(filename);
+
+    if (it != file_.end() && it->second->mod_time_ == GetFileModificationTime(filename))
+    {
+        file = it->second;
+    }
+    else
+    {
+        // Not indexed or file modified since, (re)load it. Any catalogs in use keep their own reference to previous content.
+        file = std::make_shared<CatalogFile>();
+        if (file->Load(filename) == 0)
+        {
+            file_[filename] = file;
+        }
+        else
+        {
+            file = nullptr;
+        }
+    }
+
+    mutex_.Unlock();
+
+    return file;
+}
+
+void CatalogIndex::Clear()
+{
+    mutex_.Lock();
+    file_.clear();
+    mutex_.Unlock();
+}
+
+void Catalog::SetFile(std::shared_ptr<CatalogFile> file)
+{
+    for (auto* entry : entry_)
+    {
+        delete entry;
+    }
+    entry_.assign(file->entry_.size(), nullptr);
+    entry_name_.clear();
+    name2idx_.clear();
+
+    file_ = file;
+    type_ = file->type_;
+}
+
+void Catalog::SetEntryName(size_t idx, const std::string& name)
+{
+    if (entry_name_.size() < entry_.size())
+    {
+        entry_name_.resize(entry_.size());
+    }
+
+    entry_name_[idx] = name;
+    name2idx_.emplace(name, idx);
+
+    if (entry_[idx] != nullptr)
+    {
+        entry_[idx]->name_ = name;
+    }
+}
+
+Entry* Catalog::GetEntryByIdx(size_t idx)
+{
+    if (idx >= entry_.size())
+    {
+        return nullptr;
+    }
+
+    if (entry_[idx] == nullptr && file_ != nullptr)
+    {
+        // First access, parse the entry
+        pugi::xml_document doc;
+        if (file_->ParseEntry(idx, doc) == 0)
+        {
+            std::string name = idx < entry_name_.size() && !entry_name_[idx].empty() ? entry_name_[idx] : file_->entry_[idx].name_;
+            entry_[idx]      = new Entry(name, std::move(doc));
+        }
+    }
+
+    return entry_[idx];
+}
+
+Entry* Catalog::FindEntryByName(std::string name)
+{
+    if (file_ != nullptr)
+    {
+        auto it = name2idx_.find(name);
+        if (it != name2idx_.end())
+        {
+            return GetEntryByIdx(it->second);
+        }
+
+        int idx = file_->FindEntryIdx(name);
+        if (idx >= 0)
+        {
+            return GetEntryByIdx(static_cast<size_t>(idx));
+        }
+    }
+
+    // Look for any entry added explicitly
+    for (size_t i = 0; i < entry_.size(); i++)
+    {
+        if (entry_[i] != nullptr && entry_[i]->name_ == name)
+        {
+            return entry_[i];
+        }
+    }
+
+    return 0;
+}
+
 int Catalogs::RegisterCatalogDirectory(std::string type, std::string directory)
 {
     CatalogDirEntry entry;
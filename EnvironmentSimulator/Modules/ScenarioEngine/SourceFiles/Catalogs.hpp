@@ -13,7 +13,10 @@
 #pragma once
 
 #include <iostream>
+#include <map>
+#include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "CommonMini.hpp"
@@ -55,15 +58,91 @@ namespace scenarioengine
         {
             return GetTypeAsStr_(type_);
         }
-        CatalogType GetTypeByNodeName(pugi::xml_node node);
+        static CatalogType GetTypeByNodeName(pugi::xml_node node);
+    };
+
+    // Content of a catalog file, indexed for on demand parsing of entries
+    class CatalogFile
+    {
+    public:
+        typedef struct
+        {
+            std::string name_;    // name attribute as in file, might be a parameter reference
+            size_t      offset_;  // position of entry element in buffer
+            size_t      size_;    // number of bytes until next entry or end of catalog
+        } EntryRecord;
+
+        std::string                             filename_;
+        long long                               mod_time_;
+        CatalogType                             type_;
+        std::string                             buffer_;
+        std::vector<EntryRecord>                entry_;
+        std::unordered_map<std::string, size_t> name2idx_;
+        bool                                    param_names_;  // true if any entry name is a parameter reference
+
+        CatalogFile() : mod_time_(0), type_(CatalogType::CATALOG_UNDEFINED), param_names_(false)
+        {
+        }
+
+        /**
+        Read and index the catalog file. Only the position and name of each entry is registered.
+        @param filename Resolved path of the catalog file
+        @return 0 on success, -1 on error
+        */
+        int Load(const std::string &filename);
+
+        /**
+        Parse a single entry of the catalog into a document of its own
+        @param idx Index of the entry
+        @param doc Resulting document, with entry as first child
+        @return 0 on success, -1 on error
+        */
+        int ParseEntry(size_t idx, pugi::xml_document &doc);
+
+        int FindEntryIdx(const std::string &name)
+        {
+            auto it = name2idx_.find(name);
+            return it != name2idx_.end() ? static_cast<int>(it->second) : -1;
+        }
+    };
+
+    // Process wide register of indexed catalog files, keyed by path and modification time
+    // Catalog files are read only once and then shared between scenario loads, e.g. in batch runs or parameter permutations
+    class CatalogIndex
+    {
+    public:
+        static CatalogIndex &Inst();
+
+        /**
+        Get indexed catalog file. Read and index the file if not done before or if the file has been modified.
+        @param filename Resolved path of the catalog file
+        @return Pointer to the indexed file, nullptr if failed to read it
+        */
+        std::shared_ptr<CatalogFile> GetFile(const std::string &filename);
+
+        int GetNumberOfFiles()
+        {
+            return static_cast<int>(file_.size());
+        }
+
+        void Clear();
+
+    private:
+        std::map<std::string, std::shared_ptr<CatalogFile>> file_;
+        SE_Mutex                                            mutex_;
     };
 
     class Catalog
     {
     public:
-        std::string          name_;
-        CatalogType          type_;
-        std::vector<Entry *> entry_;
+        std::string                  name_;
+        CatalogType                  type_;
+        std::vector<Entry *>         entry_;  // parsed entries, nullptr until first accessed
+        std::shared_ptr<CatalogFile> file_;
+
+        Catalog() : type_(CatalogType::CATALOG_UNDEFINED)
+        {
+        }
 
         ~Catalog()
         {
@@ -78,27 +157,40 @@ namespace scenarioengine
             return type_;
         }
 
+        /**
+        Attach an indexed catalog file. Entries will be parsed on first access.
+        @param file The indexed catalog file
+        */
+        void SetFile(std::shared_ptr<CatalogFile> file);
+
+        /**
+        Register resolved name of an entry with parameterized name
+        @param idx Index of the entry
+        @param name Resolved name
+        */
+        void SetEntryName(size_t idx, const std::string &name);
+
         void AddEntry(Entry *entry)
         {
             entry_.push_back(entry);
         }
 
-        Entry *FindEntryByName(std::string name)
+        size_t GetNumberOfEntries()
         {
-            for (size_t i = 0; i < entry_.size(); i++)
-            {
-                if (entry_[i]->name_ == name)
-                {
-                    return entry_[i];
-                }
-            }
-            return 0;
+            return entry_.size();
         }
 
+        Entry *GetEntryByIdx(size_t idx);
+        Entry *FindEntryByName(std::string name);
+
         std::string GetTypeAsStr()
         {
             return Entry::GetTypeAsStr_(type_);
         }
+
+    private:
+        std::vector<std::string>                entry_name_;  // resolved names, only used for parameterized entry names
+        std::unordered_map<std::string, size_t> name2idx_;    // lookup for resolved names
     };
 
     class Catalogs
@@ -60,6 +60,12 @@ Object::Object(Type type)
 
     trail_closest_pos_ = {0, 0, 0, 0, 0, 0, false};
 
+    // NaN will never compare equal, forcing OBB calculation on first request
+    for (int i = 0; i < 7; i++)
+    {
+        obb_key_[i] = std::nan("");
+    }
+
     // initialize override vector
     for (int i = 0; i < OVERRIDE_NR_TYPES; i++)
     {
@@ -270,6 +276,36 @@ void Object::SetJunctionSelectorAngleRandom()
     nextJunctionSelectorAngle_ = 2 * M_PI * SE_Env::Inst().GetRand().GetReal();
 }
 
+const Object::OBB& Object::GetOBB()
+{
+    const double key[7] = {pos_.GetX(),
+                           pos_.GetY(),
+                           pos_.GetH(),
+                           static_cast<double>(boundingbox_.center_.x_),
+                           static_cast<double>(boundingbox_.center_.y_),
+                           static_cast<double>(boundingbox_.dimensions_.length_),
+                           static_cast<double>(boundingbox_.dimensions_.width_)};
+
+    bool changed = false;
+    for (int i = 0; i < 7; i++)
+    {
+        if (!(key[i] == obb_key_[i]))
+        {
+            changed     = true;
+            obb_key_[i] = key[i];
+        }
+    }
+
+    if (!changed)
+    {
+        return obb_;
+    }
+
+    SetOBB2D(key[0], key[1], key[2], key[3], key[4], key[5], key[6], obb_);
+
+    return obb_;
+}
+
 bool Object::CollisionAndRelativeDistLatLong(Object* target, double* distLat, double* distLong)
 {
     // Apply method Separating Axis Theorem (SAT)
@@ -279,21 +315,20 @@ bool Object::CollisionAndRelativeDistLatLong(Object* target, double* distLat, do
     // Idea:
     // For each side of the bounding boxes:
     //   The normal of that edge will be the projection axis
-    //   Project all points of the two bounding boxes onto that axis
-    //   If we find ONE side with a gap between point clusters from BB1 and BB2,
+    //   Project the two bounding boxes onto that axis
+    //   If we find ONE side with a gap between projections of BB1 and BB2,
     //   it's enough to conclude they are not overlapping/colliding
     //
     // Optimization: Since the bounding boxes are boxes with parallel
-    // sides, we only need to check half of the sides
+    // sides, we only need to check half of the sides. Also, the projection
+    // of a box is given directly by its center and half dimensions.
 
     if (target == 0)
     {
         return false;
     }
 
-    Object* obj0 = this;
-    Object* obj1 = target;
-    bool    gap  = false;
+    bool gap = false;
     if (distLong != nullptr)
     {
         *distLong = 0.0;
@@ -317,78 +352,26 @@ bool Object::CollisionAndRelativeDistLatLong(Object* target, double* distLat, do
     }
 
     // Also do a Z sanity check, to rule out on different road elevations
-    if (fabs(obj0->pos_.GetZ() - obj1->pos_.GetZ()) > ELEVATION_DIFF_THRESHOLD && distLong == nullptr && distLat == nullptr)
+    if (fabs(pos_.GetZ() - target->pos_.GetZ()) > ELEVATION_DIFF_THRESHOLD && distLong == nullptr && distLat == nullptr)
     {
         return false;
     }
 
+    const OBB* obb[2] = {&GetOBB(), &target->GetOBB()};
+
     for (int i = 0; i < 2; i++)  // for each of the two BBs
     {
-        if (i == 1)
-        {
-            // swap order, now check all edges of target object
-            obj0 = target;
-            obj1 = this;
-        }
+        const OBB& obb0 = *obb[i];
+        const OBB& obb1 = *obb[(i + 1) % 2];
 
-        double n0[2] = {0.0, 0.0};
         for (int j = 0; j < 2; j++)  // for longitudinal and lateral sides
         {
-            if (j == 0)
-            {
-                // Normal for longitudinal side (sides) points along lateral direction
-                n0[0] = 0.0;
-                n0[1] = 1.0;
-            }
-            else
-            {
-                // Normal for lateral side (front/rear) points along lateral direction
-                n0[0] = 1.0;
-                n0[1] = 0.0;
-            }
-
-            // Rotate the normal/projection axis to align with bounding box/vehicle
-            double n1[2] = {0.0, 0.0};
-            RotateVec2D(n0[0], n0[1], obj0->pos_.GetH(), n1[0], n1[1]);
+            // Normal for longitudinal sides (j == 0) points along lateral axis, and vice versa
+            const double* n = obb0.axis[1 - j];
 
-            // Now, project each point of each BB onto the rotated normal
-            // And register min and max for point cluster of each BB
             double min[2] = {0.0, 0.0}, max[2] = {0.0, 0.0};
-            for (int k = 0; k < 2; k++)
-            {
-                Object* obj = (k == 0 ? obj0 : obj1);
-
-                // Specify bounding box corner vertices, starting at first quadrant
-                double vertices[4][2] = {
-                    {static_cast<double>(obj->boundingbox_.center_.x_) + static_cast<double>(obj->boundingbox_.dimensions_.length_) / 2.0,
-                     static_cast<double>(obj->boundingbox_.center_.y_) + static_cast<double>(obj->boundingbox_.dimensions_.width_) / 2.0},
-                    {static_cast<double>(obj->boundingbox_.center_.x_) - static_cast<double>(obj->boundingbox_.dimensions_.length_) / 2.0,
-                     static_cast<double>(obj->boundingbox_.center_.y_) + static_cast<double>(obj->boundingbox_.dimensions_.width_) / 2.0},
-                    {static_cast<double>(obj->boundingbox_.center_.x_) - static_cast<double>(obj->boundingbox_.dimensions_.length_) / 2.0,
-                     static_cast<double>(obj->boundingbox_.center_.y_) - static_cast<double>(obj->boundingbox_.dimensions_.width_) / 2.0},
-                    {static_cast<double>(obj->boundingbox_.center_.x_) + static_cast<double>(obj->boundingbox_.dimensions_.length_) / 2.0,
-                     static_cast<double>(obj->boundingbox_.center_.y_) - static_cast<double>(obj->boundingbox_.dimensions_.width_) / 2.0}};
-
-                for (int l = 0; l < 4; l++)
-                {
-                    double point_to_project[2];
-
-                    // Align projection points to object heading
-                    RotateVec2D(vertices[l][0], vertices[l][1], obj->pos_.GetH(), point_to_project[0], point_to_project[1]);
-
-                    double dot_p = GetDotProduct2D(obj->pos_.GetX() + point_to_project[0], obj->pos_.GetY() + point_to_project[1], n1[0], n1[1]);
-
-                    if (l == 0)
-                    {
-                        min[k] = max[k] = dot_p;
-                    }
-                    else
-                    {
-                        min[k] = MIN(dot_p, min[k]);
-                        max[k] = MAX(dot_p, max[k]);
-                    }
-                }
-            }
+            ProjectOBB2D(obb0, n, min[0], max[0]);
+            ProjectOBB2D(obb1, n, min[1], max[1]);
 
             if (((min[0] < min[1] - SMALL_NUMBER) && (max[0] < min[1] - SMALL_NUMBER)) ||
                 ((max[0] > max[1] + SMALL_NUMBER) && (min[0] > max[1] + SMALL_NUMBER)))
@@ -404,31 +387,25 @@ bool Object::CollisionAndRelativeDistLatLong(Object* target, double* distLat, do
                     // measure gap relative pivot vehicle
                     if (i == 0)
                     {
+                        double d = 0.0;
                         if (min[0] < min[1] - SMALL_NUMBER && max[0] < min[1] - SMALL_NUMBER)
                         {
-                            if (j == 0)
-                            {
-                                if (distLat)
-                                    *distLat = min[1] - max[0];
-                            }
-                            else
-                            {
-                                if (distLong)
-                                    *distLong = min[1] - max[0];
-                            }
+                            d = min[1] - max[0];
+                        }
+                        else
+                        {
+                            d = -(min[0] - max[1]);
+                        }
+
+                        if (j == 0)
+                        {
+                            if (distLat)
+                                *distLat = d;
                         }
                         else
                         {
-                            if (j == 0)
-                            {
-                                if (distLat)
-                                    *distLat = -(min[0] - max[1]);
-                            }
-                            else
-                            {
-                                if (distLong)
-                                    *distLong = -(min[0] - max[1]);
-                            }
+                            if (distLong)
+                                *distLong = d;
                         }
                     }
                 }
@@ -442,80 +419,19 @@ bool Object::CollisionAndRelativeDistLatLong(Object* target, double* distLat, do
 double Object::PointCollision(double x, double y)
 {
     // Apply method Separating Axis Theorem (SAT)
-    // http://www.euclideanspace.com/threed/games/examples/cars/collisions/
-    // https://www.sevenson.com.au/actionscript/sat/
+    // For each axis of the bounding box, check whether the projected point
+    // falls outside the projection of the box
 
-    // Idea:
-    // For each side of the bounding box:
-    //   The normal of that edge will be the projection axis
-    //   Project the point and all axis of the bounding boxe onto that axis
-    //   If we find ONE side with a gap between point clusters from BB1 and BB2,
-    //   it's enough to conclude they are not overlapping/colliding
-    //
-    // Optimization: Since the bounding boxes are boxes with parallel
-    // sides, we only need to check half of the sides
-
-    Object* obj0 = this;
+    const OBB& obb = GetOBB();
 
-    double n0[2] = {0.0, 0.0};
     for (int j = 0; j < 2; j++)  // for longitudinal and lateral sides
     {
-        if (j == 0)
-        {
-            // Normal for longitudinal side (sides) points along lateral side
-            n0[0] = 0.0;
-            n0[1] = 1.0;
-        }
-        else
-        {
-            // Normal for lateral side (front/rear) points along lateral side
-            n0[0] = 1.0;
-            n0[1] = 0.0;
-        }
+        double min = 0.0, max = 0.0;
+        ProjectOBB2D(obb, obb.axis[1 - j], min, max);
 
-        // Rotate the normal/projection axis to align with bounding box/vehicle
-        double n1[2] = {0.0, 0.0};
-        RotateVec2D(n0[0], n0[1], obj0->pos_.GetH(), n1[0], n1[1]);
-
-        // Now, project each point of each BB onto the rotated normal
-        // And register min and max for point cluster of each BB
-        double min[2] = {0.0, 0.0}, max[2] = {0.0, 0.0};
-
-        // Specify bounding box corner vertices, starting at first quadrant
-        double vertices[4][2] = {
-            {static_cast<double>(obj0->boundingbox_.center_.x_) + static_cast<double>(obj0->boundingbox_.dimensions_.length_) / 2.0,
-             static_cast<double>(obj0->boundingbox_.center_.y_) + static_cast<double>(obj0->boundingbox_.dimensions_.width_) / 2.0},
-            {static_cast<double>(obj0->boundingbox_.center_.x_) - static_cast<double>(obj0->boundingbox_.dimensions_.length_) / 2.0,
-             static_cast<double>(obj0->boundingbox_.center_.y_) + static_cast<double>(obj0->boundingbox_.dimensions_.width_) / 2.0},
-            {static_cast<double>(obj0->boundingbox_.center_.x_) - static_cast<double>(obj0->boundingbox_.dimensions_.length_) / 2.0,
-             static_cast<double>(obj0->boundingbox_.center_.y_) - static_cast<double>(obj0->boundingbox_.dimensions_.width_) / 2.0},
-            {static_cast<double>(obj0->boundingbox_.center_.x_) + static_cast<double>(obj0->boundingbox_.dimensions_.length_) / 2.0,
-             static_cast<double>(obj0->boundingbox_.center_.y_) - static_cast<double>(obj0->boundingbox_.dimensions_.width_) / 2.0}};
-
-        for (int l = 0; l < 4; l++)
-        {
-            double point_to_project[2];
-
-            // Align projection points to object heading
-            RotateVec2D(vertices[l][0], vertices[l][1], obj0->pos_.GetH(), point_to_project[0], point_to_project[1]);
-
-            double dot_p = GetDotProduct2D(obj0->pos_.GetX() + point_to_project[0], obj0->pos_.GetY() + point_to_project[1], n1[0], n1[1]);
-
-            if (l == 0)
-            {
-                min[0] = max[0] = dot_p;
-            }
-            else
-            {
-                min[0] = MIN(dot_p, min[0]);
-                max[0] = MAX(dot_p, max[0]);
-            }
-        }
+        double dot_p = GetDotProduct2D(x, y, obb.axis[1 - j][0], obb.axis[1 - j][1]);
 
-        double dot_p = GetDotProduct2D(x, y, n1[0], n1[1]);
-
-        if (((min[0] < dot_p - SMALL_NUMBER) && (max[0] < dot_p - SMALL_NUMBER)) ||
-            ((max[0] > dot_p + SMALL_NUMBER) && (min[0] > dot_p + SMALL_NUMBER)))
+        if (((min < dot_p - SMALL_NUMBER) && (max < dot_p - SMALL_NUMBER)) || ((max > dot_p + SMALL_NUMBER) && (min > dot_p + SMALL_NUMBER)))
         {
             // gap found - no collision
             return false;
@@ -549,72 +465,13 @@ double Object::FreeSpaceDistance(Object* target, double* latDist, double* longDi
     }
 
     // OK, they are not overlapping. Now find the distance.
-    // Strategy: Brute force check all vertices of one bounding box
-    // against all sides of the other bounding box - then switch to
-    // check vertices of the other bounding box against the sides
-    // of the first bounding box.
-
-    double vertices[2][4][2];
-
-    for (int i = 0; i < 2; i++)  // for each of the two BBs
-    {
-        Object* obj = (i == 0 ? this : target);
-
-        // Specify bounding box corner vertices, starting at first quadrant
-        double vtmp[4][2] = {{static_cast<double>(obj->boundingbox_.center_.x_) + static_cast<double>(obj->boundingbox_.dimensions_.length_) / 2.0,
-                              static_cast<double>(obj->boundingbox_.center_.y_) + static_cast<double>(obj->boundingbox_.dimensions_.width_) / 2.0},
-                             {static_cast<double>(obj->boundingbox_.center_.x_) - static_cast<double>(obj->boundingbox_.dimensions_.length_) / 2.0,
-                              static_cast<double>(obj->boundingbox_.center_.y_) + static_cast<double>(obj->boundingbox_.dimensions_.width_) / 2.0},
-                             {static_cast<double>(obj->boundingbox_.center_.x_) - static_cast<double>(obj->boundingbox_.dimensions_.length_) / 2.0,
-                              static_cast<double>(obj->boundingbox_.center_.y_) - static_cast<double>(obj->boundingbox_.dimensions_.width_) / 2.0},
-                             {static_cast<double>(obj->boundingbox_.center_.x_) + static_cast<double>(obj->boundingbox_.dimensions_.length_) / 2.0,
-                              static_cast<double>(obj->boundingbox_.center_.y_) - static_cast<double>(obj->boundingbox_.dimensions_.width_) / 2.0}};
-
-        for (int j = 0; j < 4; j++)  // for all vertices
-        {
-            // Align points to object heading and position
-            RotateVec2D(vtmp[j][0], vtmp[j][1], obj->pos_.GetH(), vertices[i][j][0], vertices[i][j][1]);
-            vertices[i][j][0] += obj->pos_.GetX();
-            vertices[i][j][1] += obj->pos_.GetY();
-        }
-    }
-
-    for (int i = 0; i < 2; i++)  // for each of the two BBs
-    {
-        int vindex = (i == 0 ? 0 : 1);
-
-        for (int j = 0; j < 4; j++)  // for all vertices
-        {
-            double point[2] = {vertices[vindex][j][0], vertices[vindex][j][1]};
-
-            for (int k = 0; k < 4; k++)  // for all sides/edges in the other bounding box
-            {
-                double edge[2][2];
-                edge[0][0] = vertices[(vindex + 1) % 2][k][0];
-                edge[0][1] = vertices[(vindex + 1) % 2][k][1];
-                edge[1][0] = vertices[(vindex + 1) % 2][(k + 1) % 4][0];
-                edge[1][1] = vertices[(vindex + 1) % 2][(k + 1) % 4][1];
-
-                double xProj   = 0;
-                double yProj   = 0;
-                double tmpDist = DistanceFromPointToEdge2D(point[0], point[1], edge[0][0], edge[0][1], edge[1][0], edge[1][1], &xProj, &yProj);
-
-                if (tmpDist < minDist)
-                {
-                    minDist = tmpDist;
-                }
-            }
-        }
-    }
-
-    return minDist;
+    return FreeSpaceDistanceOBB2D(GetOBB(), target->GetOBB());
 }
 
 double Object::FreeSpaceDistancePoint(double x, double y, double* latDist, double* longDist)
 {
-    double minDist = LARGE_NUMBER;
-    *latDist       = LARGE_NUMBER;
-    *longDist      = LARGE_NUMBER;
+    *latDist  = LARGE_NUMBER;
+    *longDist = LARGE_NUMBER;
 
     if (PointCollision(x, y))
     {
@@ -623,58 +480,14 @@ double Object::FreeSpaceDistancePoint(double x, double y, double* latDist, doubl
         return 0.0;
     }
 
-    // OK, they are not overlapping. Now find the distance.
-    // Strategy: Brute force check point against all sides
-    // of the bounding box
-
-    Object* obj = this;
-
-    double vertices[4][2];
-
-    // Specify bounding box corner vertices, starting at first quadrant
-    double vtmp[4][2] = {{static_cast<double>(obj->boundingbox_.center_.x_) + static_cast<double>(obj->boundingbox_.dimensions_.length_) / 2.0,
-                          static_cast<double>(obj->boundingbox_.center_.y_) + static_cast<double>(obj->boundingbox_.dimensions_.width_) / 2.0},
-                         {static_cast<double>(obj->boundingbox_.center_.x_) - static_cast<double>(obj->boundingbox_.dimensions_.length_) / 2.0,
-                          static_cast<double>(obj->boundingbox_.center_.y_) + static_cast<double>(obj->boundingbox_.dimensions_.width_) / 2.0},
-                         {static_cast<double>(obj->boundingbox_.center_.x_) - static_cast<double>(obj->boundingbox_.dimensions_.length_) / 2.0,
-                          static_cast<double>(obj->boundingbox_.center_.y_) - static_cast<double>(obj->boundingbox_.dimensions_.width_) / 2.0},
-                         {static_cast<double>(obj->boundingbox_.center_.x_) + static_cast<double>(obj->boundingbox_.dimensions_.length_) / 2.0,
-                          static_cast<double>(obj->boundingbox_.center_.y_) - static_cast<double>(obj->boundingbox_.dimensions_.width_) / 2.0}};
+    // OK, they are not overlapping. Find closest point on the bounding box.
+    double xProj   = 0;
+    double yProj   = 0;
+    double minDist = DistanceFromPointToOBB2D(GetOBB(), x, y, &xProj, &yProj);
 
-    for (int j = 0; j < 4; j++)  // for all vertices
-    {
-        // Align points to object heading and position
-        RotateVec2D(vtmp[j][0], vtmp[j][1], obj->pos_.GetH(), vertices[j][0], vertices[j][1]);
-        vertices[j][0] += obj->pos_.GetX();
-        vertices[j][1] += obj->pos_.GetY();
-    }
-
-    double point[2] = {x, y};
-
-    for (int k = 0; k < 4; k++)  // for all sides/edges of the bounding box
-    {
-        double edge[2][2];
-        edge[0][0] = vertices[k][0];
-        edge[0][1] = vertices[k][1];
-        edge[1][0] = vertices[(k + 1) % 4][0];
-        edge[1][1] = vertices[(k + 1) % 4][1];
-
-        double xProj   = 0;
-        double yProj   = 0;
-        double tmpDist = DistanceFromPointToEdge2D(point[0], point[1], edge[0][0], edge[0][1], edge[1][0], edge[1][1], &xProj, &yProj);
-
-        if (tmpDist < minDist)
-        {
-            minDist = tmpDist;
-
-            if (latDist && longDist)
-            {
-                // Calculate x, y components of the distance in vehicle reference system
-                // y points left in vehicle ref system, x forward
-                RotateVec2D(point[0] - xProj, point[1] - yProj, -this->pos_.GetH(), *longDist, *latDist);
-            }
-        }
-    }
+    // Calculate x, y components of the distance in vehicle reference system
+    // y points left in vehicle ref system, x forward
+    RotateVec2D(x - xProj, y - yProj, -this->pos_.GetH(), *longDist, *latDist);
 
     return minDist;
 }
@@ -696,23 +509,13 @@ int Object::FreeSpaceDistancePointRoadLane(double x, double y, double* latDist,
         cs = CoordinateSystem::CS_ROAD;
     }
 
-    // Specify bounding box corner vertices, starting at first quadrant
-    double vtmp[4][2] = {{static_cast<double>(boundingbox_.center_.x_) + static_cast<double>(boundingbox_.dimensions_.length_) / 2.0,
-                          static_cast<double>(boundingbox_.center_.y_) + static_cast<double>(boundingbox_.dimensions_.width_) / 2.0},
-                         {static_cast<double>(boundingbox_.center_.x_) - static_cast<double>(boundingbox_.dimensions_.length_) / 2.0,
-                          static_cast<double>(boundingbox_.center_.y_) + static_cast<double>(boundingbox_.dimensions_.width_) / 2.0},
-                         {static_cast<double>(boundingbox_.center_.x_) - static_cast<double>(boundingbox_.dimensions_.length_) / 2.0,
-                          static_cast<double>(boundingbox_.center_.y_) - static_cast<double>(boundingbox_.dimensions_.width_) / 2.0},
-                         {static_cast<double>(boundingbox_.center_.x_) + static_cast<double>(boundingbox_.dimensions_.length_) / 2.0,
-                          static_cast<double>(boundingbox_.center_.y_) - static_cast<double>(boundingbox_.dimensions_.width_) / 2.0}};
-
-    // Align points to object heading and position
-    double vertices[4][3];
+    // Bounding box corner vertices, aligned to object heading and position
+    const OBB& obb = GetOBB();
+    double     vertices[4][3];
     for (int i = 0; i < 4; i++)
     {
-        RotateVec2D(vtmp[i][0], vtmp[i][1], pos_.GetH(), vertices[i][0], vertices[i][1]);
-        vertices[i][0] += pos_.GetX();
-        vertices[i][1] += pos_.GetY();
+        vertices[i][0] = obb.corners[i][0];
+        vertices[i][1] = obb.corners[i][1];
         vertices[i][2] = pos_.GetH();
     }
 
@@ -839,24 +642,14 @@ int Object::FreeSpaceDistanceObjectRoadLane(Object* target, PositionDiff* posDif
 
     for (int i = 0; i < 2; i++)  // for each of the two BBs
     {
-        Object* obj = (i == 0 ? this : target);
-
-        // Specify bounding box corner vertices, starting at first quadrant
-        double vtmp[4][2] = {{static_cast<double>(obj->boundingbox_.center_.x_) + static_cast<double>(obj->boundingbox_.dimensions_.length_) / 2.0,
-                              static_cast<double>(obj->boundingbox_.center_.y_) + static_cast<double>(obj->boundingbox_.dimensions_.width_) / 2.0},
-                             {static_cast<double>(obj->boundingbox_.center_.x_) - static_cast<double>(obj->boundingbox_.dimensions_.length_) / 2.0,
-                              static_cast<double>(obj->boundingbox_.center_.y_) + static_cast<double>(obj->boundingbox_.dimensions_.width_) / 2.0},
-                             {static_cast<double>(obj->boundingbox_.center_.x_) - static_cast<double>(obj->boundingbox_.dimensions_.length_) / 2.0,
-                              static_cast<double>(obj->boundingbox_.center_.y_) - static_cast<double>(obj->boundingbox_.dimensions_.width_) / 2.0},
-                             {static_cast<double>(obj->boundingbox_.center_.x_) + static_cast<double>(obj->boundingbox_.dimensions_.length_) / 2.0,
-                              static_cast<double>(obj->boundingbox_.center_.y_) - static_cast<double>(obj->boundingbox_.dimensions_.width_) / 2.0}};
+        Object*    obj = (i == 0 ? this : target);
+        const OBB& obb = obj->GetOBB();
 
         for (int j = 0; j < 4; j++)  // for all vertices
         {
-            // Align points to object heading and position
-            RotateVec2D(vtmp[j][0], vtmp[j][1], obj->pos_.GetH(), vertices[i][j][0], vertices[i][j][1]);
-            vertices[i][j][0] += obj->pos_.GetX();
-            vertices[i][j][1] += obj->pos_.GetY();
+            // Bounding box corner, aligned to object heading and position
+            vertices[i][j][0] = obb.corners[j][0];
+            vertices[i][j][1] = obb.corners[j][1];
             vertices[i][j][2] = obj->pos_.GetH();
 
             // Map XY points to road coordinates, but consider only roads reachable from point
@@ -1196,6 +989,8 @@ int Entities::addObject(Object* obj, bool activate, int call_index)
     if (activate)
     {
         object_.push_back(obj);
+        tow_links_version_ = -1;
+        PostEvent(EntityEvent::Type::ADDED, obj->id_);
     }
     else
     {
@@ -1230,7 +1025,9 @@ int Entities::activateObject(Object* obj, int call_index)
     if (n_active_objs == 0)
     {
         object_.push_back(obj);
+        tow_links_version_ = -1;
         obj->SetActive(true);
+        PostEvent(EntityEvent::Type::ADDED, obj->id_);
 
         int n_objs = static_cast<int>(std::count(object_pool_.begin(), object_pool_.end(), obj));
         if (n_objs == 1)
@@ -1275,7 +1072,9 @@ int Entities::deactivateObject(Object* obj, int call_index)
     if (n_active_objs == 1)
     {
         object_.erase(std::remove(object_.begin(), object_.end(), obj), object_.end());
+        tow_links_version_ = -1;
         obj->SetActive(false);
+        PostEvent(EntityEvent::Type::REMOVED, obj->id_);
 
         int n_objs = static_cast<int>(std::count(object_pool_.begin(), object_pool_.end(), obj));
         if (n_objs == 0)
@@ -1352,12 +1151,101 @@ void Entities::removeObject(Object* object, bool recursive)
         }
     }
 
-    object_.erase(std::remove(object_.begin(), object_.end(), object), object_.end());
+    auto it = std::remove(object_.begin(), object_.end(), object);
+    if (it != object_.end())
+    {
+        object_.erase(it, object_.end());
+        tow_links_version_ = -1;
+        PostEvent(EntityEvent::Type::REMOVED, object->id_);
+    }
     delete object;
 
     return;
 }
 
+const std::vector<Entities::TowLink>& Entities::GetTowLinks()
+{
+    if (tow_links_version_ == Vehicle::GetTrailerConnectionVersion())
+    {
+        return tow_links_;
+    }
+
+    tow_links_.clear();
+    for (size_t i = 0; i < object_.size(); i++)
+    {
+        if (!object_[i]->TowVehicle() && object_[i]->TrailerVehicle())
+        {
+            // Found a front tow vehicle, add links all the way to the last trailer
+            Vehicle* tow_vehicle = static_cast<Vehicle*>(object_[i]);
+            Vehicle* trailer     = static_cast<Vehicle*>(tow_vehicle->TrailerVehicle());
+            while (trailer && tow_links_.size() < object_.size())  // size limit guards against circular connections
+            {
+                tow_links_.push_back({tow_vehicle, trailer});
+                tow_vehicle = trailer;
+                trailer     = static_cast<Vehicle*>(trailer->TrailerVehicle());
+            }
+        }
+    }
+    tow_links_version_ = Vehicle::GetTrailerConnectionVersion();
+
+    return tow_links_;
+}
+
+void Entities::setObjectModel3D(Object* obj, const std::string& model3d)
+{
+    if (obj->model3d_ == model3d)
+    {
+        return;
+    }
+
+    obj->model3d_ = model3d;
+    if (std::find(object_.begin(), object_.end(), obj) != object_.end())
+    {
+        PostEvent(EntityEvent::Type::MODEL_CHANGED, obj->id_);
+    }
+}
+
+int Entities::SubscribeEvents()
+{
+    int                       subscriber = next_subscriber_++;
+    std::vector<EntityEvent>& queue      = event_queues_[subscriber];
+
+    // Catch up with objects already active
+    for (size_t i = 0; i < object_.size(); i++)
+    {
+        queue.push_back({EntityEvent::Type::ADDED, object_[i]->id_});
+    }
+
+    return subscriber;
+}
+
+void Entities::UnsubscribeEvents(int subscriber)
+{
+    event_queues_.erase(subscriber);
+}
+
+int Entities::PollEvents(int subscriber, std::vector<EntityEvent>& events)
+{
+    events.clear();
+
+    auto it = event_queues_.find(subscriber);
+    if (it != event_queues_.end())
+    {
+        // swap to keep allocated capacity of both vectors for next round
+        events.swap(it->second);
+    }
+
+    return static_cast<int>(events.size());
+}
+
+void Entities::PostEvent(EntityEvent::Type type, int id)
+{
+    for (auto& queue : event_queues_)
+    {
+        queue.second.push_back({type, id});
+    }
+}
+
 bool Entities::nameExists(std::string name)
 {
     for (size_t i = 0; i < object_.size(); i++)
@@ -1437,11 +1325,14 @@ Vehicle::~Vehicle()
 {
 }
 
+int Vehicle::trailer_connection_version_ = 0;
+
 int Vehicle::ConnectTrailer(Vehicle* trailer)
 {
     if (trailer && trailer->trailer_coupler_)
     {
         trailer->trailer_coupler_->tow_vehicle_ = this;
+        trailer_connection_version_++;
         if (trailer_hitch_)
         {
             trailer_hitch_->trailer_vehicle_ = trailer;
@@ -1458,6 +1349,7 @@ int Vehicle::DisconnectTrailer()
     {
         reinterpret_cast<Vehicle*>(trailer_hitch_->trailer_vehicle_)->trailer_coupler_->tow_vehicle_ = nullptr;
         trailer_hitch_->trailer_vehicle_                                                             = nullptr;
+        trailer_connection_version_++;
     }
 
     return 0;
@@ -184,6 +184,11 @@ namespace scenarioengine
 
         std::vector<Object*> collisions_;
 
+        /**
+            Oriented bounding box in world coordinates
+        */
+        typedef OBB2D OBB;
+
         Object(Type type);
         Object(const Object& o) = default;
         virtual ~Object()
@@ -280,6 +285,14 @@ namespace scenarioengine
         */
         double FreeSpaceDistancePoint(double x, double y, double* latDist, double* longDist);
 
+        /**
+                Get the oriented bounding box in world coordinates. The box is cached and only
+                recalculated when position, heading or bounding box has changed since last call,
+                i.e. typically once per frame.
+                @return Reference to the cached OBB
+        */
+        const OBB& GetOBB();
+
         int FreeSpaceDistancePointRoadLane(double x, double y, double* latDist, double* longDist, roadmanager::CoordinateSystem cs);
         int FreeSpaceDistanceObjectRoadLane(Object* target, roadmanager::PositionDiff* diff, roadmanager::CoordinateSystem cs);
 
@@ -517,8 +530,10 @@ namespace scenarioengine
         static std::string Type2String(int type);
 
     private:
-        int  dirty_;
-        bool is_active_;
+        int    dirty_;
+        bool   is_active_;
+        OBB    obb_;
+        double obb_key_[7];  // position, heading and bounding box which the cached OBB corresponds to
 
         void SetActive(bool active)
         {
@@ -672,6 +687,17 @@ namespace scenarioengine
         static std::string              Role2String(int role);
         std::shared_ptr<TrailerCoupler> trailer_coupler_;  // mounting point to any tow vehicle
         std::shared_ptr<TrailerHitch>   trailer_hitch_;    // mounting point to any tow vehicle
+
+        /**
+        Counter incremented whenever any trailer is connected or disconnected
+        */
+        static int GetTrailerConnectionVersion()
+        {
+            return trailer_connection_version_;
+        }
+
+    private:
+        static int trailer_connection_version_;
     };
 
     class Pedestrian : public Object
@@ -845,7 +871,27 @@ namespace scenarioengine
     class Entities
     {
     public:
-        Entities() : nextId_(0)
+        // Connection between a tow vehicle and its trailer
+        struct TowLink
+        {
+            Vehicle* tow_vehicle;
+            Vehicle* trailer;
+        };
+
+        // Change of the set of active objects, or of the 3D model of an active object
+        struct EntityEvent
+        {
+            enum class Type
+            {
+                ADDED,          // object activated, i.e. added to object_
+                REMOVED,        // object deactivated or deleted, must not be dereferenced by its id anymore
+                MODEL_CHANGED,  // model3d_ of an active object changed
+            };
+            Type type;
+            int  id;
+        };
+
+        Entities() : nextId_(0), tow_links_version_(-1), next_subscriber_(0)
         {
         }
         ~Entities()
@@ -877,8 +923,50 @@ namespace scenarioengine
         Object* GetObjectById(int id);
         int     GetObjectIdxById(int id);
 
+        /**
+        Get all tow vehicle - trailer connections among active objects. Links are ordered from front to rear of each
+        vehicle combination, so that a trailer is always listed after its tow vehicle. The list is rebuilt only when
+        objects or trailer connections have changed.
+        @return Reference to the list of tow links
+        */
+        const std::vector<TowLink>& GetTowLinks();
+
+        /**
+        Change 3D model of an object, notifying event subscribers if the object is active
+        @param obj Object to update
+        @param model3d Filename of the new model
+        */
+        void setObjectModel3D(Object* obj, const std::string& model3d);
+
+        /**
+        Subscribe to entity events. The subscriber initially receives an ADDED event for each currently active object,
+        then every event in the order they occur. Events are queued until fetched by PollEvents().
+        @return Subscriber handle, to use in PollEvents() and UnsubscribeEvents()
+        */
+        int SubscribeEvents();
+
+        /**
+        Stop queuing events for given subscriber
+        @param subscriber Handle returned from SubscribeEvents()
+        */
+        void UnsubscribeEvents(int subscriber);
+
+        /**
+        Fetch and clear pending events of given subscriber
+        @param subscriber Handle returned from SubscribeEvents()
+        @param events Resulting list of events in order of occurrence, replaces any existing content
+        @return Number of events
+        */
+        int PollEvents(int subscriber, std::vector<EntityEvent>& events);
+
     private:
-        int nextId_;  // Is incremented for each new object created
+        void PostEvent(EntityEvent::Type type, int id);
+
+        int                                     nextId_;  // Is incremented for each new object created
+        std::vector<TowLink>                    tow_links_;
+        int                                     tow_links_version_;  // trailer connection version of tow_links_, -1 means outdated
+        std::map<int, std::vector<EntityEvent>> event_queues_;       // pending events per subscriber
+        int                                     next_subscriber_;
     };
 
 }  // namespace scenarioengine
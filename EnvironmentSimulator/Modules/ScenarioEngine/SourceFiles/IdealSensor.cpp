@@ -61,6 +61,20 @@ void ObjectSensor::Update()
 {
     nObj_ = 0;
 
+    // Sensor pose is the same for all objects
+    double hx2, hy2;
+    RotateVec2D(1.0, 0.0, host_->pos_.GetH(), hx2, hy2);
+
+    double sensor_pos_x, sensor_pos_y;
+    RotateVec2D(pos_.x, pos_.y, host_->pos_.GetH(), sensor_pos_x, sensor_pos_y);
+    pos_.x_global = host_->pos_.GetX() + sensor_pos_x;
+    pos_.y_global = host_->pos_.GetY() + sensor_pos_y;
+    pos_.z_global = host_->pos_.GetZ() + pos_.z;
+
+    candidates_.clear();
+    candidate_x_.clear();
+    candidate_y_.clear();
+
     for (size_t i = 0; i < entities_->object_.size(); i++)
     {
         Object *obj = entities_->object_[i];
@@ -76,32 +90,31 @@ void ObjectSensor::Update()
             continue;
         }
 
-        // Check whether object is within field of view
-
-        // find out angle between heading vector and line to object
-        double hx = 1.0;
-        double hy = 0.0;
-        double hx2, hy2;
-        RotateVec2D(hx, hy, host_->pos_.GetH(), hx2, hy2);
+        candidates_.push_back(obj);
+        candidate_x_.push_back(obj->pos_.GetX());
+        candidate_y_.push_back(obj->pos_.GetY());
+    }
 
-        double sensor_pos_x, sensor_pos_y;
-        RotateVec2D(pos_.x, pos_.y, host_->pos_.GetH(), sensor_pos_x, sensor_pos_y);
-        pos_.x_global = host_->pos_.GetX() + sensor_pos_x;
-        pos_.y_global = host_->pos_.GetY() + sensor_pos_y;
-        pos_.z_global = host_->pos_.GetZ() + pos_.z;
+    // Measure distance to all candidates in one go
+    candidate_dist_sq_.resize(candidates_.size());
+    PointSquareDistance2D(pos_.x_global, pos_.y_global, candidate_x_.data(), candidate_y_.data(), candidate_dist_sq_.data(), candidates_.size());
 
-        // Find vector from host to object
-        double xo = obj->pos_.GetX() - pos_.x_global;
-        double yo = obj->pos_.GetY() - pos_.y_global;
+    for (size_t i = 0; i < candidates_.size(); i++)
+    {
+        Object *obj = candidates_[i];
 
         // First check distance
-        double dist_sq = (xo * xo + yo * yo);
-        if (dist_sq < near_sq_ || dist_sq > far_sq_)
+        if (candidate_dist_sq_[i] < near_sq_ || candidate_dist_sq_[i] > far_sq_)
         {
             // Not within near and far radius/distance
             continue;
         }
 
+        // Check whether object is within field of view
+        // find out angle between heading vector and line to object
+        double xo = candidate_x_[i] - pos_.x_global;
+        double yo = candidate_y_[i] - pos_.y_global;
+
         double xon, yon;
         NormalizeVec2D(xo, yo, xon, yon);
 
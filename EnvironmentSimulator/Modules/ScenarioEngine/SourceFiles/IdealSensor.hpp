@@ -96,6 +96,12 @@ namespace scenarioengine
 
     private:
         Entities *entities_;  // Reference to the global collection of objects within the scenario
+
+        // Candidate objects and their positions, kept between updates to avoid reallocation
+        std::vector<Object *> candidates_;
+        std::vector<double>   candidate_x_;
+        std::vector<double>   candidate_y_;
+        std::vector<double>   candidate_dist_sq_;
     };
 
 }  // namespace scenarioengine
@@ -13,6 +13,7 @@
 #include "CommonMini.hpp"
 #include "OSIReporter.hpp"
 #include <cmath>
+#include <unordered_map>
 
 #ifdef _WIN32
 #include <winsock2.h>
@@ -64,8 +65,40 @@ static struct
     osi3::MovingObject               *mobj;
     std::vector<osi3::Lane *>         ln;
     std::vector<osi3::LaneBoundary *> lnb;
+    std::unordered_map<int, int>      ln_idx;   // lane global id -> index in ln
+    std::unordered_map<int, int>      lnb_idx;  // lane boundary global id -> index in lnb
+    std::unordered_map<int, int>      tl_idx;   // signal id -> index in ground truth traffic lights
 } obj_osi_internal;
 
+// OpenDRIVE id lookup tables, filled at start of the static ground truth update
+static struct
+{
+    std::unordered_map<int, roadmanager::Road *>     road;
+    std::unordered_map<int, roadmanager::Junction *> junction;
+} odr_lookup;
+
+static roadmanager::Road *LookupRoadById(int id)
+{
+    if (odr_lookup.road.empty())
+    {
+        return roadmanager::Position::GetOpenDrive()->GetRoadById(id);
+    }
+
+    auto it = odr_lookup.road.find(id);
+    return it != odr_lookup.road.end() ? it->second : nullptr;
+}
+
+static roadmanager::Junction *LookupJunctionById(int id)
+{
+    if (odr_lookup.junction.empty())
+    {
+        return roadmanager::Position::GetOpenDrive()->GetJunctionById(id);
+    }
+
+    auto it = odr_lookup.junction.find(id);
+    return it != odr_lookup.junction.end() ? it->second : nullptr;
+}
+
 static struct
 {
     osi3::GroundTruth *gt;
@@ -106,6 +139,11 @@ OSIReporter::OSIReporter()
     // Counter for OSI update
     osi_update_counter_ = 0;
 
+    moving_objects_frame_ = -1;
+
+    signal_state_version_        = 0;
+    all_traffic_lights_reported_ = false;
+
     nanosec_ = 0xffffffffffffffff;  // indicate not set
 }
 
@@ -137,6 +175,11 @@ OSIReporter::~OSIReporter()
 
     obj_osi_internal.ln.clear();
     obj_osi_internal.lnb.clear();
+    obj_osi_internal.ln_idx.clear();
+    obj_osi_internal.lnb_idx.clear();
+    obj_osi_internal.tl_idx.clear();
+    odr_lookup.road.clear();
+    odr_lookup.junction.clear();
 
     osiGroundTruth.size = 0;
     osiRoadLane.size    = 0;
@@ -258,16 +301,18 @@ int OSIReporter::ClearOSIGroundTruth()
     obj_osi_external.gt->clear_traffic_sign();
     obj_osi_external.gt->clear_road_marking();
 
+    all_traffic_lights_reported_ = false;
+
     return 0;
 }
 
-int OSIReporter::UpdateOSIGroundTruth(const std::vector<std::unique_ptr<ObjectState>> &objectState)
+int OSIReporter::UpdateOSIGroundTruth(const std::vector<std::unique_ptr<ObjectState>> &objectState, int frame)
 {
     if (osi_update_counter_ == 0)
     {
         UpdateOSIStaticGroundTruth(objectState);
     }
-    UpdateOSIDynamicGroundTruth(objectState);
+    UpdateOSIDynamicGroundTruth(objectState, true, frame);
 
     if (GetUDPClientStatus() == 0 || IsFileOpen())
     {
@@ -321,11 +366,26 @@ int OSIReporter::UpdateOSIGroundTruth(const std::vector<std::unique_ptr<ObjectSt
 
 int OSIReporter::UpdateOSIStaticGroundTruth(const std::vector<std::unique_ptr<ObjectState>> &objectState)
 {
-    // First pick objects from the OpenSCENARIO description
     static roadmanager::OpenDrive *opendrive = roadmanager::Position::GetOpenDrive();
-    for (size_t i = 0; i < static_cast<unsigned int>(opendrive->GetNumOfRoads()); i++)
+
+    // Establish id lookup tables once, instead of linear searches per road link
+    odr_lookup.road.clear();
+    odr_lookup.junction.clear();
+    for (int i = 0; i < opendrive->GetNumOfRoads(); i++)
+    {
+        roadmanager::Road *road        = opendrive->GetRoadByIdx(i);
+        odr_lookup.road[road->GetId()] = road;
+    }
+    for (int i = 0; i < opendrive->GetNumOfJunctions(); i++)
+    {
+        roadmanager::Junction *junction        = opendrive->GetJunctionByIdx(i);
+        odr_lookup.junction[junction->GetId()] = junction;
+    }
+
+    // Single pass over all roads, picking objects from the OpenDRIVE description and creating lanes and lane boundaries
+    for (int i = 0; i < opendrive->GetNumOfRoads(); i++)
     {
-        roadmanager::Road *road = opendrive->GetRoadByIdx(static_cast<int>(i));
+        roadmanager::Road *road = opendrive->GetRoadByIdx(i);
         if (road)
         {
             for (size_t j = 0; j < static_cast<unsigned int>(road->GetNumberOfObjects()); j++)
@@ -336,6 +396,9 @@ int OSIReporter::UpdateOSIStaticGroundTruth(const std::vector<std::unique_ptr<Ob
                     UpdateOSIStationaryObjectODR(road->GetId(), object);
                 }
             }
+
+            UpdateOSIRoadLane(road);
+            UpdateOSILaneBoundary(road);
         }
     }
 
@@ -358,10 +421,10 @@ int OSIReporter::UpdateOSIStaticGroundTruth(const std::vector<std::unique_ptr<Ob
         }
     }
 
-    UpdateOSIRoadLane();
-    UpdateOSILaneBoundary();
+    // Junction lanes refer to road lanes, so they are created after all roads have been processed
     UpdateOSIIntersection();
     UpdateTrafficSignals();
+    UpdateOSITrafficLightStates(true);
 
     // Set GeoReference in OSI as map_reference
     obj_osi_external.gt->set_map_reference(opendrive->GetGeoReferenceAsString());
@@ -371,6 +434,7 @@ int OSIReporter::UpdateOSIStaticGroundTruth(const std::vector<std::unique_ptr<Ob
     obj_osi_external.gt->mutable_lane_boundary()->CopyFrom(*obj_osi_internal.gt->mutable_lane_boundary());
     obj_osi_external.gt->mutable_traffic_sign()->CopyFrom(*obj_osi_internal.gt->mutable_traffic_sign());
     obj_osi_external.gt->mutable_traffic_light()->CopyFrom(*obj_osi_internal.gt->mutable_traffic_light());
+    all_traffic_lights_reported_ = true;
     obj_osi_external.gt->mutable_road_marking()->CopyFrom(*obj_osi_internal.gt->mutable_road_marking());
 
     obj_osi_external.gt->set_model_reference(stationary_model_reference);
@@ -378,9 +442,8 @@ int OSIReporter::UpdateOSIStaticGroundTruth(const std::vector<std::unique_ptr<Ob
     return 0;
 }
 
-int OSIReporter::UpdateOSIDynamicGroundTruth(const std::vector<std::unique_ptr<ObjectState>> &objectState, bool reportGhost)
+int OSIReporter::UpdateOSIDynamicGroundTruth(const std::vector<std::unique_ptr<ObjectState>> &objectState, bool reportGhost, int frame)
 {
-    obj_osi_internal.gt->clear_moving_object();
     obj_osi_internal.gt->clear_timestamp();
 
     if (IsTimeStampSetExplicit())
@@ -403,21 +466,15 @@ int OSIReporter::UpdateOSIDynamicGroundTruth(const std::vector<std::unique_ptr<O
         obj_osi_internal.gt->mutable_timestamp()->set_nanos(static_cast<uint32_t>(0));
     }
 
+    std::vector<ObjectState *> moving_objects;
     for (size_t i = 0; i < objectState.size(); i++)
     {
         if (objectState[i]->state_.info.obj_type == static_cast<int>(Object::Type::VEHICLE) ||
             objectState[i]->state_.info.obj_type == static_cast<int>(Object::Type::PEDESTRIAN))
         {
-            if (reportGhost)
-            {
-                UpdateOSIMovingObject(objectState[i].get());
-            }
-            else
+            if (reportGhost || objectState[i]->state_.info.ctrl_type != Controller::Type::GHOST_RESERVED_TYPE)
             {
-                if (objectState[i]->state_.info.ctrl_type != Controller::Type::GHOST_RESERVED_TYPE)
-                {
-                    UpdateOSIMovingObject(objectState[i].get());
-                }
+                moving_objects.push_back(objectState[i].get());
             }
         }
         else if (objectState[i]->state_.info.obj_type == static_cast<int>(Object::Type::MISC_OBJECT))
@@ -431,12 +488,120 @@ int OSIReporter::UpdateOSIDynamicGroundTruth(const std::vector<std::unique_ptr<O
         }
     }
 
+    // Moving objects of previous update can be kept if same objects in same order, then only changed ones are updated
+    bool keep = frame >= 0 && moving_objects_frame_ >= 0 && moving_objects.size() == moving_object_ids_.size() &&
+                obj_osi_internal.gt->moving_object_size() == static_cast<int>(moving_objects.size());
+    for (size_t i = 0; keep && i < moving_objects.size(); i++)
+    {
+        keep = moving_objects[i]->state_.info.id == moving_object_ids_[i];
+    }
+
+    if (keep)
+    {
+        for (size_t i = 0; i < moving_objects.size(); i++)
+        {
+            if (moving_objects[i]->changedSince(moving_objects_frame_))
+            {
+                UpdateOSIMovingObject(moving_objects[i], obj_osi_internal.gt->mutable_moving_object(static_cast<int>(i)));
+            }
+        }
+    }
+    else
+    {
+        obj_osi_internal.gt->clear_moving_object();
+        moving_object_ids_.clear();
+        for (size_t i = 0; i < moving_objects.size(); i++)
+        {
+            UpdateOSIMovingObject(moving_objects[i]);
+            moving_object_ids_.push_back(moving_objects[i]->state_.info.id);
+        }
+    }
+    moving_objects_frame_ = frame;
+
     obj_osi_external.gt->mutable_timestamp()->CopyFrom(*obj_osi_internal.gt->mutable_timestamp());
     obj_osi_external.gt->mutable_moving_object()->CopyFrom(*obj_osi_internal.gt->mutable_moving_object());
 
+    UpdateOSITrafficLightStates();
+
     return 0;
 }
 
+static void SetOSITrafficLightState(osi3::TrafficLight *trafficLight, const std::string &state)
+{
+    // Interpret state string as bulb states, e.g. "off;off;on" for red, yellow and green bulbs. Single color names are accepted as well.
+    osi3::TrafficLight_Classification_Color color = osi3::TrafficLight_Classification_Color::TrafficLight_Classification_Color_COLOR_OTHER;
+    osi3::TrafficLight_Classification_Mode  mode  = osi3::TrafficLight_Classification_Mode::TrafficLight_Classification_Mode_MODE_OFF;
+    static const osi3::TrafficLight_Classification_Color bulb_color[] = {
+        osi3::TrafficLight_Classification_Color::TrafficLight_Classification_Color_COLOR_RED,
+        osi3::TrafficLight_Classification_Color::TrafficLight_Classification_Color_COLOR_YELLOW,
+        osi3::TrafficLight_Classification_Color::TrafficLight_Classification_Color_COLOR_GREEN};
+
+    std::vector<std::string> bulbs = SplitString(state, ';');
+    for (size_t i = 0; i < bulbs.size(); i++)
+    {
+        std::string bulb = ToLower(bulbs[i]);
+        if (bulb == "red" || bulb == "yellow" || bulb == "amber" || bulb == "green")
+        {
+            color = bulb == "red" ? bulb_color[0] : (bulb == "green" ? bulb_color[2] : bulb_color[1]);
+            mode  = osi3::TrafficLight_Classification_Mode::TrafficLight_Classification_Mode_MODE_CONSTANT;
+            break;
+        }
+        else if (bulb == "on" || bulb == "flashing" || bulb == "blinking")
+        {
+            color = i < 3 && bulbs.size() == 3 ? bulb_color[i] : color;
+            mode  = bulb == "on" ? osi3::TrafficLight_Classification_Mode::TrafficLight_Classification_Mode_MODE_CONSTANT
+                                 : osi3::TrafficLight_Classification_Mode::TrafficLight_Classification_Mode_MODE_FLASHING;
+            break;
+        }
+    }
+
+    trafficLight->mutable_classification()->set_color(color);
+    trafficLight->mutable_classification()->set_mode(mode);
+}
+
+int OSIReporter::UpdateOSITrafficLightStates(bool key_frame)
+{
+    roadmanager::SignalStateRegistry &registry = roadmanager::Position::GetOpenDrive()->GetSignalStateRegistry();
+
+    if (!all_traffic_lights_reported_)
+    {
+        // static data has been cleared, remove lights reported in previous frame
+        obj_osi_external.gt->clear_traffic_light();
+    }
+
+    if (!key_frame && registry.GetVersion() == signal_state_version_)
+    {
+        changed_traffic_lights_.clear();
+        return 0;  // nothing changed
+    }
+
+    registry.GetChangedSignals(key_frame ? 0 : signal_state_version_, changed_traffic_lights_);
+    signal_state_version_ = registry.GetVersion();
+
+    for (size_t i = 0; i < changed_traffic_lights_.size(); i++)
+    {
+        auto it = obj_osi_internal.tl_idx.find(changed_traffic_lights_[i]);
+        if (it == obj_osi_internal.tl_idx.end())
+        {
+            continue;  // not a traffic light in the road network
+        }
+
+        osi3::TrafficLight *trafficLight = obj_osi_internal.gt->mutable_traffic_light(it->second);
+        SetOSITrafficLightState(trafficLight, registry.GetState(changed_traffic_lights_[i])->state);
+        if (all_traffic_lights_reported_)
+        {
+            obj_osi_external.gt->mutable_traffic_light(it->second)->CopyFrom(*trafficLight);
+        }
+        else
+        {
+            // report only the changed light
+            obj_osi_external.gt->add_traffic_light()->CopyFrom(*trafficLight);
+        }
+    }
+
+    return static_cast<int>(changed_traffic_lights_.size());
+}
+
 int OSIReporter::UpdateOSIHostVehicleData(ObjectState *objectState)
 {
     (void)objectState;  // avoid compiler warning
@@ -647,10 +812,19 @@ int OSIReporter::UpdateOSIStationaryObject(ObjectState *objectState)
     return 0;
 }
 
-int OSIReporter::UpdateOSIMovingObject(ObjectState *objectState)
+int OSIReporter::UpdateOSIMovingObject(ObjectState *objectState, osi3::MovingObject *mobj)
 {
-    // Create OSI Moving object
-    obj_osi_internal.mobj = obj_osi_internal.gt->add_moving_object();
+    if (mobj == nullptr)
+    {
+        // Create OSI Moving object
+        obj_osi_internal.mobj = obj_osi_internal.gt->add_moving_object();
+    }
+    else
+    {
+        // Reuse existing OSI Moving object, reset any previous content
+        mobj->Clear();
+        obj_osi_internal.mobj = mobj;
+    }
 
     // Set OSI Moving Object Mutable ID
     obj_osi_internal.mobj->mutable_id()->set_value(static_cast<unsigned int>(objectState->state_.info.id));
@@ -893,6 +1067,7 @@ int OSIReporter::UpdateOSIIntersection()
         std::vector<LaneLengthStruct> lane_lengths;
         std::vector<LaneLengthStruct> tmp_lane_lengths;
         std::set<int>                 connected_roads;
+        std::set<int>                 checked_connecting_roads;
         // //add check if it is an intersection or an highway exit/entry
         junction = opendrive->GetJunctionByIdx(i);
 
@@ -907,27 +1082,12 @@ int OSIReporter::UpdateOSIIntersection()
             // check all connections in the junction
             for (int j = 0; j < junction->GetNumberOfConnections(); j++)
             {
-                connection          = junction->GetConnectionByIdx(j);
-                incomming_road      = connection->GetIncomingRoad();
-                connecting_road     = connection->GetConnectingRoad();
-                new_connecting_road = true;
+                connection      = junction->GetConnectionByIdx(j);
+                incomming_road  = connection->GetIncomingRoad();
+                connecting_road = connection->GetConnectingRoad();
 
                 // check if the connecting road has been used before
-                for (unsigned int l = 0; l < lane_lengths.size(); l++)
-                {
-                    if (lane_lengths[l].id == connecting_road->GetId())
-                    {
-                        new_connecting_road = false;
-                    }
-                }
-
-                for (unsigned int l = 0; l < left_lane_lengths.size(); l++)
-                {
-                    if (left_lane_lengths[l].id == connecting_road->GetId())
-                    {
-                        new_connecting_road = false;
-                    }
-                }
+                new_connecting_road = checked_connecting_roads.insert(connecting_road->GetId()).second;
 
                 // get needed info about the incomming road
                 if (incomming_road->GetLink(roadmanager::LinkType::SUCCESSOR) != 0)
@@ -975,7 +1135,7 @@ int OSIReporter::UpdateOSIIntersection()
                         incomming_road->GetId());
                     return -1;
                 }
-                outgoing_road = opendrive->GetRoadById(roadlink->GetElementId());
+                outgoing_road = LookupRoadById(roadlink->GetElementId());
                 connected_roads.insert(incomming_road->GetId());
                 connected_roads.insert(outgoing_road->GetId());
                 // Get neccesary info about the outgoing road
@@ -1224,60 +1384,45 @@ int OSIReporter::UpdateOSIIntersection()
     }
 
     // Lets Update the antecessor and successor lanes of the lanes that are not intersections
-    // Get all the intersection lanes, this lanes have the predecessor and successor lanes information
-    std::vector<osi3::Lane *> IntersectionLanes;
+    // The intersection lanes have the predecessor and successor lanes information, visit each lane pairing once and look up
+    // the referred lane by id. Only the first matching pairing is registered for each lane.
     for (int i = 0; i < obj_osi_internal.gt->lane_size(); ++i)
     {
-        if (obj_osi_internal.gt->lane(i).classification().type() == osi3::Lane_Classification_Type::Lane_Classification_Type_TYPE_INTERSECTION)
+        const osi3::Lane &intersection_lane = obj_osi_internal.gt->lane(i);
+        if (intersection_lane.classification().type() != osi3::Lane_Classification_Type::Lane_Classification_Type_TYPE_INTERSECTION)
         {
-            IntersectionLanes.push_back(obj_osi_internal.gt->mutable_lane(i));
+            continue;
         }
-    }
 
-    // For each lane in OSI groundTruth
-    for (int i = 0; i < obj_osi_internal.gt->lane_size(); ++i)
-    {
-        // Check if the lane is in the intersection
-        for (unsigned int j = 0; j < IntersectionLanes.size(); ++j)
+        for (int k = 0; k < intersection_lane.classification().lane_pairing_size(); ++k)
         {
-            for (int k = 0; k < IntersectionLanes[j]->classification().lane_pairing_size(); ++k)
+            const osi3::Lane_Classification_LanePairing &pairing = intersection_lane.classification().lane_pairing(k);
+
+            // It lane is in predecesor of the intersection, then we add the intersection ID to the successor of the lane
+            if (pairing.has_antecessor_lane_id())
             {
-                // Check predecessors
-                if (IntersectionLanes[j]->classification().lane_pairing()[k].has_antecessor_lane_id())
+                int idx = GetLaneIdxfromIdOSI(static_cast<int>(pairing.antecessor_lane_id().value()));
+                if (idx >= 0 && obj_osi_internal.ln[static_cast<unsigned int>(idx)]->classification().lane_pairing_size() == 0)
                 {
-                    // It lane is in predecesor of the intersection
-                    if (obj_osi_internal.gt->lane(i).id().value() ==
-                        IntersectionLanes[j]->classification().lane_pairing()[k].antecessor_lane_id().value())
-                    {
-                        // then we add the intersection ID to the successor of the lane
-                        if (obj_osi_internal.gt->mutable_lane(i)->mutable_classification()->lane_pairing_size() == 0)
-                        {
-                            obj_osi_internal.gt->mutable_lane(i)
-                                ->mutable_classification()
-                                ->add_lane_pairing()
-                                ->mutable_successor_lane_id()
-                                ->set_value(IntersectionLanes[j]->id().value());
-                        }
-                    }
+                    obj_osi_internal.ln[static_cast<unsigned int>(idx)]
+                        ->mutable_classification()
+                        ->add_lane_pairing()
+                        ->mutable_successor_lane_id()
+                        ->set_value(intersection_lane.id().value());
                 }
+            }
 
-                // Check successors
-                if (IntersectionLanes[j]->classification().lane_pairing()[k].has_successor_lane_id())
+            // It lane is in successor of the intersection, then we add the intersection ID to the predecessor of the lane
+            if (pairing.has_successor_lane_id())
+            {
+                int idx = GetLaneIdxfromIdOSI(static_cast<int>(pairing.successor_lane_id().value()));
+                if (idx >= 0 && obj_osi_internal.ln[static_cast<unsigned int>(idx)]->classification().lane_pairing_size() == 0)
                 {
-                    // It lane is in successor of the intersection
-                    if (obj_osi_internal.gt->lane(i).id().value() ==
-                        IntersectionLanes[j]->classification().lane_pairing()[k].successor_lane_id().value())
-                    {
-                        // then we add the intersection ID to the predecessor of the lane
-                        if (obj_osi_internal.gt->mutable_lane(i)->mutable_classification()->lane_pairing_size() == 0)
-                        {
-                            obj_osi_internal.gt->mutable_lane(i)
-                                ->mutable_classification()
-                                ->add_lane_pairing()
-                                ->mutable_antecessor_lane_id()
-                                ->set_value(IntersectionLanes[j]->id().value());
-                        }
-                    }
+                    obj_osi_internal.ln[static_cast<unsigned int>(idx)]
+                        ->mutable_classification()
+                        ->add_lane_pairing()
+                        ->mutable_antecessor_lane_id()
+                        ->set_value(intersection_lane.id().value());
                 }
             }
         }
@@ -1286,259 +1431,248 @@ int OSIReporter::UpdateOSIIntersection()
     return 0;
 }
 
-int OSIReporter::UpdateOSILaneBoundary()
+int OSIReporter::UpdateOSILaneBoundary(roadmanager::Road *road)
 {
-    // Retrieve opendrive class from RoadManager
-    static roadmanager::OpenDrive *opendrive = roadmanager::Position::GetOpenDrive();
-
-    // Loop over all roads
-    for (int i = 0; i < opendrive->GetNumOfRoads(); i++)
+    // loop over all lane sections
+    for (int j = 0; j < road->GetNumberOfLaneSections(); j++)
     {
-        roadmanager::Road *road = opendrive->GetRoadByIdx(i);
+        roadmanager::LaneSection *lane_section = road->GetLaneSectionByIdx(j);
 
-        // loop over all lane sections
-        for (int j = 0; j < road->GetNumberOfLaneSections(); j++)
+        // loop over all lanes
+        for (int k = 0; k < lane_section->GetNumberOfLanes(); k++)
         {
-            roadmanager::LaneSection *lane_section = road->GetLaneSectionByIdx(j);
+            roadmanager::Lane *lane = lane_section->GetLaneByIdx(k);
 
-            // loop over all lanes
-            for (int k = 0; k < lane_section->GetNumberOfLanes(); k++)
+            int n_roadmarks = lane->GetNumberOfRoadMarks();
+            if (n_roadmarks != 0)  // if there are road marks
             {
-                roadmanager::Lane *lane = lane_section->GetLaneByIdx(k);
-
-                int n_roadmarks = lane->GetNumberOfRoadMarks();
-                if (n_roadmarks != 0)  // if there are road marks
+                // loop over RoadMarks
+                for (int ii = 0; ii < lane->GetNumberOfRoadMarks(); ii++)
                 {
-                    // loop over RoadMarks
-                    for (int ii = 0; ii < lane->GetNumberOfRoadMarks(); ii++)
+                    roadmanager::LaneRoadMark *laneroadmark = lane->GetLaneRoadMarkByIdx(ii);
+
+                    // loop over road mark types
+                    for (int jj = 0; jj < laneroadmark->GetNumberOfRoadMarkTypes(); jj++)
                     {
-                        roadmanager::LaneRoadMark *laneroadmark = lane->GetLaneRoadMarkByIdx(ii);
+                        roadmanager::LaneRoadMarkType *laneroadmarktype = laneroadmark->GetLaneRoadMarkTypeByIdx(jj);
 
-                        // loop over road mark types
-                        for (int jj = 0; jj < laneroadmark->GetNumberOfRoadMarkTypes(); jj++)
+                        int inner_index = -1;
+                        if (laneroadmark->GetType() == roadmanager::LaneRoadMark::RoadMarkType::BROKEN_SOLID ||
+                            laneroadmark->GetType() == roadmanager::LaneRoadMark::RoadMarkType::SOLID_BROKEN)
                         {
-                            roadmanager::LaneRoadMarkType *laneroadmarktype = laneroadmark->GetLaneRoadMarkTypeByIdx(jj);
+                            if (laneroadmarktype->GetNumberOfRoadMarkTypeLines() < 2)
+                            {
+                                LOG_AND_QUIT("You need to specify at least 2 line for broken solid or solid broken roadmark type");
+                                break;
+                            }
+                            std::vector<double> sort_solidbroken_brokensolid;
+                            for (int q = 0; q < laneroadmarktype->GetNumberOfRoadMarkTypeLines(); q++)
+                            {
+                                sort_solidbroken_brokensolid.push_back(laneroadmarktype->GetLaneRoadMarkTypeLineByIdx(q)->GetTOffset());
+                            }
 
-                            int inner_index = -1;
-                            if (laneroadmark->GetType() == roadmanager::LaneRoadMark::RoadMarkType::BROKEN_SOLID ||
-                                laneroadmark->GetType() == roadmanager::LaneRoadMark::RoadMarkType::SOLID_BROKEN)
+                            if (lane->GetId() < 0 || lane->GetId() == 0)
                             {
-                                if (laneroadmarktype->GetNumberOfRoadMarkTypeLines() < 2)
-                                {
-                                    LOG_AND_QUIT("You need to specify at least 2 line for broken solid or solid broken roadmark type");
-                                    break;
-                                }
-                                std::vector<double> sort_solidbroken_brokensolid;
-                                for (int q = 0; q < laneroadmarktype->GetNumberOfRoadMarkTypeLines(); q++)
-                                {
-                                    sort_solidbroken_brokensolid.push_back(laneroadmarktype->GetLaneRoadMarkTypeLineByIdx(q)->GetTOffset());
-                                }
+                                inner_index =
+                                    static_cast<int>((std::max_element(sort_solidbroken_brokensolid.begin(), sort_solidbroken_brokensolid.end()) -
+                                                      sort_solidbroken_brokensolid.begin()));
+                            }
+                            else
+                            {
+                                inner_index =
+                                    static_cast<int>((std::min_element(sort_solidbroken_brokensolid.begin(), sort_solidbroken_brokensolid.end()) -
+                                                      sort_solidbroken_brokensolid.begin()));
+                            }
+                        }
 
-                                if (lane->GetId() < 0 || lane->GetId() == 0)
-                                {
-                                    inner_index =
-                                        static_cast<int>((std::max_element(sort_solidbroken_brokensolid.begin(), sort_solidbroken_brokensolid.end()) -
-                                                          sort_solidbroken_brokensolid.begin()));
-                                }
-                                else
+                        // loop over LaneRoadMarkTypeLine
+                        for (int kk = 0; kk < laneroadmarktype->GetNumberOfRoadMarkTypeLines(); kk++)
+                        {
+                            roadmanager::LaneRoadMarkTypeLine *laneroadmarktypeline = laneroadmarktype->GetLaneRoadMarkTypeLineByIdx(kk);
+
+                            bool broken = false;
+                            if (laneroadmark->GetType() == roadmanager::LaneRoadMark::RoadMarkType::BROKEN_SOLID)
+                            {
+                                if (inner_index == kk)
                                 {
-                                    inner_index =
-                                        static_cast<int>((std::min_element(sort_solidbroken_brokensolid.begin(), sort_solidbroken_brokensolid.end()) -
-                                                          sort_solidbroken_brokensolid.begin()));
+                                    broken = true;
                                 }
                             }
 
-                            // loop over LaneRoadMarkTypeLine
-                            for (int kk = 0; kk < laneroadmarktype->GetNumberOfRoadMarkTypeLines(); kk++)
+                            if (laneroadmark->GetType() == roadmanager::LaneRoadMark::RoadMarkType::SOLID_BROKEN)
                             {
-                                roadmanager::LaneRoadMarkTypeLine *laneroadmarktypeline = laneroadmarktype->GetLaneRoadMarkTypeLineByIdx(kk);
-
-                                bool broken = false;
-                                if (laneroadmark->GetType() == roadmanager::LaneRoadMark::RoadMarkType::BROKEN_SOLID)
+                                broken = true;
+                                if (inner_index == kk)
                                 {
-                                    if (inner_index == kk)
-                                    {
-                                        broken = true;
-                                    }
+                                    broken = false;
                                 }
+                            }
 
-                                if (laneroadmark->GetType() == roadmanager::LaneRoadMark::RoadMarkType::SOLID_BROKEN)
-                                {
-                                    broken = true;
-                                    if (inner_index == kk)
-                                    {
-                                        broken = false;
-                                    }
-                                }
+                            osi3::LaneBoundary *osi_laneboundary = 0;
+
+                            int line_id = laneroadmarktypeline->GetGlobalId();
 
-                                osi3::LaneBoundary *osi_laneboundary = 0;
+                            // Check if this line is already pushed to OSI
+                            auto lnb_it = obj_osi_internal.lnb_idx.find(line_id);
+                            if (lnb_it != obj_osi_internal.lnb_idx.end())
+                            {
+                                osi_laneboundary = obj_osi_internal.lnb[static_cast<unsigned int>(lnb_it->second)];
+                            }
+                            if (!osi_laneboundary)
+                            {
+                                osi_laneboundary = obj_osi_internal.gt->add_lane_boundary();
 
-                                int line_id = laneroadmarktypeline->GetGlobalId();
+                                // update id
+                                osi_laneboundary->mutable_id()->set_value(static_cast<unsigned int>(line_id));
 
-                                // Check if this line is already pushed to OSI
-                                for (unsigned int h = 0; h < obj_osi_internal.lnb.size(); h++)
+                                int n_osi_points = laneroadmarktypeline->GetOSIPoints()->GetNumOfOSIPoints();
+                                for (int h = 0; h < n_osi_points; h++)
                                 {
-                                    if (obj_osi_internal.lnb[h]->mutable_id()->value() == static_cast<unsigned int>(line_id))
-                                    {
-                                        osi_laneboundary = obj_osi_internal.lnb[h];
-                                    }
+                                    osi3::LaneBoundary_BoundaryPoint *boundary_point = osi_laneboundary->add_boundary_line();
+                                    boundary_point->mutable_position()->set_x(laneroadmarktypeline->GetOSIPoints()->GetXfromIdx(h));
+                                    boundary_point->mutable_position()->set_y(laneroadmarktypeline->GetOSIPoints()->GetYfromIdx(h));
+                                    boundary_point->mutable_position()->set_z(laneroadmarktypeline->GetOSIPoints()->GetZfromIdx(h));
+                                    boundary_point->set_width(laneroadmarktypeline->GetWidth());
+                                    boundary_point->set_height(laneroadmark->GetHeight());
                                 }
-                                if (!osi_laneboundary)
-                                {
-                                    osi_laneboundary = obj_osi_internal.gt->add_lane_boundary();
-
-                                    // update id
-                                    osi_laneboundary->mutable_id()->set_value(static_cast<unsigned int>(line_id));
-
-                                    int n_osi_points = laneroadmarktypeline->GetOSIPoints()->GetNumOfOSIPoints();
-                                    for (int h = 0; h < n_osi_points; h++)
-                                    {
-                                        osi3::LaneBoundary_BoundaryPoint *boundary_point = osi_laneboundary->add_boundary_line();
-                                        boundary_point->mutable_position()->set_x(laneroadmarktypeline->GetOSIPoints()->GetXfromIdx(h));
-                                        boundary_point->mutable_position()->set_y(laneroadmarktypeline->GetOSIPoints()->GetYfromIdx(h));
-                                        boundary_point->mutable_position()->set_z(laneroadmarktypeline->GetOSIPoints()->GetZfromIdx(h));
-                                        boundary_point->set_width(laneroadmarktypeline->GetWidth());
-                                        boundary_point->set_height(laneroadmark->GetHeight());
-                                    }
 
-                                    // update classification type
-                                    osi3::LaneBoundary_Classification_Type classific_type;
-                                    switch (laneroadmark->GetType())
-                                    {
-                                        case roadmanager::LaneRoadMark::RoadMarkType::NONE_TYPE:
-                                            classific_type = osi3::LaneBoundary_Classification_Type::LaneBoundary_Classification_Type_TYPE_NO_LINE;
-                                            break;
-                                        case roadmanager::LaneRoadMark::RoadMarkType::SOLID:
-                                            classific_type = osi3::LaneBoundary_Classification_Type::LaneBoundary_Classification_Type_TYPE_SOLID_LINE;
-                                            break;
-                                        case roadmanager::LaneRoadMark::RoadMarkType::SOLID_SOLID:
-                                            classific_type = osi3::LaneBoundary_Classification_Type::LaneBoundary_Classification_Type_TYPE_SOLID_LINE;
-                                            break;
-                                        case roadmanager::LaneRoadMark::RoadMarkType::BROKEN:
+                                // update classification type
+                                osi3::LaneBoundary_Classification_Type classific_type;
+                                switch (laneroadmark->GetType())
+                                {
+                                    case roadmanager::LaneRoadMark::RoadMarkType::NONE_TYPE:
+                                        classific_type = osi3::LaneBoundary_Classification_Type::LaneBoundary_Classification_Type_TYPE_NO_LINE;
+                                        break;
+                                    case roadmanager::LaneRoadMark::RoadMarkType::SOLID:
+                                        classific_type = osi3::LaneBoundary_Classification_Type::LaneBoundary_Classification_Type_TYPE_SOLID_LINE;
+                                        break;
+                                    case roadmanager::LaneRoadMark::RoadMarkType::SOLID_SOLID:
+                                        classific_type = osi3::LaneBoundary_Classification_Type::LaneBoundary_Classification_Type_TYPE_SOLID_LINE;
+                                        break;
+                                    case roadmanager::LaneRoadMark::RoadMarkType::BROKEN:
+                                        classific_type =
+                                            osi3::LaneBoundary_Classification_Type::LaneBoundary_Classification_Type_TYPE_DASHED_LINE;
+                                        break;
+                                    case roadmanager::LaneRoadMark::RoadMarkType::BROKEN_BROKEN:
+                                        classific_type =
+                                            osi3::LaneBoundary_Classification_Type::LaneBoundary_Classification_Type_TYPE_DASHED_LINE;
+                                        break;
+                                    case roadmanager::LaneRoadMark::RoadMarkType::SOLID_BROKEN:
+                                        if (broken)
+                                        {
                                             classific_type =
                                                 osi3::LaneBoundary_Classification_Type::LaneBoundary_Classification_Type_TYPE_DASHED_LINE;
-                                            break;
-                                        case roadmanager::LaneRoadMark::RoadMarkType::BROKEN_BROKEN:
+                                        }
+                                        else
+                                        {
+                                            classific_type =
+                                                osi3::LaneBoundary_Classification_Type::LaneBoundary_Classification_Type_TYPE_SOLID_LINE;
+                                        }
+                                        break;
+                                    case roadmanager::LaneRoadMark::RoadMarkType::BROKEN_SOLID:
+                                        if (broken)
+                                        {
                                             classific_type =
                                                 osi3::LaneBoundary_Classification_Type::LaneBoundary_Classification_Type_TYPE_DASHED_LINE;
-                                            break;
-                                        case roadmanager::LaneRoadMark::RoadMarkType::SOLID_BROKEN:
-                                            if (broken)
-                                            {
-                                                classific_type =
-                                                    osi3::LaneBoundary_Classification_Type::LaneBoundary_Classification_Type_TYPE_DASHED_LINE;
-                                            }
-                                            else
-                                            {
-                                                classific_type =
-                                                    osi3::LaneBoundary_Classification_Type::LaneBoundary_Classification_Type_TYPE_SOLID_LINE;
-                                            }
-                                            break;
-                                        case roadmanager::LaneRoadMark::RoadMarkType::BROKEN_SOLID:
-                                            if (broken)
-                                            {
-                                                classific_type =
-                                                    osi3::LaneBoundary_Classification_Type::LaneBoundary_Classification_Type_TYPE_DASHED_LINE;
-                                            }
-                                            else
-                                            {
-                                                classific_type =
-                                                    osi3::LaneBoundary_Classification_Type::LaneBoundary_Classification_Type_TYPE_SOLID_LINE;
-                                            }
-                                            break;
-                                        case roadmanager::LaneRoadMark::RoadMarkType::BOTTS_DOTS:
-                                            classific_type = osi3::LaneBoundary_Classification_Type::LaneBoundary_Classification_Type_TYPE_BOTTS_DOTS;
-                                            break;
-                                        default:
-                                            classific_type = osi3::LaneBoundary_Classification_Type::LaneBoundary_Classification_Type_TYPE_SOLID_LINE;
-                                    }
-                                    osi_laneboundary->mutable_classification()->set_type(classific_type);
+                                        }
+                                        else
+                                        {
+                                            classific_type =
+                                                osi3::LaneBoundary_Classification_Type::LaneBoundary_Classification_Type_TYPE_SOLID_LINE;
+                                        }
+                                        break;
+                                    case roadmanager::LaneRoadMark::RoadMarkType::BOTTS_DOTS:
+                                        classific_type = osi3::LaneBoundary_Classification_Type::LaneBoundary_Classification_Type_TYPE_BOTTS_DOTS;
+                                        break;
+                                    default:
+                                        classific_type = osi3::LaneBoundary_Classification_Type::LaneBoundary_Classification_Type_TYPE_SOLID_LINE;
+                                }
+                                osi_laneboundary->mutable_classification()->set_type(classific_type);
 
-                                    // update classification color
-                                    osi3::LaneBoundary_Classification_Color classific_col;
-                                    switch (laneroadmark->GetColor())
-                                    {
-                                        case roadmanager::RoadMarkColor::STANDARD_COLOR:
-                                            classific_col = osi3::LaneBoundary_Classification_Color::LaneBoundary_Classification_Color_COLOR_WHITE;
-                                            break;
-                                        case roadmanager::RoadMarkColor::BLUE:
-                                            classific_col = osi3::LaneBoundary_Classification_Color::LaneBoundary_Classification_Color_COLOR_BLUE;
-                                            break;
-                                        case roadmanager::RoadMarkColor::GREEN:
-                                            classific_col = osi3::LaneBoundary_Classification_Color::LaneBoundary_Classification_Color_COLOR_GREEN;
-                                            break;
-                                        case roadmanager::RoadMarkColor::RED:
-                                            classific_col = osi3::LaneBoundary_Classification_Color::LaneBoundary_Classification_Color_COLOR_RED;
-                                            break;
-                                        case roadmanager::RoadMarkColor::WHITE:
-                                            classific_col = osi3::LaneBoundary_Classification_Color::LaneBoundary_Classification_Color_COLOR_WHITE;
-                                            break;
-                                        case roadmanager::RoadMarkColor::YELLOW:
-                                            classific_col = osi3::LaneBoundary_Classification_Color::LaneBoundary_Classification_Color_COLOR_YELLOW;
-                                            break;
-                                        default:
-                                            classific_col = osi3::LaneBoundary_Classification_Color::LaneBoundary_Classification_Color_COLOR_WHITE;
-                                    }
-                                    osi_laneboundary->mutable_classification()->set_color(classific_col);
+                                // update classification color
+                                osi3::LaneBoundary_Classification_Color classific_col;
+                                switch (laneroadmark->GetColor())
+                                {
+                                    case roadmanager::RoadMarkColor::STANDARD_COLOR:
+                                        classific_col = osi3::LaneBoundary_Classification_Color::LaneBoundary_Classification_Color_COLOR_WHITE;
+                                        break;
+                                    case roadmanager::RoadMarkColor::BLUE:
+                                        classific_col = osi3::LaneBoundary_Classification_Color::LaneBoundary_Classification_Color_COLOR_BLUE;
+                                        break;
+                                    case roadmanager::RoadMarkColor::GREEN:
+                                        classific_col = osi3::LaneBoundary_Classification_Color::LaneBoundary_Classification_Color_COLOR_GREEN;
+                                        break;
+                                    case roadmanager::RoadMarkColor::RED:
+                                        classific_col = osi3::LaneBoundary_Classification_Color::LaneBoundary_Classification_Color_COLOR_RED;
+                                        break;
+                                    case roadmanager::RoadMarkColor::WHITE:
+                                        classific_col = osi3::LaneBoundary_Classification_Color::LaneBoundary_Classification_Color_COLOR_WHITE;
+                                        break;
+                                    case roadmanager::RoadMarkColor::YELLOW:
+                                        classific_col = osi3::LaneBoundary_Classification_Color::LaneBoundary_Classification_Color_COLOR_YELLOW;
+                                        break;
+                                    default:
+                                        classific_col = osi3::LaneBoundary_Classification_Color::LaneBoundary_Classification_Color_COLOR_WHITE;
+                                }
+                                osi_laneboundary->mutable_classification()->set_color(classific_col);
 
-                                    // update limiting structure id only if the type of lane boundary is set to TYPE_STRUCTURE - for now it is not
-                                    // implemented
-                                    // osi_laneboundary->mutable_classification()->mutable_limiting_structure_id(0)->set_value(0);
+                                // update limiting structure id only if the type of lane boundary is set to TYPE_STRUCTURE - for now it is not
+                                // implemented
+                                // osi_laneboundary->mutable_classification()->mutable_limiting_structure_id(0)->set_value(0);
 
-                                    obj_osi_internal.lnb.push_back(osi_laneboundary);
-                                }
+                                obj_osi_internal.lnb_idx[line_id] = static_cast<int>(obj_osi_internal.lnb.size());
+                                obj_osi_internal.lnb.push_back(osi_laneboundary);
                             }
                         }
                     }
                 }
-                else  // if there are no road marks I take the lane boundary
+            }
+            else  // if there are no road marks I take the lane boundary
+            {
+                roadmanager::LaneBoundaryOSI *laneboundary = lane->GetLaneBoundary();
+                // Check if this line is already pushed to OSI
+                int                 boundary_id      = laneboundary->GetGlobalId();
+                osi3::LaneBoundary *osi_laneboundary = 0;
+                auto                lnb_it           = obj_osi_internal.lnb_idx.find(boundary_id);
+                if (lnb_it != obj_osi_internal.lnb_idx.end())
                 {
-                    roadmanager::LaneBoundaryOSI *laneboundary = lane->GetLaneBoundary();
-                    // Check if this line is already pushed to OSI
-                    int                 boundary_id      = laneboundary->GetGlobalId();
-                    osi3::LaneBoundary *osi_laneboundary = 0;
-                    for (unsigned int h = 0; h < obj_osi_internal.lnb.size(); h++)
-                    {
-                        if (obj_osi_internal.lnb[h]->mutable_id()->value() == static_cast<unsigned int>(boundary_id))
-                        {
-                            osi_laneboundary = obj_osi_internal.lnb[h];
-                        }
-                    }
-                    if (!osi_laneboundary)
-                    {
-                        osi_laneboundary = obj_osi_internal.gt->add_lane_boundary();
+                    osi_laneboundary = obj_osi_internal.lnb[static_cast<unsigned int>(lnb_it->second)];
+                }
+                if (!osi_laneboundary)
+                {
+                    osi_laneboundary = obj_osi_internal.gt->add_lane_boundary();
 
-                        // update id
-                        osi_laneboundary->mutable_id()->set_value(static_cast<unsigned int>(boundary_id));
+                    // update id
+                    osi_laneboundary->mutable_id()->set_value(static_cast<unsigned int>(boundary_id));
 
-                        int n_osi_points = laneboundary->GetOSIPoints()->GetNumOfOSIPoints();
-                        for (int h = 0; h < n_osi_points; h++)
-                        {
-                            osi3::LaneBoundary_BoundaryPoint *boundary_point = osi_laneboundary->add_boundary_line();
-                            boundary_point->mutable_position()->set_x(laneboundary->GetOSIPoints()->GetXfromIdx(h));
-                            boundary_point->mutable_position()->set_y(laneboundary->GetOSIPoints()->GetYfromIdx(h));
-                            boundary_point->mutable_position()->set_z(laneboundary->GetOSIPoints()->GetZfromIdx(h));
-                            // boundary_point->set_width(laneboundary->GetWidth());
-                            // boundary_point->set_height(laneroadmark->GetHeight());
-                        }
+                    int n_osi_points = laneboundary->GetOSIPoints()->GetNumOfOSIPoints();
+                    for (int h = 0; h < n_osi_points; h++)
+                    {
+                        osi3::LaneBoundary_BoundaryPoint *boundary_point = osi_laneboundary->add_boundary_line();
+                        boundary_point->mutable_position()->set_x(laneboundary->GetOSIPoints()->GetXfromIdx(h));
+                        boundary_point->mutable_position()->set_y(laneboundary->GetOSIPoints()->GetYfromIdx(h));
+                        boundary_point->mutable_position()->set_z(laneboundary->GetOSIPoints()->GetZfromIdx(h));
+                        // boundary_point->set_width(laneboundary->GetWidth());
+                        // boundary_point->set_height(laneroadmark->GetHeight());
+                    }
 
-                        if (lane->IsRoadEdge())
-                        {
-                            osi_laneboundary->mutable_classification()->set_type(
-                                osi3::LaneBoundary_Classification_Type::LaneBoundary_Classification_Type_TYPE_ROAD_EDGE);
-                        }
-                        else
-                        {
-                            osi_laneboundary->mutable_classification()->set_type(
-                                osi3::LaneBoundary_Classification_Type::LaneBoundary_Classification_Type_TYPE_NO_LINE);
-                        }
+                    if (lane->IsRoadEdge())
+                    {
+                        osi_laneboundary->mutable_classification()->set_type(
+                            osi3::LaneBoundary_Classification_Type::LaneBoundary_Classification_Type_TYPE_ROAD_EDGE);
+                    }
+                    else
+                    {
+                        osi_laneboundary->mutable_classification()->set_type(
+                            osi3::LaneBoundary_Classification_Type::LaneBoundary_Classification_Type_TYPE_NO_LINE);
+                    }
 
-                        osi3::LaneBoundary_Classification_Color classific_col =
-                            osi3::LaneBoundary_Classification_Color::LaneBoundary_Classification_Color_COLOR_UNKNOWN;
-                        osi_laneboundary->mutable_classification()->set_color(classific_col);
+                    osi3::LaneBoundary_Classification_Color classific_col =
+                        osi3::LaneBoundary_Classification_Color::LaneBoundary_Classification_Color_COLOR_UNKNOWN;
+                    osi_laneboundary->mutable_classification()->set_color(classific_col);
 
-                        obj_osi_internal.lnb.push_back(osi_laneboundary);
-                    }
+                    obj_osi_internal.lnb_idx[boundary_id] = static_cast<int>(obj_osi_internal.lnb.size());
+                    obj_osi_internal.lnb.push_back(osi_laneboundary);
                 }
             }
         }
@@ -1547,584 +1681,573 @@ int OSIReporter::UpdateOSILaneBoundary()
     return 0;
 }
 
-int OSIReporter::UpdateOSIRoadLane()
+int OSIReporter::UpdateOSIRoadLane(roadmanager::Road *road)
 {
-    // Retrieve opendrive class from RoadManager
-    static roadmanager::OpenDrive *opendrive = roadmanager::Position::GetOpenDrive();
-
-    // Loop over all roads
-    for (int i = 0; i < opendrive->GetNumOfRoads(); i++)
-    {
-        roadmanager::Road *road = opendrive->GetRoadByIdx(i);
+    // Get predecessor and successor roads if exists
+    roadmanager::RoadLink *roadLink = nullptr;
 
-        // Get predecessor and successor roads if exists
-        roadmanager::RoadLink *roadLink = nullptr;
+    roadmanager::Road *predecessorRoad = nullptr;
+    roadmanager::Road *successorRoad   = nullptr;
 
-        roadmanager::Road *predecessorRoad = nullptr;
-        roadmanager::Road *successorRoad   = nullptr;
+    roadmanager::Junction *predecessorJunction = nullptr;
+    roadmanager::Junction *successorJunction   = nullptr;
 
-        roadmanager::Junction *predecessorJunction = nullptr;
-        roadmanager::Junction *successorJunction   = nullptr;
-
-        roadLink = road->GetLink(roadmanager::LinkType::PREDECESSOR);
-        if (roadLink)
+    roadLink = road->GetLink(roadmanager::LinkType::PREDECESSOR);
+    if (roadLink)
+    {
+        if (roadLink->GetElementType() == roadmanager::RoadLink::ElementType::ELEMENT_TYPE_ROAD)
         {
-            if (roadLink->GetElementType() == roadmanager::RoadLink::ElementType::ELEMENT_TYPE_ROAD)
-            {
-                predecessorRoad = opendrive->GetRoadById(roadLink->GetElementId());
-            }
-            if (roadLink->GetElementType() == roadmanager::RoadLink::ElementType::ELEMENT_TYPE_JUNCTION)
-            {
-                predecessorJunction = opendrive->GetJunctionById(roadLink->GetElementId());
-            }
+            predecessorRoad = LookupRoadById(roadLink->GetElementId());
         }
-
-        roadLink = road->GetLink(roadmanager::LinkType::SUCCESSOR);
-        if (roadLink)
+        if (roadLink->GetElementType() == roadmanager::RoadLink::ElementType::ELEMENT_TYPE_JUNCTION)
         {
-            if (roadLink->GetElementType() == roadmanager::RoadLink::ElementType::ELEMENT_TYPE_ROAD)
-            {
-                successorRoad = opendrive->GetRoadById(roadLink->GetElementId());
-            }
-            if (roadLink->GetElementType() == roadmanager::RoadLink::ElementType::ELEMENT_TYPE_JUNCTION)
-            {
-                successorJunction = opendrive->GetJunctionById(roadLink->GetElementId());
-            }
+            predecessorJunction = LookupJunctionById(roadLink->GetElementId());
         }
+    }
 
-        // loop over all lane sections
-        for (int j = 0; j < road->GetNumberOfLaneSections(); j++)
+    roadLink = road->GetLink(roadmanager::LinkType::SUCCESSOR);
+    if (roadLink)
+    {
+        if (roadLink->GetElementType() == roadmanager::RoadLink::ElementType::ELEMENT_TYPE_ROAD)
+        {
+            successorRoad = LookupRoadById(roadLink->GetElementId());
+        }
+        if (roadLink->GetElementType() == roadmanager::RoadLink::ElementType::ELEMENT_TYPE_JUNCTION)
         {
-            roadmanager::LaneSection *lane_section                   = road->GetLaneSectionByIdx(j);
-            int                       global_predecessor_junction_id = -1;
-            int                       global_successor_junction_id   = -1;
-            // Get predecessor and successor lane_sections
-            roadmanager::LaneSection *predecessor_lane_section = nullptr;
-            roadmanager::LaneSection *successor_lane_section   = nullptr;
+            successorJunction = LookupJunctionById(roadLink->GetElementId());
+        }
+    }
 
-            // if there are more than 1 section we use the previous lane section in the same road
-            if (j > 0)
-            {
-                predecessor_lane_section = road->GetLaneSectionByIdx(j - 1);
-            }
-            else
+    // loop over all lane sections
+    for (int j = 0; j < road->GetNumberOfLaneSections(); j++)
+    {
+        roadmanager::LaneSection *lane_section                   = road->GetLaneSectionByIdx(j);
+        int                       global_predecessor_junction_id = -1;
+        int                       global_successor_junction_id   = -1;
+        // Get predecessor and successor lane_sections
+        roadmanager::LaneSection *predecessor_lane_section = nullptr;
+        roadmanager::LaneSection *successor_lane_section   = nullptr;
+
+        // if there are more than 1 section we use the previous lane section in the same road
+        if (j > 0)
+        {
+            predecessor_lane_section = road->GetLaneSectionByIdx(j - 1);
+        }
+        else
+        {
+            // Otherwise we use the last lane section of the predecessor road
+            if (predecessorRoad)
             {
-                // Otherwise we use the last lane section of the predecessor road
-                if (predecessorRoad)
+                // get first or last lane section depending on road direction
+                if (predecessorRoad->GetLink(roadmanager::LinkType::PREDECESSOR))
                 {
-                    // get first or last lane section depending on road direction
-                    if (predecessorRoad->GetLink(roadmanager::LinkType::PREDECESSOR))
+                    if (predecessorRoad->GetLink(roadmanager::LinkType::PREDECESSOR)->GetElementId() == road->GetId())
                     {
-                        if (predecessorRoad->GetLink(roadmanager::LinkType::PREDECESSOR)->GetElementId() == road->GetId())
-                        {
-                            predecessor_lane_section = predecessorRoad->GetLaneSectionByIdx(0);
-                        }
-                        else if (predecessorRoad->GetLink(roadmanager::LinkType::PREDECESSOR)->GetElementId() == road->GetJunction())
-                        {
-                            predecessor_lane_section = predecessorRoad->GetLaneSectionByIdx(0);
-                        }
+                        predecessor_lane_section = predecessorRoad->GetLaneSectionByIdx(0);
                     }
-                    if (predecessorRoad->GetLink(roadmanager::LinkType::SUCCESSOR))
+                    else if (predecessorRoad->GetLink(roadmanager::LinkType::PREDECESSOR)->GetElementId() == road->GetJunction())
                     {
-                        if (predecessorRoad->GetLink(roadmanager::LinkType::SUCCESSOR)->GetElementId() == road->GetId())
-                        {
-                            predecessor_lane_section = predecessorRoad->GetLaneSectionByIdx(predecessorRoad->GetNumberOfLaneSections() - 1);
-                        }
-                        else if (predecessorRoad->GetLink(roadmanager::LinkType::SUCCESSOR)->GetElementId() == road->GetJunction())
-                        {
-                            predecessor_lane_section = predecessorRoad->GetLaneSectionByIdx(predecessorRoad->GetNumberOfLaneSections() - 1);
-                        }
+                        predecessor_lane_section = predecessorRoad->GetLaneSectionByIdx(0);
                     }
                 }
-                else if (predecessorJunction && predecessorJunction->IsOsiIntersection())
+                if (predecessorRoad->GetLink(roadmanager::LinkType::SUCCESSOR))
                 {
-                    global_predecessor_junction_id = predecessorJunction->GetGlobalId();
+                    if (predecessorRoad->GetLink(roadmanager::LinkType::SUCCESSOR)->GetElementId() == road->GetId())
+                    {
+                        predecessor_lane_section = predecessorRoad->GetLaneSectionByIdx(predecessorRoad->GetNumberOfLaneSections() - 1);
+                    }
+                    else if (predecessorRoad->GetLink(roadmanager::LinkType::SUCCESSOR)->GetElementId() == road->GetJunction())
+                    {
+                        predecessor_lane_section = predecessorRoad->GetLaneSectionByIdx(predecessorRoad->GetNumberOfLaneSections() - 1);
+                    }
                 }
             }
-
-            // If it is the lane section before to the last one we use the last lane section as successor
-            if (j < road->GetNumberOfLaneSections() - 1)
+            else if (predecessorJunction && predecessorJunction->IsOsiIntersection())
             {
-                successor_lane_section = road->GetLaneSectionByIdx(j + 1);
+                global_predecessor_junction_id = predecessorJunction->GetGlobalId();
             }
-            else
+        }
+
+        // If it is the lane section before to the last one we use the last lane section as successor
+        if (j < road->GetNumberOfLaneSections() - 1)
+        {
+            successor_lane_section = road->GetLaneSectionByIdx(j + 1);
+        }
+        else
+        {
+            // Otherwise (is the last lane section) we use the first lane section of the successor road if exists
+            if (successorRoad)
             {
-                // Otherwise (is the last lane section) we use the first lane section of the successor road if exists
-                if (successorRoad)
+                // get first or last lane section depending on road direction
+                if (successorRoad->GetLink(roadmanager::LinkType::PREDECESSOR))
                 {
-                    // get first or last lane section depending on road direction
-                    if (successorRoad->GetLink(roadmanager::LinkType::PREDECESSOR))
+                    if (successorRoad->GetLink(roadmanager::LinkType::PREDECESSOR)->GetElementId() == road->GetId())
                     {
-                        if (successorRoad->GetLink(roadmanager::LinkType::PREDECESSOR)->GetElementId() == road->GetId())
-                        {
-                            successor_lane_section = successorRoad->GetLaneSectionByIdx(0);
-                        }
-                        else if (successorRoad->GetLink(roadmanager::LinkType::PREDECESSOR)->GetElementId() == road->GetJunction())
-                        {
-                            successor_lane_section = successorRoad->GetLaneSectionByIdx(0);
-                        }
+                        successor_lane_section = successorRoad->GetLaneSectionByIdx(0);
                     }
-                    if (successorRoad->GetLink(roadmanager::LinkType::SUCCESSOR))
+                    else if (successorRoad->GetLink(roadmanager::LinkType::PREDECESSOR)->GetElementId() == road->GetJunction())
                     {
-                        if (successorRoad->GetLink(roadmanager::LinkType::SUCCESSOR)->GetElementId() == road->GetId())
-                        {
-                            successor_lane_section = successorRoad->GetLaneSectionByIdx(successorRoad->GetNumberOfLaneSections() - 1);
-                        }
-                        else if (successorRoad->GetLink(roadmanager::LinkType::SUCCESSOR)->GetElementId() == road->GetJunction())
-                        {
-                            successor_lane_section = successorRoad->GetLaneSectionByIdx(successorRoad->GetNumberOfLaneSections() - 1);
-                        }
+                        successor_lane_section = successorRoad->GetLaneSectionByIdx(0);
                     }
                 }
-                else if (successorJunction && successorJunction->IsOsiIntersection())
+                if (successorRoad->GetLink(roadmanager::LinkType::SUCCESSOR))
                 {
-                    global_successor_junction_id = successorJunction->GetGlobalId();
+                    if (successorRoad->GetLink(roadmanager::LinkType::SUCCESSOR)->GetElementId() == road->GetId())
+                    {
+                        successor_lane_section = successorRoad->GetLaneSectionByIdx(successorRoad->GetNumberOfLaneSections() - 1);
+                    }
+                    else if (successorRoad->GetLink(roadmanager::LinkType::SUCCESSOR)->GetElementId() == road->GetJunction())
+                    {
+                        successor_lane_section = successorRoad->GetLaneSectionByIdx(successorRoad->GetNumberOfLaneSections() - 1);
+                    }
                 }
             }
+            else if (successorJunction && successorJunction->IsOsiIntersection())
+            {
+                global_successor_junction_id = successorJunction->GetGlobalId();
+            }
+        }
 
-            // loop over all lanes
-            for (int k = 0; k < lane_section->GetNumberOfLanes(); k++)
+        // loop over all lanes
+        for (int k = 0; k < lane_section->GetNumberOfLanes(); k++)
+        {
+            roadmanager::Lane *lane = lane_section->GetLaneByIdx(k);
+            if ((!lane->IsCenter() && !lane->IsOSIIntersection()))
             {
-                roadmanager::Lane *lane = lane_section->GetLaneByIdx(k);
-                if ((!lane->IsCenter() && !lane->IsOSIIntersection()))
+                osi3::Lane *osi_lane       = 0;
+                int         lane_global_id = lane->GetGlobalId();
+                int         lane_id        = lane->GetId();
+
+                // Check if this lane is already pushed to OSI - if yes just update
+                auto ln_it = obj_osi_internal.ln_idx.find(lane_global_id);
+                if (ln_it != obj_osi_internal.ln_idx.end())
+                {
+                    osi_lane = obj_osi_internal.ln[static_cast<unsigned int>(ln_it->second)];
+                }
+                // if the lane is not already in the osi message we add it all
+                if (!osi_lane)
                 {
-                    osi3::Lane *osi_lane       = 0;
-                    int         lane_global_id = lane->GetGlobalId();
-                    int         lane_id        = lane->GetId();
+                    // LANE ID
+                    osi_lane = obj_osi_internal.gt->add_lane();
+                    osi_lane->mutable_id()->set_value(static_cast<unsigned int>(lane_global_id));
+
+                    // CLASSIFICATION TYPE
+                    roadmanager::Lane::LaneType       lanetype   = lane->GetLaneType();
+                    osi3::Lane_Classification_Type    class_type = osi3::Lane_Classification_Type::Lane_Classification_Type_TYPE_UNKNOWN;
+                    osi3::Lane_Classification_Subtype subclass_type =
+                        osi3::Lane_Classification_Subtype::Lane_Classification_Subtype_SUBTYPE_UNKNOWN;
+                    if (lanetype == roadmanager::Lane::LaneType::LANE_TYPE_DRIVING)
+                    {
+                        class_type    = osi3::Lane_Classification_Type::Lane_Classification_Type_TYPE_DRIVING;
+                        subclass_type = osi3::Lane_Classification_Subtype::Lane_Classification_Subtype_SUBTYPE_NORMAL;
+                    }
+                    else if (lanetype == roadmanager::Lane::LaneType::LANE_TYPE_PARKING)
+                    {
+                        class_type    = osi3::Lane_Classification_Type::Lane_Classification_Type_TYPE_NONDRIVING;
+                        subclass_type = osi3::Lane_Classification_Subtype::Lane_Classification_Subtype_SUBTYPE_PARKING;
+                    }
+                    else if (lanetype == roadmanager::Lane::LaneType::LANE_TYPE_BIDIRECTIONAL)
+                    {
+                        class_type    = osi3::Lane_Classification_Type::Lane_Classification_Type_TYPE_DRIVING;
+                        subclass_type = osi3::Lane_Classification_Subtype::Lane_Classification_Subtype_SUBTYPE_NORMAL;
+                    }
+                    else if (lanetype == roadmanager::Lane::LaneType::LANE_TYPE_STOP)
+                    {
+                        class_type    = osi3::Lane_Classification_Type::Lane_Classification_Type_TYPE_NONDRIVING;
+                        subclass_type = osi3::Lane_Classification_Subtype::Lane_Classification_Subtype_SUBTYPE_STOP;
+                    }
+                    else if (lanetype == roadmanager::Lane::LaneType::LANE_TYPE_BIKING)
+                    {
+                        class_type    = osi3::Lane_Classification_Type::Lane_Classification_Type_TYPE_NONDRIVING;
+                        subclass_type = osi3::Lane_Classification_Subtype::Lane_Classification_Subtype_SUBTYPE_BIKING;
+                    }
+                    else if (lanetype == roadmanager::Lane::LaneType::LANE_TYPE_SIDEWALK)
+                    {
+                        class_type    = osi3::Lane_Classification_Type::Lane_Classification_Type_TYPE_NONDRIVING;
+                        subclass_type = osi3::Lane_Classification_Subtype::Lane_Classification_Subtype_SUBTYPE_SIDEWALK;
+                    }
+                    else if (lanetype == roadmanager::Lane::LaneType::LANE_TYPE_BORDER)
+                    {
+                        class_type    = osi3::Lane_Classification_Type::Lane_Classification_Type_TYPE_NONDRIVING;
+                        subclass_type = osi3::Lane_Classification_Subtype::Lane_Classification_Subtype_SUBTYPE_BORDER;
+                    }
+                    else if (lanetype == roadmanager::Lane::LaneType::LANE_TYPE_RESTRICTED)
+                    {
+                        class_type    = osi3::Lane_Classification_Type::Lane_Classification_Type_TYPE_NONDRIVING;
+                        subclass_type = osi3::Lane_Classification_Subtype::Lane_Classification_Subtype_SUBTYPE_RESTRICTED;
+                    }
+                    else if (lanetype == roadmanager::Lane::LaneType::LANE_TYPE_ROADMARKS)
+                    {
+                        class_type    = osi3::Lane_Classification_Type::Lane_Classification_Type_TYPE_NONDRIVING;
+                        subclass_type = osi3::Lane_Classification_Subtype::Lane_Classification_Subtype_SUBTYPE_OTHER;
+                    }
+                    else if (lanetype == roadmanager::Lane::LaneType::LANE_TYPE_TRAM)
+                    {
+                        class_type    = osi3::Lane_Classification_Type::Lane_Classification_Type_TYPE_NONDRIVING;
+                        subclass_type = osi3::Lane_Classification_Subtype::Lane_Classification_Subtype_SUBTYPE_OTHER;
+                    }
+                    else if (lanetype == roadmanager::Lane::LaneType::LANE_TYPE_RAIL)
+                    {
+                        class_type    = osi3::Lane_Classification_Type::Lane_Classification_Type_TYPE_NONDRIVING;
+                        subclass_type = osi3::Lane_Classification_Subtype::Lane_Classification_Subtype_SUBTYPE_OTHER;
+                    }
+                    else if (lanetype == roadmanager::Lane::LaneType::LANE_TYPE_ENTRY)
+                    {
+                        class_type    = osi3::Lane_Classification_Type::Lane_Classification_Type_TYPE_DRIVING;
+                        subclass_type = osi3::Lane_Classification_Subtype::Lane_Classification_Subtype_SUBTYPE_ENTRY;
+                    }
+                    else if (lanetype == roadmanager::Lane::LaneType::LANE_TYPE_EXIT)
+                    {
+                        class_type    = osi3::Lane_Classification_Type::Lane_Classification_Type_TYPE_DRIVING;
+                        subclass_type = osi3::Lane_Classification_Subtype::Lane_Classification_Subtype_SUBTYPE_EXIT;
+                    }
+                    else if (lanetype == roadmanager::Lane::LaneType::LANE_TYPE_OFF_RAMP)
+                    {
+                        class_type    = osi3::Lane_Classification_Type::Lane_Classification_Type_TYPE_DRIVING;
+                        subclass_type = osi3::Lane_Classification_Subtype::Lane_Classification_Subtype_SUBTYPE_OFFRAMP;
+                    }
+                    else if (lanetype == roadmanager::Lane::LaneType::LANE_TYPE_ON_RAMP)
+                    {
+                        class_type    = osi3::Lane_Classification_Type::Lane_Classification_Type_TYPE_DRIVING;
+                        subclass_type = osi3::Lane_Classification_Subtype::Lane_Classification_Subtype_SUBTYPE_ONRAMP;
+                    }
+                    else if (lanetype == roadmanager::Lane::LaneType::LANE_TYPE_MEDIAN)
+                    {
+                        class_type    = osi3::Lane_Classification_Type::Lane_Classification_Type_TYPE_NONDRIVING;
+                        subclass_type = osi3::Lane_Classification_Subtype::Lane_Classification_Subtype_SUBTYPE_OTHER;
+                    }
+                    else if (lanetype == roadmanager::Lane::LaneType::LANE_TYPE_SHOULDER)
+                    {
+                        class_type    = osi3::Lane_Classification_Type::Lane_Classification_Type_TYPE_NONDRIVING;
+                        subclass_type = osi3::Lane_Classification_Subtype::Lane_Classification_Subtype_SUBTYPE_SHOULDER;
+                    }
+                    else if (lanetype == roadmanager::Lane::LaneType::LANE_TYPE_CURB)
+                    {
+                        class_type    = osi3::Lane_Classification_Type::Lane_Classification_Type_TYPE_NONDRIVING;
+                        subclass_type = osi3::Lane_Classification_Subtype::Lane_Classification_Subtype_SUBTYPE_BORDER;
+                    }
+                    else if (lanetype == roadmanager::Lane::LaneType::LANE_TYPE_CONNECTING_RAMP)
+                    {
+                        class_type    = osi3::Lane_Classification_Type::Lane_Classification_Type_TYPE_DRIVING;
+                        subclass_type = osi3::Lane_Classification_Subtype::Lane_Classification_Subtype_SUBTYPE_CONNECTINGRAMP;
+                    }
+                    else if (lanetype == roadmanager::Lane::LaneType::LANE_TYPE_SPECIAL1 ||
+                             lanetype == roadmanager::Lane::LaneType::LANE_TYPE_SPECIAL2 ||
+                             lanetype == roadmanager::Lane::LaneType::LANE_TYPE_SPECIAL3)
+                    {
+                        class_type    = osi3::Lane_Classification_Type::Lane_Classification_Type_TYPE_OTHER;
+                        subclass_type = osi3::Lane_Classification_Subtype::Lane_Classification_Subtype_SUBTYPE_OTHER;
+                    }
+                    else if (lanetype == roadmanager::Lane::LaneType::LANE_TYPE_NONE)
+                    {
+                        class_type    = osi3::Lane_Classification_Type::Lane_Classification_Type_TYPE_UNKNOWN;
+                        subclass_type = osi3::Lane_Classification_Subtype::Lane_Classification_Subtype_SUBTYPE_UNKNOWN;
+                    }
+                    osi_lane->mutable_classification()->set_type(class_type);
+                    osi_lane->mutable_classification()->set_subtype(subclass_type);
 
-                    // Check if this lane is already pushed to OSI - if yes just update
-                    for (unsigned int jj = 0; jj < obj_osi_internal.ln.size(); jj++)
+                    // CENTERLINE POINTS
+                    int n_osi_points = lane->GetOSIPoints()->GetNumOfOSIPoints();
+                    for (int jj = 0; jj < n_osi_points; jj++)
                     {
-                        if (obj_osi_internal.ln[jj]->mutable_id()->value() == static_cast<unsigned int>(lane_global_id))
-                        {
-                            osi_lane = obj_osi_internal.ln[jj];
-                            break;
-                        }
+                        osi3::Vector3d *centerLine = osi_lane->mutable_classification()->add_centerline();
+                        centerLine->set_x(lane->GetOSIPoints()->GetXfromIdx(jj));
+                        centerLine->set_y(lane->GetOSIPoints()->GetYfromIdx(jj));
+                        centerLine->set_z(lane->GetOSIPoints()->GetZfromIdx(jj));
                     }
-                    // if the lane is not already in the osi message we add it all
-                    if (!osi_lane)
+
+                    // DRIVING DIRECTION
+                    bool driving_direction = true;
+                    if ((lane_id >= 0 && road->GetRule() == roadmanager::Road::RoadRule::RIGHT_HAND_TRAFFIC) ||
+                        (lane_id < 0 && road->GetRule() == roadmanager::Road::RoadRule::LEFT_HAND_TRAFFIC))
                     {
-                        // LANE ID
-                        osi_lane = obj_osi_internal.gt->add_lane();
-                        osi_lane->mutable_id()->set_value(static_cast<unsigned int>(lane_global_id));
+                        driving_direction = false;
+                    }
+                    osi_lane->mutable_classification()->set_centerline_is_driving_direction(driving_direction);
 
-                        // CLASSIFICATION TYPE
-                        roadmanager::Lane::LaneType       lanetype   = lane->GetLaneType();
-                        osi3::Lane_Classification_Type    class_type = osi3::Lane_Classification_Type::Lane_Classification_Type_TYPE_UNKNOWN;
-                        osi3::Lane_Classification_Subtype subclass_type =
-                            osi3::Lane_Classification_Subtype::Lane_Classification_Subtype_SUBTYPE_UNKNOWN;
-                        if (lanetype == roadmanager::Lane::LaneType::LANE_TYPE_DRIVING)
-                        {
-                            class_type    = osi3::Lane_Classification_Type::Lane_Classification_Type_TYPE_DRIVING;
-                            subclass_type = osi3::Lane_Classification_Subtype::Lane_Classification_Subtype_SUBTYPE_NORMAL;
-                        }
-                        else if (lanetype == roadmanager::Lane::LaneType::LANE_TYPE_PARKING)
-                        {
-                            class_type    = osi3::Lane_Classification_Type::Lane_Classification_Type_TYPE_NONDRIVING;
-                            subclass_type = osi3::Lane_Classification_Subtype::Lane_Classification_Subtype_SUBTYPE_PARKING;
-                        }
-                        else if (lanetype == roadmanager::Lane::LaneType::LANE_TYPE_BIDIRECTIONAL)
-                        {
-                            class_type    = osi3::Lane_Classification_Type::Lane_Classification_Type_TYPE_DRIVING;
-                            subclass_type = osi3::Lane_Classification_Subtype::Lane_Classification_Subtype_SUBTYPE_NORMAL;
-                        }
-                        else if (lanetype == roadmanager::Lane::LaneType::LANE_TYPE_STOP)
-                        {
-                            class_type    = osi3::Lane_Classification_Type::Lane_Classification_Type_TYPE_NONDRIVING;
-                            subclass_type = osi3::Lane_Classification_Subtype::Lane_Classification_Subtype_SUBTYPE_STOP;
-                        }
-                        else if (lanetype == roadmanager::Lane::LaneType::LANE_TYPE_BIKING)
-                        {
-                            class_type    = osi3::Lane_Classification_Type::Lane_Classification_Type_TYPE_NONDRIVING;
-                            subclass_type = osi3::Lane_Classification_Subtype::Lane_Classification_Subtype_SUBTYPE_BIKING;
-                        }
-                        else if (lanetype == roadmanager::Lane::LaneType::LANE_TYPE_SIDEWALK)
-                        {
-                            class_type    = osi3::Lane_Classification_Type::Lane_Classification_Type_TYPE_NONDRIVING;
-                            subclass_type = osi3::Lane_Classification_Subtype::Lane_Classification_Subtype_SUBTYPE_SIDEWALK;
-                        }
-                        else if (lanetype == roadmanager::Lane::LaneType::LANE_TYPE_BORDER)
-                        {
-                            class_type    = osi3::Lane_Classification_Type::Lane_Classification_Type_TYPE_NONDRIVING;
-                            subclass_type = osi3::Lane_Classification_Subtype::Lane_Classification_Subtype_SUBTYPE_BORDER;
-                        }
-                        else if (lanetype == roadmanager::Lane::LaneType::LANE_TYPE_RESTRICTED)
-                        {
-                            class_type    = osi3::Lane_Classification_Type::Lane_Classification_Type_TYPE_NONDRIVING;
-                            subclass_type = osi3::Lane_Classification_Subtype::Lane_Classification_Subtype_SUBTYPE_RESTRICTED;
-                        }
-                        else if (lanetype == roadmanager::Lane::LaneType::LANE_TYPE_ROADMARKS)
-                        {
-                            class_type    = osi3::Lane_Classification_Type::Lane_Classification_Type_TYPE_NONDRIVING;
-                            subclass_type = osi3::Lane_Classification_Subtype::Lane_Classification_Subtype_SUBTYPE_OTHER;
-                        }
-                        else if (lanetype == roadmanager::Lane::LaneType::LANE_TYPE_TRAM)
-                        {
-                            class_type    = osi3::Lane_Classification_Type::Lane_Classification_Type_TYPE_NONDRIVING;
-                            subclass_type = osi3::Lane_Classification_Subtype::Lane_Classification_Subtype_SUBTYPE_OTHER;
-                        }
-                        else if (lanetype == roadmanager::Lane::LaneType::LANE_TYPE_RAIL)
-                        {
-                            class_type    = osi3::Lane_Classification_Type::Lane_Classification_Type_TYPE_NONDRIVING;
-                            subclass_type = osi3::Lane_Classification_Subtype::Lane_Classification_Subtype_SUBTYPE_OTHER;
-                        }
-                        else if (lanetype == roadmanager::Lane::LaneType::LANE_TYPE_ENTRY)
-                        {
-                            class_type    = osi3::Lane_Classification_Type::Lane_Classification_Type_TYPE_DRIVING;
-                            subclass_type = osi3::Lane_Classification_Subtype::Lane_Classification_Subtype_SUBTYPE_ENTRY;
-                        }
-                        else if (lanetype == roadmanager::Lane::LaneType::LANE_TYPE_EXIT)
-                        {
-                            class_type    = osi3::Lane_Classification_Type::Lane_Classification_Type_TYPE_DRIVING;
-                            subclass_type = osi3::Lane_Classification_Subtype::Lane_Classification_Subtype_SUBTYPE_EXIT;
-                        }
-                        else if (lanetype == roadmanager::Lane::LaneType::LANE_TYPE_OFF_RAMP)
-                        {
-                            class_type    = osi3::Lane_Classification_Type::Lane_Classification_Type_TYPE_DRIVING;
-                            subclass_type = osi3::Lane_Classification_Subtype::Lane_Classification_Subtype_SUBTYPE_OFFRAMP;
-                        }
-                        else if (lanetype == roadmanager::Lane::LaneType::LANE_TYPE_ON_RAMP)
-                        {
-                            class_type    = osi3::Lane_Classification_Type::Lane_Classification_Type_TYPE_DRIVING;
-                            subclass_type = osi3::Lane_Classification_Subtype::Lane_Classification_Subtype_SUBTYPE_ONRAMP;
-                        }
-                        else if (lanetype == roadmanager::Lane::LaneType::LANE_TYPE_MEDIAN)
-                        {
-                            class_type    = osi3::Lane_Classification_Type::Lane_Classification_Type_TYPE_NONDRIVING;
-                            subclass_type = osi3::Lane_Classification_Subtype::Lane_Classification_Subtype_SUBTYPE_OTHER;
-                        }
-                        else if (lanetype == roadmanager::Lane::LaneType::LANE_TYPE_SHOULDER)
-                        {
-                            class_type    = osi3::Lane_Classification_Type::Lane_Classification_Type_TYPE_NONDRIVING;
-                            subclass_type = osi3::Lane_Classification_Subtype::Lane_Classification_Subtype_SUBTYPE_SHOULDER;
-                        }
-                        else if (lanetype == roadmanager::Lane::LaneType::LANE_TYPE_CURB)
-                        {
-                            class_type    = osi3::Lane_Classification_Type::Lane_Classification_Type_TYPE_NONDRIVING;
-                            subclass_type = osi3::Lane_Classification_Subtype::Lane_Classification_Subtype_SUBTYPE_BORDER;
-                        }
-                        else if (lanetype == roadmanager::Lane::LaneType::LANE_TYPE_CONNECTING_RAMP)
-                        {
-                            class_type    = osi3::Lane_Classification_Type::Lane_Classification_Type_TYPE_DRIVING;
-                            subclass_type = osi3::Lane_Classification_Subtype::Lane_Classification_Subtype_SUBTYPE_CONNECTINGRAMP;
-                        }
-                        else if (lanetype == roadmanager::Lane::LaneType::LANE_TYPE_SPECIAL1 ||
-                                 lanetype == roadmanager::Lane::LaneType::LANE_TYPE_SPECIAL2 ||
-                                 lanetype == roadmanager::Lane::LaneType::LANE_TYPE_SPECIAL3)
+                    // Get the predecessor and successor lanes
+                    roadmanager::Lane *predecessorLane = nullptr;
+                    roadmanager::Lane *successorLane   = nullptr;
+
+                    osi3::Lane_Classification_LanePairing *lane_pairing = nullptr;
+                    if (predecessor_lane_section && lane->GetLink(roadmanager::LinkType::PREDECESSOR))
+                    {
+                        predecessorLane = predecessor_lane_section->GetLaneById(lane->GetLink(roadmanager::LinkType::PREDECESSOR)->GetId());
+                        if (predecessorLane)
                         {
-                            class_type    = osi3::Lane_Classification_Type::Lane_Classification_Type_TYPE_OTHER;
-                            subclass_type = osi3::Lane_Classification_Subtype::Lane_Classification_Subtype_SUBTYPE_OTHER;
+                            if (!lane_pairing)
+                            {
+                                lane_pairing = osi_lane->mutable_classification()->add_lane_pairing();
+                            }
+                            lane_pairing->mutable_antecessor_lane_id()->set_value(static_cast<unsigned int>(predecessorLane->GetGlobalId()));
                         }
-                        else if (lanetype == roadmanager::Lane::LaneType::LANE_TYPE_NONE)
+                    }
+
+                    if (successor_lane_section && lane->GetLink(roadmanager::LinkType::SUCCESSOR))
+                    {
+                        successorLane = successor_lane_section->GetLaneById(lane->GetLink(roadmanager::LinkType::SUCCESSOR)->GetId());
+                        if (successorLane)
                         {
-                            class_type    = osi3::Lane_Classification_Type::Lane_Classification_Type_TYPE_UNKNOWN;
-                            subclass_type = osi3::Lane_Classification_Subtype::Lane_Classification_Subtype_SUBTYPE_UNKNOWN;
+                            if (!lane_pairing)
+                            {
+                                lane_pairing = osi_lane->mutable_classification()->add_lane_pairing();
+                            }
+                            lane_pairing->mutable_successor_lane_id()->set_value(static_cast<unsigned int>(successorLane->GetGlobalId()));
                         }
-                        osi_lane->mutable_classification()->set_type(class_type);
-                        osi_lane->mutable_classification()->set_subtype(subclass_type);
+                    }
 
-                        // CENTERLINE POINTS
-                        int n_osi_points = lane->GetOSIPoints()->GetNumOfOSIPoints();
-                        for (int jj = 0; jj < n_osi_points; jj++)
+                    if (global_predecessor_junction_id != -1)
+                    {
+                        if (!lane_pairing)
                         {
-                            osi3::Vector3d *centerLine = osi_lane->mutable_classification()->add_centerline();
-                            centerLine->set_x(lane->GetOSIPoints()->GetXfromIdx(jj));
-                            centerLine->set_y(lane->GetOSIPoints()->GetYfromIdx(jj));
-                            centerLine->set_z(lane->GetOSIPoints()->GetZfromIdx(jj));
+                            lane_pairing = osi_lane->mutable_classification()->add_lane_pairing();
                         }
+                        lane_pairing->mutable_antecessor_lane_id()->set_value(static_cast<unsigned int>(global_predecessor_junction_id));
+                    }
 
-                        // DRIVING DIRECTION
-                        bool driving_direction = true;
-                        if ((lane_id >= 0 && road->GetRule() == roadmanager::Road::RoadRule::RIGHT_HAND_TRAFFIC) ||
-                            (lane_id < 0 && road->GetRule() == roadmanager::Road::RoadRule::LEFT_HAND_TRAFFIC))
+                    if (global_successor_junction_id != -1)
+                    {
+                        if (!lane_pairing)
                         {
-                            driving_direction = false;
+                            lane_pairing = osi_lane->mutable_classification()->add_lane_pairing();
                         }
-                        osi_lane->mutable_classification()->set_centerline_is_driving_direction(driving_direction);
+                        lane_pairing->mutable_successor_lane_id()->set_value(static_cast<unsigned int>(global_successor_junction_id));
+                    }
+                    // Update lanes that connect with junctions that are not intersections
+                    if (road->GetNumberOfRoadTypes() > 0 && road->GetRoadType(0)->road_type_ == roadmanager::Road::RoadType::ROADTYPE_MOTORWAY &&
+                        road->GetJunction() > 0)
+                    {
+                        roadmanager::LaneLink *link_predecessor = lane->GetLink(roadmanager::LinkType::PREDECESSOR);
+                        roadmanager::LaneLink *link_successor   = lane->GetLink(roadmanager::LinkType::SUCCESSOR);
 
-                        // Get the predecessor and successor lanes
-                        roadmanager::Lane *predecessorLane = nullptr;
-                        roadmanager::Lane *successorLane   = nullptr;
+                        roadmanager::Lane *driving_lane_predecessor = 0;
+                        roadmanager::Lane *driving_lane_successor   = 0;
 
-                        osi3::Lane_Classification_LanePairing *lane_pairing = nullptr;
-                        if (predecessor_lane_section && lane->GetLink(roadmanager::LinkType::PREDECESSOR))
+                        if (link_predecessor)
                         {
-                            predecessorLane = predecessor_lane_section->GetLaneById(lane->GetLink(roadmanager::LinkType::PREDECESSOR)->GetId());
-                            if (predecessorLane)
+                            driving_lane_predecessor =
+                                predecessorRoad->GetDrivingLaneById(predecessor_lane_section->GetS(), link_predecessor->GetId());
+                            if (driving_lane_predecessor)
                             {
-                                if (!lane_pairing)
-                                {
-                                    lane_pairing = osi_lane->mutable_classification()->add_lane_pairing();
-                                }
-                                lane_pairing->mutable_antecessor_lane_id()->set_value(static_cast<unsigned int>(predecessorLane->GetGlobalId()));
+                                LOG("Lane %d on predecessor road %d s %.2f is not a driving lane",
+                                    lane->GetId(),
+                                    predecessorRoad->GetId(),
+                                    predecessor_lane_section->GetS());
                             }
                         }
-
-                        if (successor_lane_section && lane->GetLink(roadmanager::LinkType::SUCCESSOR))
+                        else
                         {
-                            successorLane = successor_lane_section->GetLaneById(lane->GetLink(roadmanager::LinkType::SUCCESSOR)->GetId());
-                            if (successorLane)
-                            {
-                                if (!lane_pairing)
-                                {
-                                    lane_pairing = osi_lane->mutable_classification()->add_lane_pairing();
-                                }
-                                lane_pairing->mutable_successor_lane_id()->set_value(static_cast<unsigned int>(successorLane->GetGlobalId()));
-                            }
+                            LOG("Failed to resolve Predecessor link of lane %d of road %d", lane->GetId(), road->GetId());
                         }
 
-                        if (global_predecessor_junction_id != -1)
+                        if (link_successor)
                         {
-                            if (!lane_pairing)
+                            driving_lane_successor = successorRoad->GetDrivingLaneById(successor_lane_section->GetS(), link_successor->GetId());
+                            if (driving_lane_successor)
                             {
-                                lane_pairing = osi_lane->mutable_classification()->add_lane_pairing();
+                                LOG("Lane %d on successor road %d s %.2f is not a driving lane",
+                                    lane->GetId(),
+                                    successorRoad->GetId(),
+                                    successor_lane_section->GetS());
                             }
-                            lane_pairing->mutable_antecessor_lane_id()->set_value(static_cast<unsigned int>(global_predecessor_junction_id));
                         }
-
-                        if (global_successor_junction_id != -1)
+                        else
                         {
-                            if (!lane_pairing)
-                            {
-                                lane_pairing = osi_lane->mutable_classification()->add_lane_pairing();
-                            }
-                            lane_pairing->mutable_successor_lane_id()->set_value(static_cast<unsigned int>(global_successor_junction_id));
+                            LOG("Failed to resolve Successor link of lane %d of road %d", lane->GetId(), road->GetId());
                         }
-                        // Update lanes that connect with junctions that are not intersections
-                        if (road->GetNumberOfRoadTypes() > 0 && road->GetRoadType(0)->road_type_ == roadmanager::Road::RoadType::ROADTYPE_MOTORWAY &&
-                            road->GetJunction() > 0)
-                        {
-                            roadmanager::LaneLink *link_predecessor = lane->GetLink(roadmanager::LinkType::PREDECESSOR);
-                            roadmanager::LaneLink *link_successor   = lane->GetLink(roadmanager::LinkType::SUCCESSOR);
-
-                            roadmanager::Lane *driving_lane_predecessor = 0;
-                            roadmanager::Lane *driving_lane_successor   = 0;
 
-                            if (link_predecessor)
+                        for (int l = 0; l < obj_osi_internal.gt->lane_size(); ++l)
+                        {
+                            if (obj_osi_internal.gt->mutable_lane(l)->mutable_classification()->lane_pairing_size() > 0)
                             {
-                                driving_lane_predecessor =
-                                    predecessorRoad->GetDrivingLaneById(predecessor_lane_section->GetS(), link_predecessor->GetId());
-                                if (driving_lane_predecessor)
-                                {
-                                    LOG("Lane %d on predecessor road %d s %.2f is not a driving lane",
-                                        lane->GetId(),
-                                        predecessorRoad->GetId(),
-                                        predecessor_lane_section->GetS());
-                                }
+                                // there should be only one lane_paring, since only intersections have multiple ones
+                                lane_pairing = obj_osi_internal.gt->mutable_lane(l)->mutable_classification()->mutable_lane_pairing(0);
                             }
                             else
                             {
-                                LOG("Failed to resolve Predecessor link of lane %d of road %d", lane->GetId(), road->GetId());
+                                lane_pairing = obj_osi_internal.gt->mutable_lane(l)->mutable_classification()->add_lane_pairing();
                             }
-
-                            if (link_successor)
+                            if (predecessorRoad && predecessor_lane_section && link_predecessor && driving_lane_predecessor &&
+                                static_cast<unsigned int>(driving_lane_predecessor->GetGlobalId()) == obj_osi_internal.gt->lane(l).id().value())
                             {
-                                driving_lane_successor = successorRoad->GetDrivingLaneById(successor_lane_section->GetS(), link_successor->GetId());
-                                if (driving_lane_successor)
+                                if ((road->GetLink(roadmanager::LinkType::PREDECESSOR) != 0))
                                 {
-                                    LOG("Lane %d on successor road %d s %.2f is not a driving lane",
-                                        lane->GetId(),
-                                        successorRoad->GetId(),
-                                        successor_lane_section->GetS());
+                                    lane_pairing->mutable_successor_lane_id()->set_value(static_cast<unsigned int>(lane_global_id));
                                 }
                             }
-                            else
-                            {
-                                LOG("Failed to resolve Successor link of lane %d of road %d", lane->GetId(), road->GetId());
-                            }
-
-                            for (int l = 0; l < obj_osi_internal.gt->lane_size(); ++l)
+                            if (successorRoad && successor_lane_section && link_successor && driving_lane_successor &&
+                                static_cast<unsigned int>(driving_lane_successor->GetGlobalId()) == obj_osi_internal.gt->lane(l).id().value())
                             {
-                                if (obj_osi_internal.gt->mutable_lane(l)->mutable_classification()->lane_pairing_size() > 0)
-                                {
-                                    // there should be only one lane_paring, since only intersections have multiple ones
-                                    lane_pairing = obj_osi_internal.gt->mutable_lane(l)->mutable_classification()->mutable_lane_pairing(0);
-                                }
-                                else
-                                {
-                                    lane_pairing = obj_osi_internal.gt->mutable_lane(l)->mutable_classification()->add_lane_pairing();
-                                }
-                                if (predecessorRoad && predecessor_lane_section && link_predecessor && driving_lane_predecessor &&
-                                    static_cast<unsigned int>(driving_lane_predecessor->GetGlobalId()) == obj_osi_internal.gt->lane(l).id().value())
-                                {
-                                    if ((road->GetLink(roadmanager::LinkType::PREDECESSOR) != 0))
-                                    {
-                                        lane_pairing->mutable_successor_lane_id()->set_value(static_cast<unsigned int>(lane_global_id));
-                                    }
-                                }
-                                if (successorRoad && successor_lane_section && link_successor && driving_lane_successor &&
-                                    static_cast<unsigned int>(driving_lane_successor->GetGlobalId()) == obj_osi_internal.gt->lane(l).id().value())
+                                if ((road->GetLink(roadmanager::LinkType::SUCCESSOR) != 0))
                                 {
-                                    if ((road->GetLink(roadmanager::LinkType::SUCCESSOR) != 0))
-                                    {
-                                        lane_pairing->mutable_antecessor_lane_id()->set_value(static_cast<unsigned int>(lane_global_id));
-                                    }
+                                    lane_pairing->mutable_antecessor_lane_id()->set_value(static_cast<unsigned int>(lane_global_id));
                                 }
                             }
                         }
+                    }
 
-                        // LEFT AND RIGHT LANE IDS
-                        std::vector<std::pair<int, int>> globalid_ids_left;
-                        std::vector<std::pair<int, int>> globalid_ids_right;
+                    // LEFT AND RIGHT LANE IDS
+                    std::vector<std::pair<int, int>> globalid_ids_left;
+                    std::vector<std::pair<int, int>> globalid_ids_right;
 
-                        if (lane_section->IsOSILaneById(lane_id + (1)))
-                        {
-                            globalid_ids_left.push_back(std::make_pair(lane_id - (1), lane_section->GetLaneGlobalIdById(lane_id + (1))));
-                        }
-                        else if (lane_section->IsOSILaneById(lane_id + (2)))
-                        {
-                            globalid_ids_left.push_back(std::make_pair(lane_id - (2), lane_section->GetLaneGlobalIdById(lane_id + (2))));
-                        }
+                    if (lane_section->IsOSILaneById(lane_id + (1)))
+                    {
+                        globalid_ids_left.push_back(std::make_pair(lane_id - (1), lane_section->GetLaneGlobalIdById(lane_id + (1))));
+                    }
+                    else if (lane_section->IsOSILaneById(lane_id + (2)))
+                    {
+                        globalid_ids_left.push_back(std::make_pair(lane_id - (2), lane_section->GetLaneGlobalIdById(lane_id + (2))));
+                    }
 
-                        if (lane_section->IsOSILaneById(lane_id - (1)))
-                        {
-                            globalid_ids_right.push_back(std::make_pair(lane_id - (1), lane_section->GetLaneGlobalIdById(lane_id - (1))));
-                        }
-                        else if (lane_section->IsOSILaneById(lane_id - (2)))
-                        {
-                            globalid_ids_right.push_back(std::make_pair(lane_id - (2), lane_section->GetLaneGlobalIdById(lane_id - (2))));
-                        }
+                    if (lane_section->IsOSILaneById(lane_id - (1)))
+                    {
+                        globalid_ids_right.push_back(std::make_pair(lane_id - (1), lane_section->GetLaneGlobalIdById(lane_id - (1))));
+                    }
+                    else if (lane_section->IsOSILaneById(lane_id - (2)))
+                    {
+                        globalid_ids_right.push_back(std::make_pair(lane_id - (2), lane_section->GetLaneGlobalIdById(lane_id - (2))));
+                    }
+
+                    // order global id with local id to maintain geographical order
+                    std::sort(globalid_ids_left.begin(), globalid_ids_left.end());
+                    std::sort(globalid_ids_right.begin(), globalid_ids_right.end());
 
-                        // order global id with local id to maintain geographical order
-                        std::sort(globalid_ids_left.begin(), globalid_ids_left.end());
-                        std::sort(globalid_ids_right.begin(), globalid_ids_right.end());
+                    for (unsigned int jj = 0; jj < globalid_ids_left.size(); jj++)
+                    {
+                        osi3::Identifier *left_id = osi_lane->mutable_classification()->add_left_adjacent_lane_id();
+                        left_id->set_value(static_cast<uint64_t>(globalid_ids_left[jj].second));
+                    }
+                    for (unsigned int jj = 0; jj < globalid_ids_right.size(); jj++)
+                    {
+                        osi3::Identifier *right_id = osi_lane->mutable_classification()->add_right_adjacent_lane_id();
+                        right_id->set_value(static_cast<uint64_t>(globalid_ids_right[jj].second));
+                    }
 
-                        for (unsigned int jj = 0; jj < globalid_ids_left.size(); jj++)
+                    // LANE BOUNDARY IDS
+                    if (lane_id == 0)  // for central lane I use the laneboundary osi points as right and left boundary so that it can be used
+                                       // from both sides
+                    {
+                        // check if lane has road mark
+                        std::vector<int> line_ids = lane->GetLineGlobalIds();
+                        if (!line_ids.empty())  // lane has RoadMarks
                         {
-                            osi3::Identifier *left_id = osi_lane->mutable_classification()->add_left_adjacent_lane_id();
-                            left_id->set_value(static_cast<uint64_t>(globalid_ids_left[jj].second));
+                            for (unsigned int jj = 0; jj < line_ids.size(); jj++)
+                            {
+                                osi3::Identifier *left_lane_bound_id = osi_lane->mutable_classification()->add_left_lane_boundary_id();
+                                left_lane_bound_id->set_value(static_cast<unsigned int>(line_ids[jj]));
+                                osi3::Identifier *right_lane_bound_id = osi_lane->mutable_classification()->add_right_lane_boundary_id();
+                                right_lane_bound_id->set_value(static_cast<unsigned int>(line_ids[jj]));
+                            }
                         }
-                        for (unsigned int jj = 0; jj < globalid_ids_right.size(); jj++)
+                        else  // no road marks -> we take lane boundary
                         {
-                            osi3::Identifier *right_id = osi_lane->mutable_classification()->add_right_adjacent_lane_id();
-                            right_id->set_value(static_cast<uint64_t>(globalid_ids_right[jj].second));
+                            int laneboundary_global_id = lane->GetLaneBoundaryGlobalId();
+                            if (laneboundary_global_id >= 0)
+                            {
+                                osi3::Identifier *left_lane_bound_id = osi_lane->mutable_classification()->add_left_lane_boundary_id();
+                                left_lane_bound_id->set_value(static_cast<unsigned int>(laneboundary_global_id));
+                                osi3::Identifier *right_lane_bound_id = osi_lane->mutable_classification()->add_right_lane_boundary_id();
+                                right_lane_bound_id->set_value(static_cast<unsigned int>(laneboundary_global_id));
+                            }
                         }
-
-                        // LANE BOUNDARY IDS
-                        if (lane_id == 0)  // for central lane I use the laneboundary osi points as right and left boundary so that it can be used
-                                           // from both sides
+                    }
+                    else
+                    {
+                        // Set left/right laneboundary ID for left/right lanes- we use LaneMarks is they exist, if not we take laneboundary
+                        std::vector<int> line_ids = lane->GetLineGlobalIds();
+                        if (!line_ids.empty())  // lane has RoadMarks
                         {
-                            // check if lane has road mark
-                            std::vector<int> line_ids = lane->GetLineGlobalIds();
-                            if (!line_ids.empty())  // lane has RoadMarks
+                            for (unsigned int jj = 0; jj < line_ids.size(); jj++)
                             {
-                                for (unsigned int jj = 0; jj < line_ids.size(); jj++)
+                                if (lane_id < 0)
                                 {
-                                    osi3::Identifier *left_lane_bound_id = osi_lane->mutable_classification()->add_left_lane_boundary_id();
+                                    osi3::Identifier *left_lane_bound_id = osi_lane->mutable_classification()->add_right_lane_boundary_id();
                                     left_lane_bound_id->set_value(static_cast<unsigned int>(line_ids[jj]));
-                                    osi3::Identifier *right_lane_bound_id = osi_lane->mutable_classification()->add_right_lane_boundary_id();
-                                    right_lane_bound_id->set_value(static_cast<unsigned int>(line_ids[jj]));
                                 }
-                            }
-                            else  // no road marks -> we take lane boundary
-                            {
-                                int laneboundary_global_id = lane->GetLaneBoundaryGlobalId();
-                                if (laneboundary_global_id >= 0)
+                                else if (lane_id > 0)
                                 {
                                     osi3::Identifier *left_lane_bound_id = osi_lane->mutable_classification()->add_left_lane_boundary_id();
-                                    left_lane_bound_id->set_value(static_cast<unsigned int>(laneboundary_global_id));
-                                    osi3::Identifier *right_lane_bound_id = osi_lane->mutable_classification()->add_right_lane_boundary_id();
-                                    right_lane_bound_id->set_value(static_cast<unsigned int>(laneboundary_global_id));
+                                    left_lane_bound_id->set_value(static_cast<unsigned int>(line_ids[jj]));
                                 }
                             }
                         }
                         else
                         {
-                            // Set left/right laneboundary ID for left/right lanes- we use LaneMarks is they exist, if not we take laneboundary
-                            std::vector<int> line_ids = lane->GetLineGlobalIds();
-                            if (!line_ids.empty())  // lane has RoadMarks
+                            int laneboundary_global_id = lane->GetLaneBoundaryGlobalId();
+                            if (lane_id < 0 && laneboundary_global_id >= 0)
+                            {
+                                osi3::Identifier *left_lane_bound_id = osi_lane->mutable_classification()->add_right_lane_boundary_id();
+                                left_lane_bound_id->set_value(static_cast<unsigned int>(laneboundary_global_id));
+                            }
+                            else if (lane_id > 0 && laneboundary_global_id >= 0)
+                            {
+                                osi3::Identifier *left_lane_bound_id = osi_lane->mutable_classification()->add_left_lane_boundary_id();
+                                left_lane_bound_id->set_value(static_cast<unsigned int>(laneboundary_global_id));
+                            }
+                        }
+
+                        // Set right/left laneboundary ID for left/right lanes - we look at neightbour lanes
+                        int next_lane_id = 0;
+                        if (lane_id < 0)  // if lane is on the right, then it contains its right boundary. So I need to look into its left lane
+                                          // for the left boundary
+                        {
+                            next_lane_id = lane_id + 1;
+                        }
+                        else if (lane_id > 0)  // if lane is on the left, then it contains its left boundary. So I need to look into its right
+                                               // lane for the right boundary
+                        {
+                            next_lane_id = lane_id - 1;
+                        }
+                        // look at right lane and check if it has Lines for RoadMarks
+                        roadmanager::Lane *next_lane = lane_section->GetLaneById(next_lane_id);
+                        if (next_lane != nullptr)
+                        {
+                            std::vector<int> nextlane_line_ids = next_lane->GetLineGlobalIds();
+                            if (!nextlane_line_ids.empty())
                             {
-                                for (unsigned int jj = 0; jj < line_ids.size(); jj++)
+                                for (unsigned int jj = 0; jj < nextlane_line_ids.size(); jj++)
                                 {
                                     if (lane_id < 0)
                                     {
-                                        osi3::Identifier *left_lane_bound_id = osi_lane->mutable_classification()->add_right_lane_boundary_id();
-                                        left_lane_bound_id->set_value(static_cast<unsigned int>(line_ids[jj]));
+                                        osi3::Identifier *right_lane_bound_id = osi_lane->mutable_classification()->add_left_lane_boundary_id();
+                                        right_lane_bound_id->set_value(static_cast<unsigned int>(nextlane_line_ids[jj]));
                                     }
                                     else if (lane_id > 0)
                                     {
-                                        osi3::Identifier *left_lane_bound_id = osi_lane->mutable_classification()->add_left_lane_boundary_id();
-                                        left_lane_bound_id->set_value(static_cast<unsigned int>(line_ids[jj]));
+                                        osi3::Identifier *right_lane_bound_id = osi_lane->mutable_classification()->add_right_lane_boundary_id();
+                                        right_lane_bound_id->set_value(static_cast<unsigned int>(nextlane_line_ids[jj]));
                                     }
                                 }
                             }
-                            else
+                            else  // if the neightbour lane does not have Lines for RoadMakrs we take the LaneBoundary
                             {
-                                int laneboundary_global_id = lane->GetLaneBoundaryGlobalId();
-                                if (lane_id < 0 && laneboundary_global_id >= 0)
+                                int next_laneboundary_global_id = next_lane->GetLaneBoundaryGlobalId();
+                                if (lane_id < 0 && next_laneboundary_global_id >= 0)
                                 {
-                                    osi3::Identifier *left_lane_bound_id = osi_lane->mutable_classification()->add_right_lane_boundary_id();
-                                    left_lane_bound_id->set_value(static_cast<unsigned int>(laneboundary_global_id));
-                                }
-                                else if (lane_id > 0 && laneboundary_global_id >= 0)
-                                {
-                                    osi3::Identifier *left_lane_bound_id = osi_lane->mutable_classification()->add_left_lane_boundary_id();
-                                    left_lane_bound_id->set_value(static_cast<unsigned int>(laneboundary_global_id));
+                                    osi3::Identifier *right_lane_bound_id = osi_lane->mutable_classification()->add_left_lane_boundary_id();
+                                    right_lane_bound_id->set_value(static_cast<unsigned int>(next_laneboundary_global_id));
                                 }
-                            }
-
-                            // Set right/left laneboundary ID for left/right lanes - we look at neightbour lanes
-                            int next_lane_id = 0;
-                            if (lane_id < 0)  // if lane is on the right, then it contains its right boundary. So I need to look into its left lane
-                                              // for the left boundary
-                            {
-                                next_lane_id = lane_id + 1;
-                            }
-                            else if (lane_id > 0)  // if lane is on the left, then it contains its left boundary. So I need to look into its right
-                                                   // lane for the right boundary
-                            {
-                                next_lane_id = lane_id - 1;
-                            }
-                            // look at right lane and check if it has Lines for RoadMarks
-                            roadmanager::Lane *next_lane = lane_section->GetLaneById(next_lane_id);
-                            if (next_lane != nullptr)
-                            {
-                                std::vector<int> nextlane_line_ids = next_lane->GetLineGlobalIds();
-                                if (!nextlane_line_ids.empty())
+                                else if (lane_id > 0 && next_laneboundary_global_id >= 0)
                                 {
-                                    for (unsigned int jj = 0; jj < nextlane_line_ids.size(); jj++)
-                                    {
-                                        if (lane_id < 0)
-                                        {
-                                            osi3::Identifier *right_lane_bound_id = osi_lane->mutable_classification()->add_left_lane_boundary_id();
-                                            right_lane_bound_id->set_value(static_cast<unsigned int>(nextlane_line_ids[jj]));
-                                        }
-                                        else if (lane_id > 0)
-                                        {
-                                            osi3::Identifier *right_lane_bound_id = osi_lane->mutable_classification()->add_right_lane_boundary_id();
-                                            right_lane_bound_id->set_value(static_cast<unsigned int>(nextlane_line_ids[jj]));
-                                        }
-                                    }
-                                }
-                                else  // if the neightbour lane does not have Lines for RoadMakrs we take the LaneBoundary
-                                {
-                                    int next_laneboundary_global_id = next_lane->GetLaneBoundaryGlobalId();
-                                    if (lane_id < 0 && next_laneboundary_global_id >= 0)
-                                    {
-                                        osi3::Identifier *right_lane_bound_id = osi_lane->mutable_classification()->add_left_lane_boundary_id();
-                                        right_lane_bound_id->set_value(static_cast<unsigned int>(next_laneboundary_global_id));
-                                    }
-                                    else if (lane_id > 0 && next_laneboundary_global_id >= 0)
-                                    {
-                                        osi3::Identifier *right_lane_bound_id = osi_lane->mutable_classification()->add_right_lane_boundary_id();
-                                        right_lane_bound_id->set_value(static_cast<unsigned int>(next_laneboundary_global_id));
-                                    }
+                                    osi3::Identifier *right_lane_bound_id = osi_lane->mutable_classification()->add_right_lane_boundary_id();
+                                    right_lane_bound_id->set_value(static_cast<unsigned int>(next_laneboundary_global_id));
                                 }
                             }
                         }
-
-                        // STILL TO DO:
-                        double temp = 0;
-                        osi_lane->mutable_classification()->mutable_road_condition()->set_surface_temperature(temp);
-                        osi_lane->mutable_classification()->mutable_road_condition()->set_surface_water_film(temp);
-                        osi_lane->mutable_classification()->mutable_road_condition()->set_surface_freezing_point(temp);
-                        osi_lane->mutable_classification()->mutable_road_condition()->set_surface_ice(temp);
-                        osi_lane->mutable_classification()->mutable_road_condition()->set_surface_roughness(temp);
-                        osi_lane->mutable_classification()->mutable_road_condition()->set_surface_texture(temp);
-
-                        obj_osi_internal.ln.push_back(osi_lane);
-                        // obj_osi_external.gt->mutable_lane()->CopyFrom(*obj_osi_internal.gt->mutable_lane());
                     }
+
+                    // STILL TO DO:
+                    double temp = 0;
+                    osi_lane->mutable_classification()->mutable_road_condition()->set_surface_temperature(temp);
+                    osi_lane->mutable_classification()->mutable_road_condition()->set_surface_water_film(temp);
+                    osi_lane->mutable_classification()->mutable_road_condition()->set_surface_freezing_point(temp);
+                    osi_lane->mutable_classification()->mutable_road_condition()->set_surface_ice(temp);
+                    osi_lane->mutable_classification()->mutable_road_condition()->set_surface_roughness(temp);
+                    osi_lane->mutable_classification()->mutable_road_condition()->set_surface_texture(temp);
+
+                    obj_osi_internal.ln_idx[lane_global_id] = static_cast<int>(obj_osi_internal.ln.size());
+                    obj_osi_internal.ln.push_back(osi_lane);
+                    // obj_osi_external.gt->mutable_lane()->CopyFrom(*obj_osi_internal.gt->mutable_lane());
                 }
             }
         }
@@ -2154,7 +2277,8 @@ int OSIReporter::UpdateTrafficSignals()
                 // Is Traffic Light
                 if (signal->IsDynamic())
                 {
-                    osi3::TrafficLight *trafficLight = obj_osi_internal.gt->add_traffic_light();
+                    obj_osi_internal.tl_idx[signal->GetId()] = obj_osi_internal.gt->traffic_light_size();
+                    osi3::TrafficLight *trafficLight           = obj_osi_internal.gt->add_traffic_light();
                     trafficLight->mutable_id()->set_value(static_cast<unsigned int>(signal->GetId()));
                     trafficLight->mutable_base()->mutable_orientation()->set_pitch(GetAngleInIntervalMinusPIPlusPI(signal->GetPitch()));
                     trafficLight->mutable_base()->mutable_orientation()->set_roll(GetAngleInIntervalMinusPIPlusPI(signal->GetRoll()));
@@ -2384,17 +2508,7 @@ const char *OSIReporter::GetOSIRoadLane(const std::vector<std::unique_ptr<Object
 
     // find the lane in the sensor view and save its index in the sensor view
     int lane_id_of_vehicle = pos.GetLaneGlobalId();
-    int idx                = -1;
-    for (unsigned int i = 0; i < obj_osi_internal.ln.size(); i++)
-    {
-        osi3::Identifier identifier = obj_osi_internal.ln[i]->id();
-        int              found_id   = static_cast<int>(identifier.value());
-        if (found_id == lane_id_of_vehicle)
-        {
-            idx = static_cast<int>(i);
-            break;
-        }
-    }
+    int idx                = GetLaneIdxfromIdOSI(lane_id_of_vehicle);
     if (idx < 0)
     {
         LOG("Failed to locate vehicle lane id!");
@@ -2410,17 +2524,8 @@ const char *OSIReporter::GetOSIRoadLane(const std::vector<std::unique_ptr<Object
 const char *OSIReporter::GetOSIRoadLaneBoundary(int *size, int global_id)
 {
     // find the lane bounday in the sensor view and save its index
-    int idx = -1;
-    for (unsigned int i = 0; i < obj_osi_internal.lnb.size(); i++)
-    {
-        osi3::Identifier identifier = obj_osi_internal.lnb[i]->id();
-        int              found_id   = static_cast<int>(identifier.value());
-        if (found_id == global_id)
-        {
-            idx = static_cast<int>(i);
-            break;
-        }
-    }
+    auto it  = obj_osi_internal.lnb_idx.find(global_id);
+    int  idx = it != obj_osi_internal.lnb_idx.end() ? it->second : -1;
 
     if (idx == -1)
     {
@@ -2455,18 +2560,8 @@ bool OSIReporter::IsCentralOSILane(int lane_idx)
 
 int OSIReporter::GetLaneIdxfromIdOSI(int lane_id)
 {
-    int idx = -1;
-    for (unsigned int i = 0; i < obj_osi_internal.ln.size(); i++)
-    {
-        osi3::Identifier identifier = obj_osi_internal.ln[i]->id();
-        int              found_id   = static_cast<int>(identifier.value());
-        if (found_id == lane_id)
-        {
-            idx = static_cast<int>(i);
-            break;
-        }
-    }
-    return idx;
+    auto it = obj_osi_internal.ln_idx.find(lane_id);
+    return it != obj_osi_internal.ln_idx.end() ? it->second : -1;
 }
 
 void OSIReporter::GetOSILaneBoundaryIds(const std::vector<std::unique_ptr<ObjectState>> &objectState, std::vector<int> &ids, int object_id)
@@ -2600,14 +2695,9 @@ int OSIReporter::SetOSITimeStampExplicit(unsigned long long int nanoseconds)
 void OSIReporter::SetStationaryModelReference(std::string model_reference)
 {
     // Check registered paths for model3d
-    std::string model3d_abs_path;
-    for (size_t i = 0; i < SE_Env::Inst().GetPaths().size(); i++)
+    std::string model3d_abs_path = SE_Env::Inst().ResolveFilePath(model_reference);
+    if (!model3d_abs_path.empty())
     {
-        std::string file_name_candidate = CombineDirectoryPathAndFilepath(SE_Env::Inst().GetPaths()[i], model_reference);
-        if (FileExists(file_name_candidate.c_str()))
-        {
-            stationary_model_reference = file_name_candidate;
-            break;
-        }
+        stationary_model_reference = model3d_abs_path;
     }
 }
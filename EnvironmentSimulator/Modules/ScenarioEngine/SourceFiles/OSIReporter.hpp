@@ -61,16 +61,19 @@ public:
     int ClearOSIGroundTruth();
     /**
     Calls UpdateOSIStaticGroundTruth and UpdateOSIDynamicGroundTruth
+    @param frame Gateway frame number, see UpdateOSIDynamicGroundTruth
     */
-    int UpdateOSIGroundTruth(const std::vector<std::unique_ptr<ObjectState>>& objectState);
+    int UpdateOSIGroundTruth(const std::vector<std::unique_ptr<ObjectState>>& objectState, int frame = -1);
     /**
     Fills up the osi message with  static GroundTruth
     */
     int UpdateOSIStaticGroundTruth(const std::vector<std::unique_ptr<ObjectState>>& objectState);
     /**
     Fills up the osi message with dynamic GroundTruth
+    @param frame Gateway frame number (see ScenarioGateway::getFrameNr()). Moving objects not changed since previous update
+    are kept as is. Set -1 to update all objects.
     */
-    int UpdateOSIDynamicGroundTruth(const std::vector<std::unique_ptr<ObjectState>>& objectState, bool reportGhost = true);
+    int UpdateOSIDynamicGroundTruth(const std::vector<std::unique_ptr<ObjectState>>& objectState, bool reportGhost = true, int frame = -1);
     /**
     Fills up the osi message with Stationary Object from the OpenDRIVE description
     */
@@ -85,24 +88,39 @@ public:
     int UpdateOSIHostVehicleData(ObjectState* objectState);
     /**
     Fills up the osi message with Moving Object
+    @param mobj Existing moving object to overwrite, or nullptr to add a new one
     */
-    int UpdateOSIMovingObject(ObjectState* objectState);
+    int UpdateOSIMovingObject(ObjectState* objectState, osi3::MovingObject* mobj = nullptr);
     /**
-    Fills up the osi message with Lane Boundary
+    Fills up the osi message with Lane Boundaries of given road
     */
-    int UpdateOSILaneBoundary();
+    int UpdateOSILaneBoundary(roadmanager::Road* road);
     /**
-    Fills up the osi message with Lanes
+    Fills up the osi message with Lanes of given road
     */
-    int UpdateOSIRoadLane();
+    int UpdateOSIRoadLane(roadmanager::Road* road);
     /**
-    Fills the intersection type of lanes
+    Fills the intersection type of lanes. Expects all road lanes to be already created.
     */
     int UpdateOSIIntersection();
     /**
     Fills the Traffic Signals
     */
     int UpdateTrafficSignals();
+    /**
+    Update state of traffic lights changed since previous call, see roadmanager::SignalStateRegistry
+    Once the static ground truth has been cleared, the external message carries only the lights changed this frame
+    @param key_frame If true, update all traffic lights with a registered state
+    @return Number of changed signals
+    */
+    int UpdateOSITrafficLightStates(bool key_frame = false);
+    /**
+    Ids of the signals changed at latest traffic light state update
+    */
+    const std::vector<int>& GetChangedTrafficLights() const
+    {
+        return changed_traffic_lights_;
+    }
 
     /**
     Set model reference for stationary environment as defined in OpenScenario
@@ -155,6 +173,11 @@ private:
     std::ofstream          osi_file;
     int                    osi_update_counter_;
     std::string            stationary_model_reference;
+    unsigned int           signal_state_version_;
+    std::vector<int>       changed_traffic_lights_;
+    bool                   all_traffic_lights_reported_;  // external ground truth holds the complete traffic light list
+    std::vector<int>       moving_object_ids_;            // object ids of internal ground truth moving objects, in order
+    int                    moving_objects_frame_;         // gateway frame of latest moving object update, -1 if unknown
     void                   CreateMovingObjectFromSensorData(const osi3::SensorData& sd, int obj_nr);
     void                   CreateLaneBoundaryFromSensordata(const osi3::SensorData& sd, int lane_boundary_nr);
 };
@@ -12,6 +12,7 @@
 
 #include "Parameters.hpp"
 #include "simple_expr.h"
+#include <cmath>
 
 using namespace scenarioengine;
 
@@ -45,6 +46,11 @@ void Parameters::RestoreParameterDeclarations()
             parameterDeclarations_.Parameter.begin() + static_cast<int>(parameterDeclarations_.Parameter.size()) - paramDeclarationsSize_.top());
         paramDeclarationsSize_.pop();
         catalog_param_assignments.clear();
+
+        // Shadowed entries might be visible again, re-create index
+        indexedSize_ = 0;
+        entryIndex_.clear();
+        UpdateEntryIndex();
     }
     else
     {
@@ -54,22 +60,25 @@ void Parameters::RestoreParameterDeclarations()
 
 int Parameters::setParameter(std::string name, std::string value)
 {
-    // If string already present in parameterDeclaration
-    for (size_t i = 0; i < parameterDeclarations_.Parameter.size(); i++)
+    OSCParameterDeclarations::ParameterStruct* ps = getParameterEntry(name);
+
+    if (!ps)
     {
-        if (PARAMETER_PREFIX + parameterDeclarations_.Parameter[i].name == name ||  // parameter names should not include prefix
-            parameterDeclarations_.Parameter[i].name == name)                       // But support also parameter name including prefix
-        {
-            parameterDeclarations_.Parameter[i].value._string = value;
-            return 0;
-        }
+        return -1;
     }
 
-    return -1;
+    ps->value._string = value;
+
+    return 0;
 }
 
 std::string Parameters::getParameter(OSCParameterDeclarations& parameterDeclaration, std::string name)
 {
+    if (&parameterDeclaration == &parameterDeclarations_)
+    {
+        return LookupParameter(name.c_str(), name.size()).value._string;
+    }
+
     // If string already present in parameterDeclaration
     for (size_t i = 0; i < parameterDeclaration.Parameter.size(); i++)
     {
@@ -83,19 +92,75 @@ std::string Parameters::getParameter(OSCParameterDeclarations& parameterDeclarat
     throw std::runtime_error("Failed to resolve parameter");
 }
 
-OSCParameterDeclarations::ParameterStruct* Parameters::getParameterEntry(std::string name)
+void Parameters::UpdateEntryIndex()
 {
-    // If string already present in parameterDeclaration
-    for (size_t i = 0; i < parameterDeclarations_.Parameter.size(); i++)
+    if (indexedSize_ == parameterDeclarations_.Parameter.size())
     {
-        if (PARAMETER_PREFIX + parameterDeclarations_.Parameter[i].name == name ||  // parameter names should not include prefix
-            parameterDeclarations_.Parameter[i].name == name)                       // But support also parameter name including prefix
-        {
-            return &parameterDeclarations_.Parameter[i];
-        }
+        return;
     }
 
-    return 0;
+    // Declaration list changed by other means than parsing, e.g. restore point, re-create index
+    // Go from the back so that front entries overwrite any shadowed ones
+    entryIndex_.clear();
+    size_t n = parameterDeclarations_.Parameter.size();
+    for (size_t i = 0; i < n; i++)
+    {
+        entryIndex_[parameterDeclarations_.Parameter[n - 1 - i].name] = static_cast<int>(i);
+    }
+    indexedSize_ = n;
+}
+
+int Parameters::FindParameterHandle(const char* name, size_t len)
+{
+    UpdateEntryIndex();
+
+    // parameter names should not include prefix, but support also parameter name including prefix
+    auto it = entryIndex_.end();
+    if (len > 0 && name[0] == PARAMETER_PREFIX)
+    {
+        lookup_key_.assign(name + 1, len - 1);
+        it = entryIndex_.find(lookup_key_);
+    }
+    if (it == entryIndex_.end())
+    {
+        lookup_key_.assign(name, len);
+        it = entryIndex_.find(lookup_key_);
+    }
+
+    return it != entryIndex_.end() ? it->second : -1;
+}
+
+int Parameters::getParameterHandle(std::string name)
+{
+    return FindParameterHandle(name.c_str(), name.size());
+}
+
+OSCParameterDeclarations::ParameterStruct& Parameters::LookupParameter(const char* name, size_t len)
+{
+    OSCParameterDeclarations::ParameterStruct* ps = getParameterEntry(FindParameterHandle(name, len));
+
+    if (ps == nullptr)
+    {
+        LOG("Failed to resolve parameter %s", std::string(name, len).c_str());
+        throw std::runtime_error("Failed to resolve parameter");
+    }
+
+    return *ps;
+}
+
+OSCParameterDeclarations::ParameterStruct* Parameters::getParameterEntry(int handle)
+{
+    if (handle < 0 || static_cast<size_t>(handle) >= parameterDeclarations_.Parameter.size())
+    {
+        return 0;
+    }
+
+    return &parameterDeclarations_.Parameter[parameterDeclarations_.Parameter.size() - 1 - static_cast<size_t>(handle)];
+}
+
+OSCParameterDeclarations::ParameterStruct* Parameters::getParameterEntry(std::string name)
+{
+    return getParameterEntry(getParameterHandle(name));
 }
 
 int Parameters::GetNumberOfParameters()
@@ -189,7 +254,12 @@ int Parameters::getParameterValue(std::string name, void* value)
 
 int Parameters::getParameterValueInt(std::string name, int& value)
 {
-    OSCParameterDeclarations::ParameterStruct* ps = getParameterEntry(name);
+    return getParameterValueByHandle(getParameterHandle(name), value);
+}
+
+int Parameters::getParameterValueByHandle(int handle, int& value)
+{
+    OSCParameterDeclarations::ParameterStruct* ps = getParameterEntry(handle);
 
     if (!ps || ps->type != OSCParameterDeclarations::ParameterType::PARAM_TYPE_INTEGER)
     {
@@ -203,7 +273,12 @@ int Parameters::getParameterValueInt(std::string name, int& value)
 
 int Parameters::getParameterValueDouble(std::string name, double& value)
 {
-    OSCParameterDeclarations::ParameterStruct* ps = getParameterEntry(name);
+    return getParameterValueByHandle(getParameterHandle(name), value);
+}
+
+int Parameters::getParameterValueByHandle(int handle, double& value)
+{
+    OSCParameterDeclarations::ParameterStruct* ps = getParameterEntry(handle);
 
     if (!ps || ps->type != OSCParameterDeclarations::ParameterType::PARAM_TYPE_DOUBLE)
     {
@@ -231,7 +306,12 @@ int Parameters::getParameterValueString(std::string name, const char*& value)
 
 int Parameters::getParameterValueBool(std::string name, bool& value)
 {
-    OSCParameterDeclarations::ParameterStruct* ps = getParameterEntry(name);
+    return getParameterValueByHandle(getParameterHandle(name), value);
+}
+
+int Parameters::getParameterValueByHandle(int handle, bool& value)
+{
+    OSCParameterDeclarations::ParameterStruct* ps = getParameterEntry(handle);
 
     if (!ps || ps->type != OSCParameterDeclarations::ParameterType::PARAM_TYPE_BOOL)
     {
@@ -309,7 +389,12 @@ int Parameters::setParameterValueByString(std::string name, std::string value)
 
 int Parameters::setParameterValue(std::string name, int value)
 {
-    OSCParameterDeclarations::ParameterStruct* ps = getParameterEntry(name);
+    return setParameterValueByHandle(getParameterHandle(name), value);
+}
+
+int Parameters::setParameterValueByHandle(int handle, int value)
+{
+    OSCParameterDeclarations::ParameterStruct* ps = getParameterEntry(handle);
 
     if (!ps || ps->type != OSCParameterDeclarations::ParameterType::PARAM_TYPE_INTEGER)
     {
@@ -324,7 +409,12 @@ int Parameters::setParameterValue(std::string name, int value)
 
 int Parameters::setParameterValue(std::string name, double value)
 {
-    OSCParameterDeclarations::ParameterStruct* ps = getParameterEntry(name);
+    return setParameterValueByHandle(getParameterHandle(name), value);
+}
+
+int Parameters::setParameterValueByHandle(int handle, double value)
+{
+    OSCParameterDeclarations::ParameterStruct* ps = getParameterEntry(handle);
 
     if (!ps || ps->type != OSCParameterDeclarations::ParameterType::PARAM_TYPE_DOUBLE)
     {
@@ -353,7 +443,12 @@ int Parameters::setParameterValue(std::string name, const char* value)
 
 int Parameters::setParameterValue(std::string name, bool value)
 {
-    OSCParameterDeclarations::ParameterStruct* ps = getParameterEntry(name);
+    return setParameterValueByHandle(getParameterHandle(name), value);
+}
+
+int Parameters::setParameterValueByHandle(int handle, bool value)
+{
+    OSCParameterDeclarations::ParameterStruct* ps = getParameterEntry(handle);
 
     if (!ps || ps->type != OSCParameterDeclarations::ParameterType::PARAM_TYPE_BOOL)
     {
@@ -368,102 +463,230 @@ int Parameters::setParameterValue(std::string name, bool value)
 
 std::string Parameters::ResolveParametersInString(std::string str)
 {
-    size_t found;
-    while ((found = str.find("$")) != std::string::npos)
+    std::string out;
+    AppendResolvedParameters(str.c_str(), str.size(), out);
+
+    return out;
+}
+
+void Parameters::AppendResolvedParameters(const char* str, size_t len, std::string& out)
+{
+    for (size_t i = 0; i < len;)
     {
-        size_t found_space = str.find_first_of(" ({)}-+*/%^!|&<>=,", found);
-        if (found_space != std::string::npos)
+        if (str[i] != PARAMETER_PREFIX)
         {
-            str.replace(found, found_space - found, getParameter(parameterDeclarations_, str.substr(found, found_space - found)));
+            out += str[i++];
+            continue;
         }
-        else
+
+        // parameter reference ends at any operator, separator or end of string
+        size_t end = i + 1;
+        while (end < len && strchr(" ({)}-+*/%^!|&<>=,", str[end]) == nullptr)
         {
-            str.replace(found, std::string::npos, getParameter(parameterDeclarations_, str.substr(found)));
+            end++;
         }
+        out += LookupParameter(str + i, end - i).value._string;
+        i = end;
     }
-
-    return str;
 }
 
-static void ReplaceStringInPlace(std::string& subject, const std::string& search, const std::string& replace)
+static bool IsIdentifierChar(char c)
 {
-    size_t pos = 0;
-    while ((pos = subject.find(search, pos)) != std::string::npos)
-    {
-        subject.replace(pos, search.length(), replace);
-        pos += replace.length();
-    }
+    return isalnum(static_cast<unsigned char>(c)) || c == '_';
 }
 
-std::string Parameters::ReadAttribute(pugi::xml_node node, std::string attribute_name, bool required)
+double Parameters::EvaluateExpression(const char* value)
 {
-    if (!strcmp(attribute_name.c_str(), ""))
+    // value is on the form "${expr}"
+    const char* expr = value + 2;
+    const char* end  = strchr(expr, '}');
+    if (end == nullptr)
     {
-        if (required)
-        {
-            LOG_AND_QUIT("Warning: Request to read empty attribute name in XML node %s", node.name());
-        }
-        return "";
+        LOG_AND_QUIT("Expression syntax error: %s, missing end '}'", value);
     }
 
-    pugi::xml_attribute attr;
+    // replace parameters by their values
+    resolved_str_.clear();
+    AppendResolvedParameters(expr, static_cast<size_t>(end - expr), resolved_str_);
 
-    if ((attr = node.attribute(attribute_name.c_str())))
+    // Convert from OpenSCENARIO 1.1 operator names to expr op names, whole words only
+    static const std::pair<const char*, const char*> operators[] = {{"not", "!"}, {"and", "&&"}, {"or", "||"}, {"true", "1"}, {"false", "0"}};
+    expr_str_.clear();
+    for (size_t i = 0; i < resolved_str_.size();)
     {
-        if (attr.value()[0] == '$' && strlen(attr.value()) > 1)
+        bool replaced = false;
+        if (IsIdentifierChar(resolved_str_[i]) && (i == 0 || !IsIdentifierChar(resolved_str_[i - 1])))
         {
-            if (attr.value()[1] == '{' && strlen(attr.value()) > 2)
+            for (const auto& op : operators)
             {
-                // Resolve expression
-                std::string expr  = attr.value();
-                std::size_t found = expr.find('}', 2);
-                if (found != std::string::npos)
+                size_t n = strlen(op.first);
+                if (resolved_str_.compare(i, n, op.first) == 0 && (i + n == resolved_str_.size() || !IsIdentifierChar(resolved_str_[i + n])))
                 {
-                    expr = expr.substr(2, found - 2);        // trim to bare expression, exclude '{' and '}'
-                    expr = ResolveParametersInString(expr);  // replace parameters by their values
-
-                    // Convert from OpenSCENARIO 1.1 operator names to expr op names
-                    ReplaceStringInPlace(expr, "not ", "!");
-                    ReplaceStringInPlace(expr, "not(", "!(");
-                    ReplaceStringInPlace(expr, "and ", "&& ");
-                    ReplaceStringInPlace(expr, "or ", "|| ");
-                    ReplaceStringInPlace(expr, "true ", "1 ");
-                    ReplaceStringInPlace(expr, "false ", "0 ");
-
-                    double value = eval_expr(expr.c_str());
-                    if (isnan(value))
+                    expr_str_ += op.second;
+                    i += n;
+                    if (op.second[0] == '!')
                     {
-                        LOG_AND_QUIT("Failed to evaluate the expression : % s\n", attr.value());
+                        // unary operator must precede its operand directly
+                        while (i < resolved_str_.size() && resolved_str_[i] == ' ')
+                        {
+                            i++;
+                        }
                     }
-
-                    LOG("Expr %s = %s = %.10lf", attr.value(), expr.c_str(), value);
-                    return std::to_string(value);
-                }
-                else
-                {
-                    LOG_AND_QUIT("Expression syntax error: %s, missing end '}'", attr.value());
+                    replaced = true;
+                    break;
                 }
             }
-            else
-            {
-                // Resolve variable
-                return getParameter(parameterDeclarations_, attr.value());
-            }
         }
-        else
+        if (!replaced)
         {
-            return attr.value();
+            expr_str_ += resolved_str_[i++];
         }
     }
-    else
+
+    double number = eval_expr(expr_str_.c_str());
+    if (isnan(number))
+    {
+        LOG_AND_QUIT("Failed to evaluate the expression : % s\n", value);
+    }
+
+    LOG("Expr %s = %s = %.10lf", value, expr_str_.c_str(), number);
+
+    return number;
+}
+
+Parameters::AttributeValueType Parameters::ResolveAttribute(pugi::xml_node node,
+                                                            const char*    attribute,
+                                                            bool           required,
+                                                            const char*&   str,
+                                                            double&        number)
+{
+    if (attribute == nullptr || attribute[0] == '\0')
     {
         if (required)
         {
-            LOG_AND_QUIT("Error: missing required attribute: %s -> %s", node.name(), attribute_name.c_str());
+            LOG_AND_QUIT("Warning: Request to read empty attribute name in XML node %s", node.name());
         }
+        return AttributeValueType::MISSING;
     }
 
-    return "";
+    pugi::xml_attribute attr = node.attribute(attribute);
+
+    if (!attr)
+    {
+        if (required)
+        {
+            LOG_AND_QUIT("Error: missing required attribute: %s -> %s", node.name(), attribute);
+        }
+        return AttributeValueType::MISSING;
+    }
+
+    const char* value = attr.value();
+
+    if (value[0] == PARAMETER_PREFIX && value[1] != '\0')
+    {
+        if (value[1] == '{' && value[2] != '\0')
+        {
+            number = EvaluateExpression(value);
+            return AttributeValueType::NUMBER;
+        }
+
+        // Resolve variable
+        str = LookupParameter(value, strlen(value)).value._string.c_str();
+        return AttributeValueType::STRING;
+    }
+
+    str = value;
+
+    return AttributeValueType::STRING;
+}
+
+const char* Parameters::ResolveAttributeString(pugi::xml_node node, const char* attribute, bool required)
+{
+    const char* str    = nullptr;
+    double      number = 0.0;
+
+    AttributeValueType type = ResolveAttribute(node, attribute, required, str, number);
+
+    if (type == AttributeValueType::NUMBER)
+    {
+        resolved_str_ = std::to_string(number);
+        return resolved_str_.c_str();
+    }
+
+    return type == AttributeValueType::STRING ? str : nullptr;
+}
+
+std::string Parameters::ReadAttribute(pugi::xml_node node, const char* attribute, bool required)
+{
+    const char* str = ResolveAttributeString(node, attribute, required);
+
+    return str != nullptr ? str : "";
+}
+
+// Convert expression result to integer, truncating like atoi but tolerating rounding errors of the evaluation
+static int ExpressionToInt(double number)
+{
+    return static_cast<int>(std::round(number * 1e6) / 1e6);
+}
+
+double Parameters::ReadDouble(pugi::xml_node node, const char* attribute, bool required, double default_value)
+{
+    const char* str    = nullptr;
+    double      number = 0.0;
+
+    switch (ResolveAttribute(node, attribute, required, str, number))
+    {
+        case AttributeValueType::NUMBER:
+            return number;
+        case AttributeValueType::STRING:
+            return str[0] != '\0' ? atof(str) : default_value;
+        default:
+            return default_value;
+    }
+}
+
+int Parameters::ReadInt(pugi::xml_node node, const char* attribute, bool required, int default_value)
+{
+    const char* str    = nullptr;
+    double      number = 0.0;
+
+    switch (ResolveAttribute(node, attribute, required, str, number))
+    {
+        case AttributeValueType::NUMBER:
+            return ExpressionToInt(number);
+        case AttributeValueType::STRING:
+            return str[0] != '\0' ? atoi(str) : default_value;
+        default:
+            return default_value;
+    }
+}
+
+bool Parameters::ReadBool(pugi::xml_node node, const char* attribute, bool required, bool default_value)
+{
+    const char* str    = nullptr;
+    double      number = 0.0;
+
+    switch (ResolveAttribute(node, attribute, required, str, number))
+    {
+        case AttributeValueType::NUMBER:
+            return number != 0.0;
+        case AttributeValueType::STRING:
+            if (!strcmp(str, "true") || !strcmp(str, "1"))
+            {
+                return true;
+            }
+            else if (!strcmp(str, "false") || !strcmp(str, "0"))
+            {
+                return false;
+            }
+            else if (str[0] != '\0')
+            {
+                LOG("Unexpected boolean %s value: %s", attribute, str);
+            }
+            return default_value;
+        default:
+            return default_value;
+    }
 }
 
 void Parameters::parseParameterDeclarations(pugi::xml_node declarationsNode, OSCParameterDeclarations* pd)
@@ -481,14 +704,31 @@ void Parameters::parseParameterDeclarations(pugi::xml_node declarationsNode, OSC
         param.name     = pdChild.attribute("name").value();
         param.variable = is_variable;
 
+        // Keep any expression result in full precision for numeric types
+        const char* str       = nullptr;
+        double      number    = 0.0;
+        bool        is_number = false;
+        switch (ResolveAttribute(pdChild, "value", false, str, number))
+        {
+            case AttributeValueType::NUMBER:
+                param.value._string = std::to_string(number);
+                is_number           = true;
+                break;
+            case AttributeValueType::STRING:
+                param.value._string = str;
+                break;
+            default:
+                break;
+        }
+
         // Check for catalog parameter assignements, overriding default value
         // Start from end of parameter list, in case of duplicates we want the most recent
-        param.value._string = ReadAttribute(pdChild, "value");
         for (int i = static_cast<int>(catalog_param_assignments.size()) - 1; i >= 0; i--)
         {
             if (param.name == catalog_param_assignments[static_cast<unsigned int>(i)].name)
             {
                 param.value._string = catalog_param_assignments[static_cast<unsigned int>(i)].value._string;
+                is_number           = false;
                 break;
             }
         }
@@ -514,12 +754,12 @@ void Parameters::parseParameterDeclarations(pugi::xml_node declarationsNode, OSC
                 LOG("INFO: int type should renamed into integer - accepting int this time.");
             }
             param.type       = OSCParameterDeclarations::ParameterType::PARAM_TYPE_INTEGER;
-            param.value._int = strtoi(param.value._string);
+            param.value._int = is_number ? ExpressionToInt(number) : strtoi(param.value._string);
         }
         else if (type_str == "double")
         {
             param.type          = OSCParameterDeclarations::ParameterType::PARAM_TYPE_DOUBLE;
-            param.value._double = strtod(param.value._string);
+            param.value._double = is_number ? number : strtod(param.value._string);
         }
         else if (type_str == "boolean" || type_str == "bool")
         {
@@ -529,7 +769,7 @@ void Parameters::parseParameterDeclarations(pugi::xml_node declarationsNode, OSC
             }
 
             param.type        = OSCParameterDeclarations::ParameterType::PARAM_TYPE_BOOL;
-            param.value._bool = param.value._string == "true" ? true : false;
+            param.value._bool = is_number ? number != 0.0 : param.value._string == "true";
         }
         else if (type_str == "string")
         {
@@ -544,12 +784,21 @@ void Parameters::parseParameterDeclarations(pugi::xml_node declarationsNode, OSC
             LOG_TRACE_AND_QUIT("Unexpected Type: %s", type_str.c_str());
         }
         pd->Parameter.insert(pd->Parameter.begin(), param);
+
+        if (pd == &parameterDeclarations_ && indexedSize_ == pd->Parameter.size() - 1)
+        {
+            // Index is up to date, just register the new entry which will shadow any previous one
+            entryIndex_[param.name] = static_cast<int>(pd->Parameter.size() - 1);
+            indexedSize_            = pd->Parameter.size();
+        }
     }
 }
 
 void Parameters::Clear()
 {
     parameterDeclarations_.Parameter.clear();
+    entryIndex_.clear();
+    indexedSize_ = 0;
     while (!paramDeclarationsSize_.empty())
     {
         paramDeclarationsSize_.pop();
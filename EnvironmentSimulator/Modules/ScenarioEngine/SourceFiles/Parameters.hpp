@@ -17,6 +17,9 @@
 #include "OSCParameterDeclarations.hpp"
 #include <vector>
 #include <stack>
+#include <unordered_map>
+#include <initializer_list>
+#include <utility>
 
 namespace scenarioengine
 {
@@ -25,7 +28,7 @@ namespace scenarioengine
     class Parameters
     {
     public:
-        Parameters()
+        Parameters() : indexedSize_(0)
         {
         }
         std::stack<int> paramDeclarationsSize_;  // original size first, then additional layered parameter declarations
@@ -41,6 +44,16 @@ namespace scenarioengine
             return getParameter(parameterDeclarations_, name);
         }
         OSCParameterDeclarations::ParameterStruct* getParameterEntry(std::string name);
+
+        /**
+        Get a handle for fast repeated access to a parameter
+        The handle stays valid as long as no parameter declarations are added or removed,
+        e.g. during the simulation once the scenario has been loaded
+        @param name Name of the parameter, with or without prefix
+        @return handle >= 0 if found, else -1
+        */
+        int                                        getParameterHandle(std::string name);
+        OSCParameterDeclarations::ParameterStruct* getParameterEntry(int handle);
         int                                        setParameter(std::string name, std::string value);
         void                                       addParameterDeclarations(pugi::xml_node xml_node);
         void                                       CreateRestorePoint();
@@ -60,11 +73,71 @@ namespace scenarioengine
         int         getParameterValueString(std::string name, const char*& value);
         int         getParameterValueBool(std::string name, bool& value);
         std::string getParameterValueAsString(std::string name);
+        int         getParameterValueByHandle(int handle, int& value);
+        int         getParameterValueByHandle(int handle, double& value);
+        int         getParameterValueByHandle(int handle, bool& value);
+        int         setParameterValueByHandle(int handle, int value);
+        int         setParameterValueByHandle(int handle, double value);
+        int         setParameterValueByHandle(int handle, bool value);
 
         std::string ResolveParametersInString(std::string str);
 
-        // Use always this method when reading attributes, it will resolve any variables
-        std::string ReadAttribute(pugi::xml_node, std::string attribute, bool required = false);
+        // Use always this method, or the typed variants below, when reading attributes, it will resolve any variables
+        std::string ReadAttribute(pugi::xml_node node, const char* attribute, bool required = false);
+
+        /**
+        Read attribute as a number, parsed directly from the XML value or parameter value
+        Expressions are evaluated in full double precision
+        @param node XML element holding the attribute
+        @param attribute Name of the attribute
+        @param required If true, quit when attribute is missing
+        @param default_value Returned when attribute is missing or empty
+        @return Attribute value
+        */
+        double ReadDouble(pugi::xml_node node, const char* attribute, bool required = false, double default_value = 0.0);
+        int    ReadInt(pugi::xml_node node, const char* attribute, bool required = false, int default_value = 0);
+
+        /**
+        Read attribute as a boolean, accepting true/false and 1/0 as xsd:boolean
+        An expression is true when evaluated to non zero
+        @param node XML element holding the attribute
+        @param attribute Name of the attribute
+        @param required If true, quit when attribute is missing
+        @param default_value Returned when attribute is missing, empty or not a boolean
+        @return Attribute value
+        */
+        bool ReadBool(pugi::xml_node node, const char* attribute, bool required = false, bool default_value = false);
+
+        /**
+        Read attribute holding one of a fixed set of literals, e.g. an OpenSCENARIO enumeration
+        @param node XML element holding the attribute
+        @param attribute Name of the attribute
+        @param values Pairs of literal and corresponding enum value
+        @param default_value Returned when attribute is missing or empty, or the value does not match any literal
+        @param required If true, quit when attribute is missing
+        @return Enum value of matching literal
+        */
+        template <typename T>
+        T ReadEnum(pugi::xml_node node, const char* attribute, std::initializer_list<std::pair<const char*, T>> values, T default_value, bool required = false)
+        {
+            const char* str = ResolveAttributeString(node, attribute, required);
+            if (str == nullptr || str[0] == '\0')
+            {
+                return default_value;
+            }
+
+            for (const auto& value : values)
+            {
+                if (!strcmp(str, value.first))
+                {
+                    return value.second;
+                }
+            }
+
+            LOG("Unexpected %s value: %s", attribute, str);
+
+            return default_value;
+        }
 
         // bool CheckAttribute(pugi::xml_node, std::string attribute);
 
@@ -73,5 +146,31 @@ namespace scenarioengine
 
         // Log current set of parameter names and values
         void Print(std::string type);
+
+    private:
+        // Parameter name -> handle, i.e. position counted from end of declaration list since
+        // local declarations are inserted at front. Front entries shadow any later ones with same name.
+        std::unordered_map<std::string, int> entryIndex_;
+        size_t                               indexedSize_;  // size of declaration list when entryIndex_ was established
+
+        // Scratch buffers reused between attribute reads to avoid temporary strings
+        std::string lookup_key_;
+        std::string resolved_str_;
+        std::string expr_str_;
+
+        enum class AttributeValueType
+        {
+            MISSING,
+            STRING,  // literal or parameter value, see str
+            NUMBER   // evaluated expression, see number
+        };
+
+        void                                       UpdateEntryIndex();
+        int                                        FindParameterHandle(const char* name, size_t len);
+        OSCParameterDeclarations::ParameterStruct& LookupParameter(const char* name, size_t len);  // throws if not found
+        void                                       AppendResolvedParameters(const char* str, size_t len, std::string& out);
+        double                                     EvaluateExpression(const char* value);
+        AttributeValueType ResolveAttribute(pugi::xml_node node, const char* attribute, bool required, const char*& str, double& number);
+        const char*        ResolveAttributeString(pugi::xml_node node, const char* attribute, bool required);  // nullptr if missing
     };
 }  // namespace scenarioengine
\ No newline at end of file
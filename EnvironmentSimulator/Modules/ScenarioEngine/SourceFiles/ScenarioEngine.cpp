@@ -55,6 +55,8 @@ void ScenarioEngine::InitScenarioCommon(bool disable_controllers)
     frame_nr_            = 0;
     ghost_mode_          = GhostMode::NORMAL;
     scenarioReader       = new ScenarioReader(&entities_, &catalogs, disable_controllers);
+
+    entity_event_subscriber_ = entities_.SubscribeEvents();
 }
 
 int ScenarioEngine::InitScenario(std::string oscFilename, bool disable_controllers)
@@ -71,27 +73,17 @@ int ScenarioEngine::InitScenario(std::string oscFilename, bool disable_controlle
     {
         file_name_candidates.push_back(CombineDirectoryPathAndFilepath(SE_Env::Inst().GetPaths()[i], oscFilename));
     }
-    size_t i;
-    for (i = 0; i < file_name_candidates.size(); i++)
+    std::string path = SE_Env::Inst().LocateFile(file_name_candidates);
+    if (path.empty())
     {
-        if (FileExists(file_name_candidates[i].c_str()))
-        {
-            if (scenarioReader->loadOSCFile(file_name_candidates[i].c_str()) != 0)
-            {
-                LOG(("Failed to load OpenSCENARIO file " + oscFilename).c_str());
-                return -3;
-            }
-            else
-            {
-                break;
-            }
-        }
+        LOG(("Couldn't locate OpenSCENARIO file " + oscFilename).c_str());
+        return -1;
     }
 
-    if (i == file_name_candidates.size())
+    if (scenarioReader->loadOSCFile(path.c_str()) != 0)
     {
-        LOG(("Couldn't locate OpenSCENARIO file " + oscFilename).c_str());
-        return -1;
+        LOG(("Failed to load OpenSCENARIO file " + oscFilename).c_str());
+        return -3;
     }
 
     if (!scenarioReader->IsLoaded())
@@ -143,6 +135,12 @@ int ScenarioEngine::step(double deltaSimTime)
 {
     UpdateGhostMode();
 
+    // Apply traffic signal phases first, so that any signal state action in this step will take precedence
+    odrManager->GetSignalStateRegistry().Update(simulationTime_);
+
+    // Keep look-ahead paths used in previous frame only, limiting the cache to current positions
+    odrManager->PruneLookAheadCache();
+
     if (frame_nr_ == 0)
     {
         // kick off init actions
@@ -626,56 +624,15 @@ int ScenarioEngine::step(double deltaSimTime)
             obj->SetEndOfRoad(false);
         }
 
-        // Report updated state to the gateway
+        // Report updated state to the gateway, static attributes only once at registration
         if (scenarioGateway.isObjectReported(obj->id_))
         {
-            if (obj->CheckDirtyBits(Object::DirtyBit::LONGITUDINAL | Object::DirtyBit::LATERAL))
-            {
-                scenarioGateway.updateObjectPos(obj->id_, simulationTime_, &obj->pos_);
-            }
-
-            if (obj->CheckDirtyBits(Object::DirtyBit::SPEED))
-            {
-                scenarioGateway.updateObjectSpeed(obj->id_, simulationTime_, obj->speed_);
-            }
-
-            if (obj->CheckDirtyBits(Object::DirtyBit::WHEEL_ANGLE))
-            {
-                scenarioGateway.updateObjectWheelAngle(obj->id_, simulationTime_, obj->wheel_angle_);
-            }
-
-            if (obj->CheckDirtyBits(Object::DirtyBit::WHEEL_ROTATION))
-            {
-                scenarioGateway.updateObjectWheelRotation(obj->id_, simulationTime_, obj->wheel_rot_);
-            }
-
-            if (obj->CheckDirtyBits(Object::DirtyBit::VISIBILITY))
-            {
-                scenarioGateway.updateObjectVisibilityMask(obj->id_, obj->visibilityMask_);
-            }
+            scenarioGateway.updateObjectState(obj, simulationTime_);
         }
         else
         {
             // Object not reported yet, do that
-            scenarioGateway.reportObject(obj->id_,
-                                         obj->name_,
-                                         static_cast<int>(obj->type_),
-                                         obj->category_,
-                                         obj->role_,
-                                         obj->model_id_,
-                                         obj->model3d_,
-                                         obj->GetActivatedControllerType(),
-                                         obj->boundingbox_,
-                                         static_cast<int>(obj->scaleMode_),
-                                         obj->visibilityMask_,
-                                         simulationTime_,
-                                         obj->speed_,
-                                         obj->wheel_angle_,
-                                         obj->wheel_rot_,
-                                         obj->rear_axle_.positionZ,
-                                         obj->front_axle_.positionX,
-                                         obj->front_axle_.positionZ,
-                                         &obj->pos_);
+            scenarioGateway.registerObject(obj, simulationTime_);
         }
     }
 
@@ -691,37 +648,32 @@ int ScenarioEngine::step(double deltaSimTime)
     }
 
     // Update any trailers now that tow vehicles have been updated by Default or custom controllers
-    for (size_t i = 0; i < entities_.object_.size(); i++)
+    // Links are ordered front to rear, so each tow vehicle has been updated before its trailer
+    for (const Entities::TowLink& link : entities_.GetTowLinks())
     {
-        Object*  obj     = entities_.object_[i];
-        Vehicle* trailer = static_cast<Vehicle*>(obj->TrailerVehicle());
+        Vehicle*     tow_vehicle = link.tow_vehicle;
+        Vehicle*     trailer     = link.trailer;
+        ObjectState* o           = scenarioGateway.getObjectStatePtrById(tow_vehicle->id_);
 
-        if (!obj->TowVehicle() && obj->TrailerVehicle())
+        if (o == nullptr)
         {
-            // Found a front tow vehicle, update trailers
-            Vehicle* tow_vehicle = static_cast<Vehicle*>(obj);
-            while (trailer)
-            {
-                // Calculate new trailer position and orientation
-                ObjectState* o = scenarioGateway.getObjectStatePtrById(tow_vehicle->id_);
-                SE_Vector    v0(tow_vehicle->trailer_hitch_->dx_, 0.0);
-
-                // Fetch updated state of tow vehicle from gateway
-                roadmanager::Position* tow_pos = &o->state_.pos;
-                v0                             = v0.Rotate(tow_pos->GetH()) + SE_Vector(tow_pos->GetX(), tow_pos->GetY());
-                SE_Vector v1                   = SE_Vector(trailer->pos_.GetX(), trailer->pos_.GetY()) - v0;
-                v1.SetLength(trailer->trailer_coupler_->dx_);
-                scenarioGateway.updateObjectWorldPosXYH(trailer->GetId(),
-                                                        getSimulationTime(),
-                                                        v0.x() + v1.x(),
-                                                        v0.y() + v1.y(),
-                                                        GetAngleInInterval2PI(atan2(v1.y(), v1.x()) + M_PI));
-                trailer->SetSpeed(tow_vehicle->GetSpeed());
-
-                tow_vehicle = trailer;
-                trailer     = static_cast<Vehicle*>(trailer->TrailerVehicle());
-            }
+            continue;
         }
+
+        // Calculate new trailer position and orientation from updated state of tow vehicle
+        SE_Vector              v0(tow_vehicle->trailer_hitch_->dx_, 0.0);
+        roadmanager::Position* tow_pos = &o->state_.pos;
+        v0                             = v0.Rotate(tow_pos->GetH()) + SE_Vector(tow_pos->GetX(), tow_pos->GetY());
+        SE_Vector v1                   = SE_Vector(trailer->pos_.GetX(), trailer->pos_.GetY()) - v0;
+        v1.SetLength(trailer->trailer_coupler_->dx_);
+
+        // Trailer is close to its previous position, use it as starting point for road position update
+        scenarioGateway.updateObjectWorldPosXYHLocal(scenarioGateway.getObjectStatePtrById(trailer->id_),
+                                                     getSimulationTime(),
+                                                     v0.x() + v1.x(),
+                                                     v0.y() + v1.y(),
+                                                     GetAngleInInterval2PI(atan2(v1.y(), v1.x()) + M_PI));
+        trailer->SetSpeed(tow_vehicle->GetSpeed());
     }
 
     // Check some states
@@ -762,6 +714,16 @@ int ScenarioEngine::step(double deltaSimTime)
         DetectCollisions();
     }
 
+    // Drop gateway states of objects deactivated or deleted during this step, e.g. by actions or controllers
+    entities_.PollEvents(entity_event_subscriber_, entity_events_);
+    for (const Entities::EntityEvent& event : entity_events_)
+    {
+        if (event.type == Entities::EntityEvent::Type::REMOVED)
+        {
+            scenarioGateway.removeObject(event.id);
+        }
+    }
+
     frame_nr_++;
 
     return 0;
@@ -826,37 +788,24 @@ int ScenarioEngine::parseScenario()
             file_name_candidates.push_back(CombineDirectoryPathAndFilepath(SE_Env::Inst().GetPaths()[i], getOdrFilename()));
             file_name_candidates.push_back(CombineDirectoryPathAndFilepath(SE_Env::Inst().GetPaths()[i], FileNameOf(getOdrFilename())));
         }
-        size_t i;
-        bool   located = false;
-        for (i = 0; i < file_name_candidates.size(); i++)
+        std::string path = SE_Env::Inst().LocateFile(file_name_candidates);
+        if (path.empty())
         {
-            if (FileExists(file_name_candidates[i].c_str()))
-            {
-                located = true;
-                if (roadmanager::Position::LoadOpenDrive(file_name_candidates[i].c_str()) == true)
-                {
-                    LOG("Loaded OpenDRIVE: %s", file_name_candidates[i].c_str());
-                    break;
-                }
-                else
-                {
-                    LOG("Failed to load OpenDRIVE file: %s", file_name_candidates[i].c_str());
-                    if (i < file_name_candidates.size() - 1)
-                    {
-                        LOG("  -> trying: %s", file_name_candidates[i + 1].c_str());
-                    }
-                }
-            }
+            LOG(("Failed to find OpenDRIVE file " + getOdrFilename()).c_str());
+            return -1;
         }
 
-        if (i == file_name_candidates.size())
+        if (roadmanager::Position::LoadOpenDrive(path.c_str()) == false)
         {
-            LOG((std::string("Failed to ") + (located ? "load" : "find") + " OpenDRIVE file " + getOdrFilename().c_str()).c_str());
+            LOG(("Failed to load OpenDRIVE file " + path).c_str());
             return -1;
         }
+        LOG("Loaded OpenDRIVE: %s", path.c_str());
     }
 
     odrManager = roadmanager::Position::GetOpenDrive();
+    odrManager->GetSignalStateRegistry().Clear();
+    scenarioReader->parseTrafficSignalControllers(odrManager->GetSignalStateRegistry());
 
     scenarioReader->parseCatalogs();
     scenarioReader->parseEntities();
@@ -901,13 +850,12 @@ int ScenarioEngine::parseScenario()
     }
 
     // Align trailers
-    for (size_t i = 0; i < entities_.object_.size(); i++)
+    for (const Entities::TowLink& link : entities_.GetTowLinks())
     {
-        Object* obj = entities_.object_[i];
-        if (!obj->TowVehicle() && obj->TrailerVehicle())
+        if (!link.tow_vehicle->TowVehicle())
         {
             // Found a front tow vehicle, update trailers
-            (static_cast<Vehicle*>(obj)->AlignTrailers());
+            link.tow_vehicle->AlignTrailers();
         }
     }
 
@@ -1109,6 +1057,9 @@ void ScenarioEngine::prepareGroundTruth(double dt)
         obj->ClearDirtyBits(Object::DirtyBit::VELOCITY | Object::DirtyBit::ANGULAR_RATE | Object::DirtyBit::ACCELERATION |
                             Object::DirtyBit::ANGULAR_ACC);
     }
+
+    // Frame complete, any further changes will belong to next frame
+    scenarioGateway.setFrameNr(static_cast<int>(frame_nr_));
 }
 
 void ScenarioEngine::ReplaceObjectInTrigger(Trigger* trigger, Object* obj1, Object* obj2, double timeOffset, Event* event)
@@ -1354,14 +1305,39 @@ void ScenarioEngine::ResetEvents()
 
 int ScenarioEngine::DetectCollisions()
 {
+    size_t n = entities_.object_.size();
+
+    // Establish a bounding circle per object, used to rule out distant pairs before the exact box check
+    collision_x_.resize(n);
+    collision_y_.resize(n);
+    collision_r_.resize(n);
+    collision_dist_sq_.resize(n);
+    for (size_t i = 0; i < n; i++)
+    {
+        const Object::OBB& obb = entities_.object_[i]->GetOBB();
+        collision_x_[i]        = obb.center[0];
+        collision_y_[i]        = obb.center[1];
+        collision_r_[i]        = sqrt(obb.half[0] * obb.half[0] + obb.half[1] * obb.half[1]);
+    }
+
     collision_pair_.clear();
-    for (size_t i = 0; i < entities_.object_.size(); i++)
+    for (size_t i = 0; i < n; i++)
     {
         Object* obj0 = entities_.object_[i];
-        for (size_t j = i + 1; j < entities_.object_.size(); j++)
+
+        // Measure distance to all remaining objects in one go
+        PointSquareDistance2D(collision_x_[i],
+                              collision_y_[i],
+                              collision_x_.data() + i + 1,
+                              collision_y_.data() + i + 1,
+                              collision_dist_sq_.data() + i + 1,
+                              n - i - 1);
+
+        for (size_t j = i + 1; j < n; j++)
         {
-            Object* obj1 = entities_.object_[j];
-            if (obj0->Collision(obj1))
+            Object* obj1  = entities_.object_[j];
+            double  r_sum = collision_r_[i] + collision_r_[j] + SMALL_NUMBER;
+            if (collision_dist_sq_[j] < r_sum * r_sum && obj0->Collision(obj1))
             {
                 collision_pair_.push_back({obj0, obj1});
                 if (std::find(obj0->collisions_.begin(), obj0->collisions_.end(), obj1) == obj0->collisions_.end())
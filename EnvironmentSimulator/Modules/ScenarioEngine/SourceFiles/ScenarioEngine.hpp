@@ -97,6 +97,10 @@ namespace scenarioengine
         {
             return odrManager;
         }
+        StoryBoard &GetStoryBoard()
+        {
+            return storyBoard;
+        }
 
         ScenarioGateway *getScenarioGateway();
         double           getSimulationTime()
@@ -181,6 +185,16 @@ namespace scenarioengine
         unsigned int frame_nr_;
         int          init_status_;
 
+        // Bounding circles of all objects, reused by DetectCollisions() between frames
+        std::vector<double> collision_x_;
+        std::vector<double> collision_y_;
+        std::vector<double> collision_r_;
+        std::vector<double> collision_dist_sq_;
+
+        // Entity events, used to drop gateway states of objects leaving the simulation
+        int                                entity_event_subscriber_;
+        std::vector<Entities::EntityEvent> entity_events_;
+
         int parseScenario();
     };
 
@@ -26,20 +26,20 @@
 
 using namespace scenarioengine;
 
-ObjectState::ObjectState()
+ObjectState::ObjectState() : dirty_(0), change_frame_(0)
 {
     state_.info.id = -1;
 }
 
 ObjectState::ObjectState(int                    id,
-                         std::string            name,
+                         const std::string&     name,
                          int                    obj_type,
                          int                    obj_category,
                          int                    obj_role,
                          int                    model_id,
-                         std::string            model3d,
+                         const std::string&     model3d,
                          int                    ctrl_type,
-                         OSCBoundingBox         boundingbox,
+                         const OSCBoundingBox&  boundingbox,
                          int                    scaleMode,
                          int                    visibilityMask,
                          double                 timestamp,
@@ -50,7 +50,7 @@ ObjectState::ObjectState(int                    id,
                          double                 front_axle_x_pos,
                          double                 front_axle_z_pos,
                          roadmanager::Position* pos)
-    : dirty_(0)
+    : dirty_(0), change_frame_(0)
 {
     state_.info.id           = id;
     state_.info.obj_type     = obj_type;
@@ -97,7 +97,7 @@ ObjectState::ObjectState(int            id,
                          double         h,
                          double         p,
                          double         r)
-    : dirty_(0)
+    : dirty_(0), change_frame_(0)
 {
     state_.info.id           = id;
     state_.info.obj_type     = obj_type;
@@ -141,7 +141,7 @@ ObjectState::ObjectState(int            id,
                          int            laneId,
                          double         laneOffset,
                          double         s)
-    : dirty_(0)
+    : dirty_(0), change_frame_(0)
 {
     state_.info.id           = id;
     state_.info.obj_type     = obj_type;
@@ -182,6 +182,7 @@ ObjectState::ObjectState(int            id,
                          int            roadId,
                          double         lateralOffset,
                          double         s)
+    : dirty_(0), change_frame_(0)
 {
     state_.info.id           = id;
     state_.info.obj_type     = obj_type;
@@ -233,7 +234,7 @@ void ObjectState::Print()
 
 // ScenarioGateway
 
-ScenarioGateway::ScenarioGateway()
+ScenarioGateway::ScenarioGateway() : frame_nr_(0)
 {
 }
 
@@ -247,30 +248,54 @@ ScenarioGateway::~ScenarioGateway()
 
 ObjectState* ScenarioGateway::getObjectStatePtrById(int id)
 {
-    for (size_t i = 0; i < objectState_.size(); i++)
+    auto it = objectStateById_.find(id);
+
+    return it != objectStateById_.end() ? it->second : nullptr;
+}
+
+int ScenarioGateway::getObjectStateById(int id, ObjectState& objectState)
+{
+    ObjectState* obj_state = getObjectStatePtrById(id);
+
+    if (obj_state == nullptr)
     {
-        if (objectState_[i]->state_.info.id == id)
-        {
-            return objectState_[i].get();
-        }
+        // Indicate not found by returning non zero
+        return -1;
     }
 
+    objectState = *obj_state;
+
     return 0;
 }
 
-int ScenarioGateway::getObjectStateById(int id, ObjectState& objectState)
+ObjectState* ScenarioGateway::addObjectState(ObjectState* obj_state)
 {
-    for (size_t i = 0; i < objectState_.size(); i++)
+    obj_state->change_frame_ = frame_nr_;
+    objectState_.push_back(std::unique_ptr<ObjectState>{obj_state});
+    objectStateById_[obj_state->state_.info.id] = obj_state;
+
+    return obj_state;
+}
+
+void ScenarioGateway::setChanged(ObjectState* obj_state, int dirty_bits, bool changed)
+{
+    obj_state->dirty_ |= static_cast<unsigned int>(dirty_bits);
+
+    if (changed)
     {
-        if (objectState_[i]->state_.info.id == id)
-        {
-            objectState = *objectState_[i];
-            return 0;
-        }
+        obj_state->change_frame_ = frame_nr_;
     }
+}
 
-    // Indicate not found by returning non zero
-    return -1;
+// Compare values of interest for consumers of the gateway, e.g. reporters and loggers
+static bool PosValuesDiffer(const roadmanager::Position& p0, const roadmanager::Position& p1)
+{
+    return p0.GetX() != p1.GetX() || p0.GetY() != p1.GetY() || p0.GetZ() != p1.GetZ() || p0.GetH() != p1.GetH() || p0.GetP() != p1.GetP() ||
+           p0.GetR() != p1.GetR() || p0.GetTrackId() != p1.GetTrackId() || p0.GetLaneId() != p1.GetLaneId() || p0.GetS() != p1.GetS() ||
+           p0.GetT() != p1.GetT() || p0.GetOffset() != p1.GetOffset() || p0.GetVelX() != p1.GetVelX() || p0.GetVelY() != p1.GetVelY() ||
+           p0.GetVelZ() != p1.GetVelZ() || p0.GetAccX() != p1.GetAccX() || p0.GetAccY() != p1.GetAccY() || p0.GetAccZ() != p1.GetAccZ() ||
+           p0.GetHRate() != p1.GetHRate() || p0.GetHAcc() != p1.GetHAcc() || p0.GetStatusBitMask() != p1.GetStatusBitMask() ||
+           p0.GetRoute() != p1.GetRoute();
 }
 
 int ScenarioGateway::updateObjectInfo(ObjectState* obj_state,
@@ -285,26 +310,29 @@ int ScenarioGateway::updateObjectInfo(ObjectState* obj_state,
         return -1;
     }
 
+    bool changed = obj_state->state_.info.speed != speed || obj_state->state_.info.wheel_angle != wheel_angle ||
+                   obj_state->state_.info.wheel_rot != wheel_rot || obj_state->state_.info.visibilityMask != visibilityMask;
+
     obj_state->state_.info.speed          = speed;
     obj_state->state_.info.timeStamp      = timestamp;
     obj_state->state_.info.wheel_angle    = wheel_angle;
     obj_state->state_.info.wheel_rot      = wheel_rot;
     obj_state->state_.info.visibilityMask = visibilityMask;
 
-    obj_state->dirty_ |= Object::DirtyBit::SPEED | Object::DirtyBit::WHEEL_ANGLE | Object::DirtyBit::WHEEL_ROTATION;
+    setChanged(obj_state, Object::DirtyBit::SPEED | Object::DirtyBit::WHEEL_ANGLE | Object::DirtyBit::WHEEL_ROTATION, changed);
 
     return 0;
 }
 
 int ScenarioGateway::reportObject(int                    id,
-                                  std::string            name,
+                                  const std::string&     name,
                                   int                    obj_type,
                                   int                    obj_category,
                                   int                    obj_role,
                                   int                    model_id,
-                                  std::string            model3d,
+                                  const std::string&     model3d,
                                   int                    ctrl_type,
-                                  OSCBoundingBox         boundingbox,
+                                  const OSCBoundingBox&  boundingbox,
                                   int                    scaleMode,
                                   int                    visibilityMask,
                                   double                 timestamp,
@@ -321,16 +349,7 @@ int ScenarioGateway::reportObject(int                    id,
     if (obj_state == 0)
     {
         // Check registered paths for model3d
-        std::string model3d_abs_path;
-        for (size_t i = 0; i < SE_Env::Inst().GetPaths().size(); i++)
-        {
-            std::string file_name_candidate = CombineDirectoryPathAndFilepath(SE_Env::Inst().GetPaths()[i], model3d);
-            if (FileExists(file_name_candidate.c_str()))
-            {
-                model3d_abs_path = file_name_candidate;
-                break;
-            }
-        }
+        std::string model3d_abs_path = SE_Env::Inst().ResolveFilePath(model3d);
 
         // Create state and set permanent information
         obj_state = new ObjectState(id,
@@ -354,13 +373,14 @@ int ScenarioGateway::reportObject(int                    id,
                                     pos);
 
         // Add object to collection
-        objectState_.push_back(std::unique_ptr<ObjectState>{obj_state});
+        addObjectState(obj_state);
     }
     else
     {
         // Update status
+        bool changed          = PosValuesDiffer(obj_state->state_.pos, *pos);
         obj_state->state_.pos = *pos;
-        obj_state->dirty_ |= Object::DirtyBit::LONGITUDINAL | Object::DirtyBit::LATERAL;
+        setChanged(obj_state, Object::DirtyBit::LONGITUDINAL | Object::DirtyBit::LATERAL, changed);
 
         updateObjectInfo(obj_state, timestamp, visibilityMask, speed, wheel_angle, wheel_rot);
     }
@@ -419,13 +439,13 @@ int ScenarioGateway::reportObject(int            id,
                                     r);
 
         // Add object to collection
-        objectState_.push_back(std::unique_ptr<ObjectState>{obj_state});
+        addObjectState(obj_state);
     }
     else
     {
         // Update status
         obj_state->state_.pos.SetInertiaPos(x, y, z, h, p, r);
-        obj_state->dirty_ |= Object::DirtyBit::LONGITUDINAL | Object::DirtyBit::LATERAL;
+        setChanged(obj_state, Object::DirtyBit::LONGITUDINAL | Object::DirtyBit::LATERAL);
 
         updateObjectInfo(obj_state, timestamp, visibilityMask, speed, wheel_angle, wheel_rot);
     }
@@ -481,13 +501,13 @@ int ScenarioGateway::reportObject(int            id,
                                     0);
 
         // Add object to collection
-        objectState_.push_back(std::unique_ptr<ObjectState>{obj_state});
+        addObjectState(obj_state);
     }
     else
     {
         // Update status
         obj_state->state_.pos.SetInertiaPos(x, y, h);
-        obj_state->dirty_ |= Object::DirtyBit::LONGITUDINAL | Object::DirtyBit::LATERAL;
+        setChanged(obj_state, Object::DirtyBit::LONGITUDINAL | Object::DirtyBit::LATERAL);
 
         updateObjectInfo(obj_state, timestamp, visibilityMask, speed, wheel_angle, wheel_rot);
     }
@@ -542,13 +562,13 @@ int ScenarioGateway::reportObject(int            id,
                                     s);
 
         // Add object to collection
-        objectState_.push_back(std::unique_ptr<ObjectState>{obj_state});
+        addObjectState(obj_state);
     }
     else
     {
         // Update status
         obj_state->state_.pos.SetLanePos(roadId, laneId, s, laneOffset);
-        obj_state->dirty_ |= Object::DirtyBit::LONGITUDINAL | Object::DirtyBit::LATERAL;
+        setChanged(obj_state, Object::DirtyBit::LONGITUDINAL | Object::DirtyBit::LATERAL);
 
         updateObjectInfo(obj_state, timestamp, visibilityMask, speed, wheel_angle, wheel_rot);
     }
@@ -601,13 +621,13 @@ int ScenarioGateway::reportObject(int            id,
                                     s);
 
         // Add object to collection
-        objectState_.push_back(std::unique_ptr<ObjectState>{obj_state});
+        addObjectState(obj_state);
     }
     else
     {
         // Update status
         obj_state->state_.pos.SetTrackPos(roadId, s, lateralOffset);
-        obj_state->dirty_ |= Object::DirtyBit::LONGITUDINAL | Object::DirtyBit::LATERAL;
+        setChanged(obj_state, Object::DirtyBit::LONGITUDINAL | Object::DirtyBit::LATERAL);
 
         updateObjectInfo(obj_state, timestamp, visibilityMask, speed, wheel_angle, wheel_rot);
     }
@@ -615,6 +635,84 @@ int ScenarioGateway::reportObject(int            id,
     return 0;
 }
 
+int ScenarioGateway::registerObject(Object* obj, double timestamp)
+{
+    if (getObjectStatePtrById(obj->id_) != nullptr)
+    {
+        LOG("Object %s (id %d) already registered", obj->GetName().c_str(), obj->id_);
+        return -1;
+    }
+
+    return reportObject(obj->id_,
+                        obj->name_,
+                        static_cast<int>(obj->type_),
+                        obj->category_,
+                        obj->role_,
+                        obj->model_id_,
+                        obj->model3d_,
+                        obj->GetActivatedControllerType(),
+                        obj->boundingbox_,
+                        static_cast<int>(obj->scaleMode_),
+                        obj->visibilityMask_,
+                        timestamp,
+                        obj->speed_,
+                        obj->wheel_angle_,
+                        obj->wheel_rot_,
+                        obj->rear_axle_.positionZ,
+                        obj->front_axle_.positionX,
+                        obj->front_axle_.positionZ,
+                        &obj->pos_);
+}
+
+int ScenarioGateway::updateObjectState(Object* obj, double timestamp)
+{
+    ObjectState* obj_state = getObjectStatePtrById(obj->id_);
+
+    if (obj_state == nullptr)
+    {
+        LOG("Object id: %d must be registered before updated", obj->id_);
+        return -1;
+    }
+
+    if (obj->CheckDirtyBits(Object::DirtyBit::LONGITUDINAL | Object::DirtyBit::LATERAL))
+    {
+        bool changed                     = PosValuesDiffer(obj_state->state_.pos, obj->pos_);
+        obj_state->state_.pos            = obj->pos_;
+        obj_state->state_.info.timeStamp = timestamp;
+        setChanged(obj_state, Object::DirtyBit::LONGITUDINAL | Object::DirtyBit::LATERAL, changed);
+    }
+
+    if (obj->CheckDirtyBits(Object::DirtyBit::SPEED))
+    {
+        bool changed                 = obj_state->state_.info.speed != obj->speed_;
+        obj_state->state_.info.speed = obj->speed_;
+        setChanged(obj_state, Object::DirtyBit::SPEED, changed);
+    }
+
+    if (obj->CheckDirtyBits(Object::DirtyBit::WHEEL_ANGLE))
+    {
+        bool changed                       = obj_state->state_.info.wheel_angle != obj->wheel_angle_;
+        obj_state->state_.info.wheel_angle = obj->wheel_angle_;
+        setChanged(obj_state, Object::DirtyBit::WHEEL_ANGLE, changed);
+    }
+
+    if (obj->CheckDirtyBits(Object::DirtyBit::WHEEL_ROTATION))
+    {
+        bool changed                     = obj_state->state_.info.wheel_rot != obj->wheel_rot_;
+        obj_state->state_.info.wheel_rot = obj->wheel_rot_;
+        setChanged(obj_state, Object::DirtyBit::WHEEL_ROTATION, changed);
+    }
+
+    if (obj->CheckDirtyBits(Object::DirtyBit::VISIBILITY))
+    {
+        bool changed                          = obj_state->state_.info.visibilityMask != obj->visibilityMask_;
+        obj_state->state_.info.visibilityMask = obj->visibilityMask_;
+        setChanged(obj_state, Object::DirtyBit::VISIBILITY, changed);
+    }
+
+    return 0;
+}
+
 int ScenarioGateway::updateObjectPos(int id, double timestamp, roadmanager::Position* pos)
 {
     ObjectState* obj_state = getObjectStatePtrById(id);
@@ -628,9 +726,10 @@ int ScenarioGateway::updateObjectPos(int id, double timestamp, roadmanager::Posi
     else
     {
         // Update status
+        bool changed                     = PosValuesDiffer(obj_state->state_.pos, *pos);
         obj_state->state_.pos            = *pos;
         obj_state->state_.info.timeStamp = timestamp;
-        obj_state->dirty_ |= Object::DirtyBit::LONGITUDINAL | Object::DirtyBit::LATERAL;
+        setChanged(obj_state, Object::DirtyBit::LONGITUDINAL | Object::DirtyBit::LATERAL, changed);
     }
 
     return 0;
@@ -651,7 +750,7 @@ int ScenarioGateway::updateObjectRoadPos(int id, double timestamp, int roadId, d
         // Update status
         obj_state->state_.pos.SetTrackPos(roadId, s, lateralOffset);
         obj_state->state_.info.timeStamp = timestamp;
-        obj_state->dirty_ |= Object::DirtyBit::LONGITUDINAL | Object::DirtyBit::LATERAL;
+        setChanged(obj_state, Object::DirtyBit::LONGITUDINAL | Object::DirtyBit::LATERAL);
     }
 
     return 0;
@@ -671,7 +770,7 @@ int ScenarioGateway::updateObjectLanePos(int id, double timestamp, int roadId, i
         // Update status
         obj_state->state_.pos.SetLanePos(roadId, laneId, s, offset);
         obj_state->state_.info.timeStamp = timestamp;
-        obj_state->dirty_ |= Object::DirtyBit::LONGITUDINAL | Object::DirtyBit::LATERAL;
+        setChanged(obj_state, Object::DirtyBit::LONGITUDINAL | Object::DirtyBit::LATERAL);
     }
 
     return 0;
@@ -691,12 +790,26 @@ int ScenarioGateway::updateObjectWorldPosXYH(int id, double timestamp, double x,
         // Update status
         obj_state->state_.pos.SetInertiaPos(x, y, h);
         obj_state->state_.info.timeStamp = timestamp;
-        obj_state->dirty_ |= Object::DirtyBit::LONGITUDINAL | Object::DirtyBit::LATERAL;
+        setChanged(obj_state, Object::DirtyBit::LONGITUDINAL | Object::DirtyBit::LATERAL);
     }
 
     return 0;
 }
 
+int ScenarioGateway::updateObjectWorldPosXYHLocal(ObjectState* obj_state, double timestamp, double x, double y, double h)
+{
+    if (obj_state == nullptr)
+    {
+        return -1;
+    }
+
+    obj_state->state_.pos.SetInertiaPosLocal(x, y, h);
+    obj_state->state_.info.timeStamp = timestamp;
+    setChanged(obj_state, Object::DirtyBit::LONGITUDINAL | Object::DirtyBit::LATERAL);
+
+    return 0;
+}
+
 int ScenarioGateway::updateObjectWorldPos(int id, double timestamp, double x, double y, double z, double h, double p, double r)
 {
     ObjectState* obj_state = getObjectStatePtrById(id);
@@ -711,7 +824,7 @@ int ScenarioGateway::updateObjectWorldPos(int id, double timestamp, double x, do
         // Update status
         obj_state->state_.pos.SetInertiaPos(x, y, z, h, p, r);
         obj_state->state_.info.timeStamp = timestamp;
-        obj_state->dirty_ |= Object::DirtyBit::LONGITUDINAL | Object::DirtyBit::LATERAL;
+        setChanged(obj_state, Object::DirtyBit::LONGITUDINAL | Object::DirtyBit::LATERAL);
     }
 
     return 0;
@@ -728,8 +841,10 @@ int ScenarioGateway::updateObjectSpeed(int id, double timestamp, double speed)
         return -1;
     }
 
+    bool changed = obj_state->state_.info.speed != speed;
+
     obj_state->state_.info.speed = speed;
-    obj_state->dirty_ |= Object::DirtyBit::SPEED;
+    setChanged(obj_state, Object::DirtyBit::SPEED, changed);
 
     return 0;
 }
@@ -746,7 +861,7 @@ int ScenarioGateway::updateObjectVel(int id, double timestamp, double x_vel, dou
     }
 
     obj_state->state_.pos.SetVel(x_vel, y_vel, z_vel);
-    obj_state->dirty_ |= Object::DirtyBit::VELOCITY;
+    setChanged(obj_state, Object::DirtyBit::VELOCITY);
 
     return 0;
 }
@@ -763,7 +878,7 @@ int ScenarioGateway::updateObjectAcc(int id, double timestamp, double x_acc, dou
     }
 
     obj_state->state_.pos.SetAcc(x_acc, y_acc, z_acc);
-    obj_state->dirty_ |= Object::DirtyBit::ACCELERATION;
+    setChanged(obj_state, Object::DirtyBit::ACCELERATION);
 
     return 0;
 }
@@ -780,7 +895,7 @@ int ScenarioGateway::updateObjectAngularVel(int id, double timestamp, double h_r
     }
 
     obj_state->state_.pos.SetAngularVel(h_rate, p_rate, r_rate);
-    obj_state->dirty_ |= Object::DirtyBit::ANGULAR_RATE;
+    setChanged(obj_state, Object::DirtyBit::ANGULAR_RATE);
 
     return 0;
 }
@@ -797,7 +912,7 @@ int ScenarioGateway::updateObjectAngularAcc(int id, double timestamp, double h_a
     }
 
     obj_state->state_.pos.SetAngularAcc(h_acc, p_acc, r_acc);
-    obj_state->dirty_ |= Object::DirtyBit::ANGULAR_ACC;
+    setChanged(obj_state, Object::DirtyBit::ANGULAR_ACC);
 
     return 0;
 }
@@ -813,8 +928,10 @@ int ScenarioGateway::updateObjectWheelAngle(int id, double timestamp, double whe
         return -1;
     }
 
+    bool changed = obj_state->state_.info.wheel_angle != wheelAngle;
+
     obj_state->state_.info.wheel_angle = wheelAngle;
-    obj_state->dirty_ |= Object::DirtyBit::WHEEL_ANGLE;
+    setChanged(obj_state, Object::DirtyBit::WHEEL_ANGLE, changed);
 
     return 0;
 }
@@ -830,8 +947,10 @@ int ScenarioGateway::updateObjectWheelRotation(int id, double timestamp, double
         return -1;
     }
 
+    bool changed = obj_state->state_.info.wheel_rot != wheelRotation;
+
     obj_state->state_.info.wheel_rot = wheelRotation;
-    obj_state->dirty_ |= Object::DirtyBit::WHEEL_ROTATION;
+    setChanged(obj_state, Object::DirtyBit::WHEEL_ROTATION, changed);
 
     return 0;
 }
@@ -846,8 +965,10 @@ int ScenarioGateway::updateObjectVisibilityMask(int id, int visibilityMask)
         return -1;
     }
 
+    bool changed = obj_state->state_.info.visibilityMask != visibilityMask;
+
     obj_state->state_.info.visibilityMask = visibilityMask;
-    obj_state->dirty_ |= Object::DirtyBit::VISIBILITY;
+    setChanged(obj_state, Object::DirtyBit::VISIBILITY, changed);
 
     return 0;
 }
@@ -863,8 +984,8 @@ int ScenarioGateway::setObjectAlignMode(int id, int mode)
     }
 
     obj_state->state_.pos.SetAlignMode(static_cast<roadmanager::Position::ALIGN_MODE>(mode));
-    obj_state->dirty_ |=
-        (Object::DirtyBit::ALIGN_MODE_H | Object::DirtyBit::ALIGN_MODE_P | Object::DirtyBit::ALIGN_MODE_R | Object::DirtyBit::ALIGN_MODE_Z);
+    setChanged(obj_state,
+               Object::DirtyBit::ALIGN_MODE_H | Object::DirtyBit::ALIGN_MODE_P | Object::DirtyBit::ALIGN_MODE_R | Object::DirtyBit::ALIGN_MODE_Z);
 
     return 0;
 }
@@ -880,7 +1001,7 @@ int ScenarioGateway::setObjectAlignModeH(int id, int mode)
     }
 
     obj_state->state_.pos.SetAlignModeH(static_cast<roadmanager::Position::ALIGN_MODE>(mode));
-    obj_state->dirty_ |= Object::DirtyBit::ALIGN_MODE_H;
+    setChanged(obj_state, Object::DirtyBit::ALIGN_MODE_H);
 
     return 0;
 }
@@ -896,7 +1017,7 @@ int ScenarioGateway::setObjectAlignModeP(int id, int mode)
     }
 
     obj_state->state_.pos.SetAlignModeP(static_cast<roadmanager::Position::ALIGN_MODE>(mode));
-    obj_state->dirty_ |= Object::DirtyBit::ALIGN_MODE_P;
+    setChanged(obj_state, Object::DirtyBit::ALIGN_MODE_P);
 
     return 0;
 }
@@ -912,7 +1033,7 @@ int ScenarioGateway::setObjectAlignModeR(int id, int mode)
     }
 
     obj_state->state_.pos.SetAlignModeR(static_cast<roadmanager::Position::ALIGN_MODE>(mode));
-    obj_state->dirty_ |= Object::DirtyBit::ALIGN_MODE_R;
+    setChanged(obj_state, Object::DirtyBit::ALIGN_MODE_R);
 
     return 0;
 }
@@ -928,7 +1049,7 @@ int ScenarioGateway::setObjectAlignModeZ(int id, int mode)
     }
 
     obj_state->state_.pos.SetAlignModeZ(static_cast<roadmanager::Position::ALIGN_MODE>(mode));
-    obj_state->dirty_ |= Object::DirtyBit::ALIGN_MODE_Z;
+    setChanged(obj_state, Object::DirtyBit::ALIGN_MODE_Z);
 
     return 0;
 }
@@ -946,8 +1067,32 @@ void ScenarioGateway::clearDirtyBits()
     }
 }
 
+bool ScenarioGateway::isObjectChangedSince(int id, int frame)
+{
+    ObjectState* obj_state = getObjectStatePtrById(id);
+
+    return obj_state != nullptr && obj_state->changedSince(frame);
+}
+
+int ScenarioGateway::getObjectsChangedSince(int frame, std::vector<ObjectState*>& changed)
+{
+    changed.clear();
+
+    for (size_t i = 0; i < objectState_.size(); i++)
+    {
+        if (objectState_[i]->changedSince(frame))
+        {
+            changed.push_back(objectState_[i].get());
+        }
+    }
+
+    return static_cast<int>(changed.size());
+}
+
 void ScenarioGateway::removeObject(int id)
 {
+    objectStateById_.erase(id);
+
     for (auto objectIt = std::begin(objectState_); objectIt != std::end(objectState_);)
     {
         if ((*objectIt)->state_.info.id == id)
@@ -967,6 +1112,7 @@ void ScenarioGateway::removeObject(std::string name)
     {
         if ((*objectIt)->state_.info.name == name)
         {
+            objectStateById_.erase((*objectIt)->state_.info.id);
             objectIt = objectState_.erase(objectIt);
         }
         else
@@ -11,6 +11,7 @@
  */
 
 #pragma once
+#include <unordered_map>
 #include "RoadManager.hpp"
 #include "OSCBoundingBox.hpp"
 #include "Entities.hpp"
@@ -101,14 +102,14 @@ namespace scenarioengine
     public:
         ObjectState();
         ObjectState(int                    id,
-                    std::string            name,
+                    const std::string     &name,
                     int                    obj_type,
                     int                    obj_category,
                     int                    obj_role,
                     int                    model_id,
-                    std::string            model3d,
+                    const std::string     &model3d,
                     int                    ctrl_type,
-                    OSCBoundingBox         boundingbox,
+                    const OSCBoundingBox  &boundingbox,
                     int                    scaleMode,
                     int                    visibilityMask,
                     double                 timestamp,
@@ -192,8 +193,19 @@ namespace scenarioengine
             dirty_ = 0;
         }
 
+        /**
+        Check whether any state of the object was changed in given frame or later
+        @param frame Frame number, see ScenarioGateway::getFrameNr()
+        @return true if changed, else false
+        */
+        bool changedSince(int frame) const
+        {
+            return change_frame_ >= frame;
+        }
+
         ObjectStateStruct state_;
         unsigned int      dirty_;
+        int               change_frame_;  // frame number of most recent change of any state value
 
     private:
         friend class ScenarioGateway;
@@ -206,14 +218,14 @@ namespace scenarioengine
         ~ScenarioGateway();
 
         int reportObject(int                    id,
-                         std::string            name,
+                         const std::string     &name,
                          int                    obj_type,
                          int                    obj_category,
                          int                    obj_role,
                          int                    model_id,
-                         std::string            model3d,
+                         const std::string     &model3d,
                          int                    ctrl_type,
-                         OSCBoundingBox         boundingbox,
+                         const OSCBoundingBox  &boundingbox,
                          int                    scaleMode,
                          int                    visibilityMask,
                          double                 timestamp,
@@ -305,6 +317,32 @@ namespace scenarioengine
                          double         lateralOffset,
                          double         s);
 
+        /**
+        Register a scenario object, including its static attributes (name, model, bounding box etc), to the gateway
+        Needed only once per object, then use updateObjectState() to report any changes
+        @param obj The scenario object
+        @param timestamp Simulation time
+        @return 0 on success, -1 if object already registered
+        */
+        int registerObject(Object *obj, double timestamp);
+
+        /**
+        Update changed states of a registered object, as indicated by the object dirty bits (see Object::DirtyBit)
+        @param obj The scenario object
+        @param timestamp Simulation time
+        @return 0 on success, -1 if object has not been registered
+        */
+        int updateObjectState(Object *obj, double timestamp);
+
+        /**
+        Update world position of an object expected to be close to its previous position, e.g. a trailer
+        Road position is primarily resolved on current road, see roadmanager::Position::SetInertiaPosLocal()
+        @param obj_state Object state, as given by getObjectStatePtrById()
+        @param timestamp Simulation time
+        @return 0 on success, -1 if no object state is given
+        */
+        int updateObjectWorldPosXYHLocal(ObjectState *obj_state, double timestamp, double x, double y, double h);
+
         int  updateObjectPos(int id, double timestamp, roadmanager::Position *pos);
         int  updateObjectRoadPos(int id, double timestamp, int roadId, double lateralOffset, double s);
         int  updateObjectLanePos(int id, double timestamp, int roadId, int laneId, double offset, double s);
@@ -326,6 +364,35 @@ namespace scenarioengine
         bool isObjectReported(int id);
         void clearDirtyBits();
 
+        /**
+        Set current frame number. Any state changes reported hereafter will be tagged with this number.
+        */
+        void setFrameNr(int frame)
+        {
+            frame_nr_ = frame;
+        }
+        int getFrameNr() const
+        {
+            return frame_nr_;
+        }
+
+        /**
+        Check whether any state of specified object was changed in given frame or later
+        @param id Object id
+        @param frame Frame number
+        @return true if changed, false if unchanged or object not found
+        */
+        bool isObjectChangedSince(int id, int frame);
+
+        /**
+        Collect objects with any state changed in given frame or later. Typical use is for a consumer
+        to store getFrameNr() after each update and then pass that number next time to skip unchanged objects.
+        @param frame Frame number
+        @param changed Resulting list of object states, replaces any existing content
+        @return Number of changed objects
+        */
+        int getObjectsChangedSince(int frame, std::vector<ObjectState *> &changed);
+
         void removeObject(int id);
         void removeObject(std::string name);
         int  getNumberOfObjects()
@@ -348,8 +415,13 @@ namespace scenarioengine
         std::vector<std::unique_ptr<ObjectState>> objectState_;
 
     private:
-        int updateObjectInfo(ObjectState *obj_state, double timestamp, int visibilityMask, double speed, double wheel_angle, double wheel_rot);
-        std::ofstream data_file_;
+        int          updateObjectInfo(ObjectState *obj_state, double timestamp, int visibilityMask, double speed, double wheel_angle, double wheel_rot);
+        ObjectState *addObjectState(ObjectState *obj_state);
+        void         setChanged(ObjectState *obj_state, int dirty_bits, bool changed = true);
+
+        std::unordered_map<int, ObjectState *> objectStateById_;  // lookup table, same content as objectState_
+        int                                    frame_nr_;
+        std::ofstream                          data_file_;
     };
 
 }  // namespace scenarioengine
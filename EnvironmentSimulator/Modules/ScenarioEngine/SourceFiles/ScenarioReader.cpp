@@ -260,10 +260,10 @@ Catalog *ScenarioReader::LoadCatalog(std::string name)
     }
 
     // Not found, try to locate it in one the registered catalog directories
-    pugi::xml_document       catalog_doc;
-    pugi::xml_parse_result   result;
-    std::vector<std::string> file_name_candidates;
-    for (size_t i = 0; i < catalogs_->catalog_dirs_.size() && !result; i++)
+    // Catalog files are indexed once per process, entries are parsed on first reference
+    std::shared_ptr<CatalogFile> catalog_file;
+    std::vector<std::string>     file_name_candidates;
+    for (size_t i = 0; i < catalogs_->catalog_dirs_.size() && catalog_file == nullptr; i++)
     {
         file_name_candidates.clear();
         // absolute path or relative to current directory
@@ -278,50 +278,39 @@ Catalog *ScenarioReader::LoadCatalog(std::string name)
                 CombineDirectoryPathAndFilepath(SE_Env::Inst().GetPaths()[j], catalogs_->catalog_dirs_[i].dir_name_ + "/" + name + ".xosc"));
             file_name_candidates.push_back(CombineDirectoryPathAndFilepath(SE_Env::Inst().GetPaths()[j], name + ".xosc"));
         }
-        for (size_t j = 0; j < file_name_candidates.size() && !result; j++)
+        std::string path = SE_Env::Inst().LocateFile(file_name_candidates);
+        if (!path.empty())
         {
-            if (FileExists(file_name_candidates[j].c_str()))
-            {
-                // Load it
-                result = catalog_doc.load_file(file_name_candidates[j].c_str());
-            }
+            // Load it, or fetch already indexed content
+            catalog_file = CatalogIndex::Inst().GetFile(path);
         }
     }
-    if (!result)
-    {
-        throw std::runtime_error("Couldn't locate catalog file: " + name + ". " + result.description());
-    }
-
-    pugi::xml_node osc_node_ = catalog_doc.child("OpenSCENARIO");
-    if (!osc_node_)
+    if (catalog_file == nullptr)
     {
-        osc_node_ = catalog_doc.child("OpenScenario");
-        if (!osc_node_)
-        {
-            throw std::runtime_error("Couldn't find Catalog OpenSCENARIO or OpenScenario element - check XML!");
-        }
+        throw std::runtime_error("Couldn't locate catalog file: " + name);
     }
-    pugi::xml_node catalog_node = osc_node_.child("Catalog");
 
     catalog        = new Catalog();
     catalog->name_ = name;
+    catalog->SetFile(catalog_file);
 
-    for (pugi::xml_node entry_n = catalog_node.first_child(); entry_n; entry_n = entry_n.next_sibling())
+    if (catalog_file->param_names_)
     {
-        std::string entry_name = parameters.ReadAttribute(entry_n, "name");
-
-        pugi::xml_document root;
-        root.append_copy(entry_n);
-
-        catalog->AddEntry(new Entry(entry_name, std::move(root)));
+        // Resolve any parameterized entry names
+        for (size_t i = 0; i < catalog_file->entry_.size(); i++)
+        {
+            if (catalog_file->entry_[i].name_[0] == PARAMETER_PREFIX)
+            {
+                Entry *entry = catalog->GetEntryByIdx(i);
+                if (entry != nullptr)
+                {
+                    catalog->SetEntryName(i, parameters.ReadAttribute(entry->GetNode(), "name"));
+                }
+            }
+        }
     }
 
-    // Get type by inspecting first entry
-    if (catalog->entry_.size() > 0)
-    {
-        catalog->type_ = catalog->entry_[0]->type_;
-    }
-    else
+    if (catalog->GetNumberOfEntries() == 0)
     {
         LOG("Warning: Catalog %s seems to be empty!", catalog->name_.c_str());
     }
@@ -350,6 +339,43 @@ void ScenarioReader::parseRoadNetwork(RoadNetwork &roadNetwork)
     }
 }
 
+void ScenarioReader::parseTrafficSignalControllers(roadmanager::SignalStateRegistry &registry)
+{
+    pugi::xml_node node = osc_root_.child("RoadNetwork").child("TrafficSignals");
+
+    for (pugi::xml_node ctrlNode = node.child("TrafficSignalController"); ctrlNode; ctrlNode = ctrlNode.next_sibling("TrafficSignalController"))
+    {
+        std::string name  = parameters.ReadAttribute(ctrlNode, "name");
+        double      delay = 0.0;
+
+        if (!ctrlNode.attribute("delay").empty())
+        {
+            delay = parameters.ReadDouble(ctrlNode, "delay");
+        }
+        if (!ctrlNode.attribute("reference").empty())
+        {
+            LOG("TrafficSignalController %s: reference not supported yet, ignored", name.c_str());
+        }
+
+        std::vector<roadmanager::SignalStateRegistry::Phase> phases;
+        for (pugi::xml_node phaseNode = ctrlNode.child("Phase"); phaseNode; phaseNode = phaseNode.next_sibling("Phase"))
+        {
+            roadmanager::SignalStateRegistry::Phase phase;
+            phase.name     = parameters.ReadAttribute(phaseNode, "name");
+            phase.duration = parameters.ReadDouble(phaseNode, "duration");
+
+            for (pugi::xml_node sNode = phaseNode.child("TrafficSignalState"); sNode; sNode = sNode.next_sibling("TrafficSignalState"))
+            {
+                int signal_id = parameters.ReadInt(sNode, "trafficSignalId");
+                phase.states.push_back(std::make_pair(signal_id, parameters.ReadAttribute(sNode, "state")));
+            }
+            phases.push_back(phase);
+        }
+
+        registry.AddPhaseSchedule(name, delay, phases);
+    }
+}
+
 void ScenarioReader::ParseOSCProperties(OSCProperties &properties, pugi::xml_node &xml_node)
 {
     pugi::xml_node properties_node = xml_node.child("Properties");
@@ -473,6 +499,14 @@ roadmanager::RelativeDistanceType ScenarioReader::ParseRelativeDistanceType(pugi
     return rdt;
 }
 
+Controller::DomainActivation ScenarioReader::ReadDomainActivation(pugi::xml_node node, const char *attribute)
+{
+    return parameters.ReadEnum(node,
+                               attribute,
+                               {{"true", Controller::DomainActivation::ON}, {"false", Controller::DomainActivation::OFF}},
+                               Controller::DomainActivation::UNDEFINED);
+}
+
 void ScenarioReader::ParseOSCBoundingBox(OSCBoundingBox &boundingbox, pugi::xml_node &xml_node)
 {
     pugi::xml_node boundingbox_node = xml_node.child("BoundingBox");
@@ -483,15 +517,15 @@ void ScenarioReader::ParseOSCBoundingBox(OSCBoundingBox &boundingbox, pugi::xml_
             std::string boundingboxChildName(boundingboxChild.name());
             if (boundingboxChildName == "Center")
             {
-                boundingbox.center_.x_ = std::stof(parameters.ReadAttribute(boundingboxChild, "x"));
-                boundingbox.center_.y_ = std::stof(parameters.ReadAttribute(boundingboxChild, "y"));
-                boundingbox.center_.z_ = std::stof(parameters.ReadAttribute(boundingboxChild, "z"));
+                boundingbox.center_.x_ = static_cast<float>(parameters.ReadDouble(boundingboxChild, "x", true));
+                boundingbox.center_.y_ = static_cast<float>(parameters.ReadDouble(boundingboxChild, "y", true));
+                boundingbox.center_.z_ = static_cast<float>(parameters.ReadDouble(boundingboxChild, "z", true));
             }
             else if (boundingboxChildName == "Dimensions")
             {
-                boundingbox.dimensions_.width_  = std::stof(parameters.ReadAttribute(boundingboxChild, "width"));
-                boundingbox.dimensions_.length_ = std::stof(parameters.ReadAttribute(boundingboxChild, "length"));
-                boundingbox.dimensions_.height_ = std::stof(parameters.ReadAttribute(boundingboxChild, "height"));
+                boundingbox.dimensions_.width_  = static_cast<float>(parameters.ReadDouble(boundingboxChild, "width", true));
+                boundingbox.dimensions_.length_ = static_cast<float>(parameters.ReadDouble(boundingboxChild, "length", true));
+                boundingbox.dimensions_.height_ = static_cast<float>(parameters.ReadDouble(boundingboxChild, "height", true));
             }
             else
             {
@@ -606,7 +640,7 @@ Vehicle *ScenarioReader::parseOSCVehicle(pugi::xml_node vehicleNode)
     {
         if (!(performance_node.attribute("maxSpeed").empty()))
         {
-            vehicle->SetMaxSpeed(strtod(parameters.ReadAttribute(performance_node, "maxSpeed")));
+            vehicle->SetMaxSpeed(parameters.ReadDouble(performance_node, "maxSpeed"));
         }
         else
         {
@@ -615,7 +649,7 @@ Vehicle *ScenarioReader::parseOSCVehicle(pugi::xml_node vehicleNode)
 
         if (!(performance_node.attribute("maxAcceleration").empty()))
         {
-            vehicle->SetMaxAcceleration(strtod(parameters.ReadAttribute(performance_node, "maxAcceleration")));
+            vehicle->SetMaxAcceleration(parameters.ReadDouble(performance_node, "maxAcceleration"));
         }
         else
         {
@@ -626,7 +660,7 @@ Vehicle *ScenarioReader::parseOSCVehicle(pugi::xml_node vehicleNode)
 
         if (!(performance_node.attribute("maxDeceleration").empty()))
         {
-            vehicle->SetMaxDeceleration(strtod(parameters.ReadAttribute(performance_node, "maxDeceleration")));
+            vehicle->SetMaxDeceleration(parameters.ReadDouble(performance_node, "maxDeceleration"));
         }
         else
         {
@@ -663,11 +697,11 @@ Vehicle *ScenarioReader::parseOSCVehicle(pugi::xml_node vehicleNode)
 
             if (axle != nullptr)
             {
-                axle->maxSteering   = std::stof(parameters.ReadAttribute(axle_node, "maxSteering"));
-                axle->positionX     = std::stof(parameters.ReadAttribute(axle_node, "positionX"));
-                axle->positionZ     = std::stof(parameters.ReadAttribute(axle_node, "positionZ"));
-                axle->trackWidth    = std::stof(parameters.ReadAttribute(axle_node, "trackWidth"));
-                axle->wheelDiameter = std::stof(parameters.ReadAttribute(axle_node, "wheelDiameter"));
+                axle->maxSteering   = static_cast<float>(parameters.ReadDouble(axle_node, "maxSteering", true));
+                axle->positionX     = static_cast<float>(parameters.ReadDouble(axle_node, "positionX", true));
+                axle->positionZ     = static_cast<float>(parameters.ReadDouble(axle_node, "positionZ", true));
+                axle->trackWidth    = static_cast<float>(parameters.ReadDouble(axle_node, "trackWidth", true));
+                axle->wheelDiameter = static_cast<float>(parameters.ReadDouble(axle_node, "wheelDiameter", true));
             }
         }
     }
@@ -677,14 +711,14 @@ Vehicle *ScenarioReader::parseOSCVehicle(pugi::xml_node vehicleNode)
     if (!trailer_hitch_node.empty())
     {
         vehicle->trailer_hitch_      = std::make_shared<Vehicle::TrailerHitch>();
-        vehicle->trailer_hitch_->dx_ = strtod(parameters.ReadAttribute(trailer_hitch_node, "dx"));
+        vehicle->trailer_hitch_->dx_ = parameters.ReadDouble(trailer_hitch_node, "dx");
     }
 
     pugi::xml_node trailer_coupler_node = vehicleNode.child("TrailerCoupler");
     if (!trailer_coupler_node.empty())
     {
         vehicle->trailer_coupler_      = std::make_shared<Vehicle::TrailerCoupler>();
-        vehicle->trailer_coupler_->dx_ = strtod(parameters.ReadAttribute(trailer_coupler_node, "dx"));
+        vehicle->trailer_coupler_->dx_ = parameters.ReadDouble(trailer_coupler_node, "dx");
     }
 
     pugi::xml_node trailer_node = vehicleNode.child("Trailer");
@@ -784,7 +818,7 @@ Pedestrian *ScenarioReader::parseOSCPedestrian(pugi::xml_node pedestrianNode)
 
     pedestrian->typeName_ = parameters.ReadAttribute(pedestrianNode, "name");
     pedestrian->SetCategory(parameters.ReadAttribute(pedestrianNode, "pedestrianCategory"));
-    pedestrian->mass_ = strtod(parameters.ReadAttribute(pedestrianNode, "mass"));
+    pedestrian->mass_ = parameters.ReadDouble(pedestrianNode, "mass");
 
     // Parse BoundingBox
     OSCBoundingBox boundingbox = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
@@ -873,7 +907,7 @@ MiscObject *ScenarioReader::parseOSCMiscObject(pugi::xml_node miscObjectNode)
 
     miscObject->typeName_ = parameters.ReadAttribute(miscObjectNode, "name");
     miscObject->SetCategory(parameters.ReadAttribute(miscObjectNode, "miscObjectCategory"));
-    miscObject->mass_ = strtod(parameters.ReadAttribute(miscObjectNode, "mass"));
+    miscObject->mass_ = parameters.ReadDouble(miscObjectNode, "mass");
 
     // Parse BoundingBox
     OSCBoundingBox boundingbox = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
@@ -1006,13 +1040,8 @@ roadmanager::Route *ScenarioReader::parseOSCRoute(pugi::xml_node routeNode)
     parameters.CreateRestorePoint();
 
     // Closed attribute not supported by roadmanager yet
-    std::string closed_str = parameters.ReadAttribute(routeNode, "closed");
-    bool        closed     = false;
+    bool closed = parameters.ReadBool(routeNode, "closed");
     (void)closed;
-    if (closed_str == "true" || closed_str == "1")
-    {
-        closed = true;
-    }
 
     for (pugi::xml_node routeChild = routeNode.first_child(); routeChild; routeChild = routeChild.next_sibling())
     {
@@ -1125,7 +1154,7 @@ roadmanager::RMTrajectory *ScenarioReader::parseTrajectory(pugi::xml_node node)
     parameters.CreateRestorePoint();
 
     traj->name_   = parameters.ReadAttribute(node, "name");
-    traj->closed_ = parameters.ReadAttribute(node, "closed") == "true" ? true : false;
+    traj->closed_ = parameters.ReadBool(node, "closed");
 
     for (pugi::xml_node childNode = node.first_child(); childNode; childNode = childNode.next_sibling())
     {
@@ -1156,7 +1185,7 @@ roadmanager::RMTrajectory *ScenarioReader::parseTrajectory(pugi::xml_node node)
                         throw std::runtime_error("Missing Trajectory/Polyline/Vertex/Position node");
                     }
                     std::unique_ptr<OSCPosition> pos  = std::unique_ptr<OSCPosition>{parseOSCPosition(posNode)};
-                    double                       time = strtod(parameters.ReadAttribute(vertexNode, "time"));
+                    double                       time = parameters.ReadDouble(vertexNode, "time");
 
                     bool calculateHeading = false;
                     if (pos->type_ == OSCPosition::PositionType::WORLD)
@@ -1180,23 +1209,23 @@ roadmanager::RMTrajectory *ScenarioReader::parseTrajectory(pugi::xml_node node)
                 pugi::xml_node               posNode = shapeNode.child("Position");
                 std::unique_ptr<OSCPosition> pos     = std::unique_ptr<OSCPosition>{parseOSCPosition(posNode)};
 
-                double curvature = strtod(parameters.ReadAttribute(shapeNode, "curvature"));
+                double curvature = parameters.ReadDouble(shapeNode, "curvature");
 
                 double curvaturePrime = 0.0;
                 if (!shapeNode.attribute("curvaturePrime").empty())
                 {
                     // curvaturePrime introduced in OSC v1.1
-                    curvaturePrime = strtod(parameters.ReadAttribute(shapeNode, "curvaturePrime"));
+                    curvaturePrime = parameters.ReadDouble(shapeNode, "curvaturePrime");
                 }
                 else if (!shapeNode.attribute("curvatureDot").empty())
                 {
                     // curvatureDot depricated in OSC v1.1
-                    curvaturePrime = strtod(parameters.ReadAttribute(shapeNode, "curvatureDot"));
+                    curvaturePrime = parameters.ReadDouble(shapeNode, "curvatureDot");
                 }
 
-                double length    = strtod(parameters.ReadAttribute(shapeNode, "length"));
-                double startTime = strtod(parameters.ReadAttribute(shapeNode, "startTime"));
-                double stopTime  = strtod(parameters.ReadAttribute(shapeNode, "stopTime"));
+                double length    = parameters.ReadDouble(shapeNode, "length");
+                double startTime = parameters.ReadDouble(shapeNode, "startTime");
+                double stopTime  = parameters.ReadDouble(shapeNode, "stopTime");
 
                 LOG("Adding clothoid(x=%.2f y=%.2f h=%.2f curv=%.2f curvDot=%.2f len=%.2f startTime=%.2f stopTime=%.2f)",
                     pos->GetRMPos()->GetX(),
@@ -1215,7 +1244,7 @@ roadmanager::RMTrajectory *ScenarioReader::parseTrajectory(pugi::xml_node node)
             }
             else if (shapeType == "Nurbs")
             {
-                int order = strtoi(parameters.ReadAttribute(shapeNode, "order"));
+                int order = parameters.ReadInt(shapeNode, "order");
 
                 roadmanager::NurbsShape *nurbs = new roadmanager::NurbsShape(order);
                 std::vector<double>      knots;
@@ -1229,18 +1258,18 @@ roadmanager::RMTrajectory *ScenarioReader::parseTrajectory(pugi::xml_node node)
                     {
                         pugi::xml_node               posNode = nurbsChild.child("Position");
                         std::unique_ptr<OSCPosition> pos     = std::unique_ptr<OSCPosition>{parseOSCPosition(posNode)};
-                        double                       time    = strtod(parameters.ReadAttribute(nurbsChild, "time"));
+                        double                       time    = parameters.ReadDouble(nurbsChild, "time");
                         double                       weight  = 1.0;
                         if (!nurbsChild.attribute("weight").empty())
                         {
-                            weight = strtod(parameters.ReadAttribute(nurbsChild, "weight"));
+                            weight = parameters.ReadDouble(nurbsChild, "weight");
                         }
                         bool calcHeading = posNode.first_child().child("Orientation") ? false : true;
                         nurbs->AddControlPoint(*pos->GetRMPos(), time, weight, calcHeading);
                     }
                     else if (nurbsChildName == "Knot")
                     {
-                        double value = strtod(parameters.ReadAttribute(nurbsChild, "value"));
+                        double value = parameters.ReadDouble(nurbsChild, "value");
                         knots.push_back(value);
                     }
                     else
@@ -1477,9 +1506,9 @@ int ScenarioReader::parseEntities()
 
 void ScenarioReader::parseOSCOrientation(OSCOrientation &orientation, pugi::xml_node orientationNode)
 {
-    orientation.h_ = strtod(parameters.ReadAttribute(orientationNode, "h"));
-    orientation.p_ = strtod(parameters.ReadAttribute(orientationNode, "p"));
-    orientation.r_ = strtod(parameters.ReadAttribute(orientationNode, "r"));
+    orientation.h_ = parameters.ReadDouble(orientationNode, "h");
+    orientation.p_ = parameters.ReadDouble(orientationNode, "p");
+    orientation.r_ = parameters.ReadDouble(orientationNode, "r");
 
     std::string type_str = parameters.ReadAttribute(orientationNode, "type");
 
@@ -1522,27 +1551,27 @@ OSCPosition *ScenarioReader::parseOSCPosition(pugi::xml_node positionNode, OSCPo
 
         if (positionChild.attribute("x"))
         {
-            x = strtod(parameters.ReadAttribute(positionChild, "x", true));
+            x = parameters.ReadDouble(positionChild, "x", true);
         }
         if (positionChild.attribute("y"))
         {
-            y = strtod(parameters.ReadAttribute(positionChild, "y", true));
+            y = parameters.ReadDouble(positionChild, "y", true);
         }
         if (!positionChild.attribute("z").empty())
         {
-            z = strtod(parameters.ReadAttribute(positionChild, "z", true));
+            z = parameters.ReadDouble(positionChild, "z", true);
         }
         if (!positionChild.attribute("h").empty())
         {
-            h = strtod(parameters.ReadAttribute(positionChild, "h", true));
+            h = parameters.ReadDouble(positionChild, "h", true);
         }
         if (!positionChild.attribute("p").empty())
         {
-            p = strtod(parameters.ReadAttribute(positionChild, "p", true));
+            p = parameters.ReadDouble(positionChild, "p", true);
         }
         if (!positionChild.attribute("r").empty())
         {
-            r = strtod(parameters.ReadAttribute(positionChild, "r", true));
+            r = parameters.ReadDouble(positionChild, "r", true);
         }
 
         if (std::isnan(x) || std::isnan(y))
@@ -1558,9 +1587,9 @@ OSCPosition *ScenarioReader::parseOSCPosition(pugi::xml_node positionNode, OSCPo
     {
         double dx, dy, dz;
 
-        dx = strtod(parameters.ReadAttribute(positionChild, "dx"));
-        dy = strtod(parameters.ReadAttribute(positionChild, "dy"));
-        dz = strtod(parameters.ReadAttribute(positionChild, "dz"));
+        dx = parameters.ReadDouble(positionChild, "dx");
+        dy = parameters.ReadDouble(positionChild, "dy");
+        dz = parameters.ReadDouble(positionChild, "dz");
 
         Object *object = ResolveObjectReference(parameters.ReadAttribute(positionChild, "entityRef"));
 
@@ -1580,9 +1609,9 @@ OSCPosition *ScenarioReader::parseOSCPosition(pugi::xml_node positionNode, OSCPo
     {
         double dx, dy, dz;
 
-        dx             = strtod(parameters.ReadAttribute(positionChild, "dx"));
-        dy             = strtod(parameters.ReadAttribute(positionChild, "dy"));
-        dz             = strtod(parameters.ReadAttribute(positionChild, "dz"));
+        dx             = parameters.ReadDouble(positionChild, "dx");
+        dy             = parameters.ReadDouble(positionChild, "dy");
+        dz             = parameters.ReadDouble(positionChild, "dz");
         Object *object = ResolveObjectReference(parameters.ReadAttribute(positionChild, "entityRef"));
 
         // Check for optional Orientation element
@@ -1604,16 +1633,16 @@ OSCPosition *ScenarioReader::parseOSCPosition(pugi::xml_node positionNode, OSCPo
 
         if (positionChild.attribute("dsLane").empty())
         {
-            ds = strtod(parameters.ReadAttribute(positionChild, "ds"));
+            ds = parameters.ReadDouble(positionChild, "ds");
         }
         else
         {
             LOG("RelativeLanePosition:dsLane not supported yet, using it as ds");
-            ds = strtod(parameters.ReadAttribute(positionChild, "dsLane"));
+            ds = parameters.ReadDouble(positionChild, "dsLane");
         }
 
-        dLane          = strtoi(parameters.ReadAttribute(positionChild, "dLane"));
-        offset         = strtod(parameters.ReadAttribute(positionChild, "offset"));
+        dLane          = parameters.ReadInt(positionChild, "dLane");
+        offset         = parameters.ReadDouble(positionChild, "offset");
         Object *object = ResolveObjectReference(parameters.ReadAttribute(positionChild, "entityRef", true));
 
         // Check for optional Orientation element
@@ -1637,8 +1666,8 @@ OSCPosition *ScenarioReader::parseOSCPosition(pugi::xml_node positionNode, OSCPo
     {
         double ds, dt;
 
-        ds             = strtod(parameters.ReadAttribute(positionChild, "ds"));
-        dt             = strtod(parameters.ReadAttribute(positionChild, "dt"));
+        ds             = parameters.ReadDouble(positionChild, "ds");
+        dt             = parameters.ReadDouble(positionChild, "dt");
         Object *object = ResolveObjectReference(parameters.ReadAttribute(positionChild, "entityRef"));
 
         // Check for optional Orientation element
@@ -1660,9 +1689,9 @@ OSCPosition *ScenarioReader::parseOSCPosition(pugi::xml_node positionNode, OSCPo
     }
     else if (positionChildName == "RoadPosition")
     {
-        int    road_id = strtoi(parameters.ReadAttribute(positionChild, "roadId"));
-        double s       = strtod(parameters.ReadAttribute(positionChild, "s"));
-        double t       = strtod(parameters.ReadAttribute(positionChild, "t"));
+        int    road_id = parameters.ReadInt(positionChild, "roadId");
+        double s       = parameters.ReadDouble(positionChild, "s");
+        double t       = parameters.ReadDouble(positionChild, "t");
 
         // Check for optional Orientation element
         pugi::xml_node orientation_node = positionChild.child("Orientation");
@@ -1683,14 +1712,14 @@ OSCPosition *ScenarioReader::parseOSCPosition(pugi::xml_node positionNode, OSCPo
     }
     else if (positionChildName == "LanePosition")
     {
-        int    road_id = strtoi(parameters.ReadAttribute(positionChild, "roadId"));
-        int    lane_id = strtoi(parameters.ReadAttribute(positionChild, "laneId"));
-        double s       = strtod(parameters.ReadAttribute(positionChild, "s"));
+        int    road_id = parameters.ReadInt(positionChild, "roadId");
+        int    lane_id = parameters.ReadInt(positionChild, "laneId");
+        double s       = parameters.ReadDouble(positionChild, "s");
 
         double offset = 0;  // Default value of optional parameter
         if (positionChild.attribute("offset"))
         {
-            offset = strtod(parameters.ReadAttribute(positionChild, "offset"));
+            offset = parameters.ReadDouble(positionChild, "offset");
         }
 
         // Check for optional Orientation element
@@ -1785,14 +1814,14 @@ OSCPosition *ScenarioReader::parseOSCPosition(pugi::xml_node positionNode, OSCPo
                     }
                     else if (rPositionChildName == "FromLaneCoordinates")
                     {
-                        double s           = strtod(parameters.ReadAttribute(rPositionChild, "pathS"));
-                        int    lane_id     = strtoi(parameters.ReadAttribute(rPositionChild, "laneId"));
+                        double s           = parameters.ReadDouble(rPositionChild, "pathS");
+                        int    lane_id     = parameters.ReadInt(rPositionChild, "laneId");
                         double lane_offset = 0;
 
                         pugi::xml_attribute laneOffsetAttribute = rPositionChild.attribute("laneOffset");
                         if (laneOffsetAttribute != NULL)
                         {
-                            lane_offset = strtod(parameters.ReadAttribute(rPositionChild, "laneOffset"));
+                            lane_offset = parameters.ReadDouble(rPositionChild, "laneOffset");
                         }
                         if (orientation)
                         {
@@ -1830,7 +1859,7 @@ OSCPosition *ScenarioReader::parseOSCPosition(pugi::xml_node positionNode, OSCPo
 
         roadmanager::RMTrajectory *traj = parseTrajectoryRef(trajectoryRef);
 
-        double s = strtod(parameters.ReadAttribute(positionChild, "s"));
+        double s = parameters.ReadDouble(positionChild, "s");
         if (!positionChild.attribute("t").empty())
         {
             LOG("TrajectoryPosition -> t not supported yet, set to zero");
@@ -1919,12 +1948,12 @@ int ScenarioReader::ParseTransitionDynamics(pugi::xml_node node, OSCPrivateActio
     {
         // dimension and value not used in this case - relax attribute requirement
         td.dimension_ = ParseDynamicsDimension(parameters.ReadAttribute(node, "dynamicsDimension", false));
-        td.SetParamTargetVal(strtod(parameters.ReadAttribute(node, "value", false)));
+        td.SetParamTargetVal(parameters.ReadDouble(node, "value", false));
     }
     else
     {
         td.dimension_ = ParseDynamicsDimension(parameters.ReadAttribute(node, "dynamicsDimension", true));
-        td.SetParamTargetVal(strtod(parameters.ReadAttribute(node, "value", true)));
+        td.SetParamTargetVal(parameters.ReadDouble(node, "value", true));
     }
 
     return 0;
@@ -2008,35 +2037,45 @@ OSCGlobalAction *ScenarioReader::parseOSCGlobalAction(pugi::xml_node actionNode)
                 trafficSwarmAction->SetCentralObject(entities_->GetObjectByName(parameters.ReadAttribute(childNode, "entityRef")));
                 // childNode = trafficChild.child("")
 
-                std::string radius, numberOfVehicles, velocity;
-
                 // Inner radius (Circle)
-                radius = parameters.ReadAttribute(trafficChild, "innerRadius");
-                trafficSwarmAction->SetInnerRadius(std::stod(radius));
+                trafficSwarmAction->SetInnerRadius(parameters.ReadDouble(trafficChild, "innerRadius", true));
 
                 // Semi major axis
-                radius = parameters.ReadAttribute(trafficChild, "semiMajorAxis");
-                trafficSwarmAction->SetSemiMajorAxes(std::stod(radius));
+                trafficSwarmAction->SetSemiMajorAxes(parameters.ReadDouble(trafficChild, "semiMajorAxis", true));
 
                 // Semi major axis
-                radius = parameters.ReadAttribute(trafficChild, "semiMinorAxis");
-                trafficSwarmAction->SetSemiMinorAxes(std::stod(radius));
+                trafficSwarmAction->SetSemiMinorAxes(parameters.ReadDouble(trafficChild, "semiMinorAxis", true));
 
                 trafficSwarmAction->SetEntities(entities_);
                 trafficSwarmAction->SetGateway(gateway_);
                 trafficSwarmAction->SetReader(this);
 
                 // Number of vehicles
-                numberOfVehicles = parameters.ReadAttribute(trafficChild, "numberOfVehicles");
-                trafficSwarmAction->SetNumberOfVehicles(static_cast<int>(std::stoul(numberOfVehicles)));
+                trafficSwarmAction->SetNumberOfVehicles(parameters.ReadInt(trafficChild, "numberOfVehicles", true));
 
                 // Velocity
-                velocity = parameters.ReadAttribute(trafficChild, "velocity");
-                trafficSwarmAction->Setvelocity(std::stod(velocity));
+                trafficSwarmAction->Setvelocity(parameters.ReadDouble(trafficChild, "velocity"));
 
                 action = trafficSwarmAction;
             }
         }
+        else if (actionChild.name() == std::string("InfrastructureAction"))
+        {
+            pugi::xml_node signalChild = actionChild.child("TrafficSignalAction").first_child();
+            if (signalChild.name() == std::string("TrafficSignalStateAction"))
+            {
+                TrafficSignalStateAction *signalStateAction = new TrafficSignalStateAction();
+
+                signalStateAction->signal_id_ = parameters.ReadInt(signalChild, "name");
+                signalStateAction->state_     = parameters.ReadAttribute(signalChild, "state");
+
+                action = signalStateAction;
+            }
+            else
+            {
+                LOG("InfrastructureAction %s not supported yet", signalChild.name());
+            }
+        }
         else if (actionChild.name() == std::string("EntityAction"))
         {
             Object *entity;
@@ -2063,7 +2102,6 @@ OSCGlobalAction *ScenarioReader::parseOSCGlobalAction(pugi::xml_node actionNode)
                 {
                     DeleteEntityAction *deleteEntityAction = new DeleteEntityAction(entity);
                     deleteEntityAction->SetEntities(entities_);
-                    deleteEntityAction->SetGateway(gateway_);
 
                     action = deleteEntityAction;
                 }
@@ -2120,28 +2158,8 @@ OSCUserDefinedAction *ScenarioReader::parseOSCUserDefinedAction(pugi::xml_node a
 
 ActivateControllerAction *ScenarioReader::parseActivateControllerAction(pugi::xml_node node)
 {
-    Controller::DomainActivation lateral      = Controller::DomainActivation::UNDEFINED;
-    Controller::DomainActivation longitudinal = Controller::DomainActivation::UNDEFINED;
-    std::string                  lat_str      = parameters.ReadAttribute(node, "lateral");
-    std::string                  long_str     = parameters.ReadAttribute(node, "longitudinal");
-
-    if (lat_str == "false")
-    {
-        lateral = Controller::DomainActivation::OFF;
-    }
-    else if (lat_str == "true")
-    {
-        lateral = Controller::DomainActivation::ON;
-    }
-
-    if (long_str == "false")
-    {
-        longitudinal = Controller::DomainActivation::OFF;
-    }
-    else if (long_str == "true")
-    {
-        longitudinal = Controller::DomainActivation::ON;
-    }
+    Controller::DomainActivation lateral      = ReadDomainActivation(node, "lateral");
+    Controller::DomainActivation longitudinal = ReadDomainActivation(node, "longitudinal");
 
     ActivateControllerAction *activateControllerAction = new ActivateControllerAction(lateral, longitudinal);
 
@@ -2174,7 +2192,7 @@ int ScenarioReader::parseDynamicConstraints(pugi::xml_node dynamics_node, Dynami
         }
         else
         {
-            *values[i].variable = strtod(parameters.ReadAttribute(dynamics_node, values[i].label.c_str()));
+            *values[i].variable = parameters.ReadDouble(dynamics_node, values[i].label.c_str());
 
             if (*values[i].variable < SMALL_NUMBER)
             {
@@ -2228,10 +2246,9 @@ OSCPrivateAction *ScenarioReader::parseOSCPrivateAction(pugi::xml_node actionNod
                                 {
                                     LongSpeedAction::TargetRelative *target_rel = new LongSpeedAction::TargetRelative;
 
-                                    target_rel->value_ = strtod(parameters.ReadAttribute(targetChild, "value"));
+                                    target_rel->value_ = parameters.ReadDouble(targetChild, "value");
 
-                                    target_rel->continuous_ = (parameters.ReadAttribute(targetChild, "continuous") == "true" ||
-                                                               parameters.ReadAttribute(targetChild, "continuous") == "1");
+                                    target_rel->continuous_ = parameters.ReadBool(targetChild, "continuous");
 
                                     target_rel->object_ = ResolveObjectReference(parameters.ReadAttribute(targetChild, "entityRef"));
 
@@ -2259,7 +2276,7 @@ OSCPrivateAction *ScenarioReader::parseOSCPrivateAction(pugi::xml_node actionNod
                                 {
                                     LongSpeedAction::TargetAbsolute *target_abs = new LongSpeedAction::TargetAbsolute;
 
-                                    target_abs->value_ = strtod(parameters.ReadAttribute(targetChild, "value"));
+                                    target_abs->value_ = parameters.ReadDouble(targetChild, "value");
                                     action_speed->target_.reset(target_abs);
                                 }
                                 else
@@ -2282,20 +2299,11 @@ OSCPrivateAction *ScenarioReader::parseOSCPrivateAction(pugi::xml_node actionNod
                     }
                     else
                     {
-                        std::string str = parameters.ReadAttribute(longitudinalChild, "followingMode");
-                        if (str == "position")
-                        {
-                            action_speed_profile->following_mode_ = FollowingMode::POSITION;
-                        }
-                        else if (str == "follow")
-                        {
-                            action_speed_profile->following_mode_ = FollowingMode::FOLLOW;
-                        }
-                        else
-                        {
-                            LOG("Unsupported SpeedProfileAction followingMode value: %, set to position", str.c_str());
-                            action_speed_profile->following_mode_ = FollowingMode::POSITION;  // set as default
-                        }
+                        action_speed_profile->following_mode_ =
+                            parameters.ReadEnum(longitudinalChild,
+                                                "followingMode",
+                                                {{"position", FollowingMode::POSITION}, {"follow", FollowingMode::FOLLOW}},
+                                                FollowingMode::POSITION);  // set as default
                     }
 
                     for (pugi::xml_node child = longitudinalChild.first_child(); child; child = child.next_sibling())
@@ -2319,7 +2327,7 @@ OSCPrivateAction *ScenarioReader::parseOSCPrivateAction(pugi::xml_node actionNod
                             }
                             else
                             {
-                                entry.speed_ = strtod(parameters.ReadAttribute(child, "speed"));
+                                entry.speed_ = parameters.ReadDouble(child, "speed");
                             }
 
                             if (child.attribute("time").empty())
@@ -2328,7 +2336,7 @@ OSCPrivateAction *ScenarioReader::parseOSCPrivateAction(pugi::xml_node actionNod
                             }
                             else
                             {
-                                entry.time_ = strtod(parameters.ReadAttribute(child, "time"));
+                                entry.time_ = parameters.ReadDouble(child, "time");
                             }
 
                             action_speed_profile->entry_.push_back(entry);
@@ -2351,26 +2359,20 @@ OSCPrivateAction *ScenarioReader::parseOSCPrivateAction(pugi::xml_node actionNod
                     if (longitudinalChild.attribute("distance"))
                     {
                         action_dist->dist_type_ = LongDistanceAction::DistType::DISTANCE;
-                        action_dist->distance_  = strtod(parameters.ReadAttribute(longitudinalChild, "distance"));
+                        action_dist->distance_  = parameters.ReadDouble(longitudinalChild, "distance");
                     }
                     else if (longitudinalChild.attribute("timeGap"))
                     {
                         action_dist->dist_type_ = LongDistanceAction::DistType::TIME_GAP;
-                        action_dist->distance_  = strtod(parameters.ReadAttribute(longitudinalChild, "timeGap"));
+                        action_dist->distance_  = parameters.ReadDouble(longitudinalChild, "timeGap");
                     }
                     else
                     {
                         LOG("Need distance or timeGap");
                     }
 
-                    std::string continuous   = parameters.ReadAttribute(longitudinalChild, "continuous");
-                    action_dist->continuous_ = continuous == "true" ? true : false;
-
-                    std::string freespace = parameters.ReadAttribute(longitudinalChild, "freespace");
-                    if (freespace == "true" || freespace == "1")
-                        action_dist->freespace_ = true;
-                    else
-                        action_dist->freespace_ = false;
+                    action_dist->continuous_ = parameters.ReadBool(longitudinalChild, "continuous");
+                    action_dist->freespace_  = parameters.ReadBool(longitudinalChild, "freespace");
 
                     std::string displacement = parameters.ReadAttribute(longitudinalChild, "displacement");
                     if (GetVersionMajor() <= 1 && GetVersionMinor() >= 1)
@@ -2423,7 +2425,7 @@ OSCPrivateAction *ScenarioReader::parseOSCPrivateAction(pugi::xml_node actionNod
 
                     if (!lateralChild.attribute("targetLaneOffset").empty())
                     {
-                        action_lane->target_lane_offset_ = strtod(parameters.ReadAttribute(lateralChild, "targetLaneOffset"));
+                        action_lane->target_lane_offset_ = parameters.ReadDouble(lateralChild, "targetLaneOffset");
                     }
 
                     for (pugi::xml_node laneChangeChild = lateralChild.first_child(); laneChangeChild;
@@ -2448,14 +2450,14 @@ OSCPrivateAction *ScenarioReader::parseOSCPrivateAction(pugi::xml_node actionNod
                                         LOG("Failed to find object %s", parameters.ReadAttribute(targetChild, "entityRef").c_str());
                                         return 0;
                                     }
-                                    target_rel->value_ = strtoi(parameters.ReadAttribute(targetChild, "value"));
+                                    target_rel->value_ = parameters.ReadInt(targetChild, "value");
                                     target             = target_rel;
                                 }
                                 else if (targetChild.name() == std::string("AbsoluteTargetLane"))
                                 {
                                     LatLaneChangeAction::TargetAbsolute *target_abs = new LatLaneChangeAction::TargetAbsolute;
 
-                                    target_abs->value_ = strtoi(parameters.ReadAttribute(targetChild, "value"));
+                                    target_abs->value_ = parameters.ReadInt(targetChild, "value");
                                     target             = target_abs;
                                 }
                                 else
@@ -2480,9 +2482,9 @@ OSCPrivateAction *ScenarioReader::parseOSCPrivateAction(pugi::xml_node actionNod
                     {
                         if (laneOffsetChild.name() == std::string("LaneOffsetActionDynamics"))
                         {
-                            if (parameters.ReadAttribute(laneOffsetChild, "maxLateralAcc") != "")
+                            if (!laneOffsetChild.attribute("maxLateralAcc").empty())
                             {
-                                action_lane->max_lateral_acc_ = strtod(parameters.ReadAttribute(laneOffsetChild, "maxLateralAcc"));
+                                action_lane->max_lateral_acc_ = parameters.ReadDouble(laneOffsetChild, "maxLateralAcc");
                                 if (action_lane->max_lateral_acc_ < SMALL_NUMBER)
                                 {
                                     action_lane->max_lateral_acc_ = SMALL_NUMBER;
@@ -2505,14 +2507,14 @@ OSCPrivateAction *ScenarioReader::parseOSCPrivateAction(pugi::xml_node actionNod
                                     LatLaneOffsetAction::TargetRelative *target_rel = new LatLaneOffsetAction::TargetRelative;
 
                                     target_rel->object_ = ResolveObjectReference(parameters.ReadAttribute(targetChild, "entityRef"));
-                                    target_rel->value_  = strtod(parameters.ReadAttribute(targetChild, "value"));
+                                    target_rel->value_  = parameters.ReadDouble(targetChild, "value");
                                     target              = target_rel;
                                 }
                                 else if (targetChild.name() == std::string("AbsoluteTargetLaneOffset"))
                                 {
                                     LatLaneOffsetAction::TargetAbsolute *target_abs = new LatLaneOffsetAction::TargetAbsolute;
 
-                                    target_abs->value_ = strtod(parameters.ReadAttribute(targetChild, "value"));
+                                    target_abs->value_ = parameters.ReadDouble(targetChild, "value");
                                     target             = target_abs;
                                 }
                             }
@@ -2546,10 +2548,7 @@ OSCPrivateAction *ScenarioReader::parseOSCPrivateAction(pugi::xml_node actionNod
             }
             action_synch->target_position_master_OSCPosition_.reset(parseOSCPosition(target_position_master_node));
             action_synch->target_position_master_ = action_synch->target_position_master_OSCPosition_->GetRMPos();
-            if (parameters.ReadAttribute(actionChild, "targetToleranceMaster") != "")
-            {
-                action_synch->tolerance_master_ = strtod(parameters.ReadAttribute(actionChild, "targetToleranceMaster"));
-            }
+            action_synch->tolerance_master_ = parameters.ReadDouble(actionChild, "targetToleranceMaster", false, action_synch->tolerance_master_);
 
             pugi::xml_node target_position_node = actionChild.child("TargetPosition");
             if (!target_position_node)
@@ -2559,10 +2558,7 @@ OSCPrivateAction *ScenarioReader::parseOSCPrivateAction(pugi::xml_node actionNod
             }
             action_synch->target_position_OSCPosition_.reset(parseOSCPosition(target_position_node));
             action_synch->target_position_ = action_synch->target_position_OSCPosition_->GetRMPos();
-            if (parameters.ReadAttribute(actionChild, "targetTolerance") != "")
-            {
-                action_synch->tolerance_ = strtod(parameters.ReadAttribute(actionChild, "targetTolerance"));
-            }
+            action_synch->tolerance_ = parameters.ReadDouble(actionChild, "targetTolerance", false, action_synch->tolerance_);
 
             pugi::xml_node target_speed_node = actionChild.child("FinalSpeed");
             if (target_speed_node)
@@ -2576,14 +2572,14 @@ OSCPrivateAction *ScenarioReader::parseOSCPrivateAction(pugi::xml_node actionNod
                 if (!strcmp(final_speed_element.name(), "AbsoluteSpeed"))
                 {
                     LongSpeedAction::TargetAbsolute *targetSpeedAbs = new LongSpeedAction::TargetAbsolute;
-                    targetSpeedAbs->value_                          = strtod(parameters.ReadAttribute(final_speed_element, "value"));
+                    targetSpeedAbs->value_                          = parameters.ReadDouble(final_speed_element, "value");
                     action_synch->final_speed_.reset(targetSpeedAbs);
                 }
                 else if (!strcmp(final_speed_element.name(), "RelativeSpeedToMaster"))
                 {
                     LongSpeedAction::TargetRelative *targetSpeedRel = new LongSpeedAction::TargetRelative;
 
-                    targetSpeedRel->value_ = strtod(parameters.ReadAttribute(final_speed_element, "value"));
+                    targetSpeedRel->value_ = parameters.ReadDouble(final_speed_element, "value");
 
                     targetSpeedRel->continuous_ = true;  // Continuous adaption needed
 
@@ -2633,12 +2629,12 @@ OSCPrivateAction *ScenarioReader::parseOSCPrivateAction(pugi::xml_node actionNod
                     if (!strcmp(steady_state_node.name(), "TargetDistanceSteadyState"))
                     {
                         action_synch->steadyState_.type_ = SynchronizeAction::SteadyStateType::STEADY_STATE_DIST;
-                        action_synch->steadyState_.dist_ = strtod(parameters.ReadAttribute(steady_state_node, "distance"));
+                        action_synch->steadyState_.dist_ = parameters.ReadDouble(steady_state_node, "distance");
                     }
                     else if (!strcmp(steady_state_node.name(), "TargetTimeSteadyState"))
                     {
                         action_synch->steadyState_.type_ = SynchronizeAction::SteadyStateType::STEADY_STATE_TIME;
-                        action_synch->steadyState_.time_ = strtod(parameters.ReadAttribute(steady_state_node, "time"));
+                        action_synch->steadyState_.time_ = parameters.ReadDouble(steady_state_node, "time");
                     }
                     else if (!strcmp(steady_state_node.name(), "TargetPositionSteadyState"))
                     {
@@ -2723,7 +2719,7 @@ OSCPrivateAction *ScenarioReader::parseOSCPrivateAction(pugi::xml_node actionNod
 
                     if (!routingChild.attribute("initialDistanceOffset").empty())
                     {
-                        action_follow_trajectory->initialDistanceOffset_ = strtod(parameters.ReadAttribute(routingChild, "initialDistanceOffset"));
+                        action_follow_trajectory->initialDistanceOffset_ = parameters.ReadDouble(routingChild, "initialDistanceOffset");
                     }
                     else
                     {
@@ -2805,8 +2801,8 @@ OSCPrivateAction *ScenarioReader::parseOSCPrivateAction(pugi::xml_node actionNod
                                     throw std::runtime_error("Unexpected TimeDomain: " + timeDomain);
                                 }
 
-                                action_follow_trajectory->timing_scale_  = strtod(parameters.ReadAttribute(timingNode, "scale"));
-                                action_follow_trajectory->timing_offset_ = strtod(parameters.ReadAttribute(timingNode, "offset"));
+                                action_follow_trajectory->timing_scale_  = parameters.ReadDouble(timingNode, "scale");
+                                action_follow_trajectory->timing_offset_ = parameters.ReadDouble(timingNode, "offset");
                             }
                             else if (timingNode && std::string(timingNode.name()) == "None")
                             {
@@ -2920,28 +2916,8 @@ OSCPrivateAction *ScenarioReader::parseOSCPrivateAction(pugi::xml_node actionNod
                             controller_.push_back(controller);
                         }
 
-                        Controller::DomainActivation lateral      = Controller::DomainActivation::UNDEFINED;
-                        Controller::DomainActivation longitudinal = Controller::DomainActivation::UNDEFINED;
-                        std::string                  lat_str      = parameters.ReadAttribute(controllerDefNode, "lateral");
-                        std::string                  long_str     = parameters.ReadAttribute(controllerDefNode, "longitudinal");
-
-                        if (lat_str == "false")
-                        {
-                            lateral = Controller::DomainActivation::OFF;
-                        }
-                        else if (lat_str == "true")
-                        {
-                            lateral = Controller::DomainActivation::ON;
-                        }
-
-                        if (long_str == "false")
-                        {
-                            longitudinal = Controller::DomainActivation::OFF;
-                        }
-                        else if (long_str == "true")
-                        {
-                            longitudinal = Controller::DomainActivation::ON;
-                        }
+                        Controller::DomainActivation lateral      = ReadDomainActivation(controllerDefNode, "lateral");
+                        Controller::DomainActivation longitudinal = ReadDomainActivation(controllerDefNode, "longitudinal");
 
                         AssignControllerAction *assignControllerAction = new AssignControllerAction(controller, lateral, longitudinal);
 
@@ -2958,18 +2934,18 @@ OSCPrivateAction *ScenarioReader::parseOSCPrivateAction(pugi::xml_node actionNod
                          controllerDefNode                = controllerDefNode.next_sibling())
                     {
                         // read active flag
-                        overrideStatus.active = parameters.ReadAttribute(controllerDefNode, "active") == "true" ? true : false;
+                        overrideStatus.active = parameters.ReadBool(controllerDefNode, "active");
 
                         if (controllerDefNode.name() == std::string("Throttle"))
                         {
-                            double value         = strtod(parameters.ReadAttribute(controllerDefNode, "value"));
+                            double value         = parameters.ReadDouble(controllerDefNode, "value");
                             overrideStatus.type  = static_cast<int>(Object::OverrideType::OVERRIDE_THROTTLE);
                             overrideStatus.value = override_action->RangeCheckAndErrorLog(Object::OverrideType::OVERRIDE_THROTTLE, value);
 
                             // version 1.2 with throttle attribute
                             if ((verFromMinor2) && (!(controllerDefNode.attribute("maxRate").empty())))
                             {
-                                double maxRate         = strtod(parameters.ReadAttribute(controllerDefNode, "maxRate"));
+                                double maxRate         = parameters.ReadDouble(controllerDefNode, "maxRate");
                                 overrideStatus.maxRate = maxRate;
                             }
                         }
@@ -2981,7 +2957,7 @@ OSCPrivateAction *ScenarioReader::parseOSCPrivateAction(pugi::xml_node actionNod
                             if (brake_input_node.empty())
                             {
                                 // No BrakeInput child element
-                                double value         = strtod(parameters.ReadAttribute(controllerDefNode, "value"));
+                                double value         = parameters.ReadDouble(controllerDefNode, "value");
                                 overrideStatus.value = override_action->RangeCheckAndErrorLog(Object::OverrideType::OVERRIDE_BRAKE, value);
                                 if (verFromMinor2)
                                 {
@@ -2991,7 +2967,7 @@ OSCPrivateAction *ScenarioReader::parseOSCPrivateAction(pugi::xml_node actionNod
                             else
                             {
                                 // BrakeInput child element seems to be present
-                                double value = strtod(parameters.ReadAttribute(brake_input_node, "value"));
+                                double value = parameters.ReadDouble(brake_input_node, "value");
                                 if ((brake_input_node.name() == std::string("BrakeForce")))
                                 {
                                     overrideStatus.value_type = static_cast<int>(Object::OverrideBrakeType::Force);
@@ -3021,7 +2997,7 @@ OSCPrivateAction *ScenarioReader::parseOSCPrivateAction(pugi::xml_node actionNod
                                 // Check for optional maxRate attribute
                                 if (!brake_input_node.attribute("maxRate").empty())
                                 {
-                                    overrideStatus.maxRate = strtod(parameters.ReadAttribute(brake_input_node, "maxRate"));
+                                    overrideStatus.maxRate = parameters.ReadDouble(brake_input_node, "maxRate");
                                 }
 
                                 if (!verFromMinor2)
@@ -3034,14 +3010,14 @@ OSCPrivateAction *ScenarioReader::parseOSCPrivateAction(pugi::xml_node actionNod
                         }
                         else if (controllerDefNode.name() == std::string("Clutch"))
                         {
-                            double value         = strtod(parameters.ReadAttribute(controllerDefNode, "value"));
+                            double value         = parameters.ReadDouble(controllerDefNode, "value");
                             overrideStatus.type  = Object::OverrideType::OVERRIDE_CLUTCH;
                             overrideStatus.value = override_action->RangeCheckAndErrorLog(Object::OverrideType::OVERRIDE_CLUTCH, value);
 
                             // version 1.2 with clutch attribute
                             if ((verFromMinor2) && (!(controllerDefNode.attribute("maxRate").empty())))
                             {
-                                double maxRate         = strtod(parameters.ReadAttribute(controllerDefNode, "maxRate"));
+                                double maxRate         = parameters.ReadDouble(controllerDefNode, "maxRate");
                                 overrideStatus.maxRate = maxRate;
                             }
                         }
@@ -3053,7 +3029,7 @@ OSCPrivateAction *ScenarioReader::parseOSCPrivateAction(pugi::xml_node actionNod
                             if (parking_brake_input_node.empty())
                             {
                                 // No BrakeInput child element
-                                double value         = strtod(parameters.ReadAttribute(controllerDefNode, "value"));
+                                double value         = parameters.ReadDouble(controllerDefNode, "value");
                                 overrideStatus.value = override_action->RangeCheckAndErrorLog(Object::OverrideType::OVERRIDE_PARKING_BRAKE, value);
                                 if (verFromMinor2)
                                 {
@@ -3063,7 +3039,7 @@ OSCPrivateAction *ScenarioReader::parseOSCPrivateAction(pugi::xml_node actionNod
                             else
                             {
                                 // BrakeInput child element seems to be present
-                                double value = strtod(parameters.ReadAttribute(parking_brake_input_node, "value"));
+                                double value = parameters.ReadDouble(parking_brake_input_node, "value");
                                 if ((parking_brake_input_node.name() == std::string("BrakeForce")))
                                 {
                                     overrideStatus.value_type = static_cast<int>(Object::OverrideBrakeType::Force);
@@ -3094,7 +3070,7 @@ OSCPrivateAction *ScenarioReader::parseOSCPrivateAction(pugi::xml_node actionNod
                                 // Check for optional maxRate attribute
                                 if (!parking_brake_input_node.attribute("maxRate").empty())
                                 {
-                                    overrideStatus.maxRate = strtod(parameters.ReadAttribute(parking_brake_input_node, "maxRate"));
+                                    overrideStatus.maxRate = parameters.ReadDouble(parking_brake_input_node, "maxRate");
                                 }
 
                                 if (!verFromMinor2)
@@ -3108,20 +3084,20 @@ OSCPrivateAction *ScenarioReader::parseOSCPrivateAction(pugi::xml_node actionNod
 
                         else if (controllerDefNode.name() == std::string("SteeringWheel"))
                         {
-                            double value        = strtod(parameters.ReadAttribute(controllerDefNode, "value"));
+                            double value        = parameters.ReadDouble(controllerDefNode, "value");
                             overrideStatus.type = Object::OverrideType::OVERRIDE_STEERING_WHEEL;
                             overrideStatus.value =
                                 override_action->RangeCheckAndErrorLog(Object::OverrideType::OVERRIDE_STEERING_WHEEL, value, -2 * M_PI, 2 * M_PI);
                             // version 1.2 and steering maxRate attribute
                             if ((verFromMinor2) && (!(controllerDefNode.attribute("maxRate").empty())))
                             {
-                                double maxRate         = strtod(parameters.ReadAttribute(controllerDefNode, "maxRate"));
+                                double maxRate         = parameters.ReadDouble(controllerDefNode, "maxRate");
                                 overrideStatus.maxRate = maxRate;
                             }
                             // version 1.2 and steering maxTorque attribute
                             if ((verFromMinor2) && (!(controllerDefNode.attribute("maxTorque").empty())))
                             {
-                                double maxTorque         = strtod(parameters.ReadAttribute(controllerDefNode, "maxTorque"));
+                                double maxTorque         = parameters.ReadDouble(controllerDefNode, "maxTorque");
                                 overrideStatus.maxTorque = maxTorque;
                             }
                         }
@@ -3135,12 +3111,12 @@ OSCPrivateAction *ScenarioReader::parseOSCPrivateAction(pugi::xml_node actionNod
                                 if (!(controllerDefNode.attribute("number").empty()))  // version < 1.2 with number attribute
                                 {
                                     // Skip range check since valid range is [-inf, inf]
-                                    overrideStatus.number = static_cast<int>(strtod(parameters.ReadAttribute(controllerDefNode, "number")));
+                                    overrideStatus.number = static_cast<int>(parameters.ReadDouble(controllerDefNode, "number"));
                                 }
                                 else if (!(controllerDefNode.attribute("value").empty()))  // version 1.1.1 with value attribute
                                 {
                                     // Skip range check since valid range is [-inf, inf]
-                                    overrideStatus.number = static_cast<int>(strtod(parameters.ReadAttribute(controllerDefNode, "value")));
+                                    overrideStatus.number = static_cast<int>(parameters.ReadDouble(controllerDefNode, "value"));
                                     LOG("Unexpected Gear attribute name, change value to number, Accepting this time");
                                 }
                                 else
@@ -3189,7 +3165,7 @@ OSCPrivateAction *ScenarioReader::parseOSCPrivateAction(pugi::xml_node actionNod
                                 {
                                     overrideStatus.value_type = static_cast<int>(Object::OverrideGearType::Manual);
                                     // Skip range check since valid range is [-inf, inf]
-                                    overrideStatus.number = strtoi(parameters.ReadAttribute(controllerDefNode.first_child(), "number"));
+                                    overrideStatus.number = parameters.ReadInt(controllerDefNode.first_child(), "number");
                                 }
                                 else
                                 {
@@ -3396,133 +3372,52 @@ static OSCCondition::ConditionEdge ParseConditionEdge(std::string edge)
     return OSCCondition::ConditionEdge::UNDEFINED;
 }
 
-static Rule ParseRule(std::string rule)
+static Rule ParseRule(Parameters &parameters, pugi::xml_node node)
 {
-    if (rule == "greaterThan")
-    {
-        return Rule::GREATER_THAN;
-    }
-    else if (rule == "greaterOrEqual")
-    {
-        return Rule::GREATER_OR_EQUAL;
-    }
-    else if (rule == "lessThan")
-    {
-        return Rule::LESS_THAN;
-    }
-    else if (rule == "lessOrEqual")
-    {
-        return Rule::LESS_OR_EQUAL;
-    }
-    else if (rule == "equalTo")
-    {
-        return Rule::EQUAL_TO;
-    }
-    else if (rule == "notEqualTo")
-    {
-        return Rule::NOT_EQUAL_TO;
-    }
-    else
-    {
-        LOG("Invalid or missing rule %s", rule.c_str());
-    }
-
-    return Rule::UNDEFINED_RULE;
+    return parameters.ReadEnum(node,
+                               "rule",
+                               {{"greaterThan", Rule::GREATER_THAN},
+                                {"greaterOrEqual", Rule::GREATER_OR_EQUAL},
+                                {"lessThan", Rule::LESS_THAN},
+                                {"lessOrEqual", Rule::LESS_OR_EQUAL},
+                                {"equalTo", Rule::EQUAL_TO},
+                                {"notEqualTo", Rule::NOT_EQUAL_TO}},
+                               Rule::UNDEFINED_RULE);
 }
 
-static Direction ParseDirection(std::string direction)
+static Direction ParseDirection(Parameters &parameters, pugi::xml_node node)
 {
-    if (direction == "longitudinal")
-    {
-        return Direction::LONGITUDINAL;
-    }
-    else if (direction == "lateral")
-    {
-        return Direction::LATERAL;
-    }
-    else if (direction == "vertical")
-    {
-        return Direction::VERTICAL;
-    }
-    else
-    {
-        LOG("Invalid or missing direction %s", direction.c_str());
-        return Direction::UNDEFINED_DIRECTION;
-    }
-
-    return Direction::UNDEFINED_DIRECTION;
+    return parameters.ReadEnum(node,
+                               "direction",
+                               {{"longitudinal", Direction::LONGITUDINAL}, {"lateral", Direction::LATERAL}, {"vertical", Direction::VERTICAL}},
+                               Direction::UNDEFINED_DIRECTION);
 }
 
-static TrigByState::CondElementState ParseState(std::string state)
+static TrigByState::CondElementState ParseState(Parameters &parameters, pugi::xml_node node)
 {
-    if (state == "startTransition")
-    {
-        return TrigByState::CondElementState::START_TRANSITION;
-    }
-    else if (state == "endTransition")
-    {
-        return TrigByState::CondElementState::END_TRANSITION;
-    }
-    else if (state == "stopTransition")
-    {
-        return TrigByState::CondElementState::STOP_TRANSITION;
-    }
-    else if (state == "skipTransition")
-    {
-        return TrigByState::CondElementState::SKIP_TRANSITION;
-    }
-    else if (state == "completeState")
-    {
-        return TrigByState::CondElementState::COMPLETE;
-    }
-    else if (state == "runningState")
-    {
-        return TrigByState::CondElementState::RUNNING;
-    }
-    else if (state == "standbyState")
-    {
-        return TrigByState::CondElementState::STANDBY;
-    }
-    else
-    {
-        LOG("Invalid state %s", state.c_str());
-    }
-
-    return TrigByState::CondElementState::UNDEFINED_ELEMENT_STATE;
+    return parameters.ReadEnum(node,
+                               "state",
+                               {{"startTransition", TrigByState::CondElementState::START_TRANSITION},
+                                {"endTransition", TrigByState::CondElementState::END_TRANSITION},
+                                {"stopTransition", TrigByState::CondElementState::STOP_TRANSITION},
+                                {"skipTransition", TrigByState::CondElementState::SKIP_TRANSITION},
+                                {"completeState", TrigByState::CondElementState::COMPLETE},
+                                {"runningState", TrigByState::CondElementState::RUNNING},
+                                {"standbyState", TrigByState::CondElementState::STANDBY}},
+                               TrigByState::CondElementState::UNDEFINED_ELEMENT_STATE);
 }
 
-static StoryBoardElement::ElementType ParseElementType(std::string element_type)
+static StoryBoardElement::ElementType ParseElementType(Parameters &parameters, pugi::xml_node node)
 {
-    if (element_type == "story")
-    {
-        return StoryBoardElement::ElementType::STORY;
-    }
-    else if (element_type == "act")
-    {
-        return StoryBoardElement::ElementType::ACT;
-    }
-    else if (element_type == "maneuver")
-    {
-        return StoryBoardElement::ElementType::MANEUVER;
-    }
-    else if (element_type == "maneuverGroup")
-    {
-        return StoryBoardElement::ElementType::MANEUVER_GROUP;
-    }
-    else if (element_type == "event")
-    {
-        return StoryBoardElement::ElementType::EVENT;
-    }
-    else if (element_type == "action")
-    {
-        return StoryBoardElement::ElementType::ACTION;
-    }
-    else
-    {
-        LOG("Invalid or unsupported element type %s", element_type.c_str());
-    }
-
-    return StoryBoardElement::ElementType::UNDEFINED_ELEMENT_TYPE;
+    return parameters.ReadEnum(node,
+                               "storyboardElementType",
+                               {{"story", StoryBoardElement::ElementType::STORY},
+                                {"act", StoryBoardElement::ElementType::ACT},
+                                {"maneuver", StoryBoardElement::ElementType::MANEUVER},
+                                {"maneuverGroup", StoryBoardElement::ElementType::MANEUVER_GROUP},
+                                {"event", StoryBoardElement::ElementType::EVENT},
+                                {"action", StoryBoardElement::ElementType::ACTION}},
+                               StoryBoardElement::ElementType::UNDEFINED_ELEMENT_TYPE);
 }
 // ------------------------------------------
 OSCCondition *ScenarioReader::parseOSCCondition(pugi::xml_node conditionNode)
@@ -3551,15 +3446,7 @@ OSCCondition *ScenarioReader::parseOSCCondition(pugi::xml_node conditionNode)
                         TrigByTimeHeadway *trigger = new TrigByTimeHeadway;
                         trigger->object_           = ResolveObjectReference(parameters.ReadAttribute(condition_node, "entityRef"));
 
-                        std::string freespace_str = parameters.ReadAttribute(condition_node, "freespace");
-                        if ((freespace_str == "true") || (freespace_str == "1"))
-                        {
-                            trigger->freespace_ = true;
-                        }
-                        else
-                        {
-                            trigger->freespace_ = false;
-                        }
+                        trigger->freespace_ = parameters.ReadBool(condition_node, "freespace");
 
                         trigger->cs_          = ParseCoordinateSystem(condition_node, roadmanager::CoordinateSystem::CS_UNDEFINED);
                         trigger->relDistType_ = ParseRelativeDistanceType(condition_node, roadmanager::RelativeDistanceType::REL_DIST_UNDEFINED);
@@ -3568,14 +3455,13 @@ OSCCondition *ScenarioReader::parseOSCCondition(pugi::xml_node conditionNode)
                             trigger->relDistType_ == roadmanager::RelativeDistanceType::REL_DIST_UNDEFINED)
                         {
                             // look for v1.0 attribute alongroute
-                            std::string along_route_str = parameters.ReadAttribute(condition_node, "alongRoute");
-                            if (!along_route_str.empty())
+                            if (!condition_node.attribute("alongRoute").empty())
                             {
                                 if (GetVersionMajor() == 1 && GetVersionMinor() == 1)
                                 {
                                     LOG("alongRoute attribute is depricated from v1.1. Reading it anyway.");
                                 }
-                                if ((along_route_str == "true") || (along_route_str == "1"))
+                                if (parameters.ReadBool(condition_node, "alongRoute"))
                                 {
                                     trigger->cs_ = roadmanager::CoordinateSystem::CS_ROAD;
                                 }
@@ -3594,8 +3480,8 @@ OSCCondition *ScenarioReader::parseOSCCondition(pugi::xml_node conditionNode)
                             trigger->relDistType_ = roadmanager::RelativeDistanceType::REL_DIST_EUCLIDIAN;
                         }
 
-                        trigger->value_ = strtod(parameters.ReadAttribute(condition_node, "value"));
-                        trigger->rule_  = ParseRule(parameters.ReadAttribute(condition_node, "rule"));
+                        trigger->value_ = parameters.ReadDouble(condition_node, "value");
+                        trigger->rule_  = ParseRule(parameters, condition_node);
 
                         condition = trigger;
                     }
@@ -3620,15 +3506,7 @@ OSCCondition *ScenarioReader::parseOSCCondition(pugi::xml_node conditionNode)
                             return 0;
                         }
 
-                        std::string freespace_str = parameters.ReadAttribute(condition_node, "freespace");
-                        if ((freespace_str == "true") || (freespace_str == "1"))
-                        {
-                            trigger->freespace_ = true;
-                        }
-                        else
-                        {
-                            trigger->freespace_ = false;
-                        }
+                        trigger->freespace_ = parameters.ReadBool(condition_node, "freespace");
 
                         trigger->cs_          = ParseCoordinateSystem(condition_node, roadmanager::CoordinateSystem::CS_UNDEFINED);
                         trigger->relDistType_ = ParseRelativeDistanceType(condition_node, roadmanager::RelativeDistanceType::REL_DIST_UNDEFINED);
@@ -3637,14 +3515,13 @@ OSCCondition *ScenarioReader::parseOSCCondition(pugi::xml_node conditionNode)
                             trigger->relDistType_ == roadmanager::RelativeDistanceType::REL_DIST_UNDEFINED)
                         {
                             // look for v1.0 attribute alongroute
-                            std::string along_route_str = parameters.ReadAttribute(condition_node, "alongRoute");
-                            if (!along_route_str.empty())
+                            if (!condition_node.attribute("alongRoute").empty())
                             {
                                 if (GetVersionMajor() == 1 && GetVersionMinor() == 1)
                                 {
                                     LOG("alongRoute attribute is depricated from v1.1. Reading it anyway.");
                                 }
-                                if ((along_route_str == "true") || (along_route_str == "1"))
+                                if (parameters.ReadBool(condition_node, "alongRoute"))
                                 {
                                     trigger->cs_ = roadmanager::CoordinateSystem::CS_ROAD;
                                 }
@@ -3663,8 +3540,8 @@ OSCCondition *ScenarioReader::parseOSCCondition(pugi::xml_node conditionNode)
                             trigger->relDistType_ = roadmanager::RelativeDistanceType::REL_DIST_EUCLIDIAN;
                         }
 
-                        trigger->value_ = strtod(parameters.ReadAttribute(condition_node, "value"));
-                        trigger->rule_  = ParseRule(parameters.ReadAttribute(condition_node, "rule"));
+                        trigger->value_ = parameters.ReadDouble(condition_node, "value");
+                        trigger->rule_  = ParseRule(parameters, condition_node);
 
                         condition = trigger;
                     }
@@ -3672,7 +3549,7 @@ OSCCondition *ScenarioReader::parseOSCCondition(pugi::xml_node conditionNode)
                     {
                         TrigByReachPosition *trigger = new TrigByReachPosition;
 
-                        trigger->tolerance_ = strtod(parameters.ReadAttribute(condition_node, "tolerance", true));
+                        trigger->tolerance_ = parameters.ReadDouble(condition_node, "tolerance", true);
 
                         // Read position
                         pugi::xml_node pos_node = condition_node.child("Position");
@@ -3689,20 +3566,12 @@ OSCCondition *ScenarioReader::parseOSCCondition(pugi::xml_node conditionNode)
                         TrigByRelativeDistance *trigger = new TrigByRelativeDistance;
                         trigger->object_                = ResolveObjectReference(parameters.ReadAttribute(condition_node, "entityRef"));
 
-                        std::string freespace_str = parameters.ReadAttribute(condition_node, "freespace");
-                        if ((freespace_str == "true") || (freespace_str == "1"))
-                        {
-                            trigger->freespace_ = true;
-                        }
-                        else
-                        {
-                            trigger->freespace_ = false;
-                        }
+                        trigger->freespace_ = parameters.ReadBool(condition_node, "freespace");
 
                         trigger->cs_          = ParseCoordinateSystem(condition_node, roadmanager::CoordinateSystem::CS_ENTITY);
                         trigger->relDistType_ = ParseRelativeDistanceType(condition_node, roadmanager::RelativeDistanceType::REL_DIST_EUCLIDIAN);
-                        trigger->value_       = strtod(parameters.ReadAttribute(condition_node, "value"));
-                        trigger->rule_        = ParseRule(parameters.ReadAttribute(condition_node, "rule"));
+                        trigger->value_       = parameters.ReadDouble(condition_node, "value");
+                        trigger->rule_        = ParseRule(parameters, condition_node);
 
                         condition = trigger;
                     }
@@ -3749,15 +3618,7 @@ OSCCondition *ScenarioReader::parseOSCCondition(pugi::xml_node conditionNode)
 
                         trigger->position_.reset(parseOSCPosition(pos_node));
 
-                        std::string freespace_str = parameters.ReadAttribute(condition_node, "freespace");
-                        if ((freespace_str == "true") || (freespace_str == "1"))
-                        {
-                            trigger->freespace_ = true;
-                        }
-                        else
-                        {
-                            trigger->freespace_ = false;
-                        }
+                        trigger->freespace_ = parameters.ReadBool(condition_node, "freespace");
 
                         trigger->cs_          = ParseCoordinateSystem(condition_node, roadmanager::CoordinateSystem::CS_UNDEFINED);
                         trigger->relDistType_ = ParseRelativeDistanceType(condition_node, roadmanager::RelativeDistanceType::REL_DIST_UNDEFINED);
@@ -3766,14 +3627,13 @@ OSCCondition *ScenarioReader::parseOSCCondition(pugi::xml_node conditionNode)
                             trigger->relDistType_ == roadmanager::RelativeDistanceType::REL_DIST_UNDEFINED)
                         {
                             // look for v1.0 attribute alongroute
-                            std::string along_route_str = parameters.ReadAttribute(condition_node, "alongRoute");
-                            if (!along_route_str.empty())
+                            if (!condition_node.attribute("alongRoute").empty())
                             {
                                 if (GetVersionMajor() == 1 && GetVersionMinor() == 1)
                                 {
                                     LOG("alongRoute attribute is depricated from v1.1. Reading it anyway.");
                                 }
-                                if ((along_route_str == "true") || (along_route_str == "1"))
+                                if (parameters.ReadBool(condition_node, "alongRoute"))
                                 {
                                     trigger->cs_ = roadmanager::CoordinateSystem::CS_ROAD;
                                 }
@@ -3792,8 +3652,8 @@ OSCCondition *ScenarioReader::parseOSCCondition(pugi::xml_node conditionNode)
                             trigger->relDistType_ = roadmanager::RelativeDistanceType::REL_DIST_EUCLIDIAN;
                         }
 
-                        trigger->value_ = strtod(parameters.ReadAttribute(condition_node, "value"));
-                        trigger->rule_  = ParseRule(parameters.ReadAttribute(condition_node, "rule"));
+                        trigger->value_ = parameters.ReadDouble(condition_node, "value");
+                        trigger->rule_  = ParseRule(parameters, condition_node);
 
                         condition = trigger;
                     }
@@ -3801,7 +3661,7 @@ OSCCondition *ScenarioReader::parseOSCCondition(pugi::xml_node conditionNode)
                     {
                         TrigByTraveledDistance *trigger = new TrigByTraveledDistance;
 
-                        trigger->value_ = strtod(parameters.ReadAttribute(condition_node, "value"));
+                        trigger->value_ = parameters.ReadDouble(condition_node, "value");
 
                         condition = trigger;
                     }
@@ -3809,7 +3669,7 @@ OSCCondition *ScenarioReader::parseOSCCondition(pugi::xml_node conditionNode)
                     {
                         TrigByEndOfRoad *trigger = new TrigByEndOfRoad;
 
-                        trigger->duration_ = strtod(parameters.ReadAttribute(condition_node, "duration"));
+                        trigger->duration_ = parameters.ReadDouble(condition_node, "duration");
 
                         condition = trigger;
                     }
@@ -3817,7 +3677,7 @@ OSCCondition *ScenarioReader::parseOSCCondition(pugi::xml_node conditionNode)
                     {
                         TrigByOffRoad *trigger = new TrigByOffRoad;
 
-                        trigger->duration_ = strtod(parameters.ReadAttribute(condition_node, "duration"));
+                        trigger->duration_ = parameters.ReadDouble(condition_node, "duration");
 
                         condition = trigger;
                     }
@@ -3825,7 +3685,7 @@ OSCCondition *ScenarioReader::parseOSCCondition(pugi::xml_node conditionNode)
                     {
                         TrigByStandStill *trigger = new TrigByStandStill;
 
-                        trigger->duration_ = strtod(parameters.ReadAttribute(condition_node, "duration"));
+                        trigger->duration_ = parameters.ReadDouble(condition_node, "duration");
 
                         condition = trigger;
                     }
@@ -3833,11 +3693,11 @@ OSCCondition *ScenarioReader::parseOSCCondition(pugi::xml_node conditionNode)
                     {
                         TrigByAcceleration *trigger = new TrigByAcceleration;
 
-                        trigger->value_ = strtod(parameters.ReadAttribute(condition_node, "value"));
-                        trigger->rule_  = ParseRule(parameters.ReadAttribute(condition_node, "rule"));
+                        trigger->value_ = parameters.ReadDouble(condition_node, "value");
+                        trigger->rule_  = ParseRule(parameters, condition_node);
                         if (!condition_node.attribute("direction").empty())
                         {
-                            trigger->direction_ = ParseDirection(parameters.ReadAttribute(condition_node, "direction"));
+                            trigger->direction_ = ParseDirection(parameters, condition_node);
                         }
 
                         condition = trigger;
@@ -3846,11 +3706,11 @@ OSCCondition *ScenarioReader::parseOSCCondition(pugi::xml_node conditionNode)
                     {
                         TrigBySpeed *trigger = new TrigBySpeed;
 
-                        trigger->value_ = strtod(parameters.ReadAttribute(condition_node, "value"));
-                        trigger->rule_  = ParseRule(parameters.ReadAttribute(condition_node, "rule"));
+                        trigger->value_ = parameters.ReadDouble(condition_node, "value");
+                        trigger->rule_  = ParseRule(parameters, condition_node);
                         if (!condition_node.attribute("direction").empty())
                         {
-                            trigger->direction_ = ParseDirection(parameters.ReadAttribute(condition_node, "direction"));
+                            trigger->direction_ = ParseDirection(parameters, condition_node);
                         }
 
                         condition = trigger;
@@ -3860,24 +3720,22 @@ OSCCondition *ScenarioReader::parseOSCCondition(pugi::xml_node conditionNode)
                         TrigByRelativeSpeed *trigger = new TrigByRelativeSpeed;
 
                         trigger->object_ = ResolveObjectReference(parameters.ReadAttribute(condition_node, "entityRef"));
-                        trigger->value_  = strtod(parameters.ReadAttribute(condition_node, "value"));
-                        trigger->rule_   = ParseRule(parameters.ReadAttribute(condition_node, "rule"));
+                        trigger->value_  = parameters.ReadDouble(condition_node, "value");
+                        trigger->rule_   = ParseRule(parameters, condition_node);
                         if (!condition_node.attribute("direction").empty())
                         {
-                            trigger->direction_ = ParseDirection(parameters.ReadAttribute(condition_node, "direction"));
+                            trigger->direction_ = ParseDirection(parameters, condition_node);
                         }
 
                         condition = trigger;
                     }
                     else if (condition_type == "RelativeClearanceCondition")
                     {
-                        std::string strTemp;
-
                         TrigByRelativeClearance *trigger = new TrigByRelativeClearance;
 
-                        if (!parameters.ReadAttribute(condition_node, "distanceForward").empty())
+                        if (!condition_node.attribute("distanceForward").empty())
                         {  // populate only if available else use default
-                            trigger->distanceForward_ = strtod(parameters.ReadAttribute(condition_node, "distanceForward"));
+                            trigger->distanceForward_ = parameters.ReadDouble(condition_node, "distanceForward");
                             if (trigger->distanceForward_ < 0)
                             {
                                 trigger->distanceForward_ = abs(trigger->distanceForward_);
@@ -3885,9 +3743,9 @@ OSCCondition *ScenarioReader::parseOSCCondition(pugi::xml_node conditionNode)
                             }
                         }
 
-                        if (!parameters.ReadAttribute(condition_node, "distanceBackward").empty())
+                        if (!condition_node.attribute("distanceBackward").empty())
                         {  // populate only if available else use default
-                            trigger->distanceBackward_ = strtod(parameters.ReadAttribute(condition_node, "distanceBackward"));
+                            trigger->distanceBackward_ = parameters.ReadDouble(condition_node, "distanceBackward");
                             if (trigger->distanceBackward_ < 0)
                             {
                                 trigger->distanceBackward_ = abs(trigger->distanceBackward_);
@@ -3895,25 +3753,22 @@ OSCCondition *ScenarioReader::parseOSCCondition(pugi::xml_node conditionNode)
                             }
                         }
 
-                        if (!parameters.ReadAttribute(condition_node, "freeSpace").empty())
+                        if (!condition_node.attribute("freeSpace").empty())
                         {
-                            strTemp             = parameters.ReadAttribute(condition_node, "freeSpace");
-                            trigger->freeSpace_ = strTemp == "true" ? true : false;
+                            trigger->freeSpace_ = parameters.ReadBool(condition_node, "freeSpace");
                         }
-                        else if (!parameters.ReadAttribute(condition_node, "freespace").empty())
+                        else if (!condition_node.attribute("freespace").empty())
                         {
-                            strTemp             = parameters.ReadAttribute(condition_node, "freespace");
-                            trigger->freeSpace_ = strTemp == "true" ? true : false;
+                            trigger->freeSpace_ = parameters.ReadBool(condition_node, "freespace");
                         }
                         else
                         {  // Provide warring and use default value
                             LOG("FreeSpace is mandatory attribute in RelativeClearanceCondition. Anyway setting it false");
                         }
 
-                        if (!parameters.ReadAttribute(condition_node, "oppositeLanes").empty())
+                        if (!condition_node.attribute("oppositeLanes").empty())
                         {
-                            strTemp                 = parameters.ReadAttribute(condition_node, "oppositeLanes");
-                            trigger->oppositeLanes_ = strTemp == "true" ? true : false;
+                            trigger->oppositeLanes_ = parameters.ReadBool(condition_node, "oppositeLanes");
                         }
                         else
                         {  // Provide warring and use default value
@@ -3931,15 +3786,9 @@ OSCCondition *ScenarioReader::parseOSCCondition(pugi::xml_node conditionNode)
                             }
                             else if (std::strcmp(relClearanceChild.name(), "RelativeLaneRange") == 0)
                             {
-                                if (!parameters.ReadAttribute(relClearanceChild, "to").empty())
-                                {  // populate only if available else use default
-                                    trigger->to_ = strtoi(parameters.ReadAttribute(relClearanceChild, "to"));
-                                }
-
-                                if (!parameters.ReadAttribute(relClearanceChild, "from").empty())
-                                {  // populate only if available else use default
-                                    trigger->from_ = strtoi(parameters.ReadAttribute(relClearanceChild, "from"));
-                                }
+                                // populate only if available else use default
+                                trigger->to_   = parameters.ReadInt(relClearanceChild, "to", false, trigger->to_);
+                                trigger->from_ = parameters.ReadInt(relClearanceChild, "from", false, trigger->from_);
                             }
                             else
                             {
@@ -3961,19 +3810,11 @@ OSCCondition *ScenarioReader::parseOSCCondition(pugi::xml_node conditionNode)
             {
                 TrigByEntity *trigger = static_cast<TrigByEntity *>(condition);
 
-                std::string trig_ent_rule = parameters.ReadAttribute(triggering_entities, "triggeringEntitiesRule");
-                if (trig_ent_rule == "any")
-                {
-                    trigger->triggering_entity_rule_ = TrigByEntity::TriggeringEntitiesRule::ANY;
-                }
-                else if (trig_ent_rule == "all")
-                {
-                    trigger->triggering_entity_rule_ = TrigByEntity::TriggeringEntitiesRule::ALL;
-                }
-                else
-                {
-                    LOG("Invalid triggering entity type: %s", trig_ent_rule.c_str());
-                }
+                trigger->triggering_entity_rule_ =
+                    parameters.ReadEnum(triggering_entities,
+                                        "triggeringEntitiesRule",
+                                        {{"any", TrigByEntity::TriggeringEntitiesRule::ANY}, {"all", TrigByEntity::TriggeringEntitiesRule::ALL}},
+                                        TrigByEntity::TriggeringEntitiesRule::ANY);
 
                 for (pugi::xml_node triggeringEntitiesChild = triggering_entities.first_child(); triggeringEntitiesChild;
                      triggeringEntitiesChild                = triggeringEntitiesChild.next_sibling())
@@ -4005,8 +3846,8 @@ OSCCondition *ScenarioReader::parseOSCCondition(pugi::xml_node conditionNode)
                 if (condition_type == "SimulationTimeCondition")
                 {
                     TrigBySimulationTime *trigger = new TrigBySimulationTime;
-                    trigger->value_               = strtod(parameters.ReadAttribute(byValueChild, "value"));
-                    trigger->rule_                = ParseRule(parameters.ReadAttribute(byValueChild, "rule"));
+                    trigger->value_               = parameters.ReadDouble(byValueChild, "value");
+                    trigger->rule_                = ParseRule(parameters, byValueChild);
                     condition                     = trigger;
                 }
                 else if (condition_type == "ParameterCondition")
@@ -4014,7 +3855,7 @@ OSCCondition *ScenarioReader::parseOSCCondition(pugi::xml_node conditionNode)
                     TrigByParameter *trigger = new TrigByParameter;
                     trigger->name_           = parameters.ReadAttribute(byValueChild, "parameterRef");
                     trigger->value_          = parameters.ReadAttribute(byValueChild, "value");
-                    trigger->rule_           = ParseRule(parameters.ReadAttribute(byValueChild, "rule"));
+                    trigger->rule_           = ParseRule(parameters, byValueChild);
                     trigger->parameters_     = &parameters;
                     condition                = trigger;
                 }
@@ -4023,17 +3864,18 @@ OSCCondition *ScenarioReader::parseOSCCondition(pugi::xml_node conditionNode)
                     TrigByVariable *trigger = new TrigByVariable;
                     trigger->name_          = variables.ReadAttribute(byValueChild, "variableRef");
                     trigger->value_         = variables.ReadAttribute(byValueChild, "value");
-                    trigger->rule_          = ParseRule(variables.ReadAttribute(byValueChild, "rule"));
+                    trigger->rule_          = ParseRule(variables, byValueChild);
                     trigger->variables_     = &variables;
                     condition               = trigger;
                 }
                 else if (condition_type == "StoryboardElementStateCondition")
                 {
-                    StoryBoardElement::ElementType element_type = ParseElementType(parameters.ReadAttribute(byValueChild, "storyboardElementType"));
-                    TrigByState::CondElementState  state        = ParseState(parameters.ReadAttribute(byValueChild, "state"));
+                    StoryBoardElement::ElementType element_type = ParseElementType(parameters, byValueChild);
+                    TrigByState::CondElementState  state        = ParseState(parameters, byValueChild);
                     std::string                    element_name = parameters.ReadAttribute(byValueChild, "storyboardElementRef");
 
                     TrigByState *trigger = new TrigByState(state, element_type, element_name);
+                    state_conditions_.push_back(trigger);
 
                     condition = trigger;
                 }
@@ -4063,7 +3905,7 @@ OSCCondition *ScenarioReader::parseOSCCondition(pugi::xml_node conditionNode)
 
     if (conditionNode.attribute("delay") != NULL)
     {
-        condition->delay_ = strtod(parameters.ReadAttribute(conditionNode, "delay"));
+        condition->delay_ = parameters.ReadDouble(conditionNode, "delay");
     }
     else
     {
@@ -4154,14 +3996,7 @@ void ScenarioReader::parseOSCManeuver(Maneuver *maneuver, pugi::xml_node maneuve
                 LOG("Invalid priority: %s", prio.c_str());
             }
 
-            if (parameters.ReadAttribute(maneuverChild, "maximumExecutionCount") != "")
-            {
-                event->max_num_executions_ = strtoi(parameters.ReadAttribute(maneuverChild, "maximumExecutionCount"));
-            }
-            else
-            {
-                event->max_num_executions_ = 1;  // 1 is default
-            }
+            event->max_num_executions_ = parameters.ReadInt(maneuverChild, "maximumExecutionCount", false, 1);  // 1 is default
 
             for (pugi::xml_node eventChild = maneuverChild.first_child(); eventChild; eventChild = eventChild.next_sibling())
             {
@@ -4289,14 +4124,7 @@ int ScenarioReader::parseStoryBoard(StoryBoard &storyBoard)
                         {
                             ManeuverGroup *mGroup = new ManeuverGroup;
 
-                            if (parameters.ReadAttribute(actChild, "maximumExecutionCount") != "")
-                            {
-                                mGroup->max_num_executions_ = strtoi(parameters.ReadAttribute(actChild, "maximumExecutionCount"));
-                            }
-                            else
-                            {
-                                mGroup->max_num_executions_ = 1;  // 1 is Default
-                            }
+                            mGroup->max_num_executions_ = parameters.ReadInt(actChild, "maximumExecutionCount", false, 1);  // 1 is Default
 
                             mGroup->name_ = parameters.ReadAttribute(actChild, "name");
 
@@ -4385,6 +4213,13 @@ int ScenarioReader::parseStoryBoard(StoryBoard &storyBoard)
         }
     }
 
+    // All storyboard elements are now created, resolve any state condition references
+    for (size_t i = 0; i < state_conditions_.size(); i++)
+    {
+        state_conditions_[i]->ResolveElement(&storyBoard);
+    }
+    state_conditions_.clear();
+
     // Log parameter declarations
     parameters.Print("parameters");
 
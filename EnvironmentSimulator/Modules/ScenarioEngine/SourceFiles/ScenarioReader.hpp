@@ -85,6 +85,7 @@ namespace scenarioengine
 
         // RoadNetwork
         void                       parseRoadNetwork(RoadNetwork& roadNetwork);
+        void                       parseTrafficSignalControllers(roadmanager::SignalStateRegistry& registry);
         void                       parseOSCFile(OSCFile& file, pugi::xml_node fileNode);
         roadmanager::RMTrajectory* parseTrajectory(pugi::xml_node node);
 
@@ -100,6 +101,7 @@ namespace scenarioengine
         void                              ParseOSCProperties(OSCProperties& properties, pugi::xml_node& xml_node);
         roadmanager::CoordinateSystem     ParseCoordinateSystem(pugi::xml_node node, roadmanager::CoordinateSystem defaultValue);
         roadmanager::RelativeDistanceType ParseRelativeDistanceType(pugi::xml_node node, roadmanager::RelativeDistanceType defaultValue);
+        Controller::DomainActivation      ReadDomainActivation(pugi::xml_node node, const char* attribute);
         void                              ParseOSCBoundingBox(OSCBoundingBox& boundingbox, pugi::xml_node& xml_node);
         Vehicle*                          parseOSCVehicle(pugi::xml_node vehicleNode);
         Pedestrian*                       parseOSCPedestrian(pugi::xml_node pedestrianNode);
@@ -191,6 +193,9 @@ namespace scenarioengine
         int                   versionMinor_;
         std::string           description_;
 
+        // State conditions to be resolved once all storyboard elements are created
+        std::vector<TrigByState*> state_conditions_;
+
         int             ParseTransitionDynamics(pugi::xml_node node, OSCPrivateAction::TransitionDynamics& td);
         ConditionGroup* ParseConditionGroup(pugi::xml_node node);
         Object*         ResolveObjectReference(std::string name);
@@ -46,15 +46,10 @@ osg::ref_ptr<osg::Texture2D> RoadGeom::ReadTexture(std::string filename)
         file_name_candidates.push_back(CombineDirectoryPathAndFilepath(SE_Env::Inst().GetPaths()[i], "../models/" + filename));
         file_name_candidates.push_back(CombineDirectoryPathAndFilepath(SE_Env::Inst().GetPaths()[i], FileNameOf(filename)));
     }
-    for (size_t i = 0; i < file_name_candidates.size(); i++)
+    std::string path = SE_Env::Inst().LocateFile(file_name_candidates);
+    if (!path.empty())
     {
-        if (FileExists(file_name_candidates[i].c_str()))
-        {
-            if (img = osgDB::readImageFile(file_name_candidates[i].c_str()))
-            {
-                break;
-            }
-        }
+        img = osgDB::readImageFile(path.c_str());
     }
 
     if (img)
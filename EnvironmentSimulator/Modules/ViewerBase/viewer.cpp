@@ -653,137 +653,113 @@ OSISensorDetection::~OSISensorDetection()
 
 void OSISensorDetection::Update(osi3::SensorView* sv)
 {
-    // lets find the detected objects that are still under the radar FOV
-    if (sv)
+    if (sv == nullptr)
     {
-        bool found = false;
-        for (auto point : detected_points_)
-        {
-            for (int i = 0; i < sv->global_ground_truth().lane_boundary_size(); ++i)
-            {
-                for (int j = 0; j < sv->global_ground_truth().lane_boundary()[i].boundary_line_size(); ++j)
-                {
-                    // lets see the lane boundary ID and check if detected points map are in the sensor view
-                    std::string str_id = std::to_string(sv->global_ground_truth().lane_boundary()[i].id().value()) + std::to_string(j);
-                    uint64_t    id     = std::stoul(str_id);
-                    if (point.first == id)
-                    {
-                        found = true;
-                        break;
-                    }
-                    if (found)
-                    {
-                        break;
-                    }
-                }
-            }
+        return;
+    }
 
-            // If the point isn't in the sensor view then we hide it
-            if (!found)
-            {
-                point.second->Hide();
-            }
-            // If the point was detected before, we show it again
-            else if (found && !point.second->showing_)
-            {
-                point.second->Show();
-            }
-            found = false;
-        }
+    // Collect ids of all items in current sensor view, creating or updating their visuals on the way
+    visible_points_.clear();
+    visible_cars_.clear();
+
+    double z_offset = 0.10;
+    if (sv->has_global_ground_truth())
+    {
+        const osi3::GroundTruth& gt = sv->global_ground_truth();
 
-        found = false;
-        for (auto car : detected_cars_)
+        for (int i = 0; i < gt.moving_object_size(); i++)
         {
-            for (int i = 0; i < sv->global_ground_truth().moving_object_size(); i++)
-            {
-                // lets see the moving object ID and check if detected cars map are in the sensor view
-                uint64_t id = sv->global_ground_truth().moving_object()[i].id().value();
-                if (car.first == id)
-                {
-                    found = true;
-                    break;
-                }
-            }
+            // Get moving object position and dimension
+            const osi3::Vector3d    moving_object_position  = gt.moving_object(i).base().position();
+            const osi3::Dimension3d moving_object_dimension = gt.moving_object(i).base().dimension();
 
-            // If the moving object isn't in the sensor view then we hide it
-            if (!found)
+            // Get moving object id
+            uint64_t id = gt.moving_object(i).id().value();
+            visible_cars_.insert(id);
+
+            // If the moving object ID isn't in the cars map then we create one and added to the map
+            auto car = detected_cars_.find(id);
+            if (car == detected_cars_.end())
             {
-                car.second->Hide();
+                detected_cars_.emplace(id,
+                                       new OSIDetectedCar(osg::Vec3(static_cast<float>(moving_object_position.x()),
+                                                                    static_cast<float>(moving_object_position.y()),
+                                                                    static_cast<float>(moving_object_position.z() + z_offset)),
+                                                          moving_object_dimension.height() + 1.0,
+                                                          moving_object_dimension.width() + 1.0,
+                                                          moving_object_dimension.length() + 1.0,
+                                                          detected_bb_group_));
             }
-            // If the moving object was detected before, we show it again
-            else if (found && !car.second->showing_)
+            else
             {
-                car.second->Show();
+                // Otherwise update the visual object
+                car->second->Update(osg::Vec3(static_cast<float>(moving_object_position.x()),
+                                              static_cast<float>(moving_object_position.y()),
+                                              static_cast<float>(moving_object_position.z()) + car->second->bb_dimensions_.z() +
+                                                  static_cast<float>(z_offset)));
             }
-            found = false;
         }
 
-        // Lets check if it is needed to create new points and moving objects visuals
-        double z_offset = 0.10;
-        if (sv->has_global_ground_truth())
+        for (int i = 0; i < gt.lane_boundary_size(); ++i)
         {
-            for (int i = 0; i < sv->global_ground_truth().moving_object_size(); i++)
-            {
-                // Get moving object position and dimension
-                const osi3::Vector3d    moving_object_position  = sv->global_ground_truth().moving_object()[i].base().position();
-                const osi3::Dimension3d moving_object_dimension = sv->global_ground_truth().moving_object()[i].base().dimension();
+            const osi3::LaneBoundary& lane_boundary = gt.lane_boundary(i);
 
-                // Get moving object id
-                uint64_t id = sv->global_ground_truth().moving_object()[i].id().value();
-
-                // If the moving object ID isn't in the cars map then we create one and added to the map
-                if (detected_cars_.count(id) == 0)
+            for (int j = 0; j < lane_boundary.boundary_line_size(); ++j)
+            {
+                // Get line boundary point id
+                uint64_t id = GetBoundaryPointId(lane_boundary.id().value(), static_cast<unsigned int>(j));
+                visible_points_.insert(id);
+
+                // Get line boundary position
+                const osi3::Vector3d boundary_line_position = lane_boundary.boundary_line(j).position();
+                const osg::Vec3      point(static_cast<float>(boundary_line_position.x()),
+                                           static_cast<float>(boundary_line_position.y()),
+                                           static_cast<float>(boundary_line_position.z() + z_offset));
+
+                // If the lane boundary point ID isn't in the points map then we create one and added to the map
+                auto detected_point = detected_points_.find(id);
+                if (detected_point == detected_points_.end())
                 {
-                    detected_cars_.emplace(id,
-                                           new OSIDetectedCar(osg::Vec3(static_cast<float>(moving_object_position.x()),
-                                                                        static_cast<float>(moving_object_position.y()),
-                                                                        static_cast<float>(moving_object_position.z() + z_offset)),
-                                                              moving_object_dimension.height() + 1.0,
-                                                              moving_object_dimension.width() + 1.0,
-                                                              moving_object_dimension.length() + 1.0,
-                                                              detected_bb_group_));
+                    detected_points_.emplace(id, new OSIDetectedPoint(point, detected_points_group_));
                 }
                 else
                 {
                     // Otherwise update the visual object
-                    osg::Vec3 bb_dimension = detected_cars_.find(id)->second->bb_dimensions_;
-                    detected_cars_.find(id)->second->Update(
-                        osg::Vec3(static_cast<float>(moving_object_position.x()),
-                                  static_cast<float>(moving_object_position.y()),
-                                  static_cast<float>(moving_object_position.z()) + bb_dimension.z() + static_cast<float>(z_offset)));
+                    detected_point->second->Update(point);
                 }
             }
+        }
+    }
 
-            for (int i = 0; i < sv->global_ground_truth().lane_boundary_size(); ++i)
+    // Show previously detected items back in the sensor view, hide the ones that left it
+    for (auto& point : detected_points_)
+    {
+        if (visible_points_.count(point.first) > 0)
+        {
+            if (!point.second->showing_)
             {
-                for (int j = 0; j < sv->global_ground_truth().lane_boundary()[i].boundary_line_size(); ++j)
-                {
-                    // Get line boundary id
-                    std::string str_id = std::to_string(sv->global_ground_truth().lane_boundary()[i].id().value()) + std::to_string(j);
-                    uint64_t    id     = std::stoul(str_id);
-
-                    // Get line boundary position
-                    const osi3::Vector3d boundary_line_position = sv->global_ground_truth().lane_boundary()[i].boundary_line()[j].position();
+                point.second->Show();
+            }
+        }
+        else if (point.second->showing_)
+        {
+            point.second->Hide();
+        }
+    }
 
-                    // If the lane boundary ID isn't in the points map then we create one and added to the map
-                    if (detected_points_.count(id) == 0)
-                    {
-                        detected_points_.emplace(id,
-                                                 new OSIDetectedPoint(osg::Vec3(static_cast<float>(boundary_line_position.x()),
-                                                                                static_cast<float>(boundary_line_position.y()),
-                                                                                static_cast<float>(boundary_line_position.z() + z_offset)),
-                                                                      detected_points_group_));
-                    }
-                    else
-                    {
-                        // Otherwise update the visual object
-                        detected_points_.find(id)->second->Update(osg::Vec3(static_cast<float>(boundary_line_position.x()),
-                                                                            static_cast<float>(boundary_line_position.y()),
-                                                                            static_cast<float>(boundary_line_position.z() + z_offset)));
-                    }
-                }
+    for (auto& car : detected_cars_)
+    {
+        if (visible_cars_.count(car.first) > 0)
+        {
+            if (!car.second->showing_)
+            {
+                car.second->Show();
             }
         }
+        else if (car.second->showing_)
+        {
+            car.second->Hide();
+        }
     }
 }
 
@@ -1724,20 +1700,12 @@ Viewer::Viewer(roadmanager::OpenDrive* odrManager,
             file_name_candidates.push_back(CombineDirectoryPathAndFilepath(SE_Env::Inst().GetPaths()[i], FileNameOf(modelFilename)));
         }
 
-        size_t i;
-        for (i = 0; i < file_name_candidates.size(); i++)
+        std::string path = SE_Env::Inst().LocateFile(file_name_candidates);
+        if (!path.empty() && AddEnvironment(path.c_str()) == 0)
         {
-            if (FileExists(file_name_candidates[i].c_str()))
-            {
-                if (AddEnvironment(file_name_candidates[i].c_str()) == 0)
-                {
-                    LOG("Loaded scenegraph: %s", file_name_candidates[i].c_str());
-                    break;
-                }
-            }
+            LOG("Loaded scenegraph: %s", path.c_str());
         }
-
-        if (i == file_name_candidates.size())
+        else
         {
             LOG("Failed to read environment model %s!", modelFilename);
         }
@@ -2169,15 +2137,10 @@ EntityModel* Viewer::CreateEntityModel(std::string             modelFilepath,
             file_name_candidates.push_back(CombineDirectoryPathAndFilepath(SE_Env::Inst().GetPaths()[i], "/../resources/models/" + modelFilepath));
             file_name_candidates.push_back(CombineDirectoryPathAndFilepath(SE_Env::Inst().GetPaths()[i], FileNameOf(modelFilepath)));
         }
-        for (size_t i = 0; i < file_name_candidates.size(); i++)
+        std::string path = SE_Env::Inst().LocateFile(file_name_candidates);
+        if (!path.empty())
         {
-            if (FileExists(file_name_candidates[i].c_str()))
-            {
-                if (modelgroup = LoadEntityModel(file_name_candidates[i].c_str(), modelBB))
-                {
-                    break;
-                }
-            }
+            modelgroup = LoadEntityModel(path.c_str(), modelBB);
         }
     }
 
@@ -2520,6 +2483,15 @@ void Viewer::RemoveCar(std::string name)
     }
 }
 
+void Viewer::RemoveCar(EntityModel* model)
+{
+    auto it = std::find(entities_.begin(), entities_.end(), model);
+    if (it != entities_.end())
+    {
+        RemoveCar(static_cast<int>(it - entities_.begin()));
+    }
+}
+
 osg::ref_ptr<osg::Group> Viewer::LoadEntityModel(const char* filename, osg::BoundingBox& bb)
 {
     static int                                   elev      = 0;  // Avoid shadow node to flicker, put every second on slightly different Z
@@ -3017,19 +2989,17 @@ osg::ref_ptr<osg::PositionAttitudeTransform> Viewer::LoadRoadFeature(roadmanager
         file_name_candidates.push_back(CombineDirectoryPathAndFilepath(SE_Env::Inst().GetPaths()[i], "../models/" + filename));
         file_name_candidates.push_back(CombineDirectoryPathAndFilepath(SE_Env::Inst().GetPaths()[i], FileNameOf(filename)));
     }
-    for (size_t i = 0; i < file_name_candidates.size(); i++)
+    std::string path = SE_Env::Inst().LocateFile(file_name_candidates);
+    if (!path.empty())
     {
-        if (FileExists(file_name_candidates[i].c_str()))
+        node = osgDB::readNodeFile(path);
+        if (!node)
         {
-            node = osgDB::readNodeFile(file_name_candidates[i]);
-            if (!node)
-            {
-                return 0;
-            }
-
-            xform = new osg::PositionAttitudeTransform;
-            xform->addChild(node);
+            return 0;
         }
+
+        xform = new osg::PositionAttitudeTransform;
+        xform->addChild(node);
     }
 
     return xform;
@@ -24,6 +24,8 @@
 #include <osg/BlendColor>
 #include <osg/ShapeDrawable>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
 
 #include "RubberbandManipulator.hpp"
 #include "IdealSensor.hpp"
@@ -197,12 +199,25 @@ namespace viewer
         osg::ref_ptr<osg::Group> detected_points_group_;
         osg::ref_ptr<osg::Group> detected_bb_group_;
 
-        std::map<uint64_t, OSIDetectedPoint*> detected_points_;
-        std::map<uint64_t, OSIDetectedCar*>   detected_cars_;
+        std::unordered_map<uint64_t, OSIDetectedPoint*> detected_points_;
+        std::unordered_map<uint64_t, OSIDetectedCar*>   detected_cars_;
 
         OSISensorDetection(osg::ref_ptr<osg::Group> parent);
         ~OSISensorDetection();
         void Update(osi3::SensorView* sv);
+
+        /**
+                Combine lane boundary id and index of point along the boundary into a unique point id
+        */
+        static uint64_t GetBoundaryPointId(uint64_t boundary_id, unsigned int point_index)
+        {
+            return (boundary_id << 20) | (point_index & 0xFFFFF);
+        }
+
+    private:
+        // ids of items in latest sensor view, kept as members to reuse allocated buckets between frames
+        std::unordered_set<uint64_t> visible_points_;
+        std::unordered_set<uint64_t> visible_cars_;
     };
 
 #endif  // _USE_OSI
@@ -537,6 +552,7 @@ namespace viewer
         int                      AddEntityModel(EntityModel* model);
         void                     RemoveCar(int index);
         void                     RemoveCar(std::string name);
+        void                     RemoveCar(EntityModel* model);
         void                     ReplaceCar(int index, EntityModel* model);
         int                      LoadShadowfile(std::string vehicleModelFilename);
         int                      AddEnvironment(const char* filename);
@@ -110,6 +110,149 @@ TEST(VectorOperations, TestProjectPointOnVector)
     EXPECT_NEAR(v_result[1], -8.45588, 1E-5);
 }
 
+TEST(VectorOperations, TestBatchVariants)
+{
+    const size_t n    = 7;
+    double       x[n] = {0.0, 1.0, -3.5, 10.0, 2.0, -0.5, 4.0};
+    double       y[n] = {0.0, 2.0, 1.0, -7.0, 0.5, -2.5, 4.0};
+    double       res0[n];
+
+    PointSquareDistance2D(1.5, -2.0, x, y, res0, n);
+    for (size_t i = 0; i < n; i++)
+    {
+        EXPECT_NEAR(res0[i], PointSquareDistance2D(1.5, -2.0, x[i], y[i]), 1E-10);
+    }
+}
+
+TEST(VectorOperations, TestOrientedBoundingBox)
+{
+    OBB2D obb0, obb1;
+
+    // reference point at rear axle, 1 m behind box center
+    SetOBB2D(-1.0, 0.0, 0.0, 1.0, 0.0, 4.0, 2.0, obb0);
+    EXPECT_NEAR(obb0.center[0], 0.0, 1E-10);
+    EXPECT_NEAR(obb0.corners[0][0], 2.0, 1E-10);
+    EXPECT_NEAR(obb0.corners[0][1], 1.0, 1E-10);
+    EXPECT_NEAR(obb0.corners[2][0], -2.0, 1E-10);
+    EXPECT_NEAR(obb0.corners[2][1], -1.0, 1E-10);
+
+    SetOBB2D(6.0, 0.0, 0.0, 0.0, 0.0, 4.0, 2.0, obb1);
+    EXPECT_FALSE(OverlapOBB2D(obb0, obb1, SMALL_NUMBER));
+    EXPECT_NEAR(FreeSpaceDistanceOBB2D(obb0, obb1), 2.0, 1E-10);
+
+    SetOBB2D(5.0, 3.0, M_PI_2, 0.0, 0.0, 4.0, 2.0, obb1);
+    EXPECT_FALSE(OverlapOBB2D(obb0, obb1, SMALL_NUMBER));
+    EXPECT_NEAR(FreeSpaceDistanceOBB2D(obb0, obb1), 2.0, 1E-10);
+
+    // touching boxes overlap within tolerance
+    SetOBB2D(4.0, 0.0, 0.0, 0.0, 0.0, 4.0, 2.0, obb1);
+    EXPECT_TRUE(OverlapOBB2D(obb0, obb1, SMALL_NUMBER));
+
+    SetOBB2D(3.0, 0.0, M_PI_4, 0.0, 0.0, 4.0, 2.0, obb1);
+    EXPECT_TRUE(OverlapOBB2D(obb0, obb1, SMALL_NUMBER));
+    EXPECT_TRUE(OverlapOBB2D(obb1, obb0, SMALL_NUMBER));
+
+    double x = 0.0, y = 0.0;
+    EXPECT_NEAR(DistanceFromPointToOBB2D(obb0, 5.0, 5.0, &x, &y), 5.0, 1E-10);
+    EXPECT_NEAR(x, 2.0, 1E-10);
+    EXPECT_NEAR(y, 1.0, 1E-10);
+    EXPECT_NEAR(DistanceFromPointToOBB2D(obb0, 0.5, -0.5, &x, &y), 0.0, 1E-10);
+}
+
+TEST(FileLookup, TestFileCache)
+{
+    const std::string filename = "file_cache_test.txt";
+    std::remove(filename.c_str());
+    SE_Env::Inst().ClearPaths();
+    SE_Env::Inst().ClearFileCache();
+    SE_Env::Inst().AddPath(".");
+
+    std::vector<std::string> candidates = {"missing_dir/" + filename, filename};
+    EXPECT_EQ(SE_Env::Inst().LocateFile(candidates), "");
+    EXPECT_EQ(SE_Env::Inst().ResolveFilePath(filename), "");
+
+    // failed lookups are cached as well
+    std::ofstream(filename) << "test";
+    EXPECT_EQ(SE_Env::Inst().LocateFile(candidates), "");
+    EXPECT_EQ(SE_Env::Inst().ResolveFilePath(filename), "");
+
+    // adding a path drops failed lookups
+    SE_Env::Inst().AddPath("missing_dir");
+    EXPECT_EQ(SE_Env::Inst().LocateFile(candidates), filename);
+    EXPECT_EQ(SE_Env::Inst().ResolveFilePath(filename), CombineDirectoryPathAndFilepath(".", filename));
+
+    // successful lookups are cached, also over added paths
+    std::remove(filename.c_str());
+    SE_Env::Inst().AddPath("missing_dir2");
+    EXPECT_EQ(SE_Env::Inst().LocateFile(candidates), filename);
+    EXPECT_EQ(SE_Env::Inst().ResolveFilePath(filename), CombineDirectoryPathAndFilepath(".", filename));
+
+    // clearing registered paths drops the cache
+    SE_Env::Inst().ClearPaths();
+    EXPECT_EQ(SE_Env::Inst().LocateFile(candidates), "");
+    EXPECT_EQ(SE_Env::Inst().ResolveFilePath(filename), "");
+
+    // and so does clearing the cache
+    std::ofstream(filename) << "test";
+    EXPECT_EQ(SE_Env::Inst().LocateFile(candidates), "");
+    SE_Env::Inst().ClearFileCache();
+    EXPECT_EQ(SE_Env::Inst().LocateFile(candidates), filename);
+    std::remove(filename.c_str());
+
+    // modifying paths directly drops the cache
+    SE_Env::Inst().GetPaths().push_back(".");
+    EXPECT_EQ(SE_Env::Inst().LocateFile(candidates), "");
+
+    SE_Env::Inst().ClearPaths();
+}
+
+TEST(TimeFunctions, TestSimTimeStepSleepsForMinStep)
+{
+    __int64 time_stamp = 0;
+
+    EXPECT_DOUBLE_EQ(SE_getSimTimeStep(time_stamp, 0.005, 0.1), 0.005);
+
+    // immediate call has to wait for remaining part of the minimal step, sub-millisecond steps included
+    EXPECT_GE(SE_getSimTimeStep(time_stamp, 0.005, 0.1), 0.005);
+    EXPECT_GE(SE_getSimTimeStep(time_stamp, 0.0005, 0.1), 0.0005);
+
+    SE_sleep(20);
+    EXPECT_DOUBLE_EQ(SE_getSimTimeStep(time_stamp, 0.001, 0.01), 0.01);
+}
+
+TEST(TimeFunctions, TestRealTimePacer)
+{
+    SE_RealTimePacer pacer;
+
+    // disabled by default, no waiting and no stats
+    __int64 t0 = SE_getMonotonicTimeNs();
+    pacer.Pace(1.0);
+    EXPECT_LT(SE_getMonotonicTimeNs() - t0, 500000000);
+    EXPECT_EQ(pacer.GetNumberOfFrames(), 0);
+
+    // 5 frames of 0.1 s at 10 times real time should take at least 50 ms
+    pacer.SetFactor(10.0);
+    pacer.Pace(0.1);  // start schedule
+    t0 = SE_getMonotonicTimeNs();
+    for (int i = 0; i < 5; i++)
+    {
+        pacer.Pace(0.1);
+    }
+    EXPECT_GE(SE_getMonotonicTimeNs() - t0, 50000000 - 1000000);
+    EXPECT_EQ(pacer.GetNumberOfFrames(), 5);
+
+    // a frame taking longer than its time slot is registered as overrun
+    pacer.SetFactor(1.0);
+    pacer.ResetStats();
+    pacer.Pace(0.001);
+    SE_sleep(20);
+    pacer.Pace(0.001);
+    EXPECT_EQ(pacer.GetNumberOfFrames(), 1);
+    EXPECT_EQ(pacer.GetNumberOfOverruns(), 1);
+    EXPECT_GE(pacer.GetMaxOverrun(), 0.018);
+    EXPECT_NEAR(pacer.GetMeanOverrun(), pacer.GetMaxOverrun(), 1E-10);
+}
+
 INSTANTIATE_TEST_SUITE_P(CommonMini,
                          Local2Global,
                          ::testing::Values(std::make_tuple(Coordinate2D{0, 1}, Coordinate2D{1, 1}, -M_PI / 2, Coordinate2D{2, 1}),
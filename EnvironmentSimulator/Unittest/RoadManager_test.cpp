@@ -3,8 +3,10 @@
 #include <gmock/gmock.h>
 #include <vector>
 #include <stdexcept>
+#include <filesystem>
 
 #include "RoadManager.hpp"
+#include "RoadNetworkExerciser.hpp"
 
 using namespace roadmanager;
 
@@ -2022,6 +2024,116 @@ TEST(PositionTest, TestJunctionId)
     EXPECT_EQ(pos.IsInJunction(), true);
 }
 
+TEST(PositionTest, IncrementalLaneWidthEvaluation)
+{
+    // Varying lane widths and lane offsets, stepping along each lane with same position object
+    for (const char *filename : {"../../../EnvironmentSimulator/Unittest/xodr/highway_example_with_merge_and_split.xodr",
+                                 "../../../EnvironmentSimulator/Unittest/xodr/mixed_roads.xodr",
+                                 "../../../resources/xodr/two_plus_one.xodr"})
+    {
+        ASSERT_EQ(roadmanager::Position::LoadOpenDrive(filename), true);
+        OpenDrive *odr = Position::GetOpenDrive();
+
+        for (int i = 0; i < odr->GetNumOfRoads(); i++)
+        {
+            Road *road = odr->GetRoadByIdx(i);
+            for (int j = 0; j < road->GetNumberOfLaneSections(); j++)
+            {
+                LaneSection *lsec     = road->GetLaneSectionByIdx(j);
+                double       lsec_end = lsec->GetS() + lsec->GetLength();
+                for (int k = 0; k < lsec->GetNumberOfLanes(); k++)
+                {
+                    int      lane_id = lsec->GetLaneByIdx(k)->GetId();
+                    Position pos;
+                    for (double s = lsec->GetS(); s < lsec_end; s += 0.7)
+                    {
+                        pos.SetLanePos(road->GetId(), lane_id, s, 0.0, j);
+                        EXPECT_NEAR(pos.GetT(), SIGN(lane_id) * lsec->GetCenterOffset(s, lane_id), 1e-9);
+
+                        // compare with position evaluated from scratch
+                        Position ref;
+                        ref.SetLanePos(road->GetId(), lane_id, s, 0.0, j);
+                        EXPECT_NEAR(pos.GetX(), ref.GetX(), 1e-9);
+                        EXPECT_NEAR(pos.GetY(), ref.GetY(), 1e-9);
+                        EXPECT_NEAR(GetAngleDifference(pos.GetH(), ref.GetH()), 0.0, 1e-9);
+
+                        pos.SetLaneBoundaryPos(road->GetId(), lane_id, s, 0.0, j);
+                        EXPECT_NEAR(pos.GetT(), SIGN(lane_id) * lsec->GetOuterOffset(s, lane_id), 1e-9);
+                        pos.SetLanePos(road->GetId(), lane_id, s, 0.0, j);
+                    }
+                }
+            }
+        }
+        odr->Clear();
+    }
+}
+
+TEST(PositionTest, DeferredWorldPos)
+{
+    ASSERT_EQ(roadmanager::Position::LoadOpenDrive("../../../resources/xodr/curve_r100.xodr"), true);
+    OpenDrive *odr     = Position::GetOpenDrive();
+    int        road_id = odr->GetRoadByIdx(0)->GetId();
+
+    Position pos;
+    Position ref;
+    pos.SetLanePos(road_id, -1, 10.0, 0.0);
+    pos.SetDeferWorldPos(true);
+
+    double x0 = pos.GetX();
+    double y0 = pos.GetY();
+    double h0 = pos.GetH();
+
+    // world coordinates keep previous values until explicitly evaluated
+    pos.SetLanePos(road_id, -1, 50.0, 0.5);
+    ref.SetLanePos(road_id, -1, 50.0, 0.5);
+    EXPECT_EQ(pos.IsWorldPosStale(), true);
+    EXPECT_NEAR(pos.GetX(), x0, 1e-9);
+    EXPECT_NEAR(pos.GetY(), y0, 1e-9);
+    EXPECT_NEAR(pos.GetH(), h0, 1e-9);
+    EXPECT_EQ(pos.IsWorldPosStale(), true);
+    pos.EvaluateWorldPos();
+    EXPECT_EQ(pos.IsWorldPosStale(), false);
+    EXPECT_NEAR(pos.GetX(), ref.GetX(), 1e-9);
+    EXPECT_NEAR(pos.GetY(), ref.GetY(), 1e-9);
+    EXPECT_NEAR(pos.GetZ(), ref.GetZ(), 1e-9);
+    EXPECT_NEAR(pos.GetH(), ref.GetH(), 1e-9);
+    EXPECT_NEAR(pos.GetHRoad(), ref.GetHRoad(), 1e-9);
+
+    // relative heading set while deferred is applied on evaluation
+    pos.SetLanePos(road_id, -1, 80.0, 0.0);
+    ref.SetLanePos(road_id, -1, 80.0, 0.0);
+    pos.SetHeadingRelative(0.1);
+    ref.SetHeadingRelative(0.1);
+    pos.EvaluateWorldPos();
+    EXPECT_NEAR(pos.GetH(), ref.GetH(), 1e-9);
+
+    // moving along s considers relative heading of the current position
+    pos.SetLanePos(road_id, -1, 100.0, 0.0);
+    ref.SetLanePos(road_id, -1, 100.0, 0.0);
+    pos.SetHeadingRelative(M_PI);
+    ref.SetHeadingRelative(M_PI);
+    pos.SetLanePos(road_id, -1, 120.0, 0.0);
+    ref.SetLanePos(road_id, -1, 120.0, 0.0);
+    pos.MoveAlongS(10.0);
+    ref.MoveAlongS(10.0);
+    EXPECT_EQ(pos.IsWorldPosStale(), true);
+    EXPECT_NEAR(pos.GetS(), 110.0, 1e-9);
+    pos.EvaluateWorldPos();
+    EXPECT_NEAR(pos.GetX(), ref.GetX(), 1e-9);
+    EXPECT_NEAR(pos.GetY(), ref.GetY(), 1e-9);
+    EXPECT_NEAR(pos.GetH(), ref.GetH(), 1e-9);
+
+    // leaving deferred mode evaluates any stale world coordinates
+    pos.SetLanePos(road_id, -1, 30.0, -0.5);
+    ref.SetLanePos(road_id, -1, 30.0, -0.5);
+    pos.SetDeferWorldPos(false);
+    EXPECT_EQ(pos.IsWorldPosStale(), false);
+    EXPECT_NEAR(pos.GetX(), ref.GetX(), 1e-9);
+    EXPECT_NEAR(pos.GetY(), ref.GetY(), 1e-9);
+
+    odr->Clear();
+}
+
 TEST(ControllerTest, TestControllers)
 {
     Position::GetOpenDrive()->LoadOpenDriveFile("../../../resources/xodr/multi_intersections.xodr");
@@ -2297,22 +2409,22 @@ TEST(OSIPointTest, MixedRoads)
     EXPECT_NEAR(road->GetLaneSectionByIdx(0)->GetLaneByIdx(0)->GetOSIPoints()->GetPoint(0).x, 0.0, 1e-3);
     EXPECT_NEAR(road->GetLaneSectionByIdx(0)->GetLaneByIdx(0)->GetOSIPoints()->GetPoint(0).y, 1.5, 1e-3);
     EXPECT_NEAR(road->GetLaneSectionByIdx(0)->GetLaneByIdx(0)->GetOSIPoints()->GetPoint(0).z, 0.0, 1e-3);
-    EXPECT_NEAR(road->GetLaneSectionByIdx(0)->GetLaneByIdx(0)->GetOSIPoints()->GetPoint(4).x, 18.119, 1e-3);
-    EXPECT_NEAR(road->GetLaneSectionByIdx(0)->GetLaneByIdx(0)->GetOSIPoints()->GetPoint(4).y, 3.181, 1e-3);
-    EXPECT_NEAR(road->GetLaneSectionByIdx(0)->GetLaneByIdx(0)->GetOSIPoints()->GetPoint(4).z, 0.0, 1e-3);
-    EXPECT_NEAR(road->GetLaneSectionByIdx(0)->GetLaneByIdx(0)->GetOSIPoints()->GetPoint(10).x, 40.423, 1e-3);
-    EXPECT_NEAR(road->GetLaneSectionByIdx(0)->GetLaneByIdx(0)->GetOSIPoints()->GetPoint(10).y, 11.275, 1e-3);
+    EXPECT_NEAR(road->GetLaneSectionByIdx(0)->GetLaneByIdx(0)->GetOSIPoints()->GetPoint(6).x, 33.766, 1e-3);
+    EXPECT_NEAR(road->GetLaneSectionByIdx(0)->GetLaneByIdx(0)->GetOSIPoints()->GetPoint(6).y, 7.468, 1e-3);
+    EXPECT_NEAR(road->GetLaneSectionByIdx(0)->GetLaneByIdx(0)->GetOSIPoints()->GetPoint(6).z, 0.0, 1e-3);
+    EXPECT_NEAR(road->GetLaneSectionByIdx(0)->GetLaneByIdx(0)->GetOSIPoints()->GetPoint(7).x, 33.433, 1e-3);
+    EXPECT_NEAR(road->GetLaneSectionByIdx(0)->GetLaneByIdx(0)->GetOSIPoints()->GetPoint(7).y, 8.411, 1e-3);
+    EXPECT_NEAR(road->GetLaneSectionByIdx(0)->GetLaneByIdx(0)->GetOSIPoints()->GetPoint(7).z, 0.0, 1e-3);
+    EXPECT_NEAR(road->GetLaneSectionByIdx(0)->GetLaneByIdx(0)->GetOSIPoints()->GetPoint(10).x, 46.744, 1e-3);
+    EXPECT_NEAR(road->GetLaneSectionByIdx(0)->GetLaneByIdx(0)->GetOSIPoints()->GetPoint(10).y, 14.436, 1e-3);
     EXPECT_NEAR(road->GetLaneSectionByIdx(0)->GetLaneByIdx(0)->GetOSIPoints()->GetPoint(10).z, 0.0, 1e-3);
-    EXPECT_NEAR(road->GetLaneSectionByIdx(0)->GetLaneByIdx(0)->GetOSIPoints()->GetPoint(12).x, 46.744, 1e-3);
-    EXPECT_NEAR(road->GetLaneSectionByIdx(0)->GetLaneByIdx(0)->GetOSIPoints()->GetPoint(12).y, 14.436, 1e-3);
-    EXPECT_NEAR(road->GetLaneSectionByIdx(0)->GetLaneByIdx(0)->GetOSIPoints()->GetPoint(12).z, 0.0, 1e-3);
 
     road = odr->GetRoadByIdx(1);
     EXPECT_EQ(road->GetId(), 1);
     EXPECT_NEAR(road->GetLaneSectionByIdx(0)->GetLaneByIdx(0)->GetOSIPoints()->GetPoint(0).x, 0.0, 1e-3);
     EXPECT_NEAR(road->GetLaneSectionByIdx(0)->GetLaneByIdx(0)->GetOSIPoints()->GetPoint(0).y, -8.5, 1e-3);
     EXPECT_NEAR(road->GetLaneSectionByIdx(0)->GetLaneByIdx(0)->GetOSIPoints()->GetPoint(0).z, 0.0, 1e-3);
-    EXPECT_NEAR(road->GetLaneSectionByIdx(0)->GetLaneByIdx(0)->GetOSIPoints()->GetPoint(1).x, 19.875, 1e-3);
+    EXPECT_NEAR(road->GetLaneSectionByIdx(0)->GetLaneByIdx(0)->GetOSIPoints()->GetPoint(1).x, 19.99, 1e-3);
     EXPECT_NEAR(road->GetLaneSectionByIdx(0)->GetLaneByIdx(0)->GetOSIPoints()->GetPoint(1).y, -8.5, 1e-3);
     EXPECT_NEAR(road->GetLaneSectionByIdx(0)->GetLaneByIdx(0)->GetOSIPoints()->GetPoint(1).z, 0.0, 1e-3);
     EXPECT_NEAR(road->GetLaneSectionByIdx(0)->GetLaneByIdx(0)->GetOSIPoints()->GetPoint(2).x, 20.0, 1e-3);
@@ -2327,34 +2439,226 @@ TEST(OSIPointTest, MixedRoads)
     EXPECT_NEAR(road->GetLaneSectionByIdx(0)->GetLaneByIdx(0)->GetOSIPoints()->GetPoint(0).x, 0.0, 1e-3);
     EXPECT_NEAR(road->GetLaneSectionByIdx(0)->GetLaneByIdx(0)->GetOSIPoints()->GetPoint(0).y, -18.5, 1e-3);
     EXPECT_NEAR(road->GetLaneSectionByIdx(0)->GetLaneByIdx(0)->GetOSIPoints()->GetPoint(0).z, 0.0, 1e-3);
+    EXPECT_NEAR(road->GetLaneSectionByIdx(0)->GetLaneByIdx(0)->GetOSIPoints()->GetPoint(3).x, 20.106, 1e-3);
+    EXPECT_NEAR(road->GetLaneSectionByIdx(0)->GetLaneByIdx(0)->GetOSIPoints()->GetPoint(3).y, -19.506, 1e-3);
+    EXPECT_NEAR(road->GetLaneSectionByIdx(0)->GetLaneByIdx(0)->GetOSIPoints()->GetPoint(3).z, 0.0, 1e-3);
     EXPECT_NEAR(road->GetLaneSectionByIdx(0)->GetLaneByIdx(0)->GetOSIPoints()->GetPoint(4).x, 20.116, 1e-3);
     EXPECT_NEAR(road->GetLaneSectionByIdx(0)->GetLaneByIdx(0)->GetOSIPoints()->GetPoint(4).y, -19.507, 1e-3);
     EXPECT_NEAR(road->GetLaneSectionByIdx(0)->GetLaneByIdx(0)->GetOSIPoints()->GetPoint(4).z, 2.0, 1e-3);
-    EXPECT_NEAR(road->GetLaneSectionByIdx(0)->GetLaneByIdx(0)->GetOSIPoints()->GetPoint(7).x, 39.167, 1e-3);
-    EXPECT_NEAR(road->GetLaneSectionByIdx(0)->GetLaneByIdx(0)->GetOSIPoints()->GetPoint(7).y, -22.343, 1e-3);
-    EXPECT_NEAR(road->GetLaneSectionByIdx(0)->GetLaneByIdx(0)->GetOSIPoints()->GetPoint(7).z, 2.0, 1e-3);
-    EXPECT_NEAR(road->GetLaneSectionByIdx(0)->GetLaneByIdx(0)->GetOSIPoints()->GetPoint(9).x, 49.852, 1e-3);
-    EXPECT_NEAR(road->GetLaneSectionByIdx(0)->GetLaneByIdx(0)->GetOSIPoints()->GetPoint(9).y, -24.764, 1e-3);
-    EXPECT_NEAR(road->GetLaneSectionByIdx(0)->GetLaneByIdx(0)->GetOSIPoints()->GetPoint(9).z, 2.0, 1e-3);
+    EXPECT_NEAR(road->GetLaneSectionByIdx(0)->GetLaneByIdx(0)->GetOSIPoints()->GetPoint(8).x, 49.852, 1e-3);
+    EXPECT_NEAR(road->GetLaneSectionByIdx(0)->GetLaneByIdx(0)->GetOSIPoints()->GetPoint(8).y, -24.764, 1e-3);
+    EXPECT_NEAR(road->GetLaneSectionByIdx(0)->GetLaneByIdx(0)->GetOSIPoints()->GetPoint(8).z, 2.0, 1e-3);
 
     road = odr->GetRoadByIdx(3);
     EXPECT_EQ(road->GetId(), 3);
     EXPECT_NEAR(road->GetLaneSectionByIdx(0)->GetLaneByIdx(2)->GetOSIPoints()->GetPoint(0).x, 0.0, 1e-3);
     EXPECT_NEAR(road->GetLaneSectionByIdx(0)->GetLaneByIdx(2)->GetOSIPoints()->GetPoint(0).y, -41.5, 1e-3);
     EXPECT_NEAR(road->GetLaneSectionByIdx(0)->GetLaneByIdx(2)->GetOSIPoints()->GetPoint(0).z, 0.0, 1e-3);
-    EXPECT_NEAR(road->GetLaneSectionByIdx(0)->GetLaneByIdx(2)->GetOSIPoints()->GetPoint(4).x, 56.0, 1e-3);
-    EXPECT_NEAR(road->GetLaneSectionByIdx(0)->GetLaneByIdx(2)->GetOSIPoints()->GetPoint(4).y, -41.5, 1e-3);
-    EXPECT_NEAR(road->GetLaneSectionByIdx(0)->GetLaneByIdx(2)->GetOSIPoints()->GetPoint(4).z, 0.397, 1e-3);
-    EXPECT_NEAR(road->GetLaneSectionByIdx(0)->GetLaneByIdx(2)->GetOSIPoints()->GetPoint(9).x, 69.875, 1e-3);
-    EXPECT_NEAR(road->GetLaneSectionByIdx(0)->GetLaneByIdx(2)->GetOSIPoints()->GetPoint(9).y, -41.5, 1e-3);
-    EXPECT_NEAR(road->GetLaneSectionByIdx(0)->GetLaneByIdx(2)->GetOSIPoints()->GetPoint(9).z, 3.484, 1e-3);
-    EXPECT_NEAR(road->GetLaneSectionByIdx(0)->GetLaneByIdx(2)->GetOSIPoints()->GetPoint(21).x, 150.0, 1e-3);
-    EXPECT_NEAR(road->GetLaneSectionByIdx(0)->GetLaneByIdx(2)->GetOSIPoints()->GetPoint(21).y, -41.5, 1e-3);
-    EXPECT_NEAR(road->GetLaneSectionByIdx(0)->GetLaneByIdx(2)->GetOSIPoints()->GetPoint(21).z, 10.0, 1e-3);
+    EXPECT_NEAR(road->GetLaneSectionByIdx(0)->GetLaneByIdx(2)->GetOSIPoints()->GetPoint(2).x, 53.846, 1e-3);
+    EXPECT_NEAR(road->GetLaneSectionByIdx(0)->GetLaneByIdx(2)->GetOSIPoints()->GetPoint(2).y, -41.5, 1e-3);
+    EXPECT_NEAR(road->GetLaneSectionByIdx(0)->GetLaneByIdx(2)->GetOSIPoints()->GetPoint(2).z, 0.168, 1e-3);
+    EXPECT_NEAR(road->GetLaneSectionByIdx(0)->GetLaneByIdx(2)->GetOSIPoints()->GetPoint(6).x, 69.231, 1e-3);
+    EXPECT_NEAR(road->GetLaneSectionByIdx(0)->GetLaneByIdx(2)->GetOSIPoints()->GetPoint(6).y, -41.5, 1e-3);
+    EXPECT_NEAR(road->GetLaneSectionByIdx(0)->GetLaneByIdx(2)->GetOSIPoints()->GetPoint(6).z, 3.3, 1e-3);
+    EXPECT_NEAR(road->GetLaneSectionByIdx(0)->GetLaneByIdx(2)->GetOSIPoints()->GetPoint(15).x, 150.0, 1e-3);
+    EXPECT_NEAR(road->GetLaneSectionByIdx(0)->GetLaneByIdx(2)->GetOSIPoints()->GetPoint(15).y, -41.5, 1e-3);
+    EXPECT_NEAR(road->GetLaneSectionByIdx(0)->GetLaneByIdx(2)->GetOSIPoints()->GetPoint(15).z, 10.0, 1e-3);
+
+    odr->Clear();
+}
+
+// Check OSI lane points against given tolerances, return total number of points
+static int CheckOSILanePoints(OpenDrive *odr, double max_deviation, double max_distance)
+{
+    Position pos;
+    int      n_points = 0;
+
+    for (int i = 0; i < odr->GetNumOfRoads(); i++)
+    {
+        Road *road = odr->GetRoadByIdx(i);
+        for (int j = 0; j < road->GetNumberOfLaneSections(); j++)
+        {
+            LaneSection *lsec = road->GetLaneSectionByIdx(j);
+            for (int k = 0; k < lsec->GetNumberOfLanes(); k++)
+            {
+                Lane                     *lane   = lsec->GetLaneByIdx(k);
+                std::vector<PointStruct> &points = lane->GetOSIPoints()->GetPoints();
+                n_points += static_cast<int>(points.size());
+
+                for (size_t m = 1; m < points.size(); m++)
+                {
+                    PointStruct &p0 = points[m - 1];
+                    PointStruct &p1 = points[m];
+                    EXPECT_LT(p1.s - p0.s, max_distance + SMALL_NUMBER);
+
+                    // skip discontinuities and shortest segments, which are not subdivided
+                    if (p1.s - p0.s < 0.4)
+                    {
+                        continue;
+                    }
+
+                    for (double f = 0.125; f < 1.0; f += 0.125)
+                    {
+                        pos.SetLanePos(road->GetId(), lane->GetId(), p0.s + f * (p1.s - p0.s), 0, j);
+                        EXPECT_LT(DistanceFromPointToEdge2D(pos.GetX(), pos.GetY(), p0.x, p0.y, p1.x, p1.y, nullptr, nullptr), 1.1 * max_deviation);
+                    }
+                }
+            }
+        }
+    }
+
+    return n_points;
+}
+
+TEST(OSIPointTest, AdaptiveTessellation)
+{
+    double max_deviation = SE_Env::Inst().GetOSIMaxLateralDeviation();
+    double max_distance  = SE_Env::Inst().GetOSIMaxLongitudinalDistance();
+
+    ASSERT_EQ(roadmanager::Position::LoadOpenDrive("../../../resources/xodr/e6mini.xodr"), true);
+    int n_points_fine = CheckOSILanePoints(Position::GetOpenDrive(), max_deviation, max_distance);
+    Position::GetOpenDrive()->Clear();
+
+    SE_Env::Inst().SetOSIMaxLateralDeviation(0.5);
+    ASSERT_EQ(roadmanager::Position::LoadOpenDrive("../../../resources/xodr/e6mini.xodr"), true);
+    int n_points_coarse = CheckOSILanePoints(Position::GetOpenDrive(), 0.5, max_distance);
+    EXPECT_LT(n_points_coarse, n_points_fine);
+
+    SE_Env::Inst().SetOSIMaxLateralDeviation(max_deviation);
+    Position::GetOpenDrive()->Clear();
+}
+
+TEST(RoadProfileTest, TestRoadAndLaneProfile)
+{
+    ASSERT_EQ(roadmanager::Position::LoadOpenDrive("../../../EnvironmentSimulator/Unittest/xodr/mixed_roads.xodr"), true);
+    roadmanager::OpenDrive *odr = Position::GetOpenDrive();
+    ASSERT_NE(odr, nullptr);
+
+    for (int i = 0; i < odr->GetNumOfRoads(); i++)
+    {
+        Road                                *road    = odr->GetRoadByIdx(i);
+        const std::vector<RoadProfilePoint> &profile = road->GetProfile();
+        ASSERT_GT(profile.size(), 1);
+        EXPECT_NEAR(profile.front().s, 0.0, 1e-10);
+        EXPECT_NEAR(profile.back().s, road->GetLength(), 1e-10);
+
+        Position pos;
+        for (size_t j = 0; j < profile.size(); j++)
+        {
+            if (j > 0)
+            {
+                EXPECT_LE(profile[j].s - profile[j - 1].s, SE_Env::Inst().GetLookAheadResolution() + SMALL_NUMBER);
+            }
+            pos.SetTrackPos(road->GetId(), profile[j].s, 0.0);
+            EXPECT_NEAR(profile[j].x, pos.GetX(), 1e-5);
+            EXPECT_NEAR(profile[j].y, pos.GetY(), 1e-5);
+            EXPECT_NEAR(profile[j].curvature, pos.GetCurvature(), 1e-5);
+        }
+
+        for (int j = 0; j < road->GetNumberOfLaneSections(); j++)
+        {
+            LaneSection *lsec = road->GetLaneSectionByIdx(j);
+            for (int k = 0; k < lsec->GetNumberOfLanes(); k++)
+            {
+                Lane                                *lane         = lsec->GetLaneByIdx(k);
+                const std::vector<LaneProfilePoint> &lane_profile = lane->GetProfile();
+                if (!lane->IsDriving())
+                {
+                    EXPECT_EQ(lane_profile.size(), 0);
+                    continue;
+                }
+                ASSERT_GT(lane_profile.size(), 1);
+                EXPECT_NEAR(profile[static_cast<unsigned int>(lane_profile.front().profile_idx)].s, lsec->GetS(), 1e-10);
+                EXPECT_NEAR(profile[static_cast<unsigned int>(lane_profile.back().profile_idx)].s, lsec->GetS() + lsec->GetLength(), 1e-10);
+
+                for (size_t l = 0; l < lane_profile.size(); l++)
+                {
+                    // compare lane center and borders, skipping end points that may be evaluated in neighbor lane section
+                    double s = profile[static_cast<unsigned int>(lane_profile[l].profile_idx)].s;
+                    if (l == 0 || l == lane_profile.size() - 1)
+                    {
+                        continue;
+                    }
+                    double half_width = lsec->GetWidth(s, lane->GetId()) / 2;
+                    for (int m = 0; m < 3; m++)
+                    {
+                        pos.SetLanePos(road->GetId(), lane->GetId(), s, (1 - m) * half_width);
+                        EXPECT_NEAR(lane_profile[l].x[m], pos.GetX(), 1e-5);
+                        EXPECT_NEAR(lane_profile[l].y[m], pos.GetY(), 1e-5);
+                    }
+                }
+            }
+        }
+    }
 
     odr->Clear();
 }
 
+TEST(RoadProfileTest, TestLookAheadPath)
+{
+    ASSERT_EQ(roadmanager::Position::LoadOpenDrive("../../../resources/xodr/e6mini.xodr"), true);
+    roadmanager::OpenDrive *odr = Position::GetOpenDrive();
+    ASSERT_NE(odr, nullptr);
+
+    Position pos(0, -3, 100.0, 0.0);
+    ASSERT_EQ(pos.GetTrackId(), 0);
+
+    const LookAheadPath &path = odr->GetLookAheadPath(pos.GetTrackIdx(), pos.GetLaneSectionIdx(), pos.GetLaneId(), pos.GetS(), 1, 80.0);
+    EXPECT_NEAR(path.s_start, 100.0, 1e-10);
+    EXPECT_GT(path.GetLength(), 80.0 + LOOKAHEAD_S_BUCKET_SIZE);
+    EXPECT_EQ(path.junction, false);
+
+    // Lane center along path matches lane position, ego moving along road s direction
+    double x = 0.0;
+    double y = 0.0;
+    for (double ds : {0.0, 10.0, 42.3, 80.0})
+    {
+        ASSERT_EQ(path.GetPos(ds, 1, x, y), true);
+        pos.SetLanePos(0, -3, path.s_start + ds, 0.0);
+        EXPECT_NEAR(x, pos.GetX(), 0.05);
+        EXPECT_NEAR(y, pos.GetY(), 0.05);
+    }
+    EXPECT_EQ(path.GetPos(path.GetLength() + 1.0, 1, x, y), false);
+
+    // Same path shared within s-bucket
+    EXPECT_EQ(&odr->GetLookAheadPath(pos.GetTrackIdx(), pos.GetLaneSectionIdx(), -3, 101.0, 1, 80.0), &path);
+    EXPECT_NE(&odr->GetLookAheadPath(pos.GetTrackIdx(), pos.GetLaneSectionIdx(), -3, 101.0, -1, 80.0), &path);
+
+    // Paths used since previous prune are kept
+    odr->PruneLookAheadCache();
+    EXPECT_EQ(&odr->GetLookAheadPath(pos.GetTrackIdx(), pos.GetLaneSectionIdx(), -3, 104.0, 1, 80.0), &path);
+
+    // Opposite direction, left border is on the right side of the road
+    const LookAheadPath &path_opposite = odr->GetLookAheadPath(pos.GetTrackIdx(), pos.GetLaneSectionIdx(), -3, 101.0, -1, 80.0);
+    ASSERT_EQ(path_opposite.GetPos(20.0, 0, x, y), true);
+    pos.SetLanePos(0, -3, path_opposite.s_start - 20.0, 0.0);
+    pos.SetLanePos(0, -3, path_opposite.s_start - 20.0, -odr->GetRoadByIdx(pos.GetTrackIdx())->GetLaneWidthByS(pos.GetS(), -3) / 2);
+    EXPECT_NEAR(x, pos.GetX(), 0.05);
+    EXPECT_NEAR(y, pos.GetY(), 0.05);
+
+    odr->ClearLookAheadCache();
+    odr->Clear();
+
+    // Look-ahead stops at junction
+    ASSERT_EQ(roadmanager::Position::LoadOpenDrive("../../../EnvironmentSimulator/Unittest/xodr/road_straight_curve_junction.xodr"), true);
+    odr = Position::GetOpenDrive();
+    ASSERT_NE(odr, nullptr);
+
+    pos.SetLanePos(4, -1, 20.0, 0.0);
+    const LookAheadPath &path_junction = odr->GetLookAheadPath(pos.GetTrackIdx(), pos.GetLaneSectionIdx(), -1, pos.GetS(), 1, 80.0);
+    EXPECT_EQ(path_junction.junction, true);
+    EXPECT_NEAR(path_junction.s_start + path_junction.GetLength(), 50.0, 1e-10);
+
+    // Look-ahead continues over consecutive roads, opposite direction
+    pos.SetLanePos(3, 1, 80.0, 0.0);
+    const LookAheadPath &path_roads = odr->GetLookAheadPath(pos.GetTrackIdx(), pos.GetLaneSectionIdx(), 1, pos.GetS(), -1, 80.0);
+    EXPECT_EQ(path_roads.junction, false);
+    EXPECT_GT(path_roads.GetLength(), 80.0 + LOOKAHEAD_S_BUCKET_SIZE);
+
+    odr->ClearLookAheadCache();
+    odr->Clear();
+}
+
 TEST(RoadEdgeTest, TestRoadEdge)
 {
     ASSERT_EQ(roadmanager::Position::LoadOpenDrive("../../../EnvironmentSimulator/Unittest/xodr/highway_example_with_merge_and_split.xodr"), true);
@@ -2423,6 +2727,454 @@ TEST(RoadEdgeTest, TestRoadEdge)
     odr->Clear();
 }
 
+TEST(SignalStateTest, TestStateRegistry)
+{
+    roadmanager::SignalStateRegistry registry;
+    std::vector<int>                 ids;
+
+    EXPECT_EQ(registry.GetState(1), nullptr);
+    EXPECT_EQ(registry.SetState(1, "off;off;on"), true);
+    EXPECT_EQ(registry.SetState(2, "on;off;off"), true);
+    EXPECT_EQ(registry.GetVersion(), 2u);
+
+    // same state again shall not bump version
+    EXPECT_EQ(registry.SetState(1, "off;off;on"), false);
+    EXPECT_EQ(registry.GetVersion(), 2u);
+    EXPECT_STREQ(registry.GetState(1)->state.c_str(), "off;off;on");
+
+    unsigned int version = registry.GetVersion();
+    registry.SetState(2, "off;on;off");
+    registry.SetState(3, "on;off;off");
+    registry.SetState(2, "off;off;on");
+    registry.GetChangedSignals(version, ids);
+    ASSERT_EQ(ids.size(), 2u);
+    EXPECT_EQ(ids[0], 3);
+    EXPECT_EQ(ids[1], 2);
+
+    // key frame
+    registry.GetChangedSignals(0, ids);
+    EXPECT_EQ(ids.size(), 3u);
+    EXPECT_EQ(registry.GetNumberOfSignals(), 3);
+
+    registry.GetChangedSignals(registry.GetVersion(), ids);
+    EXPECT_EQ(ids.size(), 0u);
+
+    // many updates of the same signals, log compaction shall not affect result
+    for (int i = 0; i < 1000; i++)
+    {
+        registry.SetState(1 + i % 3, i % 2 ? "on" : "off");
+    }
+    registry.GetChangedSignals(0, ids);
+    EXPECT_EQ(ids.size(), 3u);
+    registry.GetChangedSignals(registry.GetVersion() - 1, ids);
+    ASSERT_EQ(ids.size(), 1u);
+    EXPECT_EQ(ids[0], 1);
+
+    // version keeps increasing over clear, older versions receive a key frame
+    version = registry.GetVersion();
+    registry.Clear();
+    EXPECT_GT(registry.GetVersion(), version);
+    registry.SetState(4, "on");
+    registry.SetState(5, "on");
+    registry.GetChangedSignals(version, ids);
+    EXPECT_EQ(ids.size(), 2u);
+    version = registry.GetVersion();
+    registry.SetState(5, "off");
+    registry.GetChangedSignals(version, ids);
+    ASSERT_EQ(ids.size(), 1u);
+    EXPECT_EQ(ids[0], 5);
+}
+
+TEST(SignalStateTest, TestPhaseSchedule)
+{
+    roadmanager::SignalStateRegistry                     registry;
+    roadmanager::SignalStateRegistry::Phase              phase;
+    std::vector<roadmanager::SignalStateRegistry::Phase> phases;
+
+    phase.name     = "stop";
+    phase.duration = 10.0;
+    phase.states   = {{1, "on;off;off"}, {2, "off;off;on"}};
+    phases.push_back(phase);
+    phase.name     = "go";
+    phase.duration = 5.0;
+    phase.states   = {{1, "off;off;on"}, {2, "on;off;off"}};
+    phases.push_back(phase);
+
+    EXPECT_EQ(registry.AddPhaseSchedule("empty", 0.0, std::vector<roadmanager::SignalStateRegistry::Phase>()), -1);
+    EXPECT_EQ(registry.AddPhaseSchedule("ctrl", 2.0, phases), 0);
+
+    registry.Update(1.0);
+    EXPECT_EQ(registry.GetState(1), nullptr);
+
+    registry.Update(2.0);
+    EXPECT_STREQ(registry.GetState(1)->state.c_str(), "on;off;off");
+    EXPECT_STREQ(registry.GetState(2)->state.c_str(), "off;off;on");
+    unsigned int version = registry.GetVersion();
+
+    // same phase, no update
+    registry.Update(11.9);
+    EXPECT_EQ(registry.GetVersion(), version);
+
+    registry.Update(12.0);
+    EXPECT_STREQ(registry.GetState(1)->state.c_str(), "off;off;on");
+    EXPECT_STREQ(registry.GetState(2)->state.c_str(), "on;off;off");
+
+    // wrap into next cycle
+    registry.Update(17.5);
+    EXPECT_STREQ(registry.GetState(1)->state.c_str(), "on;off;off");
+
+    // explicit state overrides until next phase change
+    registry.SetState(1, "off;on;off");
+    registry.Update(18.0);
+    EXPECT_STREQ(registry.GetState(1)->state.c_str(), "off;on;off");
+    registry.Update(27.0);
+    EXPECT_STREQ(registry.GetState(1)->state.c_str(), "off;off;on");
+}
+
+TEST(RoadNetworkExerciserTest, TestStepAndRespawn)
+{
+    ASSERT_EQ(roadmanager::Position::LoadOpenDrive("../../../resources/xodr/straight_500m.xodr"), true);
+    roadmanager::OpenDrive *odr = roadmanager::Position::GetOpenDrive();
+
+    SE_Env::Inst().GetRand().SetSeed(0);
+    roadmanager::RoadNetworkExerciser exerciser(odr);
+    int                               n_cars = exerciser.Populate(2.0);
+    ASSERT_GT(n_cars, 0);
+    EXPECT_EQ(exerciser.GetOpenEnds().size(), 2u);
+
+    exerciser.SetEvaluateWorldPos(false);
+    for (int i = 0; i < 1000; i++)
+    {
+        exerciser.Step(0.1);
+    }
+    EXPECT_EQ(exerciser.GetNumberOfMoves(), 1000ull * static_cast<unsigned long long>(n_cars));
+
+    // cars respawned at open ends are still on the road
+    for (auto &car : exerciser.GetCars())
+    {
+        EXPECT_EQ(car.pos.GetTrackId(), 1);
+        EXPECT_EQ(car.pos.IsWorldPosStale(), true);
+    }
+
+    exerciser.SetEvaluateWorldPos(true);
+    EXPECT_EQ(exerciser.GetCars()[0].pos.IsWorldPosStale(), false);
+
+    // stopped cars are not moved further
+    exerciser.SetStopAtEndOfRoad(true);
+    for (int i = 0; i < 1000; i++)
+    {
+        exerciser.Step(0.1);
+    }
+    unsigned long long n_moves = exerciser.GetNumberOfMoves();
+    exerciser.Step(0.1);
+    EXPECT_EQ(exerciser.GetNumberOfMoves(), n_moves);
+
+    odr->Clear();
+}
+
+// Reference implementation of road connectivity, as before connectivity tables were introduced
+static bool RefIsDirectlyConnected(Road *road1, Road *road2, LinkType link_type, ContactPointType *contact_point, int fromLaneId)
+{
+    RoadLink *link = road1->GetLink(link_type);
+    if (link == nullptr)
+    {
+        return false;
+    }
+
+    if (link->GetElementType() == RoadLink::ElementType::ELEMENT_TYPE_ROAD)
+    {
+        if (link->GetElementId() == road2->GetId())
+        {
+            *contact_point = link->GetContactPointType();
+            return true;
+        }
+    }
+    else if (link->GetElementType() == RoadLink::ElementType::ELEMENT_TYPE_JUNCTION)
+    {
+        Junction *junction = Position::GetOpenDrive()->GetJunctionById(link->GetElementId());
+        for (int i = 0; junction != nullptr && i < junction->GetNumberOfConnections(); i++)
+        {
+            Connection *connection = junction->GetConnectionByIdx(i);
+            if (connection->GetIncomingRoad() == road1 && connection->GetConnectingRoad() == road2)
+            {
+                *contact_point = connection->GetContactPoint();
+                if (fromLaneId == 0)
+                {
+                    return true;
+                }
+                for (int j = 0; j < connection->GetNumberOfLaneLinks(); j++)
+                {
+                    if (connection->GetLaneLink(j)->from_ == fromLaneId)
+                    {
+                        return true;
+                    }
+                }
+            }
+        }
+    }
+
+    return false;
+}
+
+static bool
+RefIsIndirectlyConnected(OpenDrive *odr, Road *road1, int road2_id, int &connecting_road_id, int &connecting_lane_id, int lane1_id, int lane2_id)
+{
+    LinkType link_type[2] = {SUCCESSOR, PREDECESSOR};
+
+    for (int k = 0; k < 2; k++)
+    {
+        RoadLink *link = road1->GetLink(link_type[k]);
+        if (link == nullptr)
+        {
+            continue;
+        }
+
+        if (link->GetElementType() == RoadLink::ELEMENT_TYPE_ROAD)
+        {
+            if (link->GetElementId() == road2_id)
+            {
+                if (lane1_id != 0 && lane2_id != 0)
+                {
+                    LaneSection *lane_section = road1->GetLaneSectionByIdx(link_type[k] == SUCCESSOR ? road1->GetNumberOfLaneSections() - 1 : 0);
+                    return lane_section != nullptr && lane_section->GetConnectingLaneId(lane1_id, link_type[k]) == lane2_id;
+                }
+                return true;
+            }
+        }
+        else if (link->GetElementType() == RoadLink::ELEMENT_TYPE_JUNCTION)
+        {
+            Junction *junction = odr->GetJunctionById(link->GetElementId());
+            for (int i = 0; junction != nullptr && i < junction->GetNumberOfConnections(); i++)
+            {
+                Connection *connection = junction->GetConnectionByIdx(i);
+                if (connection->GetIncomingRoad() != road1)
+                {
+                    continue;
+                }
+
+                Road *connecting_road = connection->GetConnectingRoad();
+                if (connecting_road->GetId() == road2_id)
+                {
+                    for (int j = 0; j < connection->GetNumberOfLaneLinks(); j++)
+                    {
+                        if (connection->GetLaneLink(j)->from_ == lane1_id && connection->GetLaneLink(j)->to_ == lane2_id)
+                        {
+                            return true;
+                        }
+                    }
+                }
+
+                RoadLink *exit_link =
+                    connecting_road->GetLink(connection->GetContactPoint() == ContactPointType::CONTACT_POINT_START ? SUCCESSOR : PREDECESSOR);
+                LaneSection *lane_section = connecting_road->GetLaneSectionByIdx(0);
+                if (exit_link != nullptr && exit_link->GetElementId() == road2_id && lane_section != nullptr)
+                {
+                    for (int j = 0; j < lane_section->GetNumberOfLanes(); j++)
+                    {
+                        Lane     *lane = lane_section->GetLaneByIdx(j);
+                        LaneLink *pred = lane->GetLink(PREDECESSOR);
+                        LaneLink *succ = lane->GetLink(SUCCESSOR);
+                        if (pred == nullptr || succ == nullptr)
+                        {
+                            continue;
+                        }
+                        if ((connection->GetContactPoint() == ContactPointType::CONTACT_POINT_START && pred->GetId() == lane1_id &&
+                             succ->GetId() == lane2_id) ||
+                            (connection->GetContactPoint() == ContactPointType::CONTACT_POINT_END && pred->GetId() == lane2_id &&
+                             succ->GetId() == lane1_id))
+                        {
+                            connecting_road_id = connecting_road->GetId();
+                            connecting_lane_id = lane->GetId();
+                            return true;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    return false;
+}
+
+// Collect ids and OSI points of all roads, for comparison of loaded road networks
+static std::vector<double> GetRoadNetworkSignature(OpenDrive *odr)
+{
+    std::vector<double> sig;
+    for (int i = 0; i < odr->GetNumOfRoads(); i++)
+    {
+        Road *road = odr->GetRoadByIdx(i);
+        sig.push_back(road->GetId());
+        for (int j = 0; j < road->GetNumberOfLaneSections(); j++)
+        {
+            LaneSection *lsec = road->GetLaneSectionByIdx(j);
+            for (int k = 0; k < lsec->GetNumberOfLanes(); k++)
+            {
+                Lane *lane = lsec->GetLaneByIdx(k);
+                sig.push_back(lane->GetGlobalId());
+                sig.push_back(lane->GetLaneBoundaryGlobalId());
+                for (int line_id : lane->GetLineGlobalIds())
+                {
+                    sig.push_back(line_id);
+                }
+                OSIPoints *osi_points = lane->GetOSIPoints();
+                sig.push_back(osi_points->GetNumOfOSIPoints());
+                for (int l = 0; l < osi_points->GetNumOfOSIPoints(); l++)
+                {
+                    sig.push_back(osi_points->GetXfromIdx(l));
+                    sig.push_back(osi_points->GetYfromIdx(l));
+                }
+            }
+        }
+        for (int j = 0; j < road->GetNumberOfSignals(); j++)
+        {
+            sig.push_back(road->GetSignal(j)->GetX());
+            sig.push_back(road->GetSignal(j)->GetY());
+        }
+        for (int j = 0; j < road->GetNumberOfObjects(); j++)
+        {
+            sig.push_back(road->GetRoadObject(j)->GetX());
+            sig.push_back(road->GetRoadObject(j)->GetY());
+        }
+    }
+    for (int i = 0; i < odr->GetNumOfJunctions(); i++)
+    {
+        sig.push_back(odr->GetJunctionByIdx(i)->GetGlobalId());
+    }
+
+    return sig;
+}
+
+TEST(LoadTest, TestParallelLoadIsDeterministic)
+{
+    for (const char *file : {"../../../resources/xodr/fabriksgatan.xodr",
+                             "../../../resources/xodr/multi_intersections.xodr",
+                             "../../../EnvironmentSimulator/Unittest/xodr/Junction_with_building0.xodr",
+                             "../../../EnvironmentSimulator/Unittest/xodr/some_signs.xodr"})
+    {
+        SE_Env::Inst().SetLoadThreads(1);
+        ASSERT_EQ(Position::LoadOpenDrive(file), true);
+        EXPECT_EQ(Position::GetOpenDrive()->GetLoadProfile().n_threads, 1);
+        std::vector<double> sequential = GetRoadNetworkSignature(Position::GetOpenDrive());
+
+        SE_Env::Inst().SetLoadThreads(4);
+        for (int i = 0; i < 3; i++)
+        {
+            ASSERT_EQ(Position::LoadOpenDrive(file), true);
+            EXPECT_EQ(GetRoadNetworkSignature(Position::GetOpenDrive()), sequential) << file;
+        }
+
+        const OpenDrive::LoadProfile &profile = Position::GetOpenDrive()->GetLoadProfile();
+        EXPECT_EQ(profile.n_threads, MIN(4, Position::GetOpenDrive()->GetNumOfRoads()));
+        EXPECT_GE(profile.total, profile.road_parse + profile.validation);
+    }
+
+    SE_Env::Inst().SetLoadThreads(0);
+    Position::GetOpenDrive()->Clear();
+}
+
+TEST(ConnectivityTest, TestConnectivityTablesAllBundledRoads)
+{
+    std::vector<std::string> files;
+    for (const char *dir : {"../../../resources/xodr", "../../../EnvironmentSimulator/Unittest/xodr"})
+    {
+        for (const auto &entry : std::filesystem::directory_iterator(dir))
+        {
+            if (entry.path().extension() == ".xodr")
+            {
+                files.push_back(entry.path().string());
+            }
+        }
+    }
+    ASSERT_GT(files.size(), 40u);
+
+    LinkType link_types[2] = {SUCCESSOR, PREDECESSOR};
+    int      n_checks      = 0;
+    int      n_connected   = 0;
+
+    for (const auto &file : files)
+    {
+        ASSERT_EQ(Position::LoadOpenDrive(file.c_str()), true);
+        OpenDrive *odr = Position::GetOpenDrive();
+
+        for (int r1 = 0; r1 < odr->GetNumOfRoads(); r1++)
+        {
+            Road *road1 = odr->GetRoadByIdx(r1);
+
+            // candidates: linked roads, connecting roads and roads at the other end of connecting roads, and an unrelated one
+            std::vector<Road *> candidates = {odr->GetRoadByIdx(0)};
+            for (int k = 0; k < 2; k++)
+            {
+                RoadLink *link = road1->GetLink(link_types[k]);
+                if (link == nullptr)
+                {
+                    continue;
+                }
+                if (link->GetElementType() == RoadLink::ELEMENT_TYPE_ROAD)
+                {
+                    candidates.push_back(odr->GetRoadById(link->GetElementId()));
+                }
+                else if (Junction *junction = odr->GetJunctionById(link->GetElementId()))
+                {
+                    for (int i = 0; i < junction->GetNumberOfConnections(); i++)
+                    {
+                        Road *connecting_road = junction->GetConnectionByIdx(i)->GetConnectingRoad();
+                        candidates.push_back(connecting_road);
+                        for (int k2 = 0; k2 < 2; k2++)
+                        {
+                            RoadLink *exit_link = connecting_road->GetLink(link_types[k2]);
+                            if (exit_link != nullptr && exit_link->GetElementType() == RoadLink::ELEMENT_TYPE_ROAD)
+                            {
+                                candidates.push_back(odr->GetRoadById(exit_link->GetElementId()));
+                            }
+                        }
+                    }
+                }
+            }
+
+            for (Road *road2 : candidates)
+            {
+                if (road2 == nullptr)
+                {
+                    continue;
+                }
+
+                for (int lane1 = -4; lane1 <= 4; lane1++)
+                {
+                    for (int k = 0; k < 2; k++)
+                    {
+                        ContactPointType cp     = ContactPointType::CONTACT_POINT_UNDEFINED;
+                        ContactPointType cp_ref = ContactPointType::CONTACT_POINT_UNDEFINED;
+                        bool             result = road1->IsDirectlyConnected(road2, link_types[k], &cp, lane1);
+                        ASSERT_EQ(result, RefIsDirectlyConnected(road1, road2, link_types[k], &cp_ref, lane1)) << file << " road " << road1->GetId();
+                        EXPECT_EQ(cp, cp_ref);
+                        n_connected += result ? 1 : 0;
+                        n_checks++;
+                    }
+
+                    for (int lane2 = -4; lane2 <= 4; lane2++)
+                    {
+                        int  connecting[2]     = {-1, -1};
+                        int  connecting_ref[2] = {-1, -1};
+                        int *connecting_road   = &connecting[0];
+                        int *connecting_lane   = &connecting[1];
+                        bool result = odr->IsIndirectlyConnected(road1->GetId(), road2->GetId(), connecting_road, connecting_lane, lane1, lane2);
+                        ASSERT_EQ(result, RefIsIndirectlyConnected(odr, road1, road2->GetId(), connecting_ref[0], connecting_ref[1], lane1, lane2))
+                            << file << " road " << road1->GetId() << " -> " << road2->GetId() << " lanes " << lane1 << " " << lane2;
+                        EXPECT_EQ(connecting[0], connecting_ref[0]);
+                        EXPECT_EQ(connecting[1], connecting_ref[1]);
+                        n_connected += result ? 1 : 0;
+                        n_checks++;
+                    }
+                }
+            }
+        }
+        odr->Clear();
+    }
+
+    EXPECT_GT(n_checks, 100000);
+    EXPECT_GT(n_connected, 1000);
+}
+
 // Uncomment to print log output to console
 // #define LOG_TO_CONSOLE
 
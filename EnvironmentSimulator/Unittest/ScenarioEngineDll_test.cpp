@@ -10,6 +10,7 @@
 #include "esminiLib.hpp"
 #include "RoadManager.hpp"
 #include <vector>
+#include <set>
 #include <stdexcept>
 #include <fstream>
 
@@ -315,6 +316,86 @@ TEST(OSIintersections, multilane)
     SE_Close();
 }
 
+class OSIStaticGroundTruth : public ::testing::TestWithParam<std::tuple<std::string, int, int>>
+{
+};
+
+TEST_P(OSIStaticGroundTruth, lane_and_boundary_references)
+{
+    std::string scenario_file = std::get<0>(GetParam());
+    ASSERT_EQ(SE_Init(scenario_file.c_str(), 0, 0, 0, 0), 0);
+    SE_StepDT(0.001f);
+    SE_UpdateOSIGroundTruth();
+
+    osi3::GroundTruth osi_gt;
+    int               sv_size = 0;
+    const char*       gt      = SE_GetOSIGroundTruth(&sv_size);
+    osi_gt.ParseFromArray(gt, sv_size);
+
+    // Number of lanes and lane boundaries, ids unique
+    ASSERT_EQ(osi_gt.lane_size(), std::get<1>(GetParam()));
+    ASSERT_EQ(osi_gt.lane_boundary_size(), std::get<2>(GetParam()));
+
+    std::set<uint64_t> lane_ids;
+    std::set<uint64_t> boundary_ids;
+    for (int i = 0; i < osi_gt.lane_size(); i++)
+    {
+        lane_ids.insert(osi_gt.lane(i).id().value());
+    }
+    for (int i = 0; i < osi_gt.lane_boundary_size(); i++)
+    {
+        boundary_ids.insert(osi_gt.lane_boundary(i).id().value());
+    }
+    EXPECT_EQ(lane_ids.size(), static_cast<size_t>(osi_gt.lane_size()));
+    EXPECT_EQ(boundary_ids.size(), static_cast<size_t>(osi_gt.lane_boundary_size()));
+
+    // All lane and lane boundary references resolve
+    for (int i = 0; i < osi_gt.lane_size(); i++)
+    {
+        const osi3::Lane_Classification& classification = osi_gt.lane(i).classification();
+        for (const auto& id : classification.left_lane_boundary_id())
+        {
+            EXPECT_EQ(boundary_ids.count(id.value()), 1);
+        }
+        for (const auto& id : classification.right_lane_boundary_id())
+        {
+            EXPECT_EQ(boundary_ids.count(id.value()), 1);
+        }
+        for (const auto& id : classification.free_lane_boundary_id())
+        {
+            EXPECT_EQ(boundary_ids.count(id.value()), 1);
+        }
+        for (const auto& id : classification.left_adjacent_lane_id())
+        {
+            EXPECT_EQ(lane_ids.count(id.value()), 1);
+        }
+        for (const auto& id : classification.right_adjacent_lane_id())
+        {
+            EXPECT_EQ(lane_ids.count(id.value()), 1);
+        }
+        for (const auto& pairing : classification.lane_pairing())
+        {
+            if (pairing.has_antecessor_lane_id())
+            {
+                EXPECT_EQ(lane_ids.count(pairing.antecessor_lane_id().value()), 1);
+            }
+            if (pairing.has_successor_lane_id())
+            {
+                EXPECT_EQ(lane_ids.count(pairing.successor_lane_id().value()), 1);
+            }
+        }
+    }
+
+    SE_Close();
+}
+
+INSTANTIATE_TEST_SUITE_P(OSIStaticGroundTruthTests,
+                         OSIStaticGroundTruth,
+                         ::testing::Values(std::make_tuple("../../../resources/xosc/cut-in.xosc", 14, 15),
+                                           std::make_tuple("../../../resources/xosc/two_plus_one_road.xosc", 17, 22),
+                                           std::make_tuple("../../../resources/xosc/ltap-od-relative-speed.xosc", 45, 60),
+                                           std::make_tuple("../../../resources/xosc/routing-test.xosc", 247, 339)));
+
 TEST(GetOSIRoadLaneTest, lane_no_obj)
 {
     struct stat fileStatus;
@@ -884,6 +965,60 @@ TEST(GroundTruthTests, check_GroundTruth_including_init_state)
     fclose(file);
 }
 
+TEST(GroundTruthTests, check_traffic_light_state_changes)
+{
+    int               gt_size = 0;
+    const char*       gt      = nullptr;
+    osi3::GroundTruth osi_gt;
+
+    ASSERT_EQ(SE_Init("../../../resources/xosc/routing-test.xosc", 0, 0, 0, 0), 0);
+
+    // first frame holds the static ground truth, including all traffic lights
+    SE_StepDT(0.1f);
+    SE_UpdateOSIGroundTruth();
+    gt = SE_GetOSIGroundTruth(&gt_size);
+    osi_gt.ParseFromArray(gt, gt_size);
+    EXPECT_GT(osi_gt.traffic_light_size(), 1);
+    double x = 0.0;
+    for (int i = 0; i < osi_gt.traffic_light_size(); i++)
+    {
+        if (osi_gt.traffic_light(i).id().value() == 290)
+        {
+            x = osi_gt.traffic_light(i).base().position().x();
+        }
+    }
+    EXPECT_NE(x, 0.0);
+    SE_ClearOSIGroundTruth();
+
+    // no state changes, no traffic lights reported
+    SE_StepDT(0.1f);
+    SE_UpdateOSIGroundTruth();
+    gt = SE_GetOSIGroundTruth(&gt_size);
+    osi_gt.ParseFromArray(gt, gt_size);
+    EXPECT_EQ(osi_gt.traffic_light_size(), 0);
+
+    // only the changed light is reported
+    EXPECT_EQ(SE_SetTrafficSignalState(290, "off;off;on"), 0);
+    SE_StepDT(0.1f);
+    SE_UpdateOSIGroundTruth();
+    gt = SE_GetOSIGroundTruth(&gt_size);
+    osi_gt.ParseFromArray(gt, gt_size);
+    ASSERT_EQ(osi_gt.traffic_light_size(), 1);
+    EXPECT_EQ(osi_gt.traffic_light(0).id().value(), 290);
+    EXPECT_EQ(osi_gt.traffic_light(0).classification().color(), osi3::TrafficLight_Classification_Color_COLOR_GREEN);
+    EXPECT_EQ(osi_gt.traffic_light(0).classification().mode(), osi3::TrafficLight_Classification_Mode_MODE_CONSTANT);
+    EXPECT_DOUBLE_EQ(osi_gt.traffic_light(0).base().position().x(), x);
+
+    // and not repeated in following frames
+    SE_StepDT(0.1f);
+    SE_UpdateOSIGroundTruth();
+    gt = SE_GetOSIGroundTruth(&gt_size);
+    osi_gt.ParseFromArray(gt, gt_size);
+    EXPECT_EQ(osi_gt.traffic_light_size(), 0);
+
+    SE_Close();
+}
+
 TEST(GetMiscObjFromGroundTruth, receive_miscobj)
 {
     int               sv_size = 0;
@@ -1065,6 +1200,40 @@ TEST(TestGetAndSet, ReportObjectVel)
     SE_Close();
 }
 
+TEST(TestGetAndSet, ReportObjectPosBetweenFrames)
+{
+    const osi3::GroundTruth* osi_gt;
+
+    std::string scenario_file = "../../../resources/xosc/cut-in_simple.xosc";
+
+    EXPECT_EQ(SE_Init(scenario_file.c_str(), 0, 0, 0, 0), 0);
+    EXPECT_EQ(SE_GetNumberOfObjects(), 2);
+
+    SE_StepDT(0.1f);
+    SE_UpdateOSIGroundTruth();
+
+    osi_gt = reinterpret_cast<const osi3::GroundTruth*>(SE_GetOSIGroundTruthRaw());
+    ASSERT_EQ(osi_gt->moving_object().size(), 2);
+    double x0 = osi_gt->moving_object(0).base().position().x();
+    double y0 = osi_gt->moving_object(0).base().position().y();
+    double x1 = osi_gt->moving_object(1).base().position().x();
+
+    // Moving objects not changed since previous update are kept, while changes within the same frame are reported
+    SE_ScenarioObjectState state;
+    SE_GetObjectState(0, &state);
+    SE_ReportObjectPosXYH(0, 0, state.x + 10.0f, state.y, state.h);
+    SE_UpdateOSIGroundTruth();
+    EXPECT_NEAR(osi_gt->moving_object(0).base().position().x(), x0 + 10.0, 1e-3);
+    EXPECT_NEAR(osi_gt->moving_object(0).base().position().y(), y0, 1e-3);
+    EXPECT_DOUBLE_EQ(osi_gt->moving_object(1).base().position().x(), x1);
+
+    SE_StepDT(0.1f);
+    SE_UpdateOSIGroundTruth();
+    EXPECT_GT(fabs(osi_gt->moving_object(1).base().position().x() - x1), 1.0);
+
+    SE_Close();
+}
+
 TEST(OSILaneParing, multi_roads)
 {
     std::string scenario_file = "../../../EnvironmentSimulator/Unittest/xosc/consecutive_roads.xosc";
@@ -2875,8 +3044,8 @@ TEST(ExternalController, TestExternalDriver)
                 else if (abs(SE_GetSimulationTime() - 30.0f) < static_cast<float>(SMALL_NUMBER))
                 {
                     SE_GetObjectState(0, &objectState);
-                    EXPECT_NEAR(objectState.x, 356.184, 1e-3);
-                    EXPECT_NEAR(objectState.y, 330.082, 1e-3);
+                    EXPECT_NEAR(objectState.x, 356.182, 1e-3);
+                    EXPECT_NEAR(objectState.y, 330.084, 1e-3);
                     EXPECT_NEAR(objectState.h, 5.641, 1e-3);
                     EXPECT_NEAR(objectState.p, 0.046, 1e-3);
                 }
@@ -2910,8 +3079,8 @@ TEST(ExternalController, TestExternalDriver)
                     {
                         SE_RoadInfo road_info3;
                         SE_GetRoadInfoGhostTrailTime(0, SE_GetSimulationTime(), &road_info3, &speed2);
-                        EXPECT_NEAR(road_info3.global_pos_x, 388.234, 1e-3);
-                        EXPECT_NEAR(road_info3.global_pos_y, 291.231, 1e-3);
+                        EXPECT_NEAR(road_info3.global_pos_x, 388.232, 1e-3);
+                        EXPECT_NEAR(road_info3.global_pos_y, 291.235, 1e-3);
                     }
                 }
             }
@@ -2937,14 +3106,14 @@ TEST(ExternalController, TestExternalDriver)
                 {
                     SE_GetObjectState(0, &objectState);
                     EXPECT_NEAR(objectState.x, 382.069, 1e-3);
-                    EXPECT_NEAR(objectState.y, 302.541, 1e-3);
+                    EXPECT_NEAR(objectState.y, 302.542, 1e-3);
                     EXPECT_NEAR(objectState.h, 5.271, 1e-3);
                     EXPECT_NEAR(objectState.p, 0.026, 1e-3);
                     if (ghostMode[i] == true)
                     {
                         SE_GetRoadInfoGhostTrailTime(0, SE_GetSimulationTime(), &road_info2, &speed3);
-                        EXPECT_NEAR(road_info2.global_pos_x, 388.234, 1e-3);
-                        EXPECT_NEAR(road_info2.global_pos_y, 291.231, 1e-3);
+                        EXPECT_NEAR(road_info2.global_pos_x, 388.232, 1e-3);
+                        EXPECT_NEAR(road_info2.global_pos_y, 291.235, 1e-3);
                     }
                 }
             }
@@ -3557,10 +3726,10 @@ TEST(RoadmanagerTest, TestGetPositionDiff)
 
     ASSERT_EQ(SE_GetDistanceToObject(0, 1, true, &diff), 0);
     EXPECT_EQ(diff.dLaneId, 0);
-    EXPECT_NEAR(diff.ds, 31.729, 1e-3);
+    EXPECT_NEAR(diff.ds, 31.692, 1e-3);
     EXPECT_NEAR(diff.dt, 0.0, 1e-3);
-    EXPECT_NEAR(diff.dx, 21.283, 1e-3);
-    EXPECT_NEAR(diff.dy, -17.780, 1e-3);
+    EXPECT_NEAR(diff.dx, 21.247, 1e-3);
+    EXPECT_NEAR(diff.dy, -17.928, 1e-3);
     EXPECT_EQ(diff.oppositeLanes, false);
 
     while (SE_GetSimulationTime() < 35.0f)
@@ -3570,10 +3739,10 @@ TEST(RoadmanagerTest, TestGetPositionDiff)
 
     ASSERT_EQ(SE_GetDistanceToObject(0, 1, false, &diff), 0);
     EXPECT_EQ(diff.dLaneId, -1);
-    EXPECT_NEAR(diff.ds, -93.045, 1e-3);
-    EXPECT_NEAR(diff.dt, -2.923, 1e-3);
-    EXPECT_NEAR(diff.dx, -31.340, 1e-3);
-    EXPECT_NEAR(diff.dy, -68.577, 1e-3);
+    EXPECT_NEAR(diff.ds, -93.005, 1e-3);
+    EXPECT_NEAR(diff.dt, -2.897, 1e-3);
+    EXPECT_NEAR(diff.dx, -31.300, 1e-3);
+    EXPECT_NEAR(diff.dy, -68.603, 1e-3);
     EXPECT_EQ(diff.oppositeLanes, true);
 
     SE_Close();
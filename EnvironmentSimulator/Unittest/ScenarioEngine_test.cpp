@@ -2,14 +2,17 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 #include <vector>
+#include <set>
 #include <stdexcept>
 #include <array>
+#include <random>
 
 #include "ScenarioEngine.hpp"
 #include "ScenarioReader.hpp"
 #include "ControllerUDPDriver.hpp"
 #include "ControllerLooming.hpp"
 #include "ControllerALKS_R157SM.hpp"
+#include "ControllerRel2Abs.hpp"
 #include "OSCParameterDistribution.hpp"
 #include "pugixml.hpp"
 #include "simple_expr.h"
@@ -191,7 +194,7 @@ TEST(DistanceTest, CalcDistancePointAcrossIntersection)
     double longDist = 0.0;
 
     ASSERT_EQ(obj0.FreeSpaceDistancePointRoadLane(pos1.GetX(), pos1.GetY(), &latDist, &longDist, CoordinateSystem::CS_ROAD), 0);
-    EXPECT_NEAR(longDist, -38.58642, 1e-5);
+    EXPECT_NEAR(longDist, -38.58704, 1e-5);
     EXPECT_NEAR(latDist, -0.22127, 1e-5);
 }
 
@@ -269,6 +272,194 @@ TEST(DistanceTest, CalcEntityDistanceFreespace)
     EXPECT_NEAR(dist = obj0.FreeSpaceDistance(&obj1, &latDist, &longDist), 5.876278, 1e-3);
 }
 
+// Reference implementation of bounding box corners, calculated from scratch
+static void RefBBCorners(Object& obj, double vertices[4][2])
+{
+    double vtmp[4][2] = {{static_cast<double>(obj.boundingbox_.center_.x_) + static_cast<double>(obj.boundingbox_.dimensions_.length_) / 2.0,
+                          static_cast<double>(obj.boundingbox_.center_.y_) + static_cast<double>(obj.boundingbox_.dimensions_.width_) / 2.0},
+                         {static_cast<double>(obj.boundingbox_.center_.x_) - static_cast<double>(obj.boundingbox_.dimensions_.length_) / 2.0,
+                          static_cast<double>(obj.boundingbox_.center_.y_) + static_cast<double>(obj.boundingbox_.dimensions_.width_) / 2.0},
+                         {static_cast<double>(obj.boundingbox_.center_.x_) - static_cast<double>(obj.boundingbox_.dimensions_.length_) / 2.0,
+                          static_cast<double>(obj.boundingbox_.center_.y_) - static_cast<double>(obj.boundingbox_.dimensions_.width_) / 2.0},
+                         {static_cast<double>(obj.boundingbox_.center_.x_) + static_cast<double>(obj.boundingbox_.dimensions_.length_) / 2.0,
+                          static_cast<double>(obj.boundingbox_.center_.y_) - static_cast<double>(obj.boundingbox_.dimensions_.width_) / 2.0}};
+
+    for (int j = 0; j < 4; j++)
+    {
+        RotateVec2D(vtmp[j][0], vtmp[j][1], obj.pos_.GetH(), vertices[j][0], vertices[j][1]);
+        vertices[j][0] += obj.pos_.GetX();
+        vertices[j][1] += obj.pos_.GetY();
+    }
+}
+
+// Reference implementation: SAT by projecting all corners, then brute force vertex to edge distance
+static double RefFreeSpaceDistance(Object& obj0, Object& obj1, bool& overlap)
+{
+    double vertices[2][4][2];
+    RefBBCorners(obj0, vertices[0]);
+    RefBBCorners(obj1, vertices[1]);
+
+    overlap = true;
+    for (int i = 0; i < 2 && overlap; i++)
+    {
+        for (int j = 0; j < 2 && overlap; j++)
+        {
+            double n[2];
+            RotateVec2D(j == 0 ? 0.0 : 1.0, j == 0 ? 1.0 : 0.0, (i == 0 ? obj0 : obj1).pos_.GetH(), n[0], n[1]);
+            double min[2], max[2];
+            for (int k = 0; k < 2; k++)
+            {
+                int b = (i + k) % 2;
+                for (int l = 0; l < 4; l++)
+                {
+                    double dot_p = GetDotProduct2D(vertices[b][l][0], vertices[b][l][1], n[0], n[1]);
+                    min[k]       = l == 0 ? dot_p : MIN(dot_p, min[k]);
+                    max[k]       = l == 0 ? dot_p : MAX(dot_p, max[k]);
+                }
+            }
+            if ((max[0] < min[1] - SMALL_NUMBER) || (min[0] > max[1] + SMALL_NUMBER))
+            {
+                overlap = false;
+            }
+        }
+    }
+
+    if (overlap)
+    {
+        return 0.0;
+    }
+
+    double minDist = LARGE_NUMBER;
+    for (int i = 0; i < 2; i++)
+    {
+        for (int j = 0; j < 4; j++)
+        {
+            for (int k = 0; k < 4; k++)
+            {
+                double(&e)[4][2] = vertices[(i + 1) % 2];
+                double xProj = 0.0, yProj = 0.0;
+                minDist = MIN(minDist,
+                              DistanceFromPointToEdge2D(vertices[i][j][0], vertices[i][j][1], e[k][0], e[k][1], e[(k + 1) % 4][0], e[(k + 1) % 4][1], &xProj, &yProj));
+            }
+        }
+    }
+
+    return minDist;
+}
+
+static void RandomizeObject(Object& obj, std::mt19937& gen)
+{
+    std::uniform_real_distribution<double> pos_dist(-15.0, 15.0);
+    std::uniform_real_distribution<double> h_dist(-M_PI, M_PI);
+    std::uniform_real_distribution<double> dim_dist(0.5, 10.0);
+    std::uniform_real_distribution<double> offset_dist(-2.0, 2.0);
+
+    obj.boundingbox_.center_     = {static_cast<float>(offset_dist(gen)), static_cast<float>(offset_dist(gen)), 0.0f};
+    obj.boundingbox_.dimensions_ = {static_cast<float>(dim_dist(gen)), static_cast<float>(dim_dist(gen)), 1.5f};
+    obj.pos_.SetInertiaPos(pos_dist(gen), pos_dist(gen), h_dist(gen), false);
+}
+
+TEST(DistanceTest, FreeSpaceDistanceRandomizedEquivalence)
+{
+    Position::GetOpenDrive()->LoadOpenDriveFile("../../../resources/xodr/straight_500m.xodr");
+
+    std::mt19937 gen(12345);
+    Object       obj0(Object::Type::VEHICLE);
+    Object       obj1(Object::Type::VEHICLE);
+    int          n_overlap = 0;
+
+    for (int i = 0; i < 5000; i++)
+    {
+        RandomizeObject(obj0, gen);
+        RandomizeObject(obj1, gen);
+
+        bool   ref_overlap = false;
+        double ref_dist    = RefFreeSpaceDistance(obj0, obj1, ref_overlap);
+        double latDist     = 0.0;
+        double longDist    = 0.0;
+
+        ASSERT_EQ(obj0.CollisionAndRelativeDistLatLong(&obj1, nullptr, nullptr), ref_overlap) << "iteration " << i;
+        ASSERT_EQ(obj1.Collision(&obj0), ref_overlap) << "iteration " << i;
+        ASSERT_NEAR(obj0.FreeSpaceDistance(&obj1, &latDist, &longDist), ref_dist, 1e-8) << "iteration " << i;
+        ASSERT_NEAR(obj1.FreeSpaceDistance(&obj0, &latDist, &longDist), ref_dist, 1e-8) << "iteration " << i;
+
+        // Cached box must follow object movement
+        obj1.pos_.SetInertiaPos(obj1.pos_.GetX() + 1.0, obj1.pos_.GetY(), obj1.pos_.GetH(), false);
+        ref_dist = RefFreeSpaceDistance(obj0, obj1, ref_overlap);
+        ASSERT_NEAR(obj0.FreeSpaceDistance(&obj1, &latDist, &longDist), ref_dist, 1e-8) << "iteration " << i;
+
+        n_overlap += ref_overlap ? 1 : 0;
+    }
+
+    // make sure both overlapping and separated cases were covered
+    EXPECT_GT(n_overlap, 100);
+    EXPECT_LT(n_overlap, 4900);
+}
+
+TEST(TrailerTest, TowLinksOrder)
+{
+    double          dt = 0.1;
+    ScenarioEngine* se = new ScenarioEngine("../../../EnvironmentSimulator/Unittest/xosc/trailer_chain.xosc");
+    ASSERT_NE(se, nullptr);
+    ASSERT_EQ(se->entities_.object_.size(), 5);
+
+    // Ego with one trailer, Truck with two trailers
+    const std::vector<Entities::TowLink>& links = se->entities_.GetTowLinks();
+    ASSERT_EQ(links.size(), 3);
+    EXPECT_EQ(links[0].tow_vehicle->GetName(), "Ego");
+    EXPECT_EQ(links[0].trailer->GetName(), "Ego+");
+    EXPECT_EQ(links[1].tow_vehicle->GetName(), "Truck");
+    EXPECT_EQ(links[1].trailer->GetName(), "Truck+");
+    EXPECT_EQ(links[2].tow_vehicle->GetName(), "Truck+");
+    EXPECT_EQ(links[2].trailer->GetName(), "Truck++");
+
+    while (se->getSimulationTime() < 4.0 - SMALL_NUMBER)
+    {
+        se->step(dt);
+        se->prepareGroundTruth(dt);
+    }
+
+    // trailers keep following their tow vehicles
+    for (const auto& link : se->entities_.GetTowLinks())
+    {
+        double dist = PointDistance2D(link.tow_vehicle->pos_.GetX(),
+                                      link.tow_vehicle->pos_.GetY(),
+                                      link.trailer->pos_.GetX(),
+                                      link.trailer->pos_.GetY());
+        EXPECT_NEAR(dist, link.trailer->trailer_coupler_->dx_ - link.tow_vehicle->trailer_hitch_->dx_, 0.1);
+        EXPECT_NEAR(link.trailer->GetSpeed(), link.tow_vehicle->GetSpeed(), 1E-5);
+    }
+
+    delete se;
+}
+
+TEST(TrailerTest, TowLinksConnectDisconnect)
+{
+    double          dt = 0.05;
+    ScenarioEngine* se = new ScenarioEngine("../../../resources/xosc/trailer_connect.xosc");
+    ASSERT_NE(se, nullptr);
+
+    EXPECT_EQ(se->entities_.GetTowLinks().size(), 0);
+
+    while (se->getSimulationTime() < 9.0 - SMALL_NUMBER)
+    {
+        se->step(dt);
+        se->prepareGroundTruth(dt);
+    }
+    ASSERT_EQ(se->entities_.GetTowLinks().size(), 1);
+    EXPECT_EQ(se->entities_.GetTowLinks()[0].tow_vehicle->GetName(), "Car");
+    EXPECT_EQ(se->entities_.GetTowLinks()[0].trailer->GetName(), "Trailer");
+
+    while (se->getSimulationTime() < 15.0 - SMALL_NUMBER)
+    {
+        se->step(dt);
+        se->prepareGroundTruth(dt);
+    }
+    EXPECT_EQ(se->entities_.GetTowLinks().size(), 0);
+
+    delete se;
+}
+
 TEST(TrajectoryTest, EnsureContinuation)
 {
     double          dt = 0.01;
@@ -368,6 +559,116 @@ TEST(TrajectoryTest, PolyLineContinuosSpeed)
     delete se;
 }
 
+TEST(GatewayTest, ChangedSinceFrame)
+{
+    double          dt = 0.05;
+    ScenarioEngine* se = new ScenarioEngine("../../../EnvironmentSimulator/Unittest/xosc/brake_by_trajectory_100-0.xosc");
+    ASSERT_NE(se, nullptr);
+    ScenarioGateway*          gw = se->getScenarioGateway();
+    std::vector<ObjectState*> changed;
+
+    se->step(dt);
+    se->prepareGroundTruth(dt);
+    ASSERT_EQ(gw->getNumberOfObjects(), 1);
+    EXPECT_EQ(gw->getObjectsChangedSince(0, changed), 1);
+
+    // Moving object, expect change every frame
+    int frame = gw->getFrameNr();
+    se->step(dt);
+    se->prepareGroundTruth(dt);
+    EXPECT_GT(gw->getFrameNr(), frame);
+    EXPECT_TRUE(gw->isObjectChangedSince(se->entities_.object_[0]->GetId(), frame));
+    EXPECT_EQ(gw->getObjectsChangedSince(frame, changed), 1);
+    EXPECT_EQ(changed[0]->state_.info.id, se->entities_.object_[0]->GetId());
+
+    // Let the object come to a stop, then expect no more changes
+    while (se->getSimulationTime() < 4.90)
+    {
+        se->step(dt);
+        se->prepareGroundTruth(dt);
+    }
+    EXPECT_NEAR(se->entities_.object_[0]->GetSpeed(), 0.0, 1e-10);
+
+    frame = gw->getFrameNr();
+    for (int i = 0; i < 3; i++)
+    {
+        se->step(dt);
+        se->prepareGroundTruth(dt);
+    }
+    EXPECT_FALSE(gw->isObjectChangedSince(se->entities_.object_[0]->GetId(), frame));
+    EXPECT_EQ(gw->getObjectsChangedSince(frame, changed), 0);
+    EXPECT_FALSE(gw->isObjectChangedSince(-1, frame));
+
+    // Externally reported new value marks the object as changed
+    frame = gw->getFrameNr();
+    gw->updateObjectSpeed(se->entities_.object_[0]->GetId(), se->getSimulationTime(), 1.0);
+    EXPECT_TRUE(gw->isObjectChangedSince(se->entities_.object_[0]->GetId(), frame));
+
+    delete se;
+}
+
+TEST(EntitiesTest, LifecycleEvents)
+{
+    double          dt = 0.1;
+    ScenarioEngine* se = new ScenarioEngine("../../../EnvironmentSimulator/Unittest/xosc/add_delete_entity.xosc");
+    ASSERT_NE(se, nullptr);
+    ScenarioGateway*                   gw         = se->getScenarioGateway();
+    int                                subscriber = se->entities_.SubscribeEvents();
+    std::vector<Entities::EntityEvent> events;
+    std::set<int>                      active_ids;
+    int                                n_added   = 0;
+    int                                n_removed = 0;
+
+    while (se->getSimulationTime() < 15.0 - SMALL_NUMBER)
+    {
+        se->step(dt);
+        se->prepareGroundTruth(dt);
+
+        // Replaying events on a set of ids reproduces the active objects, regardless of their order
+        se->entities_.PollEvents(subscriber, events);
+        for (const Entities::EntityEvent& event : events)
+        {
+            if (event.type == Entities::EntityEvent::Type::ADDED)
+            {
+                EXPECT_TRUE(active_ids.insert(event.id).second);
+                n_added++;
+            }
+            else if (event.type == Entities::EntityEvent::Type::REMOVED)
+            {
+                EXPECT_EQ(active_ids.erase(event.id), 1);
+                n_removed++;
+            }
+        }
+
+        std::set<int> ids;
+        for (auto* obj : se->entities_.object_)
+        {
+            ids.insert(obj->GetId());
+        }
+        EXPECT_EQ(active_ids, ids);
+
+        // Gateway drops deleted objects within the same step
+        for (int i = 0; i < gw->getNumberOfObjects(); i++)
+        {
+            EXPECT_EQ(ids.count(gw->getObjectStatePtrByIdx(i)->state_.info.id), 1);
+        }
+    }
+    EXPECT_GT(n_added, 1);
+    EXPECT_GT(n_removed, 0);
+
+    // Model change is reported for active objects
+    se->entities_.setObjectModel3D(se->entities_.object_[0], "car_blue.osgb");
+    EXPECT_EQ(se->entities_.PollEvents(subscriber, events), 1);
+    EXPECT_EQ(events[0].type, Entities::EntityEvent::Type::MODEL_CHANGED);
+    EXPECT_EQ(events[0].id, se->entities_.object_[0]->GetId());
+
+    se->entities_.UnsubscribeEvents(subscriber);
+    se->step(dt);
+    EXPECT_EQ(se->entities_.PollEvents(subscriber, events), 0);
+
+    delete se;
+}
+
 TEST(TrajectoryTest, FollowTrajectoryReverse)
 {
     double          dt = 0.05;
@@ -530,6 +831,57 @@ TEST(ParameterTest, ResolveParameterTest)
     ASSERT_EQ(params.ResolveParametersInString(" $turnsignal "), " true ");
 }
 
+TEST(ParameterTest, ParameterHandleTest)
+{
+    pugi::xml_document xml_doc;
+    pugi::xml_node     paramDeclsNode = xml_doc.append_child("paramDeclsNode");
+
+    pugi::xml_node paramDeclNode0                    = paramDeclsNode.append_child("paramDeclNode0");
+    paramDeclNode0.append_attribute("name")          = "param0";
+    paramDeclNode0.append_attribute("parameterType") = "double";
+    paramDeclNode0.append_attribute("value")         = "17.0";
+
+    pugi::xml_node paramDeclNode1                    = paramDeclsNode.append_child("paramDeclNode1");
+    paramDeclNode1.append_attribute("name")          = "param1";
+    paramDeclNode1.append_attribute("parameterType") = "int";
+    paramDeclNode1.append_attribute("value")         = "3";
+
+    Parameters params;
+    params.addParameterDeclarations(paramDeclsNode);
+
+    int h0 = params.getParameterHandle("param0");
+    int h1 = params.getParameterHandle("$param1");
+    ASSERT_EQ(h0, 0);
+    ASSERT_EQ(h1, 1);
+    ASSERT_EQ(params.getParameterHandle("param2"), -1);
+
+    double dValue = 0.0;
+    int    iValue = 0;
+    EXPECT_EQ(params.getParameterValueByHandle(h0, dValue), 0);
+    EXPECT_DOUBLE_EQ(dValue, 17.0);
+    EXPECT_EQ(params.getParameterValueByHandle(h0, iValue), -1);  // wrong type
+    EXPECT_EQ(params.getParameterValueByHandle(5, dValue), -1);   // invalid handle
+
+    EXPECT_EQ(params.setParameterValueByHandle(h1, 8), 0);
+    EXPECT_EQ(params.getParameterValueInt("param1", iValue), 0);
+    EXPECT_EQ(iValue, 8);
+    EXPECT_STREQ(params.getParameterEntry(h1)->value._string.c_str(), "8");
+
+    // a new declaration shadowing an existing one should take over the name, keeping old handles valid
+    pugi::xml_node paramDeclsNode2                   = xml_doc.append_child("paramDeclsNode2");
+    pugi::xml_node paramDeclNode2                    = paramDeclsNode2.append_child("paramDeclNode2");
+    paramDeclNode2.append_attribute("name")          = "param0";
+    paramDeclNode2.append_attribute("parameterType") = "double";
+    paramDeclNode2.append_attribute("value")         = "2.0";
+    params.addParameterDeclarations(paramDeclsNode2);
+
+    EXPECT_EQ(params.getParameterHandle("param0"), 2);
+    EXPECT_EQ(params.getParameterValueByHandle(h0, dValue), 0);
+    EXPECT_DOUBLE_EQ(dValue, 17.0);
+    EXPECT_EQ(params.getParameterValueDouble("param0", dValue), 0);
+    EXPECT_DOUBLE_EQ(dValue, 2.0);
+}
+
 TEST(ParameterTest, ParseParameterTest)
 {
     // Create parameter declarations
@@ -575,6 +927,72 @@ TEST(ParameterTest, ParseParameterTest)
     ASSERT_EQ(params.ReadAttribute(someNode0, "attr9", false), "2.000000");
 }
 
+TEST(ParameterTest, TypedAttributeTest)
+{
+    pugi::xml_document xml_doc;
+    pugi::xml_node     paramDeclsNode = xml_doc.append_child("paramDeclsNode");
+
+    pugi::xml_node paramDeclNode0                    = paramDeclsNode.append_child("paramDeclNode0");
+    paramDeclNode0.append_attribute("name")          = "param0";
+    paramDeclNode0.append_attribute("parameterType") = "double";
+    paramDeclNode0.append_attribute("value")         = "17.25";
+
+    pugi::xml_node paramDeclNode1                    = paramDeclsNode.append_child("paramDeclNode1");
+    paramDeclNode1.append_attribute("name")          = "param1";
+    paramDeclNode1.append_attribute("parameterType") = "boolean";
+    paramDeclNode1.append_attribute("value")         = "true";
+
+    pugi::xml_node paramDeclNode2                    = paramDeclsNode.append_child("paramDeclNode2");
+    paramDeclNode2.append_attribute("name")          = "param2";
+    paramDeclNode2.append_attribute("parameterType") = "double";
+    paramDeclNode2.append_attribute("value")         = "${1 / 3}";
+
+    Parameters params;
+    params.addParameterDeclarations(paramDeclsNode);
+
+    pugi::xml_node someNode0            = xml_doc.append_child("someNode0");
+    someNode0.append_attribute("speed") = "5.1";
+    someNode0.append_attribute("acc")   = "$param0";
+    someNode0.append_attribute("third") = "${1 / 3}";
+    someNode0.append_attribute("count") = "${3 * 0.1 * 10}";
+    someNode0.append_attribute("neg")   = "-2.7";
+    someNode0.append_attribute("flag0") = "$param1";
+    someNode0.append_attribute("flag1") = "${not $param1}";
+    someNode0.append_attribute("flag2") = "False";
+    someNode0.append_attribute("flag3") = "1";
+    someNode0.append_attribute("empty") = "";
+    someNode0.append_attribute("rule")  = "lessThan";
+
+    EXPECT_DOUBLE_EQ(params.ReadDouble(someNode0, "speed"), 5.1);
+    EXPECT_DOUBLE_EQ(params.ReadDouble(someNode0, "acc"), 17.25);
+    EXPECT_DOUBLE_EQ(params.ReadDouble(someNode0, "third"), 1.0 / 3.0);  // full precision, not rounded to 6 decimals
+    EXPECT_DOUBLE_EQ(params.ReadDouble(someNode0, "missing", false, 2.5), 2.5);
+    EXPECT_DOUBLE_EQ(params.ReadDouble(someNode0, "empty", false, 2.5), 2.5);
+    EXPECT_EQ(params.ReadInt(someNode0, "count"), 3);
+    EXPECT_EQ(params.ReadInt(someNode0, "neg"), -2);
+    EXPECT_EQ(params.ReadInt(someNode0, "missing", false, 1), 1);
+
+    EXPECT_TRUE(params.ReadBool(someNode0, "flag0"));
+    EXPECT_FALSE(params.ReadBool(someNode0, "flag1"));
+    EXPECT_TRUE(params.ReadBool(someNode0, "flag2", false, true));  // not a valid xsd:boolean, default applies
+    EXPECT_TRUE(params.ReadBool(someNode0, "flag3"));
+    EXPECT_TRUE(params.ReadBool(someNode0, "missing", false, true));
+
+    EXPECT_EQ(params.ReadEnum(someNode0, "rule", {{"greaterThan", Rule::GREATER_THAN}, {"lessThan", Rule::LESS_THAN}}, Rule::UNDEFINED_RULE),
+              Rule::LESS_THAN);
+    EXPECT_EQ(params.ReadEnum(someNode0, "speed", {{"greaterThan", Rule::GREATER_THAN}}, Rule::UNDEFINED_RULE), Rule::UNDEFINED_RULE);
+    EXPECT_EQ(params.ReadEnum(someNode0, "missing", {{"greaterThan", Rule::GREATER_THAN}}, Rule::EQUAL_TO), Rule::EQUAL_TO);
+
+    // parameter declared by expression keeps full precision as well
+    double dValue = 0.0;
+    EXPECT_EQ(params.getParameterValueDouble("param2", dValue), 0);
+    EXPECT_DOUBLE_EQ(dValue, 1.0 / 3.0);
+
+    // the string reader still returns expression results in the legacy format
+    EXPECT_EQ(params.ReadAttribute(someNode0, "third"), "0.333333");
+    EXPECT_EQ(params.ReadAttribute(someNode0, "flag0"), "true");
+}
+
 // Test junction selector functionality
 // Utilizing fabriksgatan 4 way intersection
 // Car will always drive on road 0, north towards the intersection
@@ -1888,42 +2306,42 @@ TEST(ControllerTest, TestLoomingControllerSimple)
         se->step(dt);
         se->prepareGroundTruth(dt);
     }
-    ASSERT_NEAR(se->entities_.object_[0]->pos_.GetS(), 41.4060182298, 1E-5);
-    ASSERT_NEAR(se->entities_.object_[0]->pos_.GetT(), -1.0844662327, 1E-5);
-    ASSERT_NEAR(se->entities_.object_[0]->pos_.GetH(), 0.2065681342, 1e-5);
+    ASSERT_NEAR(se->entities_.object_[0]->pos_.GetS(), 41.4065200035, 1E-5);
+    ASSERT_NEAR(se->entities_.object_[0]->pos_.GetT(), -1.0800514775, 1E-5);
+    ASSERT_NEAR(se->entities_.object_[0]->pos_.GetH(), 0.2061948103, 1e-5);
 
     while (se->getSimulationTime() < 10.0 - SMALL_NUMBER)
     {
         se->step(dt);
         se->prepareGroundTruth(dt);
     }
-    ASSERT_NEAR(se->entities_.object_[0]->pos_.GetS(), 82.8457730916, 1E-5);
-    ASSERT_NEAR(se->entities_.object_[0]->pos_.GetT(), -1.0642454223, 1E-5);
+    ASSERT_NEAR(se->entities_.object_[0]->pos_.GetS(), 82.8473699416, 1E-5);
+    ASSERT_NEAR(se->entities_.object_[0]->pos_.GetT(), -1.0586462231, 1E-5);
 
     while (se->getSimulationTime() < 15.0 - SMALL_NUMBER)
     {
         se->step(dt);
         se->prepareGroundTruth(dt);
     }
-    ASSERT_NEAR(se->entities_.object_[0]->pos_.GetS(), 4.2868112508, 1e-5);
-    ASSERT_NEAR(se->entities_.object_[0]->pos_.GetT(), -1.0630431865, 1e-5);
+    ASSERT_NEAR(se->entities_.object_[0]->pos_.GetS(), 4.2895483136, 1e-5);
+    ASSERT_NEAR(se->entities_.object_[0]->pos_.GetT(), -1.0579723773, 1e-5);
 
     while (se->getSimulationTime() < 20.0 - SMALL_NUMBER)
     {
         se->step(dt);
         se->prepareGroundTruth(dt);
     }
-    ASSERT_NEAR(se->entities_.object_[0]->pos_.GetS(), 45.7279451776, 1e-5);
-    ASSERT_NEAR(se->entities_.object_[0]->pos_.GetT(), -1.0638741808, 1e-5);
+    ASSERT_NEAR(se->entities_.object_[0]->pos_.GetS(), 45.7318237590, 1e-5);
+    ASSERT_NEAR(se->entities_.object_[0]->pos_.GetT(), -1.0579511448, 1e-5);
 
     while (se->getSimulationTime() < 25.0 - SMALL_NUMBER)
     {
         se->step(dt);
         se->prepareGroundTruth(dt);
     }
-    ASSERT_NEAR(se->entities_.object_[0]->pos_.GetS(), 87.1641289481, 1e-5);
-    ASSERT_NEAR(se->entities_.object_[0]->pos_.GetT(), -1.2282167087, 1e-5);
-    ASSERT_NEAR(se->entities_.object_[0]->pos_.GetH(), 1.0125829829, 1e-5);
+    ASSERT_NEAR(se->entities_.object_[0]->pos_.GetS(), 87.1703329549, 1e-5);
+    ASSERT_NEAR(se->entities_.object_[0]->pos_.GetT(), -1.1978553211, 1e-5);
+    ASSERT_NEAR(se->entities_.object_[0]->pos_.GetH(), 1.0126822059, 1e-5);
 
     delete se;
 }
@@ -1946,8 +2364,8 @@ TEST(ControllerTest, TestLoomingSimpleFarTan)
         se->prepareGroundTruth(dt);
         EXPECT_EQ(ctrl->getHasFarTan(), true);
     }
-    ASSERT_NEAR(se->entities_.object_[0]->pos_.GetS(), 41.4060182298, 1E-5);
-    ASSERT_NEAR(se->entities_.object_[0]->pos_.GetT(), -1.0844662326, 1E-5);
+    ASSERT_NEAR(se->entities_.object_[0]->pos_.GetS(), 41.4065200035, 1E-5);
+    ASSERT_NEAR(se->entities_.object_[0]->pos_.GetT(), -1.0800514775, 1E-5);
 
     delete se;
 }
@@ -2017,8 +2435,8 @@ TEST(TwoPlusOneRoadTest, TestTwoPlusOneRoad)
         double h;
         int    lane_id;
     } exp_values[5] = {{4.0, 115.0, -1.75, 0.0, -1},
-                       {5.25, 134.19, -1.789, 0.054, -2},
-                       {7.0, 168.89, -2.154, 0.05, -1},
+                       {5.25, 134.30, -1.789, 0.054, -2},
+                       {7.0, 168.99, -2.154, 0.05, -1},
                        {9.0, 218.22, -1.75, 0.0, -1},
                        {11.25, 274.39, -4.118, 6.20, -2}};
 
@@ -2105,7 +2523,8 @@ TEST(ControllerTest, TestLoomingControllerAdvanced)
     ControllerLooming* ctrl = reinterpret_cast<ControllerLooming*>(se->scenarioReader->controller_[0]);
     ASSERT_NE(ctrl, nullptr);
 
-    while (se->getSimulationTime() < 2.5 - SMALL_NUMBER)
+    // straight road ahead, spiral starts at s=100
+    while (se->getSimulationTime() < 1.0 - SMALL_NUMBER)
     {
         se->step(dt);
         se->prepareGroundTruth(dt);
@@ -2118,9 +2537,9 @@ TEST(ControllerTest, TestLoomingControllerAdvanced)
         se->prepareGroundTruth(dt);
     }
     EXPECT_EQ(ctrl->getHasFarTan(), true);
-    ASSERT_NEAR(se->entities_.object_[0]->pos_.GetS(), 83.321507875, 1E-5);
-    ASSERT_NEAR(se->entities_.object_[0]->pos_.GetT(), -1.452957222, 1E-5);
-    ASSERT_NEAR(se->entities_.object_[0]->pos_.GetH(), 5.7631188563, 1e-5);
+    ASSERT_NEAR(se->entities_.object_[0]->pos_.GetS(), 83.3214370706, 1E-5);
+    ASSERT_NEAR(se->entities_.object_[0]->pos_.GetT(), -1.4438996829, 1E-5);
+    ASSERT_NEAR(se->entities_.object_[0]->pos_.GetH(), 5.7626276407, 1e-5);
 
     while (se->getSimulationTime() < 31.0 - SMALL_NUMBER)
     {
@@ -2132,6 +2551,36 @@ TEST(ControllerTest, TestLoomingControllerAdvanced)
     delete se;
 }
 
+TEST(ControllerTest, TestRel2AbsPredictionRange)
+{
+    double          dt = 0.1;
+    ScenarioEngine* se = new ScenarioEngine("../../../EnvironmentSimulator/Unittest/xosc/rel2abs_prediction.xosc");
+    ASSERT_NE(se, nullptr);
+    ASSERT_EQ(se->entities_.object_.size(), 10);
+
+    ASSERT_EQ(se->scenarioReader->controller_[0]->GetType(), scenarioengine::Controller::Type::CONTROLLER_TYPE_REL2ABS);
+    ControllerRel2Abs* ctrl = static_cast<ControllerRel2Abs*>(se->scenarioReader->controller_[0]);
+
+    se->step(dt);
+    se->prepareGroundTruth(dt);
+
+    // only ego and the controlled object are within interaction radius
+    EXPECT_EQ(ctrl->GetNumberOfPredictedObjects(), 2);
+
+    double x = se->entities_.object_[9]->pos_.GetX();
+    double v = se->entities_.object_[9]->GetSpeed();
+
+    ctrl->interaction_radius = 0.0;
+    ctrl->Predict(se->getSimulationTime());
+    EXPECT_EQ(ctrl->GetNumberOfPredictedObjects(), 10);
+
+    // all objects restored after prediction
+    EXPECT_NEAR(se->entities_.object_[9]->pos_.GetX(), x, 1E-10);
+    EXPECT_NEAR(se->entities_.object_[9]->GetSpeed(), v, 1E-10);
+
+    delete se;
+}
+
 static void TTCAndLateralDistParamDeclCallback(void*)
 {
     static int counter  = 0;
@@ -2177,6 +2626,28 @@ TEST(ConditionTest, TestTTCAndLateralDist)
     RegisterParameterDeclarationCallback(nullptr, 0);
 }
 
+TEST(ConditionTest, TestStateConditionResolvedAtLoad)
+{
+    ScenarioEngine* se = new ScenarioEngine("../../../EnvironmentSimulator/Unittest/xosc/speed_over_distance.xosc");
+    ASSERT_NE(se, nullptr);
+
+    // Referenced storyboard element is resolved once the scenario is loaded, before any evaluation
+    ASSERT_EQ(se->GetStoryBoard().story_.size(), 1);
+    ASSERT_EQ(se->GetStoryBoard().story_[0]->act_.size(), 1);
+    Trigger* trigger = se->GetStoryBoard().story_[0]->act_[0]->stop_trigger_;
+    ASSERT_NE(trigger, nullptr);
+    ASSERT_EQ(trigger->conditionGroup_.size(), 1);
+    ASSERT_EQ(trigger->conditionGroup_[0]->condition_.size(), 1);
+    OSCCondition* condition = trigger->conditionGroup_[0]->condition_[0];
+    ASSERT_EQ(condition->base_type_, OSCCondition::ConditionType::BY_STATE);
+    TrigByState* state_condition = static_cast<TrigByState*>(condition);
+    ASSERT_NE(state_condition->GetElement(), nullptr);
+    EXPECT_EQ(state_condition->GetElement(), se->GetStoryBoard().FindEventByName("SpeedChangeEvent3"));
+    EXPECT_EQ(state_condition->GetElement()->name_, "SpeedChangeEvent3");
+
+    delete se;
+}
+
 TEST(ActionTest, TestRelativeLaneChangeAction)
 {
     double dt = 0.1;
@@ -2265,6 +2736,42 @@ TEST(ActionTest, TestRelativeLaneOffsetAction)
     delete se;
 }
 
+TEST(CatalogTest, TestCatalogIndexReuse)
+{
+    ScenarioEngine* se = new ScenarioEngine("../../../EnvironmentSimulator/Unittest/xosc/relative_lane_change.xosc");
+    ASSERT_NE(se, nullptr);
+
+    Catalog* catalog = se->GetScenarioReader()->GetCatalogs()->FindCatalogByName("VehicleCatalog");
+    ASSERT_NE(catalog, nullptr);
+    ASSERT_GT(catalog->GetNumberOfEntries(), 4u);
+
+    // only the four referenced entries are expected to be parsed
+    int n_parsed = 0;
+    for (auto* entry : catalog->entry_)
+    {
+        if (entry != nullptr)
+        {
+            n_parsed++;
+        }
+    }
+    EXPECT_EQ(n_parsed, 4);
+
+    std::shared_ptr<CatalogFile> file    = catalog->file_;
+    int                          n_files = CatalogIndex::Inst().GetNumberOfFiles();
+    delete se;
+
+    // loading the scenario again should reuse the indexed catalog file
+    se = new ScenarioEngine("../../../EnvironmentSimulator/Unittest/xosc/relative_lane_change.xosc");
+    ASSERT_NE(se, nullptr);
+    EXPECT_EQ(CatalogIndex::Inst().GetNumberOfFiles(), n_files);
+    catalog = se->GetScenarioReader()->GetCatalogs()->FindCatalogByName("VehicleCatalog");
+    ASSERT_NE(catalog, nullptr);
+    EXPECT_EQ(catalog->file_.get(), file.get());
+    EXPECT_EQ(se->entities_.object_[3]->GetName(), "Target3");
+
+    delete se;
+}
+
 // Uncomment to print log output to console
 // #define LOG_TO_CONSOLE
 
@@ -1,6 +1,7 @@
 import argparse
 import ctypes
 import os
+import numpy as np
 
 VERSION = 2
 REPLAY_FILENAME_SIZE = 512
@@ -52,24 +53,51 @@ class DATHeader(ctypes.Structure):
         ('model_filename', ctypes.c_char * REPLAY_FILENAME_SIZE),
     ]
 
+# numpy equivalents of the structs above, for reading all records of a file in one go
+ctypes2numpy = {ctypes.c_int: np.int32, ctypes.c_float: np.float32}
+
+def struct_dtype(struct):
+    fields = []
+    for name, ctype in struct._fields_:
+        if ctype in ctypes2numpy:
+            fields.append((name, ctypes2numpy[ctype]))
+        else:
+            # char array
+            fields.append((name, 'S{}'.format(ctypes.sizeof(ctype))))
+    dtype = np.dtype(fields)
+    assert dtype.itemsize == ctypes.sizeof(struct), 'dtype of {} does not match struct size'.format(struct.__name__)
+    return dtype
+
+DAT_HEADER_DTYPE = struct_dtype(DATHeader)
+OBJECT_STATE_DTYPE = struct_dtype(ObjectStateStructDat)
+
+def decode_str(b):
+    # same as ctypes char array, i.e. string ends at first null character
+    return b.split(b'\0', 1)[0].decode('utf-8')
+
 class DATFile():
     def __init__(self, filename):
         if not os.path.isfile(filename):
             print('ERROR: dat-file not found: {}'.format(filename))
             return
+
+        self.filename = filename
         try:
-            self.file = open(filename, 'rb')
+            header = np.fromfile(filename, dtype=DAT_HEADER_DTYPE, count=1)
         except OSError:
             print('ERROR: Could not open file {} for reading'.format(filename))
             raise
 
-        self.header = DATHeader.from_buffer_copy(self.file.read(ctypes.sizeof(DATHeader)))
-        self.filename = filename
+        if len(header) < 1:
+            print('ERROR: {} is too short to contain a header'.format(filename))
+            exit(-1)
+
+        self.header = DATHeader.from_buffer_copy(header.tobytes())
         self.version = self.header.version
         self.odr_filename = self.header.odr_filename.decode('utf-8')
         self.model_filename = self.header.model_filename.decode('utf-8')
         self.labels = [field[0] for field in ObjectStateStructDat._fields_]
-        self.data = []
+        self._data = None
 
         if (self.version != VERSION):
             print('Version mismatch. {} is version {} while supported version is: {}'.format(
@@ -77,12 +105,72 @@ class DATFile():
             )
             exit(-1)
 
-        # Read and print all rows of data
-        while (True):
-            buffer = self.file.read(ctypes.sizeof(ObjectStateStructDat))
-            if len(buffer) < ctypes.sizeof(ObjectStateStructDat):
-                break
-            self.data.append(ObjectStateStructDat.from_buffer_copy(buffer))
+        # Map all complete records, any incomplete trailing record is ignored
+        n_records = (os.path.getsize(filename) - DAT_HEADER_DTYPE.itemsize) // OBJECT_STATE_DTYPE.itemsize
+        if n_records > 0:
+            self.records = np.memmap(filename, dtype=OBJECT_STATE_DTYPE, mode='r', offset=DAT_HEADER_DTYPE.itemsize, shape=(n_records,))
+        else:
+            self.records = np.empty(0, dtype=OBJECT_STATE_DTYPE)
+
+        self.names = {}  # cache of decoded object names
+        self.by_id = None  # records grouped by object id, see group_by_id()
+
+    @property
+    def data(self):
+        # records as list of ObjectStateStructDat, created on first access for backward compatibility
+        if self._data is None:
+            self._data = [ObjectStateStructDat.from_buffer_copy(r.tobytes()) for r in self.records]
+        return self._data
+
+    def group_by_id(self):
+        # Sort records by object id once, keeping time order within each object
+        # Each object then occupies one contiguous range of the sorted array
+        if self.by_id is None:
+            order = np.argsort(self.records['id'], kind='stable')
+            sorted_records = self.records[order]
+            ids, start, count = np.unique(sorted_records['id'], return_index=True, return_counts=True)
+            ranges = {int(i): (int(s), int(s + n)) for i, s, n in zip(ids, start, count)}
+            self.by_id = (sorted_records, ranges)
+        return self.by_id
+
+    def get_ids(self):
+        # object ids in order of first appearance
+        ids, first = np.unique(self.records['id'], return_index=True)
+        return [int(i) for i in ids[np.argsort(first)]]
+
+    def get_columns(self, id=None, labels=None):
+        # Return dict of label -> column array, for all records or the records of one object
+        # All arrays are views, either into the file or, per object, into the records grouped by id
+        if id is None:
+            records = self.records
+        else:
+            sorted_records, ranges = self.group_by_id()
+            start, end = ranges.get(id, (0, 0))
+            records = sorted_records[start:end]
+        return {label: records[label] for label in (labels if labels is not None else self.labels)}
+
+    def get_names(self, records=None):
+        raw = (self.records if records is None else records)['name'].tolist()
+        names = []
+        for b in raw:
+            if b not in self.names:
+                self.names[b] = decode_str(b)
+            names.append(self.names[b])
+        return names
+
+    def get_rows(self, labels, records=None):
+        # Return list of rows, each row a list of python values of the given labels
+        records = self.records if records is None else records
+        columns = []
+        for label in labels:
+            if label == 'name':
+                columns.append(self.get_names(records))
+            elif records.dtype[label] == np.float32:
+                # convert to double just like ctypes, to get identical formatting
+                columns.append(records[label].astype(np.float64).tolist())
+            else:
+                columns.append(records[label].tolist())
+        return [list(row) for row in zip(*columns)]
 
     def get_header_line(self):
         return 'Version: {}, OpenDRIVE: {}, 3DModel: {}'.format(
@@ -134,6 +222,31 @@ class DATFile():
                 data.wheel_rot
             )
 
+    def get_data_lines(self, extended = False):
+        # Format all records at once, same output as get_data_line() and get_data_line_extended()
+        # Each distinct value of a column is formatted only once
+        if extended:
+            labels = self.get_labels_line_extended().split(', ')
+        else:
+            labels = self.get_labels_line().split(', ')
+
+        table = np.empty((len(self.records), len(labels)), dtype=object)
+        for i, label in enumerate(labels):
+            column = self.records[label]
+            if label == 'name':
+                values, index = np.unique(column, return_inverse=True)
+                strings = [decode_str(b) for b in values.tolist()]
+            elif column.dtype == np.float32:
+                # compare bit patterns, keeping e.g. -0.0 and 0.0 apart
+                values, index = np.unique(column.view(np.int32), return_inverse=True)
+                strings = ['{:.3f}'.format(v) for v in values.view(np.float32).astype(np.float64).tolist()]
+            else:
+                values, index = np.unique(column, return_inverse=True)
+                strings = [str(v) for v in values.tolist()]
+            table[:, i] = np.array(strings, dtype=object)[index.ravel()]
+
+        return [', '.join(row) for row in table.tolist()]
+
     def get_labels_line_array(self):
         return [
             "time",
@@ -198,6 +311,9 @@ class DATFile():
             data.t,
             data.s];
 
+    def get_data_lines_array(self):
+        # All records, same content as get_data_line_array() per record
+        return self.get_rows(self.get_labels_line_array())
 
     def print_csv(self, extended = False, include_file_refs = True):
 
@@ -211,12 +327,10 @@ class DATFile():
         else:
             print(self.get_labels_line())
 
-        # Read and print all rows of data
-        for data in self.data:
-            if extended:
-                print(self.get_data_line_extended(data))
-            else:
-                print(self.get_data_line(data))
+        # Print all rows of data
+        lines = self.get_data_lines(extended)
+        if lines:
+            print('\n'.join(lines))
 
     def save_csv(self, extended = False, include_file_refs = True):
         csvfile = os.path.splitext(self.filename)[0] + '.csv'
@@ -236,12 +350,9 @@ class DATFile():
         else:
             fcsv.write(self.get_labels_line() + '\n')
 
-        # Read and save all rows of data
-        for data in self.data:
-            if extended:
-                fcsv.write(self.get_data_line_extended(data) + '\n')
-            else:
-                fcsv.write(self.get_data_line(data) + '\n')
+        # Save all rows of data
+        for line in self.get_data_lines(extended):
+            fcsv.write(line + '\n')
 
         fcsv.close()
 
@@ -254,13 +365,20 @@ class DATFile():
 
         fdat.write(self.header)
 
-        for d in self.data:
-            fdat.write(d)
+        if self._data is not None:
+            # records may have been modified via the data list
+            for d in self._data:
+                fdat.write(d)
+        else:
+            fdat.write(self.records.tobytes())
 
         fdat.close()
 
     def close(self):
-        self.file.close()
+        # release the file mapping
+        self.records = np.empty(0, dtype=OBJECT_STATE_DTYPE)
+        self._data = None
+        self.by_id = None
 
 if __name__ == "__main__":
     # Create the parser
@@ -124,7 +124,7 @@ class TestSuite(unittest.TestCase):
         self.assertTrue(re.search('\n2.500, 1, OverTaker, -3.971, 115.014, -0.170, 1.566, 0.002, 0.000, 42.000, -0.000, 4.690', csv))
         self.assertTrue(re.search('\n4.380, 0, Ego, -7.198, 171.427, -0.293, 1.563, 0.002, 6.283, 30.000, -0.000, 4.721', csv))
         self.assertTrue(re.search('\n4.380, 1, OverTaker, -4.253, 193.957, -0.336, 1.618, 0.002, 0.000, 42.000, 0.004, 4.096', csv))
-        self.assertTrue(re.search('\n9.000, 1, OverTaker, -4.022, 387.898, -0.697, 1.544, 0.002, 6.283, 42.000, -0.001, 5.575', csv))
+        self.assertTrue(re.search('\n9.000, 1, OverTaker, -4.022, 387.898, -0.697, 1.544, 0.002, 0.000, 42.000, -0.001, 5.575', csv))
         self.assertTrue(re.search('\n9.010, 0, Ego, -5.639, 310.318, -0.547, 1.555, 0.002, 6.283, 30.000, -0.000, 5.737', csv))
 
     def test_left_hand_using_road_rule(self):
@@ -147,7 +147,7 @@ class TestSuite(unittest.TestCase):
         self.assertTrue(re.search('\n2.500, 1, OverTaker, -3.971, 115.014, -0.170, 1.566, 0.002, 0.000, 42.000, -0.000, 4.690', csv))
         self.assertTrue(re.search('\n4.380, 0, Ego, -7.198, 171.427, -0.293, 1.563, 0.002, 0.000, 30.000, -0.000, 4.721', csv))
         self.assertTrue(re.search('\n4.380, 1, OverTaker, -4.253, 193.957, -0.336, 1.618, 0.002, 0.000, 42.000, 0.004, 4.096', csv))
-        self.assertTrue(re.search('\n9.000, 1, OverTaker, -4.022, 387.898, -0.697, 1.544, 0.002, 6.283, 42.000, -0.001, 5.575', csv))
+        self.assertTrue(re.search('\n9.000, 1, OverTaker, -4.022, 387.898, -0.697, 1.544, 0.002, 0.000, 42.000, -0.001, 5.575', csv))
         self.assertTrue(re.search('\n9.010, 0, Ego, -5.639, 310.318, -0.547, 1.555, 0.002, 0.000, 30.000, -0.000, 5.737', csv))
 
     def test_routing(self):
@@ -294,8 +294,8 @@ class TestSuite(unittest.TestCase):
         self.assertTrue(re.search('^2.060, 1, Ego_ghost, 8.386, 101.178, -0.139, 1.566, 0.002, 0.000, 22.550, -0.000, 1.795', csv, re.MULTILINE))
         self.assertTrue(re.search('^2.550, 0, Ego, 8.279, 77.042, -0.088, 1.567, 0.002, 0.000, 18.389, -0.000, 1.950', csv, re.MULTILINE))
         self.assertTrue(re.search('^6.500, 0, Ego, 6.053, 178.715, -0.308, 1.633, 0.002, 0.000, 27.778, -0.015, 3.658', csv, re.MULTILINE))
-        self.assertTrue(re.search('^13.000, 1, Ego_ghost, 11.231, 356.499, -0.638, 1.549, 0.002, 0.000, 5.100, -0.000, 3.236', csv, re.MULTILINE))
-        self.assertTrue(re.search('^13.350, 0, Ego, 10.915, 341.217, -0.608, 1.551, 0.002, 0.000, 10.003, -0.001, 3.515', csv, re.MULTILINE))
+        self.assertTrue(re.search('^13.000, 1, Ego_ghost, 11.231, 356.498, -0.638, 1.549, 0.002, 0.000, 5.100, -0.000, 3.236', csv, re.MULTILINE))
+        self.assertTrue(re.search('^13.350, 0, Ego, 10.915, 341.216, -0.608, 1.551, 0.002, 0.000, 10.003, -0.001, 3.512', csv, re.MULTILINE))
 
     def test_heading_trig(self):
         log = run_scenario(os.path.join(ESMINI_PATH, 'EnvironmentSimulator/Unittest/xosc/traj-heading-trig.xosc'), COMMON_ARGS)
@@ -355,7 +355,7 @@ class TestSuite(unittest.TestCase):
         self.assertTrue(re.search('^7.000, 0, Ego, 255.000, -4.500, 0.000, 0.000, 0.000, 0.000, 35.000', csv, re.MULTILINE))
         self.assertTrue(re.search('^7.000, 1, Target, 263.824, -6.702, 0.000, 6.250, 0.000, 0.000, 31.250, 0.001, 2.150', csv, re.MULTILINE))
         self.assertTrue(re.search('^11.500, 0, Ego, 412.500, -4.500, 0.000, 0.000, 0.000, 0.000, 35.000, 0.000, 0.177', csv, re.MULTILINE))
-        self.assertTrue(re.search('^11.500, 1, Target, 400.809, -30.943, 0.000, 5.933, 0.000, 0.000, 31.250, 0.000, 1.812', csv, re.MULTILINE))
+        self.assertTrue(re.search('^11.500, 1, Target, 400.803, -30.941, 0.000, 5.933, 0.000, 0.000, 31.250, 0.000, 1.812', csv, re.MULTILINE))
 
     def test_lane_change_clothoid(self):
         log = run_scenario(os.path.join(ESMINI_PATH, 'resources/xosc/lane-change_clothoid_based_trajectory.xosc'), COMMON_ARGS)
@@ -517,6 +517,26 @@ class TestSuite(unittest.TestCase):
         self.assertTrue(re.search('^20.000, 1, NPC1, 60.000, -1.535, 0.000, 0.000, 0.000, 0.000, 1.000, 0.000, 0.594', csv, re.MULTILINE))
         self.assertTrue(re.search('^20.000, 2, NPC2, 30.000, 1.535, 0.000, 3.142, 0.000, 0.000, 1.000, 0.000, 0.594', csv, re.MULTILINE))
 
+    def test_datanalyzer(self):
+        log = run_scenario(os.path.join(ESMINI_PATH, 'EnvironmentSimulator/Unittest/xosc/test-collision-detection.xosc'), COMMON_ARGS + \
+            '--disable_controllers')
+
+        # Check some initialization steps
+        self.assertTrue(re.search('Loading .*test-collision-detection.xosc', log)  is not None)
+
+        # Analyze the recording, collisions should be found at same time as in previous collision tests
+        with open(STDOUT_FILENAME, "w") as f:
+            args = [os.path.join(ESMINI_PATH,'bin','datanalyzer'), '--output', 'analysis.csv', DAT_FILENAME]
+            process = subprocess.Popen(args, cwd=os.path.dirname(os.path.realpath(__file__)), stdout=f)
+            assert process.wait() == 0
+
+        with open('analysis.csv', "r") as f:
+            summary = f.read()
+
+        self.assertTrue(re.search('^sim.dat, 0, Ego, 1, NPC1, 1, 6.260, 0.000, 6.260, 0.000, 6.260, 0.000, 6.260', summary, re.MULTILINE))
+        self.assertTrue(re.search('^sim.dat, 0, Ego, 2, NPC2, 1, 5.250, 0.000, 5.250, 0.000, 5.250, 0.000, 5.250', summary, re.MULTILINE))
+        self.assertTrue(re.search('^sim.dat, 1, NPC1, 2, NPC2, 0, , 0.820, 0.710, 0.468, 0.690, , ', summary, re.MULTILINE))
+
     def test_add_delete_entity(self):
         log = run_scenario(os.path.join(ESMINI_PATH, 'EnvironmentSimulator/Unittest/xosc/add_delete_entity.xosc'), COMMON_ARGS)
 
@@ -903,8 +923,8 @@ class TestSuite(unittest.TestCase):
         self.assertTrue(re.search('^6.000, 13, Ego_6_1, 1.750, 33.633, 0.000, 4.712, 0.000, 0.000, 2.000, 0.000, 2.870', csv, re.MULTILINE))
         self.assertTrue(re.search('^6.000, 14, Ego_7_-1, -1.750, 33.633, -14.489, 4.712, 5.733, 0.000, 2.000, 0.000, 2.870', csv, re.MULTILINE))
         self.assertTrue(re.search('^6.000, 15, Ego_7_1, 1.750, 33.633, -14.489, 4.712, 5.733, 0.000, 2.000, 0.000, 2.870', csv, re.MULTILINE))
-        self.assertTrue(re.search('^6.000, 16, Ego_8_-1, -1.750, 33.633, 14.489, 4.712, 0.550, 6.283, 2.000, 0.000, 2.870', csv, re.MULTILINE))
-        self.assertTrue(re.search('^6.000, 17, Ego_8_1, 1.750, 33.633, 14.489, 4.712, 0.550, 6.283, 2.000, 0.000, 2.870', csv, re.MULTILINE))
+        self.assertTrue(re.search('^6.000, 16, Ego_8_-1, -1.750, 33.633, 14.489, 4.712, 0.550, 0.000, 2.000, 0.000, 2.870', csv, re.MULTILINE))
+        self.assertTrue(re.search('^6.000, 17, Ego_8_1, 1.750, 33.633, 14.489, 4.712, 0.550, 0.000, 2.000, 0.000, 2.870', csv, re.MULTILINE))
         self.assertTrue(re.search('^6.000, 18, Ego_9_-1, -25.019, 22.544, 0.000, 5.498, 0.000, 0.000, 2.000, 0.000, 2.870', csv, re.MULTILINE))
         self.assertTrue(re.search('^6.000, 19, Ego_9_1, -22.544, 25.019, 0.000, 5.498, 0.000, 0.000, 2.000, 0.000, 2.870', csv, re.MULTILINE))
         self.assertTrue(re.search('^6.000, 20, Ego_10_-1, -25.019, 22.544, -14.489, 5.498, 5.733, 0.000, 2.000, 0.000, 2.870', csv, re.MULTILINE))
@@ -927,8 +947,8 @@ class TestSuite(unittest.TestCase):
         self.assertTrue(re.search('^6.000, 37, Ego_18_1, -1.750, -33.633, 0.000, 1.571, 0.000, 0.000, 2.000, 0.000, 2.870', csv, re.MULTILINE))
         self.assertTrue(re.search('^6.000, 38, Ego_19_-1, 1.750, -33.633, -14.489, 1.571, 5.733, 0.000, 2.000, 0.000, 2.870', csv, re.MULTILINE))
         self.assertTrue(re.search('^6.000, 39, Ego_19_1, -1.750, -33.633, -14.489, 1.571, 5.733, 0.000, 2.000, 0.000, 2.870', csv, re.MULTILINE))
-        self.assertTrue(re.search('^6.000, 40, Ego_20_-1, 1.750, -33.633, 14.489, 1.571, 0.550, 6.283, 2.000, 0.000, 2.870', csv, re.MULTILINE))
-        self.assertTrue(re.search('^6.000, 41, Ego_20_1, -1.750, -33.633, 14.489, 1.571, 0.550, 6.283, 2.000, 0.000, 2.870', csv, re.MULTILINE))
+        self.assertTrue(re.search('^6.000, 40, Ego_20_-1, 1.750, -33.633, 14.489, 1.571, 0.550, 0.000, 2.000, 0.000, 2.870', csv, re.MULTILINE))
+        self.assertTrue(re.search('^6.000, 41, Ego_20_1, -1.750, -33.633, 14.489, 1.571, 0.550, 0.000, 2.000, 0.000, 2.870', csv, re.MULTILINE))
         self.assertTrue(re.search('^6.000, 42, Ego_21_-1, 25.019, -22.544, 0.000, 2.356, 0.000, 0.000, 2.000, 0.000, 2.870', csv, re.MULTILINE))
         self.assertTrue(re.search('^6.000, 43, Ego_21_1, 22.544, -25.019, 0.000, 2.356, 0.000, 0.000, 2.000, 0.000, 2.870', csv, re.MULTILINE))
         self.assertTrue(re.search('^6.000, 44, Ego_22_-1, 25.019, -22.544, -14.489, 2.356, 5.733, 0.000, 2.000, 0.000, 2.870', csv, re.MULTILINE))